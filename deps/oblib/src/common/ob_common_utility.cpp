@@ -137,6 +137,13 @@ void set_stackattr(void *stackaddr, size_t stacksize)
   g_stacksize = stacksize;
 }
 
+bool get_cached_stackattr(void *&stackaddr, size_t &stacksize)
+{
+  stackaddr = g_stackaddr;
+  stacksize = g_stacksize;
+  return nullptr != stackaddr;
+}
+
 ObFatalErrExtraInfoGuard::ObFatalErrExtraInfoGuard()
 {
   last_ = get_val();
@@ -31,6 +31,8 @@ extern int check_stack_overflow(
     int64_t *used_size = nullptr);
 extern int get_stackattr(void *&stackaddr, size_t &stacksize);
 extern void set_stackattr(void *stackaddr, size_t stacksize);
+// async-signal-safe, returns false if the stack attributes of this thread are not loaded yet
+extern bool get_cached_stackattr(void *&stackaddr, size_t &stacksize);
 
 // return OB_SIZE_OVERFLOW if stack overflow
 inline int check_stack_overflow(void)
@@ -252,6 +252,8 @@ struct AChunk {
     struct {
       struct {
         uint8_t is_hugetlb_ : 1;
+        // numa node the chunk is bound to, only meaningful when numa aware chunk is enabled
+        uint8_t numa_node_ : 6;
       };
     };
   };
@@ -299,6 +301,8 @@ struct AObject {
   OB_INLINE bool is_valid() const;
   OB_INLINE bool is_first() const;
   OB_INLINE bool is_last(uint32_t cells_per_block) const;
+  // in use by its owner or kept in ObjectCache, must not be merged by the ObjectSet
+  OB_INLINE bool is_occupied() const;
   OB_INLINE ABlock *block() const;
   OB_INLINE uint64_t hold(uint32_t cells_per_block) const;
   OB_INLINE ObLabel label() const;
@@ -310,6 +314,8 @@ struct AObject {
     struct {
       uint16_t in_use_ : 1;
       uint16_t is_large_ : 1;
+      // freed by its owner but kept in ObjectCache, still occupied in the ObjectSet
+      uint16_t in_cache_ : 1;
     };
   } __attribute__((packed));
 
@@ -352,6 +358,7 @@ static const uint16_t FREE_AOBJECT_MAGIC_CODE     = 0XCED0;
 static const uint16_t AOBJECT_MAGIC_CODE          = 0XCED1;
 static const uint16_t FREE_BIG_AOBJECT_MAGIC_CODE = 0XCED2;
 static const uint16_t BIG_AOBJECT_MAGIC_CODE      = 0XCED3;
+static const uint16_t AOBJECT_OCCUPIED_MASK       = 0X0005; // in_use_ | in_cache_
 
 static const uint32_t AOBJECT_HEADER_SIZE = offsetof(AObject, data_);
 static const uint32_t AOBJECT_META_SIZE = AOBJECT_HEADER_SIZE + AOBJECT_TAIL_SIZE;
@@ -599,6 +606,13 @@ bool AObject::is_last(uint32_t cells_per_block) const
   return obj_offset_ + nobjs_ >= cells_per_block;
 }
 
+bool AObject::is_occupied() const
+{
+  // read both bits in one load, ObjectCache flips them without the lock of ObjectSet
+  const uint16_t magic_code = *reinterpret_cast<const volatile uint16_t*>(&MAGIC_CODE_);
+  return 0 != (magic_code & AOBJECT_OCCUPIED_MASK);
+}
+
 ABlock *AObject::block() const
 {
   AChunk *chunk = AChunk::ptr2chunk(this);
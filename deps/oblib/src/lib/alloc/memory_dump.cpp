@@ -470,7 +470,7 @@ int label_stat(AChunk *chunk, ABlock *block, AObject *object,
                int64_t &item_used)
 {
   int ret = OB_SUCCESS;
-  if (object->in_use_) {
+  if (object->is_occupied()) {
     int64_t hold = 0;
     if (!object->is_large_) {
       hold = object->nobjs_ * AOBJECT_CELL_BYTES;
@@ -608,7 +608,11 @@ void ObMemoryDump::handle(void *task)
                   [tenant_id, ctx_id, &lmap, w_stat, &item_used, min_check_version, max_check_version]
                   (AChunk *chunk, ABlock *block, AObject *object) {
                     int ret = OB_SUCCESS;
-                    if (object->in_use_) {
+                    if (object->in_cache_) {
+                      // freed objects kept by ObjectCache are shown under the ObjectCache label
+                      ret = label_stat(chunk, block, object, lmap, w_stat->up2date_items_,
+                                       ARRAYSIZEOF(w_stat->up2date_items_), item_used);
+                    } else if (object->in_use_) {
                      if (OB_FAIL(label_stat(chunk, block, object, lmap, w_stat->up2date_items_,
                                            ARRAYSIZEOF(w_stat->up2date_items_), item_used))) {
                         // do-nothing
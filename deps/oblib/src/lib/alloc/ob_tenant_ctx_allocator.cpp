@@ -378,6 +378,8 @@ int64_t ObTenantCtxAllocator::sync_wash(int64_t wash_size)
 {
   int64_t washed_size = 0;
 
+  // cached objects are counted as used, give them back before checking the fragment
+  obj_mgr_.get_obj_cache().flush();
   auto stat = obj_mgr_.get_stat();
   const double min_utilization = 0.95;
   int64_t min_memory_fragment = 64LL << 20;
@@ -555,6 +557,9 @@ void ObTenantCtxAllocator::common_free(void *ptr)
     AObject *obj = reinterpret_cast<AObject*>((char*)ptr - AOBJECT_HEADER_SIZE);
     on_free(*obj);
     ObjectSet *os = obj->block()->obj_set_;
-    os->free_object(obj);
+    ObjectCache *obj_cache = os->get_obj_cache();
+    if (OB_ISNULL(obj_cache) || !obj_cache->push(obj)) {
+      os->free_object(obj);
+    }
   }
 }
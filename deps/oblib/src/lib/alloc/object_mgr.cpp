@@ -19,6 +19,105 @@
 using namespace oceanbase;
 using namespace lib;
 
+// meta of allocators(SubObjectMgr, ObjectCache slots) is allocated from the root_mgr of
+// server tenant, bypassing the ObjectMgr which it belongs to.
+static void *alloc_meta(const int64_t size)
+{
+  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(OB_SERVER_TENANT_ID,
+                                                                        ObCtxIds::DEFAULT_CTX_ID);
+  ObMemAttr attr;
+  attr.tenant_id_ = OB_SERVER_TENANT_ID;
+  attr.label_ = common::ObModIds::OB_TENANT_CTX_ALLOCATOR;
+  attr.ctx_id_ = ObCtxIds::DEFAULT_CTX_ID;
+  attr.ignore_version_ = true;
+  class SubObjectMgrWrapper {
+  public:
+    SubObjectMgrWrapper(SubObjectMgr& sub_mgr)
+      : sub_mgr_(sub_mgr)
+    {}
+    AObject *realloc_object(AObject *obj,  const uint64_t size, const ObMemAttr &attr)
+    {
+      sub_mgr_.lock();
+      AObject *new_obj = sub_mgr_.realloc_object(obj, size, attr);
+      sub_mgr_.unlock();
+      return new_obj;
+    }
+    void free_object(AObject *obj)
+    {
+      sub_mgr_.free_object(obj);
+    }
+  private:
+    SubObjectMgr& sub_mgr_;
+  } root_mgr(static_cast<ObjectMgr&>(ta->get_block_mgr()).root_mgr_);
+  return ObTenantCtxAllocator::common_realloc(NULL, size, attr, *(ta.ref_allocator()), root_mgr);
+}
+
+static void free_meta(void *ptr)
+{
+  ObTenantCtxAllocator::common_free(ptr);
+}
+
+ObjectCache::Slot *ObjectCache::create_slots()
+{
+  void *ptr = alloc_meta(sizeof(Slot) * SLOT_CNT);
+  if (OB_NOT_NULL(ptr)) {
+    MEMSET(ptr, 0, sizeof(Slot) * SLOT_CNT);
+    if (ATOMIC_BCAS(&slots_, nullptr, reinterpret_cast<Slot*>(ptr))) {
+      // succ
+    } else {
+      free_meta(ptr);
+    }
+  }
+  return get_slot();
+}
+
+void ObjectCache::reset()
+{
+  Slot *slots = ATOMIC_LOAD(&slots_);
+  if (OB_NOT_NULL(slots)) {
+    flush();
+    ATOMIC_STORE(&slots_, nullptr);
+    free_meta(slots);
+  }
+}
+
+int64_t ObjectCache::flush()
+{
+  int64_t flushed_size = 0;
+  Slot *slots = ATOMIC_LOAD(&slots_);
+  for (int i = 0; OB_NOT_NULL(slots) && i < SLOT_CNT; i++) {
+    Slot &slot = slots[i];
+    AObject *objs[CLASS_CNT * MAG_SIZE];
+    int64_t cnt = 0;
+    slot.lock();
+    for (int cls = 0; cls < CLASS_CNT; cls++) {
+      for (int j = 0; j < slot.cnt_[cls]; j++) {
+        objs[cnt++] = slot.objs_[cls][j];
+      }
+      slot.cnt_[cls] = 0;
+    }
+    flushed_size += slot.hold_;
+    slot.hold_ = 0;
+    slot.unlock();
+    // free outside the slot lock, free_object may wait on the lock of ObjectSet
+    for (int64_t j = 0; j < cnt; j++) {
+      take_out(objs[j]);
+      objs[j]->block()->obj_set_->free_object(objs[j]);
+    }
+  }
+  return flushed_size;
+}
+
+int64_t ObjectCache::get_hold() const
+{
+  int64_t hold = 0;
+  Slot *slots = ATOMIC_LOAD(&slots_);
+  for (int i = 0; OB_NOT_NULL(slots) && i < SLOT_CNT; i++) {
+    hold += ATOMIC_LOAD(&slots[i].hold_);
+  }
+  return hold;
+}
+
 SubObjectMgr::SubObjectMgr(ObTenantCtxAllocator &ta,
                            const bool enable_no_log,
                            const uint32_t ablock_size,
@@ -90,6 +189,10 @@ ObjectMgr::ObjectMgr(ObTenantCtxAllocator &ta,
 {
   MEMSET(sub_mgrs_, 0, sizeof(sub_mgrs_));
   sub_mgrs_[0] = &root_mgr_;
+  // only the main ObjectMgr of a ctx caches objects, objects of sub ctx are rarely hot
+  if (NULL == blk_mgr_) {
+    root_mgr_.os_.set_obj_cache(&obj_cache_);
+  }
 }
 
 ObjectMgr::~ObjectMgr()
@@ -98,6 +201,7 @@ ObjectMgr::~ObjectMgr()
 }
 
 void ObjectMgr::reset() {
+  obj_cache_.reset();
   for (int i = 1; i < ATOMIC_LOAD(&sub_cnt_); i++) {
     if (sub_mgrs_[i] != nullptr) {
       destroy_sub_mgr(sub_mgrs_[i]);
@@ -112,6 +216,9 @@ AObject *ObjectMgr::alloc_object(uint64_t size, const ObMemAttr &attr)
   AObject *obj = NULL;
   const uint64_t start = common::get_itid();
   SubObjectMgr *sub_mgr = nullptr;
+  if (!attr.alloc_extra_info_) {
+    obj = obj_cache_.pop(size);
+  }
   for (uint64_t i = 0; NULL == obj && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
     sub_mgr = ATOMIC_LOAD(&sub_mgrs_[idx]);
@@ -237,36 +344,13 @@ void ObjectMgr::free_block(ABlock *block)
 SubObjectMgr *ObjectMgr::create_sub_mgr()
 {
   SubObjectMgr *sub_mgr = nullptr;
-  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(OB_SERVER_TENANT_ID,
-                                                                        ObCtxIds::DEFAULT_CTX_ID);
-  ObMemAttr attr;
-  attr.tenant_id_ = OB_SERVER_TENANT_ID;
-  attr.label_ = common::ObModIds::OB_TENANT_CTX_ALLOCATOR;
-  attr.ctx_id_ = ObCtxIds::DEFAULT_CTX_ID;
-  attr.ignore_version_ = true;
-  class SubObjectMgrWrapper {
-  public:
-    SubObjectMgrWrapper(SubObjectMgr& sub_mgr)
-      : sub_mgr_(sub_mgr)
-    {}
-    AObject *realloc_object(AObject *obj,  const uint64_t size, const ObMemAttr &attr)
-    {
-      sub_mgr_.lock();
-      AObject *new_obj = sub_mgr_.realloc_object(obj, size, attr);
-      sub_mgr_.unlock();
-      return new_obj;
-    }
-    void free_object(AObject *obj)
-    {
-      sub_mgr_.free_object(obj);
-    }
-  private:
-    SubObjectMgr& sub_mgr_;
-  } root_mgr(static_cast<ObjectMgr&>(ta->get_block_mgr()).root_mgr_);
-  void *ptr = ObTenantCtxAllocator::common_realloc(NULL, sizeof(SubObjectMgr), attr, *(ta.ref_allocator()), root_mgr);
+  void *ptr = alloc_meta(sizeof(SubObjectMgr));
   if (OB_NOT_NULL(ptr)) {
     sub_mgr = new (ptr) SubObjectMgr(ta_, enable_no_log_,
         ablock_size_, enable_dirty_list_, blk_mgr_);
+    if (NULL == blk_mgr_) {
+      sub_mgr->os_.set_obj_cache(&obj_cache_);
+    }
   }
   return sub_mgr;
 }
@@ -274,11 +358,8 @@ SubObjectMgr *ObjectMgr::create_sub_mgr()
 void ObjectMgr::destroy_sub_mgr(SubObjectMgr *sub_mgr)
 {
   if (sub_mgr != nullptr) {
-    auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(OB_SERVER_TENANT_ID,
-                                                                          ObCtxIds::DEFAULT_CTX_ID);
-    auto &root_mgr = static_cast<ObjectMgr&>(ta->get_block_mgr()).root_mgr_;
     sub_mgr->~SubObjectMgr();
-    ObTenantCtxAllocator::common_free(sub_mgr);
+    free_meta(sub_mgr);
   }
 }
 
@@ -286,6 +367,8 @@ int64_t ObjectMgr::sync_wash(int64_t wash_size)
 {
   int64_t washed_size = 0;
   const uint64_t start = common::get_itid();
+  // give cached objects back to their ObjectSets first so that their blocks can be washed
+  obj_cache_.flush();
   for (uint64_t i = 0; washed_size < wash_size && i < ATOMIC_LOAD(&sub_cnt_); i++) {
     uint64_t idx = (start + i) % sub_cnt_;
     auto sub_mgr = ATOMIC_LOAD(&sub_mgrs_[idx]);
@@ -323,13 +406,15 @@ ObjectMgr::Stat ObjectMgr::get_stat()
       .payload_ = payload,
       .used_ = used,
       .last_washed_size_ = ATOMIC_LOAD(&last_washed_size_),
-      .last_wash_ts_ = ATOMIC_LOAD(&last_wash_ts_)
+      .last_wash_ts_ = ATOMIC_LOAD(&last_wash_ts_),
+      .obj_cache_hold_ = obj_cache_.get_hold()
       };
 }
 
 bool ObjectMgr::check_has_unfree()
 {
   bool has_unfree = false;
+  obj_cache_.flush();
   for (uint64_t idx = 0; idx < ATOMIC_LOAD(&sub_cnt_) && !has_unfree; idx++) {
     auto sub_mgr = ATOMIC_LOAD(&sub_mgrs_[idx]);
     if (OB_ISNULL(sub_mgr)) {
@@ -346,6 +431,7 @@ bool ObjectMgr::check_has_unfree()
 bool ObjectMgr::check_has_unfree(char *first_label, char *first_bt)
 {
   bool has_unfree = false;
+  obj_cache_.flush();
   for (uint64_t idx = 0; idx < ATOMIC_LOAD(&sub_cnt_) && !has_unfree; idx++) {
     auto sub_mgr = ATOMIC_LOAD(&sub_mgrs_[idx]);
     if (OB_ISNULL(sub_mgr)) {
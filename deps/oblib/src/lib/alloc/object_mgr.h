@@ -30,11 +30,143 @@ namespace oceanbase
 {
 namespace lib
 {
+// ObjectCache keeps magazines of recently freed small objects, one set of magazines
+// per thread slot and size class, so that alloc/free pairs of a thread are served
+// without taking the lock of a SubObjectMgr.
+// A cached object is freed for its owner (in_use_ is cleared, so a double free still
+// aborts) but stays occupied in its ObjectSet (in_cache_): ctx hold/used and the tenant
+// limit stay exact, only label statistics see it as freed. The cached bytes are
+// bounded by SLOT_CNT * MAX_SLOT_HOLD and are given back on wash and reset.
+class ObjectCache
+{
+public:
+  static const int SLOT_CNT = 32;
+  static const int CLASS_CNT = 14;   // 16, 24, 32, 48 ... 1024, 1536
+  static const int MAG_SIZE = 16;
+  static const int64_t MAX_SLOT_HOLD = 64L << 10;
+  static const uint32_t MIN_CACHE_SIZE = 16;
+private:
+  struct Slot
+  {
+    OB_INLINE bool trylock() { return ATOMIC_BCAS(&lock_, 0, 1); }
+    OB_INLINE void lock() { while (!trylock()) { PAUSE(); } }
+    OB_INLINE void unlock() { ATOMIC_STORE(&lock_, 0); }
+    int64_t lock_;
+    int64_t hold_;
+    int32_t cnt_[CLASS_CNT];
+    AObject *objs_[CLASS_CNT][MAG_SIZE];
+  } CACHE_ALIGNED;
+public:
+  ObjectCache() : slots_(nullptr) {}
+  ~ObjectCache() { reset(); }
+  void reset();
+  // Returns an object whose alloc_bytes_ >= size, or NULL if the magazine is empty.
+  OB_INLINE AObject *pop(const uint64_t size);
+  // Returns false if obj can't be cached, the caller should free it to its ObjectSet.
+  OB_INLINE bool push(AObject *obj);
+  int64_t flush();
+  int64_t get_hold() const;
+private:
+  // class i holds objects with alloc_bytes_ in [bound(i), bound(i + 1))
+  static OB_INLINE int get_class(const uint64_t size)
+  {
+    const int msb = 63 - __builtin_clzl(size);
+    return (msb - 4) * 2 + static_cast<int>((size >> (msb - 1)) & 1);
+  }
+  static OB_INLINE uint64_t get_bound(const int cls)
+  {
+    return (2UL + (cls & 1)) << (cls / 2 + 3);
+  }
+  OB_INLINE Slot *get_slot() const
+  {
+    Slot *slots = ATOMIC_LOAD(&slots_);
+    return OB_ISNULL(slots) ? nullptr : &slots[common::get_itid() & (SLOT_CNT - 1)];
+  }
+  Slot *create_slots();
+  // in_cache_ is set before in_use_ is cleared and vice versa, so the ObjectSet always
+  // sees the object occupied while it is not holding the lock of the object.
+  static OB_INLINE void put_in(AObject *obj)
+  {
+    obj->in_cache_ = true;
+    WEAK_BARRIER();
+    obj->in_use_ = false;
+  }
+  static OB_INLINE void take_out(AObject *obj)
+  {
+    obj->in_use_ = true;
+    WEAK_BARRIER();
+    obj->in_cache_ = false;
+  }
+private:
+  Slot *slots_;
+  DISALLOW_COPY_AND_ASSIGN(ObjectCache);
+};
+
+OB_INLINE AObject *ObjectCache::pop(const uint64_t size)
+{
+  AObject *obj = nullptr;
+  Slot *slot = get_slot();
+  if (OB_ISNULL(slot) || size > get_bound(CLASS_CNT - 1)) {
+    // do nothing
+  } else {
+    int cls = size <= MIN_CACHE_SIZE ? 0 : get_class(size);
+    if (get_bound(cls) < size) {
+      cls++;
+    }
+    if (slot->trylock()) {
+      if (slot->cnt_[cls] > 0) {
+        obj = slot->objs_[cls][--slot->cnt_[cls]];
+        slot->hold_ -= obj->alloc_bytes_;
+      }
+      slot->unlock();
+    }
+    if (OB_NOT_NULL(obj)) {
+      abort_unless(obj->in_cache_ && !obj->in_use_);
+      take_out(obj);
+      obj->block()->obj_set_->reuse_cached_object(obj, size);
+    }
+  }
+  return obj;
+}
+
+OB_INLINE bool ObjectCache::push(AObject *obj)
+{
+  bool cached = false;
+  Slot *slot = get_slot();
+  if (OB_UNLIKELY(nullptr == slot && nullptr == (slot = create_slots()))) {
+    // do nothing
+  } else if (obj->MAGIC_CODE_ != AOBJECT_MAGIC_CODE
+             || obj->on_malloc_sample_
+             || obj->alloc_bytes_ < MIN_CACHE_SIZE
+             || obj->alloc_bytes_ >= get_bound(CLASS_CNT)) {
+    // big object or object with extra info
+  } else {
+    // same checks as ObjectSet::free_object, a cached object must not be freed again
+    abort_unless(obj->is_valid());
+    abort_unless(AOBJECT_TAIL_MAGIC_CODE
+                 == reinterpret_cast<uint64_t&>(obj->data_[obj->alloc_bytes_]));
+    if (slot->trylock()) {
+      const int cls = get_class(obj->alloc_bytes_);
+      if (slot->cnt_[cls] < MAG_SIZE && slot->hold_ + obj->alloc_bytes_ <= MAX_SLOT_HOLD) {
+        // the label makes cached objects recognizable in memory dump
+        MEMCPY(obj->label_, "ObjectCache", sizeof("ObjectCache"));
+        put_in(obj);
+        slot->objs_[cls][slot->cnt_[cls]++] = obj;
+        slot->hold_ += obj->alloc_bytes_;
+        cached = true;
+      }
+      slot->unlock();
+    }
+  }
+  return cached;
+}
+
 // object_set needs to be lightweight, and some large or logically optional members need to be stripped out
 // SubObjectMgr is a combination of object_set and attributes stripped from object_set, such as block_set, mutex, etc.
 class SubObjectMgr : public IBlockMgr
 {
   friend class ObTenantCtxAllocator;
+  friend class ObjectMgr;
 public:
   SubObjectMgr(ObTenantCtxAllocator &ta,
                const bool enable_no_log,
@@ -97,6 +229,7 @@ public:
     int64_t used_;
     int64_t last_washed_size_;
     int64_t last_wash_ts_;
+    int64_t obj_cache_hold_;
   };
 public:
   ObjectMgr(ObTenantCtxAllocator &ta,
@@ -121,6 +254,7 @@ public:
   Stat get_stat();
   bool check_has_unfree();
   bool check_has_unfree(char *first_label, char *first_bt);
+  OB_INLINE ObjectCache &get_obj_cache() { return obj_cache_; }
 private:
   SubObjectMgr *create_sub_mgr();
   void destroy_sub_mgr(SubObjectMgr *sub_mgr);
@@ -133,6 +267,7 @@ public:
   bool enable_dirty_list_;
   IBlockMgr *blk_mgr_;
   int sub_cnt_;
+  ObjectCache obj_cache_;
   SubObjectMgr root_mgr_;
   SubObjectMgr *sub_mgrs_[N];
   int64_t last_wash_ts_;
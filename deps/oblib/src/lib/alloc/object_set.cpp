@@ -37,7 +37,7 @@ void __attribute__((weak)) has_unfree_callback(char *info)
 ObjectSet::ObjectSet(__MemoryContext__ *mem_context, const uint32_t ablock_size,
   const bool enable_dirty_list)
   : mem_context_(mem_context), locker_(nullptr),
-    blk_mgr_(nullptr), blist_(NULL), last_remainder_(NULL),
+    blk_mgr_(nullptr), obj_cache_(nullptr), blist_(NULL), last_remainder_(NULL),
     bm_(NULL), free_lists_(NULL),
     dirty_list_mutex_(common::ObLatchIds::ALLOC_OBJECT_LOCK), dirty_list_(nullptr), dirty_objs_(0),
     alloc_bytes_(0), used_bytes_(0), hold_bytes_(0), allocs_(0),
@@ -74,7 +74,7 @@ AObject *ObjectSet::alloc_object(
     const uint32_t cls = (uint32_t)(1+ ((all_size - 1) / AOBJECT_CELL_BYTES));
     obj = alloc_normal_object(cls, attr);
     if (NULL != obj) {
-      normal_alloc_bytes_ += size;
+      (void)ATOMIC_AAF(&normal_alloc_bytes_, size);
       normal_used_bytes_ += obj->nobjs_ * AOBJECT_CELL_BYTES;
     }
   } else {
@@ -88,7 +88,7 @@ AObject *ObjectSet::alloc_object(
     reinterpret_cast<uint64_t&>(obj->data_[size]) = AOBJECT_TAIL_MAGIC_CODE;
     obj->alloc_bytes_ = static_cast<uint32_t>(size);
     allocs_++;
-    alloc_bytes_ += size;
+    (void)ATOMIC_AAF(&alloc_bytes_, size);
     used_bytes_ += obj->hold(cells_per_block_);
   }
 
@@ -243,7 +243,7 @@ void ObjectSet::take_off_free_object(AObject *obj)
   abort_unless(obj->is_valid());
 
   if (OB_ISNULL(bm_) || OB_ISNULL(free_lists_)) {
-  } else if (!!obj->in_use_) {
+  } else if (obj->is_occupied()) {
   } else if (obj->nobjs_ < MIN_FREE_CELLS) {
   } else if (obj->next_ == obj) {
     bm_->unset(obj->nobjs_);
@@ -262,7 +262,7 @@ void ObjectSet::free_normal_object(AObject *obj)
   abort_unless(NULL != obj);
   abort_unless(obj->is_valid());
 
-  normal_alloc_bytes_ -= obj->alloc_bytes_;
+  (void)ATOMIC_SAF(&normal_alloc_bytes_, obj->alloc_bytes_);
   normal_used_bytes_ -= obj->nobjs_ * AOBJECT_CELL_BYTES;
 
   AObject *newobj = merge_obj(obj);
@@ -398,7 +398,7 @@ void ObjectSet::do_free_object(AObject *obj)
   const int64_t hold = obj->hold(cells_per_block_);
   const int64_t used = obj->alloc_bytes_;
 
-  alloc_bytes_ -= obj->alloc_bytes_;
+  (void)ATOMIC_SAF(&alloc_bytes_, obj->alloc_bytes_);
   used_bytes_ -= hold;
 
   obj->in_use_ = false;
@@ -471,7 +471,7 @@ bool ObjectSet::check_has_unfree(char *first_label, char *first_bt)
       if (block != free_list_block) {
         AObject *obj = reinterpret_cast<AObject *>(block->data());
         while (true) {
-          bool tmp_has_unfree = obj->in_use_;
+          bool tmp_has_unfree = obj->is_occupied();
           if (OB_UNLIKELY(tmp_has_unfree)) {
             if ('\0' == first_label[0]) {
               STRCPY(first_label, obj->label_);
@@ -576,7 +576,7 @@ bool ObjectSet::build_free_lists()
       // ignore large object
       if (!obj->is_large_) {
         for (;;) {
-          while (obj->in_use_ && !obj->is_last(cells_per_block_)) {
+          while (obj->is_occupied() && !obj->is_last(cells_per_block_)) {
             AObject *next_obj = obj->phy_next(obj->nobjs_);
             next_obj->nobjs_prev_ = obj->nobjs_;
             obj = next_obj;
@@ -584,7 +584,7 @@ bool ObjectSet::build_free_lists()
           }
           if (obj->is_last(cells_per_block_)) {
             obj->nobjs_ = static_cast<uint16_t>(cells_per_block_ - obj->obj_offset_);
-            if (!obj->in_use_) {
+            if (!obj->is_occupied()) {
               add_free_object(obj);
             }
             break;
@@ -593,11 +593,11 @@ bool ObjectSet::build_free_lists()
           AObject *first = obj;
           obj = obj->phy_next(obj->nobjs_);
           abort_unless(obj->is_valid());
-          while (!obj->in_use_ && !obj->is_last(cells_per_block_)) {
+          while (!obj->is_occupied() && !obj->is_last(cells_per_block_)) {
             obj = obj->phy_next(obj->nobjs_);
             abort_unless(obj->is_valid());
           }
-          if (obj->is_last(cells_per_block_) && !obj->in_use_) {
+          if (obj->is_last(cells_per_block_) && !obj->is_occupied()) {
             first->nobjs_ = static_cast<uint16_t>(cells_per_block_ - first->obj_offset_);
             add_free_object(first);
             break;
@@ -653,7 +653,7 @@ AObject *ObjectSet::merge_obj(AObject *obj)
     abort_unless(prev_obj->is_valid());
     if (prev_obj == last_remainder_) {
       last_remainder_ = nullptr;
-    } else if (!prev_obj->in_use_) {
+    } else if (!prev_obj->is_occupied()) {
       take_off_free_object(prev_obj);
     }
   }
@@ -663,20 +663,20 @@ AObject *ObjectSet::merge_obj(AObject *obj)
     abort_unless(next_obj->is_valid());
     if (next_obj == last_remainder_) {
       last_remainder_ = nullptr;
-    } else if (!next_obj->in_use_) {
+    } else if (!next_obj->is_occupied()) {
       take_off_free_object(next_obj);
     }
   }
 
-  if (NULL != next_obj && !next_obj->in_use_) {
+  if (NULL != next_obj && !next_obj->is_occupied()) {
     if (!next_obj->is_last(cells_per_block_)) {
       next_next_obj = next_obj->phy_next(next_obj->nobjs_);
       abort_unless(next_next_obj->is_valid());
     }
   }
 
-  AObject *head = NULL != prev_obj && !prev_obj->in_use_ ? prev_obj : obj;
-  AObject *tail = next_obj != NULL && !next_obj->in_use_ ? next_next_obj : next_obj;
+  AObject *head = NULL != prev_obj && !prev_obj->is_occupied() ? prev_obj : obj;
+  AObject *tail = next_obj != NULL && !next_obj->is_occupied() ? next_next_obj : next_obj;
 
   if (NULL != tail) {
     head->nobjs_ = static_cast<uint16_t>(tail->obj_offset_ - head->obj_offset_);
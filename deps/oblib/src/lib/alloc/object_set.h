@@ -32,6 +32,7 @@ class __MemoryContext__;
 class ObTenantCtxAllocator;
 class IBlockMgr;
 class ISetLocker;
+class ObjectCache;
 class ObjectSet
 {
   friend class common::ObAllocator;
@@ -67,6 +68,10 @@ public:
   void set_block_mgr(IBlockMgr *blk_mgr) { blk_mgr_ = blk_mgr; }
   IBlockMgr *get_block_mgr() { return blk_mgr_; }
   void set_locker(ISetLocker *locker) { locker_ = locker; }
+  void set_obj_cache(ObjectCache *obj_cache) { obj_cache_ = obj_cache; }
+  ObjectCache *get_obj_cache() { return obj_cache_; }
+  // hand a normal object kept in ObjectCache out again with a new size, without the lock
+  inline void reuse_cached_object(AObject *obj, const uint64_t size);
   inline int64_t get_normal_hold() const;
   inline int64_t get_normal_used() const;
   inline int64_t get_normal_alloc() const;
@@ -98,6 +103,7 @@ private:
   __MemoryContext__ *mem_context_;
   ISetLocker *locker_;
   IBlockMgr *blk_mgr_;
+  ObjectCache *obj_cache_;
 
   ABlock *blist_;
 
@@ -138,6 +144,16 @@ inline void ObjectSet::unlock()
   locker_->unlock();
 }
 
+inline void ObjectSet::reuse_cached_object(AObject *obj, const uint64_t size)
+{
+  // alloc bytes are also changed under the lock, so both sides update them atomically
+  const int64_t delta = static_cast<int64_t>(size) - static_cast<int64_t>(obj->alloc_bytes_);
+  obj->alloc_bytes_ = static_cast<uint32_t>(size);
+  reinterpret_cast<uint64_t&>(obj->data_[size]) = AOBJECT_TAIL_MAGIC_CODE;
+  (void)ATOMIC_AAF(&alloc_bytes_, delta);
+  (void)ATOMIC_AAF(&normal_alloc_bytes_, delta);
+}
+
 inline uint64_t ObjectSet::get_alloc_bytes() const
 {
   return alloc_bytes_;
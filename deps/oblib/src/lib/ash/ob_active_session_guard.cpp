@@ -16,13 +16,13 @@ using namespace oceanbase::common;
 
 ActiveSessionStat ObActiveSessionGuard::dummy_stat_;
 thread_local ActiveSessionStat ObActiveSessionGuard::thread_local_stat_;
+// before ObActiveSessionGuard constructed,
+// ensure it can get the dummy value if anyone call get_stat
+__thread ActiveSessionStat *ObActiveSessionGuard::stat_ptr_ = &ObActiveSessionGuard::dummy_stat_;
 
 ActiveSessionStat *&ObActiveSessionGuard::get_stat_ptr()
 {
-  // before ObActiveSessionGuard constructed,
-  // ensure it can get the dummy value if anyone call get_stat
-  RLOCAL_INIT(ActiveSessionStat *, stat, &dummy_stat_);
-  return stat;
+  return stat_ptr_;
 }
 
 ActiveSessionStat &ObActiveSessionGuard::get_stat()
@@ -149,10 +149,13 @@ public:
   // set ash_stat in session to the thread local ash_stat_
   static void setup_ash(ActiveSessionStat &stat);
   static ActiveSessionStat &get_stat();
+  // async-signal-safe, the pointer is statically initialized and never allocates tls on access
+  static const ActiveSessionStat *get_stat_in_signal() { return stat_ptr_; }
   static void setup_thread_local_ash();
   static thread_local ActiveSessionStat thread_local_stat_;
 private:
   static ActiveSessionStat dummy_stat_;
+  static __thread ActiveSessionStat *stat_ptr_ __attribute__((tls_model("initial-exec")));
   static ActiveSessionStat *&get_stat_ptr();
   DISALLOW_COPY_AND_ASSIGN(ObActiveSessionGuard);
 };
@@ -0,0 +1,233 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX COMMON
+
+#include "lib/ash/ob_ash_profiler.h"
+#include <sys/time.h>
+#include <ucontext.h>
+#include "lib/hash_func/murmur_hash.h"
+#include "lib/time/ob_time_utility.h"
+#include "common/ob_common_utility.h"
+
+using namespace oceanbase::common;
+
+int64_t ObAshProfiler::Entry::to_folded(char *buf, const int64_t buf_len) const
+{
+  int64_t pos = 0;
+  const char *event = "ON CPU";
+  char event_buf[32];
+  if (0 == event_no_) {
+    // not in any wait event
+  } else if (event_no_ > 0 && event_no_ < ObWaitEventIds::WAIT_EVENT_DEF_END) {
+    event = OB_WAIT_EVENTS[event_no_].event_name_;
+  } else {
+    IGNORE_RETURN snprintf(event_buf, sizeof(event_buf), "event_%ld", event_no_);
+    event = event_buf;
+  }
+  IGNORE_RETURN databuff_printf(buf, buf_len, pos, "tenant_%lu;%s;line_%d;%s",
+                                tenant_id_, '\0' == sql_id_[0] ? "no_sql" : sql_id_,
+                                plan_line_id_, event);
+  // folded stack is ordered from root to leaf
+  for (int64_t i = depth_ - 1; i >= 0; i--) {
+    IGNORE_RETURN databuff_printf(buf, buf_len, pos, ";%p", frames_[i]);
+  }
+  return pos;
+}
+
+ObAshProfiler &ObAshProfiler::get_instance()
+{
+  static ObAshProfiler the_one;
+  return the_one;
+}
+
+ObAshProfiler::ObAshProfiler()
+  : interval_us_(0), push_idx_(0), dropped_cnt_(0), evicted_cnt_(0), lock_()
+{}
+
+int ObAshProfiler::set_interval(const int64_t interval_us)
+{
+  int ret = OB_SUCCESS;
+  static bool handler_installed = false;
+  if (OB_UNLIKELY(interval_us < 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(interval_us));
+  } else if (interval_us == ATOMIC_LOAD(&interval_us_)) {
+    // do nothing
+  } else {
+    if (interval_us > 0 && !handler_installed) {
+      struct sigaction sa;
+      MEMSET(&sa, 0, sizeof(sa));
+      sa.sa_sigaction = signal_handler;
+      sa.sa_flags = SA_SIGINFO | SA_RESTART;
+      sigemptyset(&sa.sa_mask);
+      if (0 != sigaction(SIGPROF, &sa, NULL)) {
+        ret = OB_ERR_SYS;
+        LOG_WARN("install SIGPROF handler failed", K(ret), K(errno));
+      } else {
+        handler_installed = true;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      struct itimerval tv;
+      tv.it_interval.tv_sec = interval_us / 1000000;
+      tv.it_interval.tv_usec = interval_us % 1000000;
+      tv.it_value = tv.it_interval;
+      if (0 != setitimer(ITIMER_PROF, &tv, NULL)) {
+        ret = OB_ERR_SYS;
+        LOG_WARN("setitimer failed", K(ret), K(errno), K(interval_us));
+      } else {
+        LOG_INFO("ash profiler interval changed", "from", interval_us_, "to", interval_us);
+        ATOMIC_STORE(&interval_us_, interval_us);
+        if (0 == interval_us) {
+          drain();
+          reset();
+        }
+      }
+    }
+  }
+  return ret;
+}
+
+void ObAshProfiler::signal_handler(int sig, siginfo_t *si, void *context)
+{
+  UNUSED(sig);
+  UNUSED(si);
+  const int saved_errno = errno;
+  get_instance().on_sample(context);
+  errno = saved_errno;
+}
+
+// Walks frame pointers from the interrupted context. Runs in the signal handler, so the stack
+// range must come from the cached stack attributes of the thread, otherwise only the
+// interrupted ip is recorded.
+static int32_t walk_stack(void *context, void **frames, const int64_t max_depth)
+{
+  int32_t depth = 0;
+  const ucontext_t *uc = reinterpret_cast<const ucontext_t*>(context);
+#if defined(__x86_64__)
+  const int64_t ip = uc->uc_mcontext.gregs[REG_RIP];
+  int64_t bp = uc->uc_mcontext.gregs[REG_RBP];
+#elif defined(__aarch64__)
+  const int64_t ip = uc->uc_mcontext.pc;
+  int64_t bp = uc->uc_mcontext.regs[29];
+#else
+  const int64_t ip = 0;
+  int64_t bp = 0;
+#endif
+  frames[depth++] = reinterpret_cast<void*>(ip);
+  void *stack_addr = nullptr;
+  size_t stack_size = 0;
+  if (get_cached_stackattr(stack_addr, stack_size)) {
+    const int64_t stack_begin = reinterpret_cast<int64_t>(stack_addr);
+    const int64_t stack_end = stack_begin + static_cast<int64_t>(stack_size);
+    while (depth < max_depth && bp >= stack_begin && bp + 16 <= stack_end && 0 == (bp & 7)) {
+      const int64_t next_bp = *reinterpret_cast<int64_t*>(bp);
+      frames[depth++] = *reinterpret_cast<void**>(bp + 8);
+      if (next_bp <= bp) {
+        break;
+      }
+      bp = next_bp;
+    }
+  }
+  return depth;
+}
+
+void ObAshProfiler::on_sample(void *context)
+{
+  Sample &sample = ring_[ATOMIC_FAA(&push_idx_, 1) % RING_SIZE];
+  if (!ATOMIC_BCAS(&sample.state_, SLOT_FREE, SLOT_WRITING)) {
+    // the ring is full, ASH task is late
+    ATOMIC_INC(&dropped_cnt_);
+  } else {
+    Entry &entry = sample.entry_;
+    const ActiveSessionStat *stat = ObActiveSessionGuard::get_stat_in_signal();
+    if (OB_ISNULL(stat)) {
+      entry.tenant_id_ = 0;
+      entry.event_no_ = 0;
+      entry.plan_line_id_ = -1;
+      entry.sql_id_[0] = '\0';
+    } else {
+      entry.tenant_id_ = stat->tenant_id_;
+      entry.event_no_ = stat->event_no_;
+      entry.plan_line_id_ = stat->plan_line_id_;
+      MEMCPY(entry.sql_id_, stat->sql_id_, sizeof(entry.sql_id_));
+      entry.sql_id_[sizeof(entry.sql_id_) - 1] = '\0';
+    }
+    entry.depth_ = walk_stack(context, entry.frames_, MAX_DEPTH);
+    entry.count_ = 1;
+    entry.last_sample_time_ = ObTimeUtility::current_time();
+    ATOMIC_STORE(&sample.state_, SLOT_READY);
+  }
+}
+
+void ObAshProfiler::drain()
+{
+  ObSpinLockGuard guard(lock_);
+  for (int64_t i = 0; i < RING_SIZE; i++) {
+    Sample &sample = ring_[i];
+    if (SLOT_READY == ATOMIC_LOAD(&sample.state_)) {
+      add_entry(sample.entry_);
+      ATOMIC_STORE(&sample.state_, SLOT_FREE);
+    }
+  }
+}
+
+void ObAshProfiler::add_entry(const Entry &sample)
+{
+  uint64_t hash = murmurhash(sample.frames_, static_cast<int32_t>(sample.depth_ * sizeof(void*)), 0);
+  hash = murmurhash(&sample.tenant_id_, sizeof(sample.tenant_id_), hash);
+  hash = murmurhash(&sample.event_no_, sizeof(sample.event_no_), hash);
+  hash = murmurhash(&sample.plan_line_id_, sizeof(sample.plan_line_id_), hash);
+  hash = murmurhash(sample.sql_id_, static_cast<int32_t>(STRLEN(sample.sql_id_)), hash);
+  bool added = false;
+  Entry *lru_entry = nullptr;
+  for (int64_t i = 0; !added && i < MAX_PROBE; i++) {
+    Entry &entry = table_[(hash + i) % TABLE_SIZE];
+    if (nullptr == lru_entry || entry.last_sample_time_ < lru_entry->last_sample_time_) {
+      lru_entry = &entry;
+    }
+    if (entry.is_empty()) {
+      entry = sample;
+      entry.hash_ = hash;
+      added = true;
+    } else if (entry.hash_ == hash
+               && entry.tenant_id_ == sample.tenant_id_
+               && entry.event_no_ == sample.event_no_
+               && entry.plan_line_id_ == sample.plan_line_id_
+               && entry.depth_ == sample.depth_
+               && 0 == STRCMP(entry.sql_id_, sample.sql_id_)
+               && 0 == MEMCMP(entry.frames_, sample.frames_, sample.depth_ * sizeof(void*))) {
+      entry.count_ += sample.count_;
+      entry.last_sample_time_ = MAX(entry.last_sample_time_, sample.last_sample_time_);
+      added = true;
+    }
+  }
+  if (!added && nullptr != lru_entry) {
+    // slots are never emptied before reset, so replacing one keeps the probe chains of the others
+    *lru_entry = sample;
+    lru_entry->hash_ = hash;
+    ATOMIC_INC(&evicted_cnt_);
+  }
+}
+
+void ObAshProfiler::reset()
+{
+  ObSpinLockGuard guard(lock_);
+  for (int64_t i = 0; i < TABLE_SIZE; i++) {
+    if (!table_[i].is_empty()) {
+      table_[i].reset();
+    }
+  }
+  ATOMIC_STORE(&dropped_cnt_, 0);
+  ATOMIC_STORE(&evicted_cnt_, 0);
+}
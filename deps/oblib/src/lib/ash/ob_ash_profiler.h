@@ -0,0 +1,110 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef _OB_SHARE_ASH_PROFILER_H_
+#define _OB_SHARE_ASH_PROFILER_H_
+
+#include <signal.h>
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/utility/ob_print_utils.h"
+#include "lib/ash/ob_active_session_guard.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// ObAshProfiler is a sampling profiler built on ASH.
+// Every ITIMER_PROF tick, the thread consuming cpu takes a SIGPROF and records its native
+// stack together with the ASH stat of the session running on it (tenant, sql_id, plan line,
+// wait event). The signal handler only fills a slot of a fixed sample ring, the ASH task
+// drains the ring every second into a fixed-memory table aggregated by
+// (tenant, sql_id, plan line, event, stack), which is shown by __all_virtual_ash_profile.
+// When the probe window of a new stack is full, its least recently sampled entry is evicted.
+class ObAshProfiler
+{
+public:
+  static const int64_t MAX_DEPTH = 32;
+  static const int64_t RING_SIZE = 8192;
+  static const int64_t TABLE_SIZE = 8192;
+  static const int64_t MAX_PROBE = 16;
+  // POD, so that the fixed-memory ring and table stay untouched until profiling is enabled
+  struct Entry
+  {
+    void reset() { MEMSET(this, 0, sizeof(*this)); }
+    bool is_empty() const { return 0 == count_; }
+    // folded stack: "tenant;sql_id;plan_line;event;root_frame;...;leaf_frame", which is the
+    // input format of flamegraph.pl with the sample count appended.
+    int64_t to_folded(char *buf, const int64_t buf_len) const;
+    TO_STRING_KV(K_(tenant_id), K_(sql_id), K_(plan_line_id), K_(event_no), K_(depth), K_(count));
+
+    uint64_t hash_;
+    uint64_t tenant_id_;
+    int64_t event_no_;
+    int32_t plan_line_id_;
+    int32_t depth_;
+    int64_t count_;
+    int64_t last_sample_time_;
+    char sql_id_[common::OB_MAX_SQL_ID_LENGTH + 1];
+    void *frames_[MAX_DEPTH];
+  };
+private:
+  enum { SLOT_FREE = 0, SLOT_WRITING = 1, SLOT_READY = 2 };
+  struct Sample
+  {
+    int64_t state_;
+    Entry entry_;
+  };
+public:
+  static ObAshProfiler &get_instance();
+  // 0 disables the profiler, otherwise a SIGPROF is raised every interval of process cpu time
+  int set_interval(const int64_t interval_us);
+  int64_t get_interval() const { return ATOMIC_LOAD(&interval_us_); }
+  // aggregate the samples of the ring, called by ASH task
+  void drain();
+  void reset();
+  // samples lost because the ring is full
+  int64_t get_dropped_cnt() const { return ATOMIC_LOAD(&dropped_cnt_); }
+  // entries replaced by newer stacks because the table is full
+  int64_t get_evicted_cnt() const { return ATOMIC_LOAD(&evicted_cnt_); }
+  template <typename Function>
+  int for_each_entry(Function &fn)
+  {
+    int ret = OB_SUCCESS;
+    ObSpinLockGuard guard(lock_);
+    for (int64_t i = 0; OB_SUCC(ret) && i < TABLE_SIZE; i++) {
+      if (!table_[i].is_empty()) {
+        ret = fn(table_[i]);
+      }
+    }
+    return ret;
+  }
+private:
+  ObAshProfiler();
+  static void signal_handler(int sig, siginfo_t *si, void *context);
+  void on_sample(void *context);
+  void add_entry(const Entry &sample);
+private:
+  int64_t interval_us_;
+  int64_t push_idx_ CACHE_ALIGNED;
+  int64_t dropped_cnt_ CACHE_ALIGNED;
+  int64_t evicted_cnt_;
+  ObSpinLock lock_;
+  Sample ring_[RING_SIZE];
+  Entry table_[TABLE_SIZE];
+  DISALLOW_COPY_AND_ASSIGN(ObAshProfiler);
+};
+
+}
+}
+#endif /* _OB_SHARE_ASH_PROFILER_H_ */
+//// end of header file
@@ -17,6 +17,7 @@
 #include <bitset>
 #include <iterator>
 #include <map>
+#include <type_traits>
 #include <utility>
 #include "lib/charset/ob_ctype.h"
 #include "lib/charset/mb_wc.h"
@@ -425,6 +426,16 @@ ALWAYS_INLINE int uca_scanner_any<Mb_wc>::next() {
   }
   do {
     ob_wc_t wc = 0;
+    // ASCII fast path: the byte is the code point, and without contractions
+    // its weights are found in the first page directly
+    if (std::is_same<Mb_wc, Mb_wc_utf8mb4>::value && sbeg < send && *sbeg < 0x80 &&
+        !ob_uca_have_contractions(uca)) {
+      wc = *sbeg++;
+      char_index++;
+      wbeg = uca->weights[0] + wc * uca->lengths[0];
+      wbeg_stride = UCA900_DISTANCE_BETWEEN_WEIGHTS;
+      continue;
+    }
     int mblen = mb_wc(&wc, sbeg, send);
     if (mblen <= 0) {
       ++weight_lv;
@@ -870,6 +881,24 @@ static size_t ob_strnxfrm_uca(const ObCharsetInfo *cs, Mb_wc mb_wc, unsigned cha
   }
   return dst - d0;
 }
+template <class Mb_wc>
+static size_t ob_strnxfrm_uca_nopad(const ObCharsetInfo *cs, Mb_wc mb_wc, unsigned char *dst,
+                                    size_t dstlen, const unsigned char *src, size_t srclen,
+                                    bool *is_overflow) {
+  unsigned char *d0 = dst;
+  unsigned char *de = dst + dstlen;
+  int s_res;
+  uca_scanner_any<Mb_wc> scanner(mb_wc, cs, src, srclen);
+  *is_overflow = false;
+  while (!*is_overflow && (s_res = scanner.next()) > 0) {
+    if (dst + 2 > de) {
+      *is_overflow = true;
+    } else {
+      dst = store16be(dst, s_res);
+    }
+  }
+  return dst - d0;
+}
 static int ob_uca_charcmp_900(const ObCharsetInfo *cs, ob_wc_t wc1,
                               ob_wc_t wc2) {
   uint16_t *weight1_ptr = ob_char_weight_addr_900(cs->uca, wc1);
@@ -2861,17 +2890,105 @@ static size_t ob_strnxfrmlen_uca_900(const ObCharsetInfo *cs, size_t len) {
   }
   return (max_num_weights + (cs->levels_for_compare - 1)) * sizeof(uint16_t);
 }
+/*
+  Makes a variable length sortkey, sortkeys of several strings can be concatenated and
+  compared by memcmp. Weights of the string are followed by a terminator:
+  - NO PAD: 0x0000, which is less than any weight.
+  - PAD SPACE: trailing spaces are dropped, every run of inner spaces is encoded as
+    [space weight, marker, count], the marker 0x0021 (with flipped count) or 0x0019 tells
+    whether the following weight is greater or less than space weight. The terminator
+    [space weight, 0x0020] then compares as infinite spaces.
+  Returns 0 if dst is too small.
+*/
+static size_t ob_strnxfrm_uca_varlen(const ObCharsetInfo *cs, unsigned char *dst,
+                                     size_t dst_len, unsigned int nweights __attribute__((unused)),
+                                     const unsigned char *src, size_t srclen,
+                                     bool is_memcmp, bool *is_valid_unicode) {
+  const bool is_pad_space = !is_memcmp && PAD_SPACE == cs->pad_attribute;
+  const unsigned int space_weight = ob_space_weight(cs);
+  const size_t tail_len = is_pad_space ? 4 : 2;
+  // weights are 16 bits
+  const size_t weights_buf_len = dst_len < tail_len ? 0 : (dst_len - tail_len) & ~static_cast<size_t>(1);
+  size_t wlen = 0;
+  size_t res = 0;
+  bool is_overflow = 0 == weights_buf_len;
+  *is_valid_unicode = true;
+  if (is_overflow) {
+  } else if (cs->uca && cs->uca->version == UCA_V900) {
+    wlen = ob_strnxfrm_uca_900(cs, dst, weights_buf_len, 0, src, srclen, 0, is_valid_unicode);
+    // weights may be truncated when the buffer is filled up
+    is_overflow = wlen >= weights_buf_len;
+  } else if (cs->cset->mb_wc == ob_mb_wc_utf8mb4_thunk) {
+    wlen = ob_strnxfrm_uca_nopad(cs, Mb_wc_utf8mb4(), dst, weights_buf_len, src, srclen, &is_overflow);
+  } else {
+    Mb_wc_through_function_pointer mb_wc(cs);
+    wlen = ob_strnxfrm_uca_nopad(cs, mb_wc, dst, weights_buf_len, src, srclen, &is_overflow);
+  }
+  if (is_overflow) {
+  } else if (!is_pad_space) {
+    store16be(dst + wlen, 0);
+    res = wlen + 2;
+  } else {
+    while (wlen >= 2 && load16be(dst + wlen - 2) == space_weight) {
+      wlen -= 2;
+    }
+    size_t run_cnt = 0;
+    for (size_t i = 0; i < wlen; i += 2) {
+      if (load16be(dst + i) == space_weight && (0 == i || load16be(dst + i - 2) != space_weight)) {
+        run_cnt++;
+      }
+    }
+    if (wlen + 4 * run_cnt + tail_len > dst_len) {
+      is_overflow = true;
+    } else {
+      // move weights to the tail of dst, so that encoding never overwrites unread weights
+      unsigned char *src_w = dst + dst_len - wlen;
+      const unsigned char *src_we = dst + dst_len;
+      unsigned char *d = dst;
+      memmove(src_w, dst, wlen);
+      while (*is_valid_unicode && src_w < src_we) {
+        unsigned int w = load16be(src_w);
+        if (w != space_weight) {
+          d = store16be(d, w);
+          src_w += 2;
+        } else {
+          unsigned int space_cnt = 0;
+          while (src_w < src_we && load16be(src_w) == space_weight) {
+            space_cnt++;
+            src_w += 2;
+          }
+          if (space_cnt > 0xFFFF) {
+            // too long to encode, let the caller compare the original string
+            *is_valid_unicode = false;
+          } else if (load16be(src_w) > space_weight) {
+            d = store16be(d, space_weight);
+            d = store16be(d, 0x0021);
+            d = store16be(d, space_cnt ^ 0xFFFF);
+          } else {
+            d = store16be(d, space_weight);
+            d = store16be(d, 0x0019);
+            d = store16be(d, space_cnt);
+          }
+        }
+      }
+      d = store16be(d, space_weight);
+      d = store16be(d, 0x0020);
+      res = d - dst;
+    }
+  }
+  return is_overflow ? 0 : res;
+}
 }  // extern "C"
 ObCollationHandler ob_collation_any_uca_handler = {
     ob_coll_init_uca,
     ob_coll_uninit_uca,   ob_strnncoll_any_uca,  ob_strnncollsp_any_uca,
-    ob_strnxfrm_any_uca,  ob_strnxfrmlen_simple, NULL, ob_like_range_mb,
+    ob_strnxfrm_any_uca,  ob_strnxfrmlen_simple, ob_strnxfrm_uca_varlen, ob_like_range_mb,
     ob_wildcmp_uca,       ob_strcasecmp_uca,     ob_instr_mb,
     ob_hash_sort_any_uca, ob_propagate_complex};
 ObCollationHandler ob_collation_uca_900_handler = {
     ob_coll_init_uca,
     ob_coll_uninit_uca,   ob_strnncoll_uca_900,   ob_strnncollsp_uca_900,
-    ob_strnxfrm_uca_900,  ob_strnxfrmlen_uca_900, NULL, ob_like_range_mb,
+    ob_strnxfrm_uca_900,  ob_strnxfrmlen_uca_900, ob_strnxfrm_uca_varlen, ob_like_range_mb,
     ob_wildcmp_uca,       ob_strcasecmp_uca,      ob_instr_mb,
     ob_hash_sort_uca_900, ob_propagate_uca_900};
 static ObCollationHandler ob_collation_utf16_uca_handler =
@@ -0,0 +1,317 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX LIB
+#include "lib/compress/ob_compress_dict.h"
+#include "lib/compress/ob_compress_util.h"
+#include "lib/compress/zstd_1_3_8/ob_zstd_wrapper.h"
+#include "lib/hash_func/murmur_hash.h"
+#include <algorithm>
+
+namespace oceanbase
+{
+namespace common
+{
+/**
+ * ----------------------------ObCompressDictMgr---------------------------
+ */
+ObCompressDictMgr::ObCompressDictMgr()
+  : allocator_(ObMemAttr(OB_SERVER_TENANT_ID, "CompressDict")),
+    dict_cnt_(0)
+{
+  MEMSET(buckets_, 0, sizeof(buckets_));
+}
+
+ObCompressDictMgr &ObCompressDictMgr::get_instance()
+{
+  static ObCompressDictMgr instance;
+  return instance;
+}
+
+uint64_t ObCompressDictMgr::calc_dict_id(const char *dict, const int64_t dict_size)
+{
+  uint64_t dict_id = murmurhash64A(dict, static_cast<int32_t>(dict_size), 0);
+  // 0 is reserved for no dictionary
+  return 0 == dict_id ? 1 : dict_id;
+}
+
+int ObCompressDictMgr::create_dict(
+    const uint64_t dict_id,
+    const char *dict,
+    const int64_t dict_size,
+    ObCompressDict *&compress_dict)
+{
+  int ret = OB_SUCCESS;
+  zstd_1_3_8::OB_ZSTD_customMem zstd_mem = {ob_zstd_malloc, ob_zstd_free, &allocator_};
+  char *buf = nullptr;
+  compress_dict = nullptr;
+  if (OB_ISNULL(buf = static_cast<char *>(allocator_.alloc(sizeof(ObCompressDict) + dict_size)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc compress dict", K(ret), K(dict_size));
+  } else {
+    compress_dict = reinterpret_cast<ObCompressDict *>(buf);
+    compress_dict->next_ = nullptr;
+    compress_dict->dict_id_ = dict_id;
+    compress_dict->ref_cnt_ = 1;
+    compress_dict->dict_size_ = dict_size;
+    compress_dict->cdict_ = nullptr;
+    compress_dict->dict_ = buf + sizeof(ObCompressDict);
+    MEMCPY(compress_dict->dict_, dict, dict_size);
+    if (OB_FAIL(zstd_1_3_8::ObZstdWrapper::create_cdict(zstd_mem, compress_dict->dict_, dict_size,
+                                                        compress_dict->cdict_))) {
+      LOG_WARN("fail to create cdict", K(ret), K(dict_size));
+    }
+    if (OB_FAIL(ret)) {
+      destroy_dict(compress_dict);
+      compress_dict = nullptr;
+    }
+  }
+  return ret;
+}
+
+void ObCompressDictMgr::destroy_dict(ObCompressDict *compress_dict)
+{
+  if (OB_NOT_NULL(compress_dict)) {
+    if (OB_NOT_NULL(compress_dict->cdict_)) {
+      zstd_1_3_8::ObZstdWrapper::free_cdict(compress_dict->cdict_);
+    }
+    allocator_.free(compress_dict);
+  }
+}
+
+int ObCompressDictMgr::acquire(const char *dict, const int64_t dict_size, ObCompressDict *&compress_dict)
+{
+  int ret = OB_SUCCESS;
+  compress_dict = nullptr;
+  if (OB_ISNULL(dict) || OB_UNLIKELY(dict_size <= 0 || dict_size > MAX_DICT_SIZE)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(dict), K(dict_size));
+  } else {
+    const uint64_t dict_id = calc_dict_id(dict, dict_size);
+    ObSpinLockGuard guard(bucket_lock(dict_id));
+    ObCompressDict *cur = buckets_[bucket_idx(dict_id)];
+    while (nullptr != cur && nullptr == compress_dict) {
+      if (cur->dict_id_ == dict_id) {
+        if (OB_UNLIKELY(cur->dict_size_ != dict_size || 0 != MEMCMP(cur->dict_, dict, dict_size))) {
+          ret = OB_HASH_EXIST;
+          LOG_ERROR("compress dict id conflict", K(ret), K(dict_id), K(dict_size), KPC(cur));
+        } else {
+          ATOMIC_INC(&cur->ref_cnt_);
+        }
+        compress_dict = cur;
+      }
+      cur = cur->next_;
+    }
+    if (OB_FAIL(ret)) {
+      compress_dict = nullptr;
+    } else if (nullptr != compress_dict) {
+      // registered
+    } else if (OB_FAIL(create_dict(dict_id, dict, dict_size, compress_dict))) {
+      LOG_WARN("fail to create compress dict", K(ret), K(dict_id), K(dict_size));
+    } else {
+      compress_dict->next_ = buckets_[bucket_idx(dict_id)];
+      buckets_[bucket_idx(dict_id)] = compress_dict;
+      ATOMIC_INC(&dict_cnt_);
+      LOG_INFO("register compress dict", KPC(compress_dict), K_(dict_cnt));
+    }
+  }
+  return ret;
+}
+
+void ObCompressDictMgr::inc_ref(ObCompressDict *compress_dict)
+{
+  if (OB_NOT_NULL(compress_dict)) {
+    ATOMIC_INC(&compress_dict->ref_cnt_);
+  }
+}
+
+void ObCompressDictMgr::revert(ObCompressDict *compress_dict)
+{
+  if (OB_NOT_NULL(compress_dict)) {
+    const uint64_t dict_id = compress_dict->dict_id_;
+    bool need_destroy = false;
+    {
+      ObSpinLockGuard guard(bucket_lock(dict_id));
+      if (0 == ATOMIC_AAF(&compress_dict->ref_cnt_, -1)) {
+        ObCompressDict **prev = &buckets_[bucket_idx(dict_id)];
+        while (nullptr != *prev && *prev != compress_dict) {
+          prev = &(*prev)->next_;
+        }
+        if (nullptr != *prev) {
+          *prev = compress_dict->next_;
+        }
+        need_destroy = true;
+        ATOMIC_DEC(&dict_cnt_);
+      }
+    }
+    if (need_destroy) {
+      LOG_INFO("unregister compress dict", KPC(compress_dict), K_(dict_cnt));
+      destroy_dict(compress_dict);
+    }
+  }
+}
+
+/**
+ * ----------------------------ObCompressDictTrainer---------------------------
+ */
+ObCompressDictTrainer::ObCompressDictTrainer(ObIAllocator &allocator)
+  : allocator_(allocator),
+    dict_size_(0),
+    sample_capacity_(0),
+    sample_len_(0),
+    sample_cnt_(0),
+    sample_buf_(nullptr),
+    is_inited_(false)
+{
+}
+
+int ObCompressDictTrainer::init(const int64_t dict_size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_UNLIKELY(dict_size < MIN_DICT_SIZE || dict_size > ObCompressDictMgr::MAX_DICT_SIZE)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid dict size", K(ret), K(dict_size));
+  } else if (OB_ISNULL(sample_buf_ = static_cast<char *>(allocator_.alloc(dict_size * SAMPLE_RATIO)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc sample buf", K(ret), K(dict_size));
+  } else {
+    dict_size_ = dict_size;
+    sample_capacity_ = dict_size * SAMPLE_RATIO;
+    sample_len_ = 0;
+    sample_cnt_ = 0;
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObCompressDictTrainer::reset()
+{
+  if (nullptr != sample_buf_) {
+    allocator_.free(sample_buf_);
+    sample_buf_ = nullptr;
+  }
+  dict_size_ = 0;
+  sample_capacity_ = 0;
+  sample_len_ = 0;
+  sample_cnt_ = 0;
+  is_inited_ = false;
+}
+
+int ObCompressDictTrainer::add_sample(const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(buf) || OB_UNLIKELY(size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(buf), K(size));
+  } else if (!is_ready()) {
+    // take a slice of every block, so that the sample covers at least MIN_SAMPLE_CNT blocks
+    const int64_t copy_len = MIN(MIN(size, sample_capacity_ / MIN_SAMPLE_CNT),
+                                 sample_capacity_ - sample_len_);
+    MEMCPY(sample_buf_ + sample_len_, buf + (size - copy_len) / 2, copy_len);
+    sample_len_ += copy_len;
+    sample_cnt_++;
+  }
+  return ret;
+}
+
+OB_INLINE uint64_t ObCompressDictTrainer::kmer_hash(const char *pos)
+{
+  uint64_t kmer = 0;
+  MEMCPY(&kmer, pos, KMER_SIZE);
+  return (kmer * 0x9E3779B97F4A7C15ULL) >> (64 - HASH_BITS);
+}
+
+int64_t ObCompressDictTrainer::score_segment(const uint16_t *freq, const int64_t offset) const
+{
+  int64_t score = 0;
+  const int64_t end = MIN(offset + SEGMENT_SIZE, sample_len_) - KMER_SIZE;
+  for (int64_t i = offset; i <= end; ++i) {
+    const uint16_t cnt = freq[kmer_hash(sample_buf_ + i)];
+    score += cnt > 1 ? cnt - 1 : 0;
+  }
+  return score;
+}
+
+int ObCompressDictTrainer::train(char *dict_buf, const int64_t dict_buf_size, int64_t &dict_len)
+{
+  int ret = OB_SUCCESS;
+  const int64_t segment_cnt = sample_len_ / SEGMENT_SIZE;
+  const int64_t max_dict_len = MIN(dict_size_, dict_buf_size) / SEGMENT_SIZE * SEGMENT_SIZE;
+  uint16_t *freq = nullptr;
+  Segment *segments = nullptr;
+  dict_len = 0;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(dict_buf) || OB_UNLIKELY(max_dict_len < MIN_DICT_SIZE)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(dict_buf), K(dict_buf_size), K_(dict_size));
+  } else if (segment_cnt * SEGMENT_SIZE < MIN_DICT_SIZE) {
+    ret = OB_ENTRY_NOT_EXIST;
+    LOG_DEBUG("sample is too small", K(ret), KPC(this));
+  } else if (OB_ISNULL(freq = static_cast<uint16_t *>(
+      allocator_.alloc(sizeof(uint16_t) << HASH_BITS)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc kmer frequency", K(ret));
+  } else if (OB_ISNULL(segments = static_cast<Segment *>(allocator_.alloc(sizeof(Segment) * segment_cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc segments", K(ret), K(segment_cnt));
+  } else {
+    MEMSET(freq, 0, sizeof(uint16_t) << HASH_BITS);
+    for (int64_t i = 0; i + KMER_SIZE <= sample_len_; ++i) {
+      uint16_t &cnt = freq[kmer_hash(sample_buf_ + i)];
+      if (cnt < UINT16_MAX) {
+        cnt++;
+      }
+    }
+    for (int64_t i = 0; i < segment_cnt; ++i) {
+      segments[i].offset_ = i * SEGMENT_SIZE;
+      segments[i].score_ = score_segment(freq, segments[i].offset_);
+    }
+    std::sort(segments, segments + segment_cnt);
+    // fill the dictionary from the end, the best segment is the nearest to the data
+    for (int64_t i = 0; i < segment_cnt && dict_len < max_dict_len && segments[i].score_ > 0; ++i) {
+      const int64_t offset = segments[i].offset_;
+      // skip the segment whose k-mers are all covered by the chosen ones
+      if (score_segment(freq, offset) > 0) {
+        dict_len += SEGMENT_SIZE;
+        MEMCPY(dict_buf + max_dict_len - dict_len, sample_buf_ + offset, SEGMENT_SIZE);
+        for (int64_t j = offset; j + KMER_SIZE <= offset + SEGMENT_SIZE; ++j) {
+          freq[kmer_hash(sample_buf_ + j)] = 0;
+        }
+      }
+    }
+    if (dict_len < MIN_DICT_SIZE) {
+      ret = OB_ENTRY_NOT_EXIST;
+      LOG_DEBUG("sample is not repetitive enough", K(ret), K(dict_len), KPC(this));
+      dict_len = 0;
+    } else if (dict_len < max_dict_len) {
+      MEMMOVE(dict_buf, dict_buf + max_dict_len - dict_len, dict_len);
+    }
+  }
+  if (nullptr != freq) {
+    allocator_.free(freq);
+  }
+  if (nullptr != segments) {
+    allocator_.free(segments);
+  }
+  return ret;
+}
+
+} // namespace common
+} // namespace oceanbase
@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_COMPRESS_DICT_H_
+#define OB_COMPRESS_DICT_H_
+
+#include "lib/allocator/ob_malloc.h"
+#include "lib/lock/ob_spin_lock.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+// ObDecompressDict refers to the dictionary of an sstable held by the sstable meta. The id is
+// calculated once when the meta is loaded, readers compare it with the id of the block instead
+// of hashing the dictionary again.
+struct ObDecompressDict
+{
+  ObDecompressDict() : dict_(nullptr), dict_size_(0), dict_id_(0) {}
+  ObDecompressDict(const char *dict, const int64_t dict_size, const uint64_t dict_id)
+    : dict_(dict), dict_size_(dict_size), dict_id_(dict_id) {}
+  OB_INLINE bool empty() const { return nullptr == dict_ || 0 >= dict_size_; }
+  OB_INLINE int64_t length() const { return dict_size_; }
+  OB_INLINE void reset() { dict_ = nullptr; dict_size_ = 0; dict_id_ = 0; }
+  TO_STRING_KV(KP_(dict), K_(dict_size), K_(dict_id));
+  const char *dict_;
+  int64_t dict_size_;
+  uint64_t dict_id_;
+};
+
+// ObCompressDict is a zstd_1.3.8 raw content dictionary digested once for compression.
+// A block compressed with a dictionary carries the dictionary id, readers pass the dictionary
+// stored in the sstable meta to the compressor, which checks the id.
+class ObCompressDict
+{
+public:
+  OB_INLINE uint64_t get_dict_id() const { return dict_id_; }
+  OB_INLINE const char *get_dict() const { return dict_; }
+  OB_INLINE int64_t get_dict_size() const { return dict_size_; }
+  OB_INLINE const void *get_cdict() const { return cdict_; }
+  OB_INLINE int64_t get_ref() const { return ATOMIC_LOAD(&ref_cnt_); }
+  OB_INLINE ObDecompressDict get_decompress_dict() const
+  {
+    return ObDecompressDict(dict_, dict_size_, dict_id_);
+  }
+  TO_STRING_KV(K_(dict_id), K_(dict_size), K_(ref_cnt), KP_(cdict));
+private:
+  friend class ObCompressDictMgr;
+  ObCompressDict *next_;
+  uint64_t dict_id_;
+  int64_t ref_cnt_;
+  int64_t dict_size_;
+  void *cdict_;
+  char *dict_;
+};
+
+// Process wide registry of the dictionaries used by the running merges, keyed by dict id, so
+// the writers of an sstable share one digested dictionary. It is not used to read blocks.
+// The dictionary is freed when the last reference is reverted.
+class ObCompressDictMgr
+{
+public:
+  static const int64_t MAX_DICT_SIZE = 128L << 10;
+  static ObCompressDictMgr &get_instance();
+  static uint64_t calc_dict_id(const char *dict, const int64_t dict_size);
+  // register the dictionary, or take a reference of the registered one with the same content
+  int acquire(const char *dict, const int64_t dict_size, ObCompressDict *&compress_dict);
+  void inc_ref(ObCompressDict *compress_dict);
+  void revert(ObCompressDict *compress_dict);
+  int64_t get_dict_cnt() const { return ATOMIC_LOAD(&dict_cnt_); }
+private:
+  static const int64_t BUCKET_CNT = 1024;
+  static const int64_t LOCK_CNT = 64;
+  ObCompressDictMgr();
+  ~ObCompressDictMgr() {}
+  int create_dict(const uint64_t dict_id, const char *dict, const int64_t dict_size,
+                  ObCompressDict *&compress_dict);
+  void destroy_dict(ObCompressDict *compress_dict);
+  OB_INLINE int64_t bucket_idx(const uint64_t dict_id) const { return dict_id % BUCKET_CNT; }
+  OB_INLINE ObSpinLock &bucket_lock(const uint64_t dict_id) { return locks_[bucket_idx(dict_id) % LOCK_CNT]; }
+private:
+  ObMalloc allocator_;
+  int64_t dict_cnt_;
+  ObSpinLock locks_[LOCK_CNT];
+  ObCompressDict *buckets_[BUCKET_CNT];
+  DISALLOW_COPY_AND_ASSIGN(ObCompressDictMgr);
+};
+
+// ObCompressDictTrainer builds a raw content dictionary from samples of the blocks to compress.
+// zstd dictBuilder is not vendored, so it picks segments like the cover algorithm does: the
+// sample is cut into segments, every segment is scored by how often its k-mers occur in the
+// whole sample, and the best segments are chosen greedily with the k-mers already covered by
+// the chosen ones no longer counted. Segments are large to keep the context of the rows. The
+// best segment is put at the end of the dictionary, where the match offsets are the smallest.
+class ObCompressDictTrainer
+{
+public:
+  static const int64_t DEFAULT_DICT_SIZE = 16L << 10;
+  static const int64_t MIN_DICT_SIZE = 1L << 10;
+  ObCompressDictTrainer(ObIAllocator &allocator);
+  ~ObCompressDictTrainer() { reset(); }
+  int init(const int64_t dict_size = DEFAULT_DICT_SIZE);
+  void reset();
+  int add_sample(const char *buf, const int64_t size);
+  OB_INLINE bool is_ready() const { return sample_len_ >= sample_capacity_; }
+  OB_INLINE int64_t get_sample_cnt() const { return sample_cnt_; }
+  // return OB_ENTRY_NOT_EXIST if the sample does not have enough repetitive content
+  int train(char *dict_buf, const int64_t dict_buf_size, int64_t &dict_len);
+  TO_STRING_KV(K_(dict_size), K_(sample_capacity), K_(sample_len), K_(sample_cnt));
+private:
+  static const int64_t SAMPLE_RATIO = 8;
+  static const int64_t MIN_SAMPLE_CNT = 16;
+  static const int64_t SEGMENT_SIZE = 1024;
+  static const int64_t KMER_SIZE = 8;
+  static const int64_t HASH_BITS = 16;
+  struct Segment
+  {
+    int64_t score_;
+    int64_t offset_;
+    bool operator<(const Segment &other) const { return score_ > other.score_; }
+  };
+  OB_INLINE static uint64_t kmer_hash(const char *pos);
+  int64_t score_segment(const uint16_t *freq, const int64_t offset) const;
+private:
+  ObIAllocator &allocator_;
+  int64_t dict_size_;
+  int64_t sample_capacity_;
+  int64_t sample_len_;
+  int64_t sample_cnt_;
+  char *sample_buf_;
+  bool is_inited_;
+  DISALLOW_COPY_AND_ASSIGN(ObCompressDictTrainer);
+};
+
+} // namespace common
+} // namespace oceanbase
+
+#endif // OB_COMPRESS_DICT_H_
@@ -13,6 +13,7 @@
 #include "ob_zstd_compressor_1_3_8.h"
 
 #include "lib/ob_errno.h"
+#include "lib/compress/ob_compress_dict.h"
 #include "lib/rc/context.h"
 #include "lib/thread_local/ob_tsi_factory.h"
 #include "ob_zstd_wrapper.h"
@@ -21,6 +22,66 @@ using namespace oceanbase;
 using namespace common;
 using namespace zstd_1_3_8;
 
+/**
+ * ----------------------------ObZstdDictDecompressCtx---------------------------
+ */
+// Creating the decompression context and referencing the dictionary cost more than
+// decompressing a small block, so every thread keeps them for the last dictionary it read.
+// They are allocated by the zstd hooks from an allocator of their own, as the context outlives
+// the compressor that uses it.
+class ObZstdDictDecompressCtx
+{
+public:
+  ObZstdDictDecompressCtx()
+    : allocator_(ObMemAttr(OB_SERVER_TENANT_ID, "ZstdDictDCtx")),
+      dict_(), dctx_(nullptr), ddict_(nullptr) {}
+  ~ObZstdDictDecompressCtx() { reset(); }
+  int prepare(const ObDecompressDict &dict);
+  void reset();
+public:
+  ObMalloc allocator_;
+  ObDecompressDict dict_;
+  void *dctx_;
+  void *ddict_;
+};
+
+int ObZstdDictDecompressCtx::prepare(const ObDecompressDict &dict)
+{
+  int ret = OB_SUCCESS;
+  OB_ZSTD_customMem zstd_mem = {ob_zstd_malloc, ob_zstd_free, &allocator_};
+  if (nullptr == dctx_ && OB_FAIL(ObZstdWrapper::create_dctx(zstd_mem, dctx_))) {
+    LIB_LOG(WARN, "fail to create dctx", K(ret));
+  } else if (nullptr != ddict_
+      && dict.dict_ == dict_.dict_
+      && dict.dict_size_ == dict_.dict_size_
+      && dict.dict_id_ == dict_.dict_id_) {
+    // the same dictionary, the ddict refers to its bytes
+  } else {
+    if (nullptr != ddict_) {
+      ObZstdWrapper::free_ddict(ddict_);
+      dict_.reset();
+    }
+    if (OB_FAIL(ObZstdWrapper::create_ddict(zstd_mem, dict.dict_, dict.dict_size_, ddict_))) {
+      LIB_LOG(WARN, "fail to create ddict", K(ret), K(dict));
+    } else {
+      dict_ = dict;
+    }
+  }
+  return ret;
+}
+
+void ObZstdDictDecompressCtx::reset()
+{
+  if (nullptr != ddict_) {
+    ObZstdWrapper::free_ddict(ddict_);
+  }
+  if (nullptr != dctx_) {
+    ObZstdWrapper::free_dctx(dctx_);
+    dctx_ = nullptr;
+  }
+  dict_.reset();
+}
+
 
 /**
  * ----------------------------ObZstdCompressor---------------------------
@@ -83,6 +144,10 @@ int ObZstdCompressor_1_3_8::decompress(const char *src_buffer,
     ret = OB_INVALID_ARGUMENT;
     LIB_LOG(WARN, "invalid decompress argument, ",
         K(ret), KP(src_buffer), K(src_data_size), KP(dst_buffer), K(dst_buffer_size));
+  } else if (OB_UNLIKELY(is_dict_frame(src_buffer, src_data_size))) {
+    ret = OB_ERR_COMPRESS_DECOMPRESS_DATA;
+    LIB_LOG(WARN, "dictionary compressed block read without its dictionary", K(ret),
+        KP(src_buffer), K(src_data_size), "dict_id", get_frame_dict_id(src_buffer));
   } else if (OB_FAIL(ObZstdWrapper::decompress(zstd_mem,
                                               src_buffer,
                                               src_data_size,
@@ -98,6 +163,110 @@ int ObZstdCompressor_1_3_8::decompress(const char *src_buffer,
   return ret;
 }
 
+int ObZstdCompressor_1_3_8::compress(const char *src_buffer,
+                                     const int64_t src_data_size,
+                                     char *dst_buffer,
+                                     const int64_t dst_buffer_size,
+                                     int64_t &dst_data_size,
+                                     const ObCompressDict &dict)
+{
+  int ret = OB_SUCCESS;
+  int64_t max_overflow_size = 0;
+  size_t compress_ret_size = 0;
+  OB_ZSTD_customMem zstd_mem = {ob_zstd_malloc, ob_zstd_free, &allocator_};
+  dst_data_size = 0;
+
+  if (NULL == src_buffer
+      || 0 >= src_data_size
+      || NULL == dst_buffer
+      || 0 >= dst_buffer_size
+      || NULL == dict.get_cdict()) {
+    ret = OB_INVALID_ARGUMENT;
+    LIB_LOG(WARN, "invalid compress argument, ",
+        K(ret), KP(src_buffer), K(src_data_size), KP(dst_buffer), K(dst_buffer_size), K(dict));
+  } else if (OB_FAIL(get_max_overflow_size(src_data_size, max_overflow_size))) {
+    LIB_LOG(WARN, "fail to get max_overflow_size, ", K(ret), K(src_data_size));
+  } else if ((DICT_FRAME_HEADER_SIZE + src_data_size + max_overflow_size) > dst_buffer_size) {
+    ret = OB_BUF_NOT_ENOUGH;
+    LIB_LOG(WARN, "dst buffer not enough, ",
+        K(ret), K(src_data_size), K(max_overflow_size), K(dst_buffer_size));
+  } else if (OB_FAIL(ObZstdWrapper::compress_using_cdict(zstd_mem,
+                                                         dict.get_cdict(),
+                                                         src_buffer,
+                                                         static_cast<size_t>(src_data_size),
+                                                         dst_buffer + DICT_FRAME_HEADER_SIZE,
+                                                         static_cast<size_t>(dst_buffer_size - DICT_FRAME_HEADER_SIZE),
+                                                         compress_ret_size))) {
+    LIB_LOG(WARN, "failed to compress zstd with dict", K(ret), K(compress_ret_size),
+        KP(src_buffer), K(src_data_size), KP(dst_buffer), K(dst_buffer_size), K(dict));
+  } else {
+    const uint32_t magic = DICT_FRAME_MAGIC;
+    const uint32_t frame_size = sizeof(uint64_t);
+    const uint64_t dict_id = dict.get_dict_id();
+    MEMCPY(dst_buffer, &magic, sizeof(uint32_t));
+    MEMCPY(dst_buffer + sizeof(uint32_t), &frame_size, sizeof(uint32_t));
+    MEMCPY(dst_buffer + 2 * sizeof(uint32_t), &dict_id, sizeof(uint64_t));
+    dst_data_size = DICT_FRAME_HEADER_SIZE + compress_ret_size;
+  }
+  return ret;
+}
+
+int ObZstdCompressor_1_3_8::decompress(const char *src_buffer,
+                                       const int64_t src_data_size,
+                                       char *dst_buffer,
+                                       const int64_t dst_buffer_size,
+                                       int64_t &dst_data_size,
+                                       const ObDecompressDict &dict)
+{
+  int ret = OB_SUCCESS;
+  size_t decompress_ret_size = 0;
+  ObZstdDictDecompressCtx *dict_ctx = nullptr;
+  dst_data_size = 0;
+
+  if (NULL == src_buffer
+      || 0 >= src_data_size
+      || NULL == dst_buffer
+      || 0 >= dst_buffer_size
+      || dict.empty()) {
+    ret = OB_INVALID_ARGUMENT;
+    LIB_LOG(WARN, "invalid decompress argument, ", K(ret), KP(src_buffer), K(src_data_size),
+        KP(dst_buffer), K(dst_buffer_size), K(dict));
+  } else if (!is_dict_frame(src_buffer, src_data_size)) {
+    // blocks written before the dictionary was trained are compressed without it
+    if (OB_FAIL(decompress(src_buffer, src_data_size, dst_buffer, dst_buffer_size, dst_data_size))) {
+      LIB_LOG(WARN, "failed to decompress zstd", K(ret), K(src_data_size), K(dst_buffer_size));
+    }
+  } else if (OB_UNLIKELY(get_frame_dict_id(src_buffer) != dict.dict_id_)) {
+    ret = OB_ERR_COMPRESS_DECOMPRESS_DATA;
+    LIB_LOG(WARN, "block is compressed with another dictionary", K(ret), K(dict),
+        "frame_dict_id", get_frame_dict_id(src_buffer));
+  } else if (OB_ISNULL(dict_ctx = GET_TSI(ObZstdDictDecompressCtx))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LIB_LOG(WARN, "fail to get dict decompress ctx", K(ret));
+  } else if (OB_FAIL(dict_ctx->prepare(dict))) {
+    LIB_LOG(WARN, "fail to prepare dict decompress ctx", K(ret), K(dict));
+  } else if (OB_FAIL(ObZstdWrapper::decompress_using_ddict(dict_ctx->dctx_,
+                                                          dict_ctx->ddict_,
+                                                          src_buffer + DICT_FRAME_HEADER_SIZE,
+                                                          src_data_size - DICT_FRAME_HEADER_SIZE,
+                                                          dst_buffer,
+                                                          dst_buffer_size,
+                                                          decompress_ret_size))) {
+    LIB_LOG(WARN, "failed to decompress zstd with dict", K(ret), K(decompress_ret_size),
+        KP(src_buffer), K(src_data_size), KP(dst_buffer), K(dst_buffer_size), K(dict));
+  } else {
+    dst_data_size = decompress_ret_size;
+  }
+  return ret;
+}
+
+uint64_t ObZstdCompressor_1_3_8::get_frame_dict_id(const char *src_buffer)
+{
+  uint64_t dict_id = 0;
+  MEMCPY(&dict_id, src_buffer + 2 * sizeof(uint32_t), sizeof(uint64_t));
+  return dict_id;
+}
+
 const char *ObZstdCompressor_1_3_8::get_compressor_name() const
 {
   return all_compressor_name[ObCompressorType::ZSTD_1_3_8_COMPRESSOR];
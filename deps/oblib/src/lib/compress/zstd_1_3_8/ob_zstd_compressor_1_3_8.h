@@ -18,6 +18,8 @@ namespace oceanbase
 {
 namespace common
 {
+class ObCompressDict;
+struct ObDecompressDict;
 
 namespace zstd_1_3_8
 {
@@ -25,6 +27,10 @@ namespace zstd_1_3_8
 class __attribute__((visibility ("default"))) ObZstdCompressor_1_3_8 : public ObCompressor
 {
 public:
+  // A block compressed with a dictionary starts with a zstd skippable frame holding the
+  // dictionary id: | magic(4) | frame size(4) | dict id(8) | zstd frame |
+  static const int64_t DICT_FRAME_HEADER_SIZE = 16;
+  static const uint32_t DICT_FRAME_MAGIC = 0x184D2A5E;
   explicit ObZstdCompressor_1_3_8(ObIAllocator &allocator)
     : allocator_(allocator) {}
   virtual ~ObZstdCompressor_1_3_8() {}
@@ -38,10 +44,35 @@ public:
                  char *dst_buffer,
                  const int64_t dst_buffer_size,
                  int64_t &dst_data_size) override;
+  // dst_buffer_size should be larger than DICT_FRAME_HEADER_SIZE plus the max overflow size
+  int compress(const char *src_buffer,
+               const int64_t src_data_size,
+               char *dst_buffer,
+               const int64_t dst_buffer_size,
+               int64_t &dst_data_size,
+               const ObCompressDict &dict);
+  // decompress a block of an sstable with the raw content dictionary of the sstable, a block
+  // compressed without dictionary is decompressed as usual
+  int decompress(const char *src_buffer,
+                 const int64_t src_data_size,
+                 char *dst_buffer,
+                 const int64_t dst_buffer_size,
+                 int64_t &dst_data_size,
+                 const ObDecompressDict &dict);
+  static OB_INLINE bool is_dict_frame(const char *src_buffer, const int64_t src_data_size)
+  {
+    uint32_t magic = 0;
+    if (src_data_size > DICT_FRAME_HEADER_SIZE) {
+      MEMCPY(&magic, src_buffer, sizeof(uint32_t));
+    }
+    return DICT_FRAME_MAGIC == magic;
+  }
   const char *get_compressor_name() const;
   ObCompressorType get_compressor_type() const;
   int get_max_overflow_size(const int64_t src_data_size,
                             int64_t &max_overflow_size) const;
+private:
+  static uint64_t get_frame_dict_id(const char *src_buffer);
 private:
   ObIAllocator &allocator_;
 
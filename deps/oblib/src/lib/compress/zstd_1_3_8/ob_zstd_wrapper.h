@@ -65,6 +65,29 @@ public:
   static void free_stream_dctx(void *&ctx);
   static int decompress_stream(void *ctx, const char *src, const size_t src_size, size_t &consumed_size,
                                   char *dest, const size_t dest_capacity, size_t &decompressed_size);
+
+  // for dictionary, the dictionary is always loaded as raw content
+  static int create_cdict(OB_ZSTD_customMem &ob_zstd_mem, const char *dict, const size_t dict_size, void *&cdict);
+  static void free_cdict(void *&cdict);
+  static int compress_using_cdict(
+      OB_ZSTD_customMem &zstd_mem,
+      const void *cdict,
+      const char *src_buffer,
+      const size_t src_data_size,
+      char *dst_buffer,
+      const size_t dst_buffer_size,
+      size_t &compress_ret_size);
+  static int create_ddict(OB_ZSTD_customMem &ob_zstd_mem, const char *dict, const size_t dict_size, void *&ddict);
+  static void free_ddict(void *&ddict);
+  // dctx is created by create_dctx and can be reused
+  static int decompress_using_ddict(
+      void *dctx,
+      const void *ddict,
+      const char *src_buffer,
+      const size_t src_data_size,
+      char *dst_buffer,
+      const size_t dst_buffer_size,
+      size_t &dst_data_size);
 };
 
 #undef OB_PUBLIC_API
@@ -42,6 +42,76 @@ public:
   }
   ~ObLatchWaitEventGuard() { ObLatch::current_wait = nullptr; }
 };
+
+/**
+ * -------------------------------------------------------ObLatchHoldStat---------------------------------------------------------------
+ */
+thread_local ObLatchHoldStat::Sample ObLatchHoldStat::sample_;
+int64_t ObLatchHoldStat::hold_ns_[ObLatchIds::LATCH_END];
+
+static inline int64_t latch_clock_ns()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000000000L + ts.tv_nsec;
+}
+
+int64_t ObLatchHoldStat::get_pause_ns()
+{
+  static int64_t pause_ns = []() {
+    const int64_t PAUSE_CNT = 1000;
+    const int64_t start_ns = latch_clock_ns();
+    for (int64_t i = 0; i < PAUSE_CNT; ++i) {
+      PAUSE();
+    }
+    return MAX(1, (latch_clock_ns() - start_ns) / PAUSE_CNT);
+  }();
+  return pause_ns;
+}
+
+uint64_t ObLatchHoldStat::get_spin_cnt(const uint32_t latch_id)
+{
+  uint64_t spin_cnt = OB_LATCHES[latch_id].max_spin_cnt_;
+  const int64_t hold_ns = ATOMIC_LOAD(&hold_ns_[latch_id]);
+  // keep the configured spin until the latch has been sampled
+  if (hold_ns > 0) {
+    const uint64_t adaptive_cnt = MAX(MIN_SPIN_CNT, 2 * hold_ns / get_pause_ns());
+    spin_cnt = MIN(spin_cnt, adaptive_cnt);
+  }
+  return spin_cnt;
+}
+
+void ObLatchHoldStat::start_sample(const void *latch, const uint32_t latch_id)
+{
+  const int64_t now = latch_clock_ns();
+  // the latch of the last sample may be unlocked by another thread, give it up after a while
+  if (NULL == sample_.latch_ || now - sample_.start_ns_ > STALE_SAMPLE_NS) {
+    sample_.latch_ = latch;
+    sample_.latch_id_ = latch_id;
+    sample_.start_ns_ = now;
+  }
+}
+
+void ObLatchHoldStat::finish_sample()
+{
+  const uint32_t latch_id = sample_.latch_id_;
+  const int64_t hold_ns = latch_clock_ns() - sample_.start_ns_;
+  sample_.latch_ = NULL;
+  if (OB_LIKELY(hold_ns >= 0 && hold_ns < STALE_SAMPLE_NS) && OB_LIKELY(latch_id < ObLatchIds::LATCH_END)) {
+    // ewma with 1/8 weight, concurrent updates may lose a sample, which is harmless
+    const int64_t old_ns = ATOMIC_LOAD(&hold_ns_[latch_id]);
+    ATOMIC_STORE(&hold_ns_[latch_id], MAX(1, old_ns <= 0 ? hold_ns : old_ns + (hold_ns - old_ns) / 8));
+    if (lib::is_diagnose_info_enabled()) {
+      ObDiagnoseTenantInfo *di = ObDiagnoseTenantInfo::get_local_diagnose_info();
+      if (NULL != di) {
+        ObLatchStat *p_latch_stat = di->get_latch_stats().get_or_create_item(latch_id);
+        if (NULL != p_latch_stat) {
+          p_latch_stat->hold_hist_.inc(hold_ns);
+        }
+      }
+    }
+  }
+}
 /**
  * -------------------------------------------------------ObLatchMutex---------------------------------------------------------------
  */
@@ -74,6 +144,9 @@ int ObLatchMutex::try_lock(
       ret = OB_EAGAIN;
     } else {
       IGNORE_RETURN ObLatch::reg_lock((uint32_t*)&lock_.val());
+      if (need_record_stat()) {
+        ObLatchHoldStat::on_lock(this, latch_id);
+      }
     }
     if (need_record_stat()) {
       TRY_LOCK_RECORD_STAT(latch_id, 1, ret);
@@ -101,12 +174,13 @@ int ObLatchMutex::lock(
     ret = OB_INVALID_ARGUMENT;
     COMMON_LOG(WARN, "Invalid argument", K(latch_id), K(uid), K(abs_timeout_us), K(ret), KCSTRING(lbt()));
   } else {
+    const uint64_t max_spin_cnt = ObLatchHoldStat::get_spin_cnt(latch_id);
     while (OB_SUCC(ret)) {
       //spin
-      i = low_try_lock(OB_LATCHES[latch_id].max_spin_cnt_, (WRITE_MASK | uid));
+      i = low_try_lock(max_spin_cnt, (WRITE_MASK | uid));
       spin_cnt += i;
 
-      if (OB_LIKELY(i < OB_LATCHES[latch_id].max_spin_cnt_)) {
+      if (OB_LIKELY(i < max_spin_cnt)) {
         //success lock
         ++spin_cnt;
         break;
@@ -146,6 +220,9 @@ int ObLatchMutex::lock(
     }
     if (need_record_stat()) {
       LOCK_RECORD_STAT(latch_id, waited, spin_cnt, yield_cnt);
+      if (OB_SUCC(ret)) {
+        ObLatchHoldStat::on_lock(this, latch_id);
+      }
     }
   }
   HOLD_LOCK_INC();
@@ -193,6 +270,7 @@ int ObLatchMutex::wait(const int64_t abs_timeout_us, const uint32_t uid)
 int ObLatchMutex::unlock()
 {
   int ret = OB_SUCCESS;
+  ObLatchHoldStat::on_unlock(this);
   uint32_t lock = ATOMIC_SET(&lock_.val(), 0);
   IGNORE_RETURN ObLatch::unreg_lock((uint32_t*)&lock_.val());
   if (OB_UNLIKELY(0 == lock)) {
@@ -289,7 +367,11 @@ int ObLatchWaitQueue::wait(
           }
         }
 
-        if (OB_TIMEOUT != tmp_ret) {
+        if (1 == ATOMIC_LOAD(&proc.granted_)) {
+          // the latch has been handed over by the unlocker
+          ret = OB_SUCCESS;
+          IGNORE_RETURN ObLatch::reg_lock((uint32_t*)&latch.lock_);
+        } else if (OB_TIMEOUT != tmp_ret) {
           //try lock
           conflict = false;
           while(!conflict) {
@@ -344,6 +426,11 @@ int ObLatchWaitQueue::wait(
       }
       unlock_bucket(bucket);
     }
+    if (OB_TIMEOUT == ret && 1 == ATOMIC_LOAD(&proc.granted_)) {
+      // handed over just before timeout, the latch is held by us
+      ret = OB_SUCCESS;
+      IGNORE_RETURN ObLatch::reg_lock((uint32_t*)&latch.lock_);
+    }
   }
 
   return ret;
@@ -362,6 +449,7 @@ int ObLatchWaitQueue::wake_up(ObLatch &latch, const bool only_rd_wait)
   uint32_t actual_wake_cnt = 0;
   ObDList<ObWaitProc> wake_list;
   bool has_wait = true;
+  bool granted = false;
 
   lock_bucket(bucket);
   // wake_cnt is used to count the waiters need to be waked by
@@ -413,7 +501,10 @@ int ObLatchWaitQueue::wake_up(ObLatch &latch, const bool only_rd_wait)
         break;
       }
     }
-    if (!has_wait) {
+    if (1 == wake_cnt && !only_rd_wait) {
+      granted = try_handoff(latch, *wake_list.get_first(), has_wait);
+    }
+    if (!has_wait && !granted) {
       //no wait, clear the wait mask
       ATOMIC_ANDF(&latch.lock_, ~latch.WAIT_MASK);
     }
@@ -430,8 +521,9 @@ int ObLatchWaitQueue::wake_up(ObLatch &latch, const bool only_rd_wait)
         //the proc.wait_ must be set to 0 at last, once the 0 is set, the *iter may be not valid any more
         MEM_BARRIER();
         *pwait = 0;
-        // a thread waits using sys futex
-        if (1 == futex_wake(pwait, 1)) {
+        // a thread waits using sys futex, a handed over waiter counts as waked even if it
+        // has not slept yet
+        if (1 == futex_wake(pwait, 1) || granted) {
           ++actual_wake_cnt;
         }
       }
@@ -444,6 +536,29 @@ int ObLatchWaitQueue::wake_up(ObLatch &latch, const bool only_rd_wait)
   return ret;
 }
 
+bool ObLatchWaitQueue::try_handoff(ObLatch &latch, ObWaitProc &proc, const bool has_wait)
+{
+  // performance critical, do not double check the parameters
+  bool granted = false;
+  if (ObLatchWaitMode::WRITE_WAIT == proc.mode_
+      && ObLatchPolicy::LATCH_FIFO_HANDOFF == OB_LATCHES[proc.latch_id_].policy_) {
+    // the latch goes to the first writer directly instead of being released, so it is
+    // neither stolen by the spinners nor fought for by a herd of waked up waiters
+    const uint32_t new_lock = (latch.WRITE_MASK | proc.uid_) | (has_wait ? latch.WAIT_MASK : 0);
+    uint32_t lock = latch.lock_;
+    while (0 == (lock & ~latch.WAIT_MASK)) {
+      if (ATOMIC_BCAS(&latch.lock_, lock, new_lock)) {
+        granted = true;
+        proc.granted_ = 1;
+        break;
+      }
+      PAUSE();
+      lock = latch.lock_;
+    }
+  }
+  return granted;
+}
+
 template<typename LowTryLock>
 int ObLatchWaitQueue::try_lock(
     ObLatchBucket &bucket,
@@ -598,7 +713,7 @@ int ObLatch::try_rdlock(const uint32_t latch_id)
           COMMON_LOG(ERROR, "Too many read locks, ", K(lock), K(ret));
           break;
         } else {
-          if (ObLatchPolicy::LATCH_FIFO == OB_LATCHES[latch_id].policy_) {
+          if (ObLatchPolicy::LATCH_READ_PREFER != OB_LATCHES[latch_id].policy_) {
         	if (0 != (lock & WAIT_MASK)) {
         	  ret = OB_EAGAIN;
         	  break;
@@ -608,6 +723,9 @@ int ObLatch::try_rdlock(const uint32_t latch_id)
           if (ATOMIC_BCAS(&lock_, lock, lock + 1)) {
             ret = OB_SUCCESS;
             IGNORE_RETURN reg_lock((uint32_t*)&lock_);
+            if (need_record_stat()) {
+              ObLatchHoldStat::on_lock(this, latch_id);
+            }
             break;
           }
         }
@@ -638,6 +756,9 @@ int ObLatch::try_wrlock(const uint32_t latch_id, const uint32_t *puid)
       ret = OB_EAGAIN;
     } else {
       IGNORE_RETURN reg_lock((uint32_t*)&lock_);
+      if (need_record_stat()) {
+        ObLatchHoldStat::on_lock(this, latch_id);
+      }
     }
     if (need_record_stat()) {
       TRY_LOCK_RECORD_STAT(latch_id, 1, ret);
@@ -661,7 +782,7 @@ int ObLatch::rdlock(
       abs_timeout_us,
       uid,
       ObLatchWaitMode::READ_WAIT,
-      ObLatchPolicy::LATCH_FIFO == OB_LATCHES[latch_id].policy_ ? low_try_rdlock : low_try_rdlock_ignore,
+      ObLatchPolicy::LATCH_READ_PREFER != OB_LATCHES[latch_id].policy_ ? low_try_rdlock : low_try_rdlock_ignore,
       low_try_rdlock_ignore))) {
     if (OB_TIMEOUT != ret) {
       COMMON_LOG(WARN, "Fail to low lock, ", K(ret));
@@ -719,6 +840,7 @@ int ObLatch::wr2rdlock(const uint32_t *puid)
 int ObLatch::unlock(const uint32_t *puid)
 {
   int ret = OB_SUCCESS;
+  ObLatchHoldStat::on_unlock(this);
   uint32_t lock = ATOMIC_LOAD(&lock_);
 
   if (0 != (lock & WRITE_MASK)) {
@@ -773,9 +895,10 @@ OB_INLINE int ObLatch::low_lock(
     ret = OB_INVALID_ARGUMENT;
     COMMON_LOG(WARN, "Invalid argument", K(latch_id), K(uid), K(ret));
   } else {
+    const uint64_t max_spin_cnt = ObLatchHoldStat::get_spin_cnt(latch_id);
     while (OB_SUCC(ret)) {
       //spin
-      for (i = 0; OB_SUCC(ret) && i < OB_LATCHES[latch_id].max_spin_cnt_; ++i) {
+      for (i = 0; OB_SUCC(ret) && i < max_spin_cnt; ++i) {
         lock = lock_;
         if (OB_SUCC(lock_func(&lock_, lock, uid, conflict))) {
           break;
@@ -789,7 +912,7 @@ OB_INLINE int ObLatch::low_lock(
 
       if (OB_FAIL(ret)) {
         //fail
-      } else if (i < OB_LATCHES[latch_id].max_spin_cnt_) {
+      } else if (i < max_spin_cnt) {
         //success lock
         ++spin_cnt;
         break;
@@ -807,7 +930,7 @@ OB_INLINE int ObLatch::low_lock(
           reinterpret_cast<uint64_t>(this),
           (uint32_t*)&lock_,
           0);
-        ObWaitProc proc(*this, wait_mode);
+        ObWaitProc proc(*this, wait_mode, latch_id, uid);
         if (OB_FAIL(ObLatchWaitQueue::get_instance().wait(
             proc,
             latch_id,
@@ -825,6 +948,9 @@ OB_INLINE int ObLatch::low_lock(
     }
     if (need_record_stat()) {
       LOCK_RECORD_STAT(latch_id, waited, spin_cnt, yield_cnt);
+      if (OB_SUCC(ret)) {
+        ObLatchHoldStat::on_lock(this, latch_id);
+      }
     }
   }
   return ret;
@@ -74,6 +74,7 @@ extern bool USE_CO_LATCH;
             ObDiagnoseSessionInfo *dsi = ObDiagnoseSessionInfo::get_local_diagnose_info();   \
             if (NULL != dsi) {                                                               \
               latch_stat.wait_time_ += dsi->get_curr_wait().wait_time_;                      \
+              latch_stat.wait_hist_.inc(dsi->get_curr_wait().wait_time_ * 1000);             \
               if (dsi->get_curr_wait().wait_time_ > 1000 * 1000) {                           \
                 COMMON_LOG_RET(WARN, OB_ERR_TOO_MUCH_TIME, "The Latch wait too much time, ", \
                     K(dsi->get_curr_wait()), KCSTRING(lbt()));                               \
@@ -95,6 +96,47 @@ struct ObLatchWaitMode
   };
 };
 
+// Recent hold time of every latch id, which sizes the spin of the lockers: a locker who has
+// spun about twice the hold time without getting the latch is queued behind other waiters
+// and should park instead of burning cpu. One of SAMPLE_INTERVAL acquisitions of a thread
+// is timed from lock to unlock, the sample also goes to the hold time histogram of the latch.
+class ObLatchHoldStat
+{
+public:
+  static const uint32_t SAMPLE_INTERVAL = 64;
+  static const uint64_t MIN_SPIN_CNT = 16;
+  static const int64_t STALE_SAMPLE_NS = 1000L * 1000L * 1000L;
+  OB_INLINE static void on_lock(const void *latch, const uint32_t latch_id)
+  {
+    if (OB_UNLIKELY(0 == (++sample_.seq_ % SAMPLE_INTERVAL))) {
+      start_sample(latch, latch_id);
+    }
+  }
+  OB_INLINE static void on_unlock(const void *latch)
+  {
+    if (OB_UNLIKELY(latch == sample_.latch_)) {
+      finish_sample();
+    }
+  }
+  // max_spin_cnt_ of the latch bounded by the recent hold time
+  static uint64_t get_spin_cnt(const uint32_t latch_id);
+  static int64_t get_hold_ns(const uint32_t latch_id) { return ATOMIC_LOAD(&hold_ns_[latch_id]); }
+private:
+  struct Sample
+  {
+    const void *latch_;
+    uint32_t latch_id_;
+    uint32_t seq_;
+    int64_t start_ns_;
+  };
+  static void start_sample(const void *latch, const uint32_t latch_id);
+  static void finish_sample();
+  static int64_t get_pause_ns();
+private:
+  static thread_local Sample sample_;
+  static int64_t hold_ns_[ObLatchIds::LATCH_END];
+};
+
 class ObLatchMutex
 {
 public:
@@ -130,10 +172,13 @@ class ObLatch;
 
 struct ObWaitProc : public ObDLinkBase<ObWaitProc>
 {
-  ObWaitProc(ObLatch &latch, const uint32_t wait_mode)
+  ObWaitProc(ObLatch &latch, const uint32_t wait_mode, const uint32_t latch_id, const uint32_t uid)
     : addr_(&latch),
       mode_(wait_mode),
-      wait_(0)
+      wait_(0),
+      latch_id_(latch_id),
+      uid_(uid),
+      granted_(0)
   {
   }
   virtual ~ObWaitProc()
@@ -149,6 +194,10 @@ struct ObWaitProc : public ObDLinkBase<ObWaitProc>
   ObLatch *addr_;
   int32_t mode_;
   volatile int32_t wait_;
+  uint32_t latch_id_;
+  uint32_t uid_;
+  // set by the unlocker of a LATCH_FIFO_HANDOFF latch, the latch is already held by this proc
+  volatile int32_t granted_;
 
 private:
   DISALLOW_COPY_AND_ASSIGN(ObWaitProc);
@@ -191,6 +240,7 @@ private:
     bucket.lock_.unlock();
   }
 
+  bool try_handoff(ObLatch &latch, ObWaitProc &proc, const bool has_wait);
   template<typename LowTryLock>
   int try_lock(
       ObLatchBucket &bucket,
@@ -2038,6 +2038,12 @@ enum ObJsonPartialUpdateFlag
   OB_JSON_PARTIAL_UPDATE_FIRST_EXPR = 1 << 2,
 };
 
+// shares expr extra bits with ObJsonPartialUpdateFlag
+enum ObLobPartialUpdateFlag
+{
+  OB_LOB_PARTIAL_APPEND_ALLOW = 1 << 3,
+};
+
 enum ObDmlType
 {
   OB_DML_UNKNOW = 0,
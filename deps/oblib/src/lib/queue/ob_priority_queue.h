@@ -15,6 +15,7 @@
 
 #include "lib/queue/ob_link_queue.h"
 #include "lib/lock/ob_scond.h"
+#include "lib/thread_local/ob_tsi_utils.h"
 
 namespace oceanbase
 {
@@ -223,6 +224,168 @@ private:
   int64_t limit_ CACHE_ALIGNED;
   DISALLOW_COPY_AND_ASSIGN(ObPriorityQueue2);
 };
+
+// ObShardedPriorityQueue has the same priority levels and interface as ObPriorityQueue2, but
+// requests of each priority are spread over per-core shards instead of one ObLinkQueue, whose
+// push and pop counters are shared by all the producers and consumers.
+//
+// 1. A request is pushed into the shard of the cpu which the producer runs on.
+// 2. A consumer pops from the shard of its own cpu first and steals from the other shards
+//    when it is empty, the priority is strictly kept among all the shards, that is a request
+//    of lower priority is never popped while there is one of higher priority in any shard.
+template <int HIGH_PRIOS, int NORMAL_PRIOS=0, int LOW_PRIOS=0>
+class ObShardedPriorityQueue
+{
+public:
+  enum { PRIO_CNT = HIGH_PRIOS + NORMAL_PRIOS + LOW_PRIOS };
+  enum { SHARD_CNT = 16 };
+
+  ObShardedPriorityQueue() : shards_(), size_(0), limit_(INT64_MAX) {}
+  ~ObShardedPriorityQueue() {}
+
+  void set_limit(int64_t limit) { limit_ = limit; }
+  inline int64_t size() const { return ATOMIC_LOAD(&size_); }
+  int64_t queue_size(const int i) const
+  {
+    int64_t size = 0;
+    if (i >= 0 && i < PRIO_CNT) {
+      for (int64_t shard_idx = 0; shard_idx < SHARD_CNT; shard_idx++) {
+        size += ATOMIC_LOAD(&shards_[shard_idx].size_[i]);
+      }
+    }
+    return size;
+  }
+  int64_t to_string(char *buf, const int64_t buf_len) const
+  {
+    int64_t pos = 0;
+    common::databuff_printf(buf, buf_len, pos, "total_size=%ld ", size());
+    for(int i = 0; i < PRIO_CNT; i++) {
+      common::databuff_printf(buf, buf_len, pos, "queue[%d]=%ld ", i, queue_size(i));
+    }
+    return pos;
+  }
+
+  int push(ObLink* data, int priority)
+  {
+    int ret = OB_SUCCESS;
+    int64_t extra;
+    if (priority < HIGH_PRIOS) {
+      extra = 2048;
+    } else if (priority < NORMAL_PRIOS + HIGH_PRIOS) {
+      extra = 1024;
+    } else {
+      extra = 0;
+    }
+    if (ATOMIC_FAA(&size_, 1) > limit_ + extra) {
+      ret = OB_SIZE_OVERFLOW;
+    } else if (OB_UNLIKELY(NULL == data) || OB_UNLIKELY(priority < 0) || OB_UNLIKELY(priority >= PRIO_CNT)) {
+      ret = OB_INVALID_ARGUMENT;
+      COMMON_LOG(WARN, "push error, invalid argument", KP(data), K(priority));
+    } else {
+      Shard &shard = shards_[home_shard_idx()];
+      if (OB_FAIL(shard.queue_[priority].push(data))) {
+        // do nothing
+      } else {
+        (void)ATOMIC_FAA(&shard.size_[priority], 1);
+        if (priority < HIGH_PRIOS) {
+          cond_.signal(1, 0);
+        } else if (priority < NORMAL_PRIOS + HIGH_PRIOS) {
+          cond_.signal(1, 1);
+        } else {
+          cond_.signal(1, 2);
+        }
+      }
+    }
+
+    if (OB_FAIL(ret)) {
+      (void)ATOMIC_FAA(&size_, -1);
+    }
+    return ret;
+  }
+
+  // @param [out] priority  the priority of the request popped, optional
+  int pop(ObLink*& data, int64_t timeout_us, int *priority = NULL)
+  {
+    return do_pop(data, PRIO_CNT, timeout_us, priority);
+  }
+
+  int pop_normal(ObLink*& data, int64_t timeout_us, int *priority = NULL)
+  {
+    return do_pop(data, HIGH_PRIOS + NORMAL_PRIOS, timeout_us, priority);
+  }
+
+  int pop_high(ObLink*& data, int64_t timeout_us, int *priority = NULL)
+  {
+    return do_pop(data, HIGH_PRIOS, timeout_us, priority);
+  }
+
+private:
+  struct Shard
+  {
+    Shard() : queue_(), size_() {}
+    ObSpLinkQueue queue_[PRIO_CNT];
+    int64_t size_[PRIO_CNT];
+  } CACHE_ALIGNED;
+
+  static inline int64_t home_shard_idx() { return icpu_id() & (SHARD_CNT - 1); }
+
+  inline int try_pop(ObLink*& data, int64_t plimit, int *priority)
+  {
+    int ret = OB_ENTRY_NOT_EXIST;
+    if (ATOMIC_LOAD(&size_) > 0) {
+      const int64_t home_idx = home_shard_idx();
+      for (int i = 0; OB_ENTRY_NOT_EXIST == ret && i < plimit; i++) {
+        // pop from the home shard first, then steal from the others
+        for (int64_t n = 0; OB_ENTRY_NOT_EXIST == ret && n < SHARD_CNT; n++) {
+          Shard &shard = shards_[(home_idx + n) & (SHARD_CNT - 1)];
+          ObLink *p = NULL;
+          if (shard.queue_[i].is_empty()) {
+            // skip empty queue without locking it
+          } else if (OB_SUCCESS == shard.queue_[i].pop(p)) {
+            (void)ATOMIC_FAA(&shard.size_[i], -1);
+            data = p;
+            ret = OB_SUCCESS;
+            if (NULL != priority) {
+              *priority = i;
+            }
+          }
+        }
+      }
+    }
+    return ret;
+  }
+
+  inline int do_pop(ObLink*& data, int64_t plimit, int64_t timeout_us, int *priority)
+  {
+    int ret = OB_ENTRY_NOT_EXIST;
+    if (OB_UNLIKELY(timeout_us < 0)) {
+      ret = OB_INVALID_ARGUMENT;
+      COMMON_LOG(ERROR, "timeout is invalid", K(ret), K(timeout_us));
+    } else {
+      if (plimit <= HIGH_PRIOS) {
+        cond_.prepare(0);
+      } else if (plimit <= NORMAL_PRIOS + HIGH_PRIOS) {
+        cond_.prepare(1);
+      } else {
+        cond_.prepare(2);
+      }
+      ret = try_pop(data, plimit, priority);
+      if (OB_FAIL(ret)) {
+        cond_.wait(timeout_us);
+        data = NULL;
+      } else {
+        (void)ATOMIC_FAA(&size_, -1);
+      }
+    }
+    return ret;
+  }
+
+  SCondTemp<3> cond_;
+  Shard shards_[SHARD_CNT];
+  int64_t size_ CACHE_ALIGNED;
+  int64_t limit_ CACHE_ALIGNED;
+  DISALLOW_COPY_AND_ASSIGN(ObShardedPriorityQueue);
+};
 } // end namespace common
 } // end namespace oceanbase
 
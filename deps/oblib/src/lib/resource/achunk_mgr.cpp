@@ -13,8 +13,10 @@
 #define USING_LOG_PREFIX LIB
 
 #include <new>
+#include <dirent.h>
 #include <stdlib.h>
 #include <sys/mman.h>
+#include <sys/syscall.h>
 #include "lib/resource/achunk_mgr.h"
 #include "lib/utility/utility.h"
 #include "lib/allocator/ob_tc_malloc.h"
@@ -38,6 +40,8 @@ void ObLargePageHelper::set_param(const char *param)
       large_page_type_ = PREFER_LARGE_PAGE;
     } else if (0 == strcasecmp(param, "only")) {
       large_page_type_ = ONLY_LARGE_PAGE;
+    } else if (0 == strcasecmp(param, "transparent")) {
+      large_page_type_ = TRANSPARENT_LARGE_PAGE;
     }
     LOG_INFO("set large page param", K(large_page_type_));
   }
@@ -61,7 +65,8 @@ AChunkMgr &AChunkMgr::instance()
 AChunkMgr::AChunkMgr()
   : limit_(DEFAULT_LIMIT), urgent_(0), hold_(0),
     total_hold_(0), cache_hold_(0), shadow_hold_(0),
-    max_chunk_cache_size_(limit_)
+    max_chunk_cache_size_(limit_), numa_aware_(false), numa_node_cnt_(0),
+    large_page_maps_(0), numa_local_allocs_(0), numa_remote_allocs_(0)
 {
   // only cache normal_chunk or large_chunk
   for (int i = 0; i < ARRAYSIZEOF(slots_); ++i) {
@@ -70,6 +75,50 @@ AChunkMgr::AChunkMgr()
   slots_[HUGE_ACHUNK_INDEX]->set_max_chunk_cache_size(0);
 }
 
+void AChunkMgr::set_numa_aware(const bool numa_aware)
+{
+  int64_t node_cnt = 0;
+  if (numa_aware) {
+    DIR *dir = opendir("/sys/devices/system/node");
+    if (OB_NOT_NULL(dir)) {
+      struct dirent *entry = NULL;
+      while (OB_NOT_NULL(entry = readdir(dir))) {
+        if (0 == strncmp(entry->d_name, "node", 4) && isdigit(entry->d_name[4])) {
+          ++node_cnt;
+        }
+      }
+      closedir(dir);
+    }
+  }
+  numa_aware_ = node_cnt > 1 && node_cnt <= MAX_NUMA_NODE_CNT;
+  numa_node_cnt_ = numa_aware_ ? node_cnt : 0;
+  LOG_INFO("set numa aware chunk", K(numa_aware), K(node_cnt), K(numa_aware_));
+}
+
+int64_t AChunkMgr::get_numa_node()
+{
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (0 != syscall(SYS_getcpu, &cpu, &node, NULL)) {
+    node = 0;
+  }
+  return MIN(node, MAX_NUMA_NODE_CNT - 1);
+}
+
+void AChunkMgr::bind_numa_node(void *ptr, const uint64_t size, const int64_t numa_node)
+{
+  // MPOL_PREFERRED, pages fall back to other nodes when the node is short of memory
+  static const int OB_MPOL_PREFERRED = 1;
+  const unsigned long nodemask = 1UL << numa_node;
+  // the kernel drops the last bit of maxnode, so pass one more than the node count
+  const unsigned long maxnode = numa_node_cnt_ + 1;
+  if (0 != syscall(SYS_mbind, ptr, size, OB_MPOL_PREFERRED, &nodemask, maxnode, 0)) {
+    if (REACH_TIME_INTERVAL(60 * 1000 * 1000)) {
+      LOG_WARN_RET(OB_ERR_SYS, "mbind failed", KP(ptr), K(size), K(numa_node), K(errno));
+    }
+  }
+}
+
 void *AChunkMgr::direct_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow)
 {
   common::ObTimeGuard time_guard(__func__, 1000 * 1000);
@@ -156,6 +205,13 @@ void *AChunkMgr::low_alloc(const uint64_t size, const bool can_use_huge_page, bo
       OB_LIKELY(ObLargePageHelper::ONLY_LARGE_PAGE != large_page_type)) {
     if (MAP_FAILED == (ptr = ::mmap(ptr, size, prot, flags, fd, offset))) {
       ptr = nullptr;
+    } else if (ObLargePageHelper::TRANSPARENT_LARGE_PAGE == large_page_type && can_use_huge_page) {
+#ifdef MADV_HUGEPAGE
+      // chunks are 2M aligned, so the whole chunk can be backed by transparent huge pages
+      if (0 == this->madvise(ptr, size, MADV_HUGEPAGE)) {
+        IGNORE_RETURN ATOMIC_FAA(&large_page_maps_, 1);
+      }
+#endif
     }
   } else {
     if (MAP_FAILED == (ptr = ::mmap(ptr, size, prot, huge_flags, fd, offset))) {
@@ -167,6 +223,9 @@ void *AChunkMgr::low_alloc(const uint64_t size, const bool can_use_huge_page, bo
       }
     } else {
       huge_page_used = huge_flags != flags;
+      if (huge_page_used) {
+        IGNORE_RETURN ATOMIC_FAA(&large_page_maps_, 1);
+      }
     }
   }
   if (ptr && SANITY_ADDR_IN_RANGE(ptr)) {
@@ -206,8 +265,9 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
   const int64_t all_size = aligned(size);
 
   AChunk *chunk = nullptr;
+  const int64_t numa_node = numa_aware_ ? get_numa_node() : -1;
   // Reuse chunk from self-cache
-  if (OB_NOT_NULL(chunk = pop_chunk_with_size(all_size))) {
+  if (OB_NOT_NULL(chunk = pop_chunk_with_size(all_size, numa_node))) {
     int64_t orig_hold_size = chunk->hold();
     bool need_free = false;
     if (hold_size == orig_hold_size) {
@@ -248,8 +308,13 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
       bool hugetlb_used = false;
       void *ptr = direct_alloc(all_size, true, hugetlb_used, SANITY_BOOL_EXPR(true));
       if (ptr != nullptr) {
+        if (numa_node >= 0) {
+          // before the first touch, which faults in the pages
+          bind_numa_node(ptr, all_size, numa_node);
+        }
         chunk = new (ptr) AChunk();
         chunk->is_hugetlb_ = hugetlb_used;
+        chunk->numa_node_ = numa_node >= 0 ? numa_node : 0;
       } else {
         IGNORE_RETURN update_hold(-hold_size, false);
       }
@@ -257,6 +322,9 @@ AChunk *AChunkMgr::alloc_chunk(const uint64_t size, bool high_prio)
   }
   if (OB_NOT_NULL(chunk)) {
     chunk->alloc_bytes_ = size;
+    if (numa_node >= 0) {
+      IGNORE_RETURN ATOMIC_FAA(numa_node == chunk->numa_node_ ? &numa_local_allocs_ : &numa_remote_allocs_, 1);
+    }
     SANITY_UNPOISON(chunk, all_size); // maybe no need?
   } else if (REACH_TIME_INTERVAL(1 * 1000 * 1000)) {
     LOG_DBA_WARN_V2(OB_LIB_ALLOCATE_MEMORY_FAIL, OB_ALLOCATE_MEMORY_FAILED,
@@ -294,6 +362,7 @@ AChunk *AChunkMgr::alloc_co_chunk(const uint64_t size)
   const int64_t all_size = aligned(size);
 
   AChunk *chunk = nullptr;
+  const int64_t numa_node = numa_aware_ ? get_numa_node() : -1;
   bool updated = false;
   for (int i = MAX_LARGE_ACHUNK_INDEX; !updated && i >= 0; --i) {
     while (!(updated = update_hold(hold_size, true)) &&
@@ -310,8 +379,14 @@ AChunk *AChunkMgr::alloc_co_chunk(const uint64_t size)
     bool hugetlb_used = false;
     void *ptr = direct_alloc(all_size, false, hugetlb_used, SANITY_BOOL_EXPR(false));
     if (ptr != nullptr) {
+      if (numa_node >= 0) {
+        // co stacks are touched by the allocating thread only
+        bind_numa_node(ptr, all_size, numa_node);
+        IGNORE_RETURN ATOMIC_FAA(&numa_local_allocs_, 1);
+      }
       chunk = new (ptr) AChunk();
       chunk->is_hugetlb_ = hugetlb_used;
+      chunk->numa_node_ = numa_node >= 0 ? numa_node : 0;
     } else {
       IGNORE_RETURN update_hold(-hold_size, true);
     }
@@ -404,7 +479,7 @@ int64_t AChunkMgr::to_string(char *buf, const int64_t buf_len) const
   ret = databuff_printf(buf, buf_len, pos,
       "[CHUNK_MGR] limit=%'15ld hold=%'15ld total_hold=%'15ld used=%'15ld freelists_hold=%'15ld"
       " total_maps=%'15ld total_unmaps=%'15ld large_maps=%'15ld large_unmaps=%'15ld huge_maps=%'15ld huge_unmaps=%'15ld"
-      " memalign=%d resident_size=%'15ld"
+      " memalign=%d resident_size=%'15ld large_page_maps=%'15ld numa_local_allocs=%'15ld numa_remote_allocs=%'15ld"
 #ifndef ENABLE_SANITY
       " virtual_memory_used=%'15ld\n",
 #else
@@ -412,7 +487,7 @@ int64_t AChunkMgr::to_string(char *buf, const int64_t buf_len) const
 #endif
       limit_, hold_, total_hold_, get_used(), cache_hold_,
       total_maps, total_unmaps, large_maps, large_unmaps, get_maps(HUGE_ACHUNK_INDEX), get_unmaps(HUGE_ACHUNK_INDEX),
-      0, resident_size,
+      0, resident_size, large_page_maps_, numa_local_allocs_, numa_remote_allocs_,
 #ifndef ENABLE_SANITY
       memory_used
 #else
@@ -42,6 +42,7 @@ class AChunkList
 
 public:
   static const int64_t DEFAULT_MAX_CHUNK_CACHE_SIZE = 1L<<30;
+  static const int64_t MAX_NUMA_SCAN_CNT = 16;
   AChunkList(const bool with_mutex = true)
     : max_chunk_cache_size_(DEFAULT_MAX_CHUNK_CACHE_SIZE),
       mutex_(common::ObLatchIds::ALLOC_CHUNK_LOCK),
@@ -91,7 +92,9 @@ public:
     }
     return bret;
   }
-  inline AChunk *pop()
+  // prefer the chunk on numa_node among the first MAX_NUMA_SCAN_CNT chunks,
+  // any chunk is ok if numa_node is negative
+  inline AChunk *pop(const int64_t numa_node = -1)
   {
     AChunk *chunk = NULL;
     if (!OB_ISNULL(header_)) {
@@ -101,6 +104,22 @@ public:
       }
       DEFER(if (with_mutex_) {mutex_.unlock();});
       if (!OB_ISNULL(header_)) {
+        if (numa_node >= 0 && header_->numa_node_ != numa_node) {
+          AChunk *iter = header_->next_;
+          for (int64_t i = 0; iter != header_ && i < MAX_NUMA_SCAN_CNT; ++i, iter = iter->next_) {
+            if (iter->numa_node_ == numa_node) {
+              // make it the header, so that it is removed below
+              iter->prev_->next_ = iter->next_;
+              iter->next_->prev_ = iter->prev_;
+              iter->prev_ = header_->prev_;
+              iter->next_ = header_;
+              iter->prev_->next_ = iter;
+              header_->prev_ = iter;
+              header_ = iter;
+              break;
+            }
+          }
+        }
         chunk = header_;
         hold_ -= chunk->hold();
         pops_++;
@@ -170,7 +189,8 @@ const char *const use_large_pages_confs[] =
 {
   "true",
   "false",
-  "only"
+  "only",
+  "transparent"
 };
 
 class ObLargePageHelper
@@ -180,6 +200,8 @@ public:
   static const int NO_LARGE_PAGE = 0;
   static const int PREFER_LARGE_PAGE = 1;
   static const int ONLY_LARGE_PAGE = 2;
+  // 4K pages advised by MADV_HUGEPAGE, collapsed into transparent huge pages by the kernel
+  static const int TRANSPARENT_LARGE_PAGE = 3;
 public:
   static void set_param(const char *param);
   static int get_type();
@@ -210,6 +232,7 @@ private:
   static constexpr int32_t MIN_LARGE_ACHUNK_INDEX = NORMAL_ACHUNK_INDEX + 1;
   static constexpr int32_t MAX_LARGE_ACHUNK_INDEX = MAX_ACHUNK_INDEX - 1;
   static constexpr int32_t HUGE_ACHUNK_INDEX = MAX_ACHUNK_INDEX;
+  static constexpr int64_t MAX_NUMA_NODE_CNT = 64;
 public:
   static AChunkMgr &instance();
 
@@ -247,6 +270,13 @@ public:
   inline int64_t get_used() const;
   inline int64_t get_freelist_hold() const;
   inline int64_t get_shadow_hold() const { return ATOMIC_LOAD(&shadow_hold_); }
+  // chunks are bound to the numa node of the allocating thread, and the cached
+  // chunks of the same node are preferred, ignored if there is only one node.
+  void set_numa_aware(const bool numa_aware);
+  bool is_numa_aware() const { return numa_aware_; }
+  inline int64_t get_large_page_maps() const { return ATOMIC_LOAD(&large_page_maps_); }
+  inline int64_t get_numa_local_allocs() const { return ATOMIC_LOAD(&numa_local_allocs_); }
+  inline int64_t get_numa_remote_allocs() const { return ATOMIC_LOAD(&numa_remote_allocs_); }
 
   int64_t sync_wash();
 
@@ -259,6 +289,8 @@ private:
   // wrap for mmap
   void *low_alloc(const uint64_t size, const bool can_use_huge_page, bool &huge_page_used, const bool alloc_shadow);
   void low_free(const void *ptr, const uint64_t size);
+  static int64_t get_numa_node();
+  void bind_numa_node(void *ptr, const uint64_t size, const int64_t numa_node);
   int32_t get_chunk_index(const uint64_t size)
   {
     return MIN(HUGE_ACHUNK_INDEX, (size - 1) / INTACT_ACHUNK_SIZE);
@@ -286,19 +318,19 @@ private:
     }
     return bret;
   }
-  AChunk* pop_chunk_with_index(int32_t chunk_index)
+  AChunk* pop_chunk_with_index(int32_t chunk_index, const int64_t numa_node = -1)
   {
-    AChunk *chunk = slots_[chunk_index]->pop();
+    AChunk *chunk = slots_[chunk_index]->pop(numa_node);
     if (OB_NOT_NULL(chunk)) {
       ATOMIC_FAA(&cache_hold_, -chunk->hold());
     }
     return chunk;
   }
 
-  AChunk* pop_chunk_with_size(const uint64_t size)
+  AChunk* pop_chunk_with_size(const uint64_t size, const int64_t numa_node = -1)
   {
     int32_t chunk_index = get_chunk_index(size);
-    return pop_chunk_with_index(chunk_index);
+    return pop_chunk_with_index(chunk_index, numa_node);
   }
 
   AChunk* popall_with_index(int32_t chunk_index, int64_t &hold)
@@ -327,6 +359,11 @@ protected:
   int64_t cache_hold_;
   int64_t shadow_hold_;
   int64_t max_chunk_cache_size_;
+  bool numa_aware_;
+  int64_t numa_node_cnt_;
+  int64_t large_page_maps_;
+  int64_t numa_local_allocs_;
+  int64_t numa_remote_allocs_;
   Slot slots_[MAX_ACHUNK_INDEX + 1];
 }; // end of class AChunkMgr
 
@@ -602,5 +602,282 @@ int ObRoaringBitmap::convert_to_bitmap() {
   return ret;
 }
 
+int ObRoaringBitmapLazyUnion::value_add(uint64_t value)
+{
+  int ret = OB_SUCCESS;
+  uint32_t high32 = static_cast<uint32_t>(value >> 32);
+  bool found = false;
+  int64_t idx = find_bucket_(high32, found);
+  if (!found) {
+    roaring::api::roaring_bitmap_t *bitmap = nullptr;
+    ROARING_TRY_CATCH(bitmap = roaring::api::roaring_bitmap_create());
+    if (OB_FAIL(ret)) {
+    } else if (OB_ISNULL(bitmap)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to create bitmap", K(ret));
+    } else if (OB_FAIL(insert_bucket_(idx, high32, bitmap))) {
+      LOG_WARN("failed to insert bucket", K(ret), K(idx), K(high32));
+      roaring::api::roaring_bitmap_free(bitmap);
+    }
+  }
+  if (OB_SUCC(ret)) {
+    ROARING_TRY_CATCH(roaring::api::roaring_bitmap_add(buckets_.at(idx).bitmap_, static_cast<uint32_t>(value)));
+  }
+  return ret;
+}
+
+int ObRoaringBitmapLazyUnion::value_or(const ObString &rb_bin)
+{
+  int ret = OB_SUCCESS;
+  uint32_t offset = RB_VERSION_SIZE + RB_BIN_TYPE_SIZE;
+  if (rb_bin.length() < offset) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid roaringbitmap binary length", K(ret), K(rb_bin.length()));
+  } else {
+    ObRbBinType bin_type = static_cast<ObRbBinType>(*(rb_bin.ptr() + RB_VERSION_SIZE));
+    switch (bin_type) {
+      case ObRbBinType::EMPTY: {
+        // do nothing
+        break;
+      }
+      case ObRbBinType::SINGLE_32: {
+        uint32_t value_32 = *reinterpret_cast<const uint32_t*>(rb_bin.ptr() + offset);
+        if (OB_FAIL(value_add(static_cast<uint64_t>(value_32)))) {
+          LOG_WARN("failed to add value", K(ret), K(value_32));
+        }
+        break;
+      }
+      case ObRbBinType::SINGLE_64: {
+        uint64_t value_64 = *reinterpret_cast<const uint64_t*>(rb_bin.ptr() + offset);
+        if (OB_FAIL(value_add(value_64))) {
+          LOG_WARN("failed to add value", K(ret), K(value_64));
+        }
+        break;
+      }
+      case ObRbBinType::SET_32: {
+        uint8_t value_count = static_cast<uint8_t>(*(rb_bin.ptr() + offset));
+        offset += RB_VALUE_COUNT_SIZE;
+        for (int i = 0; OB_SUCC(ret) && i < value_count; i++) {
+          uint32_t value_32 = *reinterpret_cast<const uint32_t*>(rb_bin.ptr() + offset);
+          offset += sizeof(uint32_t);
+          if (OB_FAIL(value_add(static_cast<uint64_t>(value_32)))) {
+            LOG_WARN("failed to add value", K(ret), K(value_32));
+          }
+        }
+        break;
+      }
+      case ObRbBinType::SET_64: {
+        uint8_t value_count = static_cast<uint8_t>(*(rb_bin.ptr() + offset));
+        offset += RB_VALUE_COUNT_SIZE;
+        for (int i = 0; OB_SUCC(ret) && i < value_count; i++) {
+          uint64_t value_64 = *reinterpret_cast<const uint64_t*>(rb_bin.ptr() + offset);
+          offset += sizeof(uint64_t);
+          if (OB_FAIL(value_add(value_64))) {
+            LOG_WARN("failed to add value", K(ret), K(value_64));
+          }
+        }
+        break;
+      }
+      case ObRbBinType::BITMAP_32: {
+        size_t read_bytes = 0;
+        if (OB_FAIL(lazy_or_bitmap32_(0, rb_bin.ptr() + offset, rb_bin.length() - offset, read_bytes))) {
+          LOG_WARN("failed to or bitmap", K(ret));
+        }
+        break;
+      }
+      case ObRbBinType::BITMAP_64: {
+        // | buckets | high32[0] | roaring_bitmap[0] | ... |, see ObRoaring64Bin::init
+        uint64_t buckets = 0;
+        size_t read_bytes = offset + sizeof(uint64_t);
+        if (read_bytes > rb_bin.length()) {
+          ret = OB_INVALID_DATA;
+          LOG_WARN("ran out of bytes while reading buckets", K(ret), K(read_bytes), K(rb_bin.length()));
+        } else {
+          buckets = *reinterpret_cast<const uint64_t*>(rb_bin.ptr() + offset);
+        }
+        for (uint64_t bucket = 0; OB_SUCC(ret) && bucket < buckets; ++bucket) {
+          uint32_t high32 = 0;
+          size_t bitmap_bytes = 0;
+          if (read_bytes + sizeof(uint32_t) > rb_bin.length()) {
+            ret = OB_INVALID_DATA;
+            LOG_WARN("ran out of bytes while reading high32", K(ret), K(read_bytes), K(bucket), K(rb_bin.length()));
+          } else if (OB_FALSE_IT(high32 = *reinterpret_cast<const uint32_t*>(rb_bin.ptr() + read_bytes))) {
+          } else if (OB_FALSE_IT(read_bytes += sizeof(uint32_t))) {
+          } else if (OB_FAIL(lazy_or_bitmap32_(high32, rb_bin.ptr() + read_bytes,
+                                               rb_bin.length() - read_bytes, bitmap_bytes))) {
+            LOG_WARN("failed to or bitmap", K(ret), K(bucket), K(high32));
+          } else {
+            read_bytes += bitmap_bytes;
+          }
+        }
+        break;
+      }
+      default: {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("unknown RbBinType", K(ret), K(bin_type));
+        break;
+      }
+    } // end switch
+  }
+  return ret;
+}
+
+int ObRoaringBitmapLazyUnion::serialize(ObStringBuffer &res_buf)
+{
+  int ret = OB_SUCCESS;
+  uint64_t cardinality = 0;
+  if (OB_FAIL(repair_and_get_cardinality_(cardinality))) {
+    LOG_WARN("failed to repair bitmaps", K(ret));
+  } else if (cardinality <= MAX_BITMAP_SET_VALUES) {
+    // small unions are written as EMPTY/SINGLE/SET by ObRoaringBitmap
+    ObRoaringBitmap rb(allocator_);
+    uint32_t values[MAX_BITMAP_SET_VALUES];
+    for (int64_t i = 0; OB_SUCC(ret) && i < buckets_.count(); ++i) {
+      uint64_t bucket_card = roaring::api::roaring_bitmap_get_cardinality(buckets_.at(i).bitmap_);
+      uint64_t high_bits = static_cast<uint64_t>(buckets_.at(i).high32_) << 32;
+      roaring::api::roaring_bitmap_to_uint32_array(buckets_.at(i).bitmap_, values);
+      for (uint64_t j = 0; OB_SUCC(ret) && j < bucket_card; ++j) {
+        if (OB_FAIL(rb.value_add(high_bits | values[j]))) {
+          LOG_WARN("failed to add value", K(ret), K(high_bits), K(values[j]));
+        }
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(rb.serialize(res_buf))) {
+      LOG_WARN("failed to serialize roaringbitmap", K(ret));
+    }
+    rb.set_empty();
+  } else {
+    uint8_t version = BITMAP_VESION_1;
+    ObRbBinType bin_type = ObRbBinType::BITMAP_64;
+    uint64_t buckets = 0;
+    uint64_t serial_size = RB_VERSION_SIZE + RB_BIN_TYPE_SIZE + sizeof(uint64_t);
+    for (int64_t i = 0; OB_SUCC(ret) && i < buckets_.count(); ++i) {
+      if (!roaring::api::roaring_bitmap_is_empty(buckets_.at(i).bitmap_)) {
+        buckets++;
+        ROARING_TRY_CATCH(serial_size += sizeof(uint32_t) + roaring::api::roaring_bitmap_portable_size_in_bytes(buckets_.at(i).bitmap_));
+      }
+    }
+    if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(res_buf.reserve(serial_size))) {
+      LOG_WARN("failed to reserve buffer", K(ret), K(serial_size));
+    } else if (OB_FAIL(res_buf.append(reinterpret_cast<const char*>(&version), RB_VERSION_SIZE))) {
+      LOG_WARN("failed to append version", K(ret));
+    } else if (OB_FAIL(res_buf.append(reinterpret_cast<const char*>(&bin_type), RB_BIN_TYPE_SIZE))) {
+      LOG_WARN("failed to append bin_type", K(ret));
+    } else if (OB_FAIL(res_buf.append(reinterpret_cast<const char*>(&buckets), sizeof(uint64_t)))) {
+      LOG_WARN("failed to append buckets", K(ret));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < buckets_.count(); ++i) {
+      const Bucket &bucket = buckets_.at(i);
+      size_t bitmap_size = 0;
+      if (roaring::api::roaring_bitmap_is_empty(bucket.bitmap_)) {
+      } else if (OB_FAIL(res_buf.append(reinterpret_cast<const char*>(&bucket.high32_), sizeof(uint32_t)))) {
+        LOG_WARN("failed to append high32", K(ret), K(bucket));
+      } else if (OB_FALSE_IT(bitmap_size = roaring::api::roaring_bitmap_portable_size_in_bytes(bucket.bitmap_))) {
+      } else if (bitmap_size != roaring::api::roaring_bitmap_portable_serialize(bucket.bitmap_, res_buf.ptr() + res_buf.length())) {
+        ret = OB_SERIALIZE_ERROR;
+        LOG_WARN("serialize size not match", K(ret), K(bitmap_size));
+      } else if (OB_FAIL(res_buf.set_length(res_buf.length() + bitmap_size))) {
+        LOG_WARN("failed to set buffer length", K(ret));
+      }
+    }
+  }
+  return ret;
+}
+
+void ObRoaringBitmapLazyUnion::reset()
+{
+  for (int64_t i = 0; i < buckets_.count(); ++i) {
+    if (OB_NOT_NULL(buckets_.at(i).bitmap_)) {
+      roaring::api::roaring_bitmap_free(buckets_.at(i).bitmap_);
+    }
+  }
+  buckets_.reset();
+  last_bucket_idx_ = -1;
+}
+
+int64_t ObRoaringBitmapLazyUnion::find_bucket_(uint32_t high32, bool &found)
+{
+  int64_t idx = 0;
+  found = false;
+  if (last_bucket_idx_ >= 0 && buckets_.at(last_bucket_idx_).high32_ == high32) {
+    // values of one group usually share the same high 32 bits
+    idx = last_bucket_idx_;
+    found = true;
+  } else {
+    while (idx < buckets_.count() && buckets_.at(idx).high32_ < high32) {
+      idx++;
+    }
+    if (idx < buckets_.count() && buckets_.at(idx).high32_ == high32) {
+      found = true;
+      last_bucket_idx_ = idx;
+    }
+  }
+  return idx;
+}
+
+int ObRoaringBitmapLazyUnion::insert_bucket_(int64_t idx, uint32_t high32, roaring::api::roaring_bitmap_t *bitmap)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(buckets_.push_back(Bucket(high32, bitmap)))) {
+    LOG_WARN("failed to push back bucket", K(ret), K(high32));
+  } else {
+    for (int64_t i = buckets_.count() - 1; i > idx; --i) {
+      std::swap(buckets_.at(i), buckets_.at(i - 1));
+    }
+    last_bucket_idx_ = idx;
+  }
+  return ret;
+}
+
+int ObRoaringBitmapLazyUnion::lazy_or_bitmap32_(uint32_t high32, const char *buf, size_t buf_len, size_t &read_bytes)
+{
+  int ret = OB_SUCCESS;
+  roaring::api::roaring_bitmap_t *bitmap = nullptr;
+  bool found = false;
+  int64_t idx = 0;
+  ROARING_TRY_CATCH(read_bytes = roaring::api::roaring_bitmap_portable_deserialize_size(buf, buf_len));
+  if (OB_FAIL(ret)) {
+  } else if (read_bytes == 0) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid roaring bitmap binary", K(ret), K(buf_len));
+  } else {
+    ROARING_TRY_CATCH(bitmap = roaring::api::roaring_bitmap_portable_deserialize_safe(buf, read_bytes));
+  }
+  if (OB_FAIL(ret)) {
+  } else if (OB_ISNULL(bitmap)) {
+    ret = OB_DESERIALIZE_ERROR;
+    LOG_WARN("failed to deserialize the bitmap", K(ret));
+  } else if (OB_FALSE_IT(idx = find_bucket_(high32, found))) {
+  } else if (!found) {
+    // the first bitmap of a bucket is taken over as is
+    if (OB_FAIL(insert_bucket_(idx, high32, bitmap))) {
+      LOG_WARN("failed to insert bucket", K(ret), K(idx), K(high32));
+    } else {
+      bitmap = nullptr;
+    }
+  } else {
+    ROARING_TRY_CATCH(roaring::api::roaring_bitmap_lazy_or_inplace(buckets_.at(idx).bitmap_, bitmap, true));
+  }
+  if (OB_NOT_NULL(bitmap)) {
+    roaring::api::roaring_bitmap_free(bitmap);
+  }
+  return ret;
+}
+
+int ObRoaringBitmapLazyUnion::repair_and_get_cardinality_(uint64_t &cardinality)
+{
+  int ret = OB_SUCCESS;
+  cardinality = 0;
+  for (int64_t i = 0; OB_SUCC(ret) && i < buckets_.count(); ++i) {
+    ROARING_TRY_CATCH(roaring::api::roaring_bitmap_repair_after_lazy(buckets_.at(i).bitmap_));
+    if (OB_SUCC(ret)) {
+      cardinality += roaring::api::roaring_bitmap_get_cardinality(buckets_.at(i).bitmap_);
+    }
+  }
+  return ret;
+}
+
 } // namespace common
 } // namespace oceanbase
\ No newline at end of file
@@ -21,6 +21,7 @@
 #include "lib/string/ob_string_buffer.h"
 #include "lib/oblog/ob_log_module.h"
 #include "lib/hash/ob_hashset.h"
+#include "lib/container/ob_se_array.h"
 #include "lib/allocator/page_arena.h"
 
 
@@ -142,6 +143,46 @@ private:
 
 };
 
+// Union accumulator for rb_build_agg/rb_or_agg.
+// Values are kept in 32-bit roaring bitmaps bucketed by the high 32 bits. Bitmap binaries are
+// or-ed into the buckets lazily (container cardinalities are not maintained) without building
+// a roaring64 bitmap for every input, and the buckets are repaired once in serialize().
+class ObRoaringBitmapLazyUnion
+{
+public:
+  struct Bucket
+  {
+    Bucket() : high32_(0), bitmap_(nullptr) {}
+    Bucket(uint32_t high32, roaring::api::roaring_bitmap_t *bitmap) : high32_(high32), bitmap_(bitmap) {}
+    TO_STRING_KV(K_(high32), KP_(bitmap));
+    uint32_t high32_;
+    roaring::api::roaring_bitmap_t *bitmap_;
+  };
+public:
+  ObRoaringBitmapLazyUnion(ObIAllocator *allocator)
+      : allocator_(allocator),
+        buckets_(),
+        last_bucket_idx_(-1) {}
+  virtual ~ObRoaringBitmapLazyUnion() { reset(); }
+
+  int value_add(uint64_t value);
+  int value_or(const ObString &rb_bin);
+  // serialize the union in the same binary format as ObRoaringBitmap::serialize after optimize()
+  int serialize(ObStringBuffer &res_buf);
+  void reset();
+
+private:
+  int64_t find_bucket_(uint32_t high32, bool &found);
+  int insert_bucket_(int64_t idx, uint32_t high32, roaring::api::roaring_bitmap_t *bitmap);
+  int lazy_or_bitmap32_(uint32_t high32, const char *buf, size_t buf_len, size_t &read_bytes);
+  int repair_and_get_cardinality_(uint64_t &cardinality);
+
+private:
+  ObIAllocator* allocator_;
+  ObSEArray<Bucket, 4> buckets_; // sorted by high32_
+  int64_t last_bucket_idx_;
+};
+
 } // namespace common
 } // namespace oceanbase
 
@@ -34,7 +34,9 @@ ObLatchStat::ObLatchStat()
     immediate_gets_(0),
     immediate_misses_(0),
     spin_gets_(0),
-    wait_time_(0)
+    wait_time_(0),
+    hold_hist_(),
+    wait_hist_()
 {
 }
 
@@ -54,6 +56,8 @@ int ObLatchStat::add(const ObLatchStat &other)
   immediate_misses_ += other.immediate_misses_;
   spin_gets_ += other.spin_gets_;
   wait_time_ += other.wait_time_;
+  hold_hist_.add(other.hold_hist_);
+  wait_hist_.add(other.wait_hist_);
   return ret;
 }
 
@@ -70,6 +74,24 @@ void ObLatchStat::reset()
   immediate_misses_ = 0;
   spin_gets_ = 0;
   wait_time_ = 0;
+  hold_hist_.reset();
+  wait_hist_.reset();
+}
+
+int64_t ObLatchTimeHist::to_string(char *buf, const int64_t buf_len) const
+{
+  static const char *BUCKET_NAMES[BUCKET_CNT] = {
+    "<256ns", "<1us", "<4us", "<16us", "<65us", "<262us", "<1ms", "<4ms", "<16ms", ">=16ms"
+  };
+  int64_t pos = 0;
+  bool first = true;
+  for (int64_t i = 0; i < BUCKET_CNT; ++i) {
+    if (0 != buckets_[i]) {
+      (void)databuff_printf(buf, buf_len, pos, "%s%s:%lu", first ? "" : ",", BUCKET_NAMES[i], buckets_[i]);
+      first = false;
+    }
+  }
+  return pos;
 }
 
 /**
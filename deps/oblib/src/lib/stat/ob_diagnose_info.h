@@ -30,6 +30,32 @@ typedef ObStatArray<ObWaitEventStat, WAIT_EVENTS_TOTAL> ObWaitEventStatArray;
 typedef ObStatArray<ObStatEventAddStat, ObStatEventIds::STAT_EVENT_ADD_END> ObStatEventAddStatArray;
 typedef ObStatArray<ObStatEventSetStat, ObStatEventIds::STAT_EVENT_SET_END - ObStatEventIds::STAT_EVENT_ADD_END -1> ObStatEventSetStatArray;
 
+// log4 histogram of nanoseconds, bucket 0 counts [0, 256ns), bucket i counts
+// [256ns * 4^(i-1), 256ns * 4^i), the last bucket counts everything above 16ms.
+struct ObLatchTimeHist
+{
+  static const int64_t BUCKET_CNT = 10;
+  ObLatchTimeHist() { reset(); }
+  void reset() { MEMSET(buckets_, 0, sizeof(buckets_)); }
+  void add(const ObLatchTimeHist &other)
+  {
+    for (int64_t i = 0; i < BUCKET_CNT; ++i) {
+      buckets_[i] += other.buckets_[i];
+    }
+  }
+  void inc(const int64_t ns)
+  {
+    int64_t idx = 0;
+    if (ns >= 256) {
+      idx = (64 - __builtin_clzll(ns) - 9) / 2 + 1;
+    }
+    ++buckets_[idx < BUCKET_CNT ? idx : BUCKET_CNT - 1];
+  }
+  // "<256ns:3,<1us:10,...", empty buckets are skipped
+  int64_t to_string(char *buf, const int64_t buf_len) const;
+  uint64_t buckets_[BUCKET_CNT];
+};
+
 struct ObLatchStat
 {
   ObLatchStat();
@@ -46,6 +72,8 @@ struct ObLatchStat
   uint64_t immediate_misses_;
   uint64_t spin_gets_;
   uint64_t wait_time_;
+  ObLatchTimeHist hold_hist_;
+  ObLatchTimeHist wait_hist_;
 };
 
 struct ObLatchStatArray
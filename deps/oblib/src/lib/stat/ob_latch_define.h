@@ -16,7 +16,8 @@
  * @param def Name of this latch
  * @param id Identifier of an latch ATTENTION: please add id placeholder on master.
  * @param name Name for this latch. Display on virtual table v$event_name
- * @param policy LATCH_READ_PREFER and LATCH_FIFO
+ * @param policy LATCH_READ_PREFER, LATCH_FIFO and LATCH_FIFO_HANDOFF (FIFO, and the unlocker hands the
+ *        latch over to the first waiting writer, for heavily contended latches)
  * @param max_spin_cnt for mutex, spin several times to try to get lock before actually perform an mutex lock.
  * @param max_yield_cnt times of call to sched_yield() instead of perform an mutex lock.
  * @param enable Indicate whether this latch is enabled. Marked it false it you merely need it as an placeholder.
@@ -122,7 +123,7 @@ LATCH_DEF(CLOG_SWITCH_INFO_LOCK, 95, "clog switch_info latch", LATCH_FIFO, 20000
 LATCH_DEF(PARTITION_GROUP_LOCK, 96, "partition group lock", LATCH_FIFO, 2000, 0, false)
 LATCH_DEF(PX_WORKER_LEADER_LOCK, 97, "px worker leader lock", LATCH_FIFO, 2000, 0, true)
 LATCH_DEF(CLOG_IDC_LOCK, 98, "clog idc lock", LATCH_FIFO, 2000, 0, false)
-LATCH_DEF(TABLET_BUCKET_LOCK, 99, "tablet bucket lock", LATCH_FIFO, 2000, 0, true)
+LATCH_DEF(TABLET_BUCKET_LOCK, 99, "tablet bucket lock", LATCH_FIFO_HANDOFF, 2000, 0, true)
 LATCH_DEF(OB_ALLOCATOR_LOCK, 100, "ob allocator lock", LATCH_READ_PREFER, 2000, 0, true)
 LATCH_DEF(BLOCK_ID_GENERATOR_LOCK, 101, "block id generator lock", LATCH_FIFO, 2000, 0, true)
 LATCH_DEF(OB_CONTEXT_LOCK, 102, "ob context lock", LATCH_FIFO, 2000, 0, false)
@@ -414,7 +415,8 @@ struct ObLatchPolicy
   enum ObLatchPolicyEnum
   {
     LATCH_READ_PREFER = 0,
-    LATCH_FIFO
+    LATCH_FIFO,
+    LATCH_FIFO_HANDOFF
   };
 };
 
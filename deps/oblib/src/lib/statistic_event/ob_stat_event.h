@@ -52,6 +52,14 @@ STAT_EVENT_ADD_DEF(REQUEST_QUEUED_COUNT, "REQUEST_QUEUED_COUNT", QUEUE, "REQUEST
 STAT_EVENT_ADD_DEF(REQUEST_ENQUEUE_COUNT, "request enqueue count", ObStatClassIds::QUEUE, 20000, false, true, true)
 STAT_EVENT_ADD_DEF(REQUEST_DEQUEUE_COUNT, "request dequeue count", ObStatClassIds::QUEUE, 20001, false, true, true)
 STAT_EVENT_ADD_DEF(REQUEST_QUEUE_TIME, "request queue time", ObStatClassIds::QUEUE, 20002, false, true, true)
+STAT_EVENT_ADD_DEF(REQUEST_QUICK_QUEUE_DEQUEUE_COUNT, "request quick queue dequeue count", ObStatClassIds::QUEUE, 20003, false, true, true)
+STAT_EVENT_ADD_DEF(REQUEST_QUICK_QUEUE_TIME, "request quick queue time", ObStatClassIds::QUEUE, 20004, false, true, true)
+STAT_EVENT_ADD_DEF(REQUEST_HIGH_QUEUE_DEQUEUE_COUNT, "request high queue dequeue count", ObStatClassIds::QUEUE, 20005, false, true, true)
+STAT_EVENT_ADD_DEF(REQUEST_HIGH_QUEUE_TIME, "request high queue time", ObStatClassIds::QUEUE, 20006, false, true, true)
+STAT_EVENT_ADD_DEF(REQUEST_NORMAL_QUEUE_DEQUEUE_COUNT, "request normal queue dequeue count", ObStatClassIds::QUEUE, 20007, false, true, true)
+STAT_EVENT_ADD_DEF(REQUEST_NORMAL_QUEUE_TIME, "request normal queue time", ObStatClassIds::QUEUE, 20008, false, true, true)
+STAT_EVENT_ADD_DEF(REQUEST_LOW_QUEUE_DEQUEUE_COUNT, "request low queue dequeue count", ObStatClassIds::QUEUE, 20009, false, true, true)
+STAT_EVENT_ADD_DEF(REQUEST_LOW_QUEUE_TIME, "request low queue time", ObStatClassIds::QUEUE, 20010, false, true, true)
 
 // TRANS
 STAT_EVENT_ADD_DEF(TRANS_COMMIT_LOG_SYNC_TIME, "trans commit log sync time", ObStatClassIds::TRANS, 30000, false, true, true)
@@ -650,6 +658,9 @@ STAT_EVENT_SET_DEF(SYSTEM_MEMORY, "effective system memory", ObStatClassIds::RES
 STAT_EVENT_SET_DEF(HIDDEN_SYS_MEMORY, "effective hidden sys memory", ObStatClassIds::RESOURCE, 140016, false, true, true)
 STAT_EVENT_SET_DEF(MAX_SESSION_NUM, "max session num", ObStatClassIds::RESOURCE, 140017, false, true, true)
 STAT_EVENT_SET_DEF(KV_CACHE_HOLD, "kvcache hold", ObStatClassIds::RESOURCE, 140018, false, true, true)
+STAT_EVENT_SET_DEF(MEMORY_LARGE_PAGE_MAPS, "observer memory large page chunk maps", ObStatClassIds::RESOURCE, 140019, false, true, true)
+STAT_EVENT_SET_DEF(MEMORY_NUMA_LOCAL_ALLOCS, "observer memory numa local chunk allocs", ObStatClassIds::RESOURCE, 140020, false, true, true)
+STAT_EVENT_SET_DEF(MEMORY_NUMA_REMOTE_ALLOCS, "observer memory numa remote chunk allocs", ObStatClassIds::RESOURCE, 140021, false, true, true)
 
 //CLOG
 
@@ -692,6 +703,11 @@ STAT_EVENT_SET_DEF(RS_START_SERVICE_TIME, "rootservice start time", ObStatClassI
 STAT_EVENT_SET_DEF(DAS_PARALLEL_TENANT_MEMORY_USAGE, "the memory use of all DAS parallel task", ObStatClassIds::SQL, 230001, false, true, true)
 STAT_EVENT_SET_DEF(DAS_PARALLEL_TENANT_TASK_CNT, "the count of DAS parallel task", ObStatClassIds::SQL, 230002, false, true, true)
 
+// sql workarea
+STAT_EVENT_SET_DEF(SQL_WORKAREA_REDISTRIBUTE_COUNT, "sql workarea redistribute count", ObStatClassIds::SQL, 235001, false, true, true)
+STAT_EVENT_SET_DEF(SQL_WORKAREA_REDISTRIBUTE_GRANT_SIZE, "sql workarea redistribute grant size", ObStatClassIds::SQL, 235002, false, true, true)
+STAT_EVENT_SET_DEF(SQL_WORKAREA_REDISTRIBUTE_RECLAIM_SIZE, "sql workarea redistribute reclaim size", ObStatClassIds::SQL, 235003, false, true, true)
+
 // shared-storage local_cache(start from 245001)
 STAT_EVENT_SET_DEF(SS_MICRO_CACHE_USED_MEM_SIZE, "ss_micro_cache micro_meta used memory size", ObStatClassIds::CACHE, 245001, false, true, true)
 STAT_EVENT_SET_DEF(SS_MICRO_CACHE_ALLOC_DISK_SIZE, "ss_micro_cache total alloc disk size", ObStatClassIds::CACHE, 245002, false, true, true)
@@ -0,0 +1,206 @@
+/**
+ * Copyright (c) 2024 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_VECTOR_DISTANCE_SIMD_H
+#define OB_VECTOR_DISTANCE_SIMD_H
+
+#include <cmath>
+#include "lib/ob_define.h"
+#include "common/ob_target_specific.h"
+
+#if OB_USE_MULTITARGET_CODE
+#include <immintrin.h>
+#endif
+
+namespace oceanbase
+{
+namespace common
+{
+// AVX2 / AVX512 distance kernels of float vectors, the callers dispatch them by
+// is_arch_supported(). The elements are widened and accumulated in double like the scalar
+// loops of share/vector_type, so the results only differ by the summation order. The sums
+// are not checked for overflow here, the callers check the final results instead.
+OB_DECLARE_AVX2_SPECIFIC_CODE(
+OB_INLINE double reduce_add(const __m256d v)
+{
+  __m128d sum = _mm_add_pd(_mm256_castpd256_pd128(v), _mm256_extractf128_pd(v, 1));
+  return _mm_cvtsd_f64(_mm_add_sd(sum, _mm_unpackhi_pd(sum, sum)));
+}
+
+inline double l2_square(const float *a, const float *b, const int64_t len)
+{
+  __m256d sum_lo = _mm256_setzero_pd();
+  __m256d sum_hi = _mm256_setzero_pd();
+  int64_t i = 0;
+  for (; i + 8 <= len; i += 8) {
+    const __m256 diff = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+    const __m256d diff_lo = _mm256_cvtps_pd(_mm256_castps256_ps128(diff));
+    const __m256d diff_hi = _mm256_cvtps_pd(_mm256_extractf128_ps(diff, 1));
+    sum_lo = _mm256_add_pd(sum_lo, _mm256_mul_pd(diff_lo, diff_lo));
+    sum_hi = _mm256_add_pd(sum_hi, _mm256_mul_pd(diff_hi, diff_hi));
+  }
+  double sum = reduce_add(_mm256_add_pd(sum_lo, sum_hi));
+  for (; i < len; ++i) {
+    const double diff = a[i] - b[i];
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+inline double inner_product(const float *a, const float *b, const int64_t len)
+{
+  __m256d sum_lo = _mm256_setzero_pd();
+  __m256d sum_hi = _mm256_setzero_pd();
+  int64_t i = 0;
+  for (; i + 8 <= len; i += 8) {
+    const __m256 va = _mm256_loadu_ps(a + i);
+    const __m256 vb = _mm256_loadu_ps(b + i);
+    sum_lo = _mm256_add_pd(sum_lo, _mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(va)),
+                                                 _mm256_cvtps_pd(_mm256_castps256_ps128(vb))));
+    sum_hi = _mm256_add_pd(sum_hi, _mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(va, 1)),
+                                                 _mm256_cvtps_pd(_mm256_extractf128_ps(vb, 1))));
+  }
+  double sum = reduce_add(_mm256_add_pd(sum_lo, sum_hi));
+  for (; i < len; ++i) {
+    sum += static_cast<double>(a[i]) * b[i];
+  }
+  return sum;
+}
+
+inline double l1_distance(const float *a, const float *b, const int64_t len)
+{
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  __m256d sum_lo = _mm256_setzero_pd();
+  __m256d sum_hi = _mm256_setzero_pd();
+  int64_t i = 0;
+  for (; i + 8 <= len; i += 8) {
+    const __m256 diff = _mm256_andnot_ps(sign_mask, _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    sum_lo = _mm256_add_pd(sum_lo, _mm256_cvtps_pd(_mm256_castps256_ps128(diff)));
+    sum_hi = _mm256_add_pd(sum_hi, _mm256_cvtps_pd(_mm256_extractf128_ps(diff, 1)));
+  }
+  double sum = reduce_add(_mm256_add_pd(sum_lo, sum_hi));
+  for (; i < len; ++i) {
+    sum += fabs(a[i] - b[i]);
+  }
+  return sum;
+}
+
+// inner product and the squared norms of both vectors in one pass
+inline void cosine_calculate(const float *a, const float *b, const int64_t len,
+                             double &ip, double &abs_dist_a, double &abs_dist_b)
+{
+  __m256d sum_ab = _mm256_setzero_pd();
+  __m256d sum_aa = _mm256_setzero_pd();
+  __m256d sum_bb = _mm256_setzero_pd();
+  int64_t i = 0;
+  for (; i + 4 <= len; i += 4) {
+    const __m256d va = _mm256_cvtps_pd(_mm_loadu_ps(a + i));
+    const __m256d vb = _mm256_cvtps_pd(_mm_loadu_ps(b + i));
+    sum_ab = _mm256_add_pd(sum_ab, _mm256_mul_pd(va, vb));
+    sum_aa = _mm256_add_pd(sum_aa, _mm256_mul_pd(va, va));
+    sum_bb = _mm256_add_pd(sum_bb, _mm256_mul_pd(vb, vb));
+  }
+  ip = reduce_add(sum_ab);
+  abs_dist_a = reduce_add(sum_aa);
+  abs_dist_b = reduce_add(sum_bb);
+  for (; i < len; ++i) {
+    ip += static_cast<double>(a[i]) * b[i];
+    abs_dist_a += static_cast<double>(a[i]) * a[i];
+    abs_dist_b += static_cast<double>(b[i]) * b[i];
+  }
+}
+)
+
+OB_DECLARE_AVX512_SPECIFIC_CODE(
+inline double l2_square(const float *a, const float *b, const int64_t len)
+{
+  __m512d sum_lo = _mm512_setzero_pd();
+  __m512d sum_hi = _mm512_setzero_pd();
+  int64_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    const __m512d diff_lo = _mm512_cvtps_pd(_mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i)));
+    const __m512d diff_hi = _mm512_cvtps_pd(_mm256_sub_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8)));
+    sum_lo = _mm512_add_pd(sum_lo, _mm512_mul_pd(diff_lo, diff_lo));
+    sum_hi = _mm512_add_pd(sum_hi, _mm512_mul_pd(diff_hi, diff_hi));
+  }
+  double sum = _mm512_reduce_add_pd(_mm512_add_pd(sum_lo, sum_hi));
+  for (; i < len; ++i) {
+    const double diff = a[i] - b[i];
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+inline double inner_product(const float *a, const float *b, const int64_t len)
+{
+  __m512d sum_lo = _mm512_setzero_pd();
+  __m512d sum_hi = _mm512_setzero_pd();
+  int64_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    sum_lo = _mm512_add_pd(sum_lo, _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(a + i)),
+                                                 _mm512_cvtps_pd(_mm256_loadu_ps(b + i))));
+    sum_hi = _mm512_add_pd(sum_hi, _mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(a + i + 8)),
+                                                 _mm512_cvtps_pd(_mm256_loadu_ps(b + i + 8))));
+  }
+  double sum = _mm512_reduce_add_pd(_mm512_add_pd(sum_lo, sum_hi));
+  for (; i < len; ++i) {
+    sum += static_cast<double>(a[i]) * b[i];
+  }
+  return sum;
+}
+
+inline double l1_distance(const float *a, const float *b, const int64_t len)
+{
+  __m512d sum_lo = _mm512_setzero_pd();
+  __m512d sum_hi = _mm512_setzero_pd();
+  int64_t i = 0;
+  for (; i + 16 <= len; i += 16) {
+    const __m256 diff_lo = _mm256_sub_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i));
+    const __m256 diff_hi = _mm256_sub_ps(_mm256_loadu_ps(a + i + 8), _mm256_loadu_ps(b + i + 8));
+    sum_lo = _mm512_add_pd(sum_lo, _mm512_abs_pd(_mm512_cvtps_pd(diff_lo)));
+    sum_hi = _mm512_add_pd(sum_hi, _mm512_abs_pd(_mm512_cvtps_pd(diff_hi)));
+  }
+  double sum = _mm512_reduce_add_pd(_mm512_add_pd(sum_lo, sum_hi));
+  for (; i < len; ++i) {
+    sum += fabs(a[i] - b[i]);
+  }
+  return sum;
+}
+
+inline void cosine_calculate(const float *a, const float *b, const int64_t len,
+                             double &ip, double &abs_dist_a, double &abs_dist_b)
+{
+  __m512d sum_ab = _mm512_setzero_pd();
+  __m512d sum_aa = _mm512_setzero_pd();
+  __m512d sum_bb = _mm512_setzero_pd();
+  int64_t i = 0;
+  for (; i + 8 <= len; i += 8) {
+    const __m512d va = _mm512_cvtps_pd(_mm256_loadu_ps(a + i));
+    const __m512d vb = _mm512_cvtps_pd(_mm256_loadu_ps(b + i));
+    sum_ab = _mm512_add_pd(sum_ab, _mm512_mul_pd(va, vb));
+    sum_aa = _mm512_add_pd(sum_aa, _mm512_mul_pd(va, va));
+    sum_bb = _mm512_add_pd(sum_bb, _mm512_mul_pd(vb, vb));
+  }
+  ip = _mm512_reduce_add_pd(sum_ab);
+  abs_dist_a = _mm512_reduce_add_pd(sum_aa);
+  abs_dist_b = _mm512_reduce_add_pd(sum_bb);
+  for (; i < len; ++i) {
+    ip += static_cast<double>(a[i]) * b[i];
+    abs_dist_a += static_cast<double>(a[i]) * a[i];
+    abs_dist_b += static_cast<double>(b[i]) * b[i];
+  }
+}
+)
+
+} // common
+} // oceanbase
+#endif
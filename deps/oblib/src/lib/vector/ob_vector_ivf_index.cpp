@@ -0,0 +1,817 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX LIB
+
+#include "lib/vector/ob_vector_ivf_index.h"
+#include <algorithm>
+#include "lib/oblog/ob_log.h"
+#include "lib/ob_errno.h"
+#include "lib/utility/utility.h"
+#include "lib/vector/ob_vector_distance_simd.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+void ObVectorIvfIndex::TopKHeap::push(const float dist, const int64_t vid)
+{
+  if (cnt_ < capacity_) {
+    items_[cnt_].dist_ = dist;
+    items_[cnt_].vid_ = vid;
+    ++cnt_;
+    std::push_heap(items_, items_ + cnt_);
+  } else if (dist < items_[0].dist_) {
+    std::pop_heap(items_, items_ + cnt_);
+    items_[cnt_ - 1].dist_ = dist;
+    items_[cnt_ - 1].vid_ = vid;
+    std::push_heap(items_, items_ + cnt_);
+  }
+}
+
+int64_t ObVectorIvfIndex::TopKHeap::finish()
+{
+  std::sort_heap(items_, items_ + cnt_);
+  return cnt_;
+}
+
+ObVectorIvfIndex::ObVectorIvfIndex(vsag::Allocator *allocator)
+  : is_inited_(false),
+    is_trained_(false),
+    allocator_(allocator),
+    dim_(0),
+    metric_(VIVM_MAX),
+    quantizer_(VQT_MAX),
+    nlist_(0),
+    pq_m_(0),
+    pq_dsub_(0),
+    code_size_(0),
+    total_cnt_(0),
+    centroids_(nullptr),
+    sq8_min_(nullptr),
+    sq8_diff_(nullptr),
+    pq_centroids_(nullptr),
+    lists_(nullptr),
+    pending_cnt_(0),
+    pending_cap_(0),
+    pending_vids_(nullptr),
+    pending_vectors_(nullptr),
+    rand_seed_(0x2545F4914F6CDD1DUL)
+{
+}
+
+int ObVectorIvfIndex::init(const int64_t dim, const ObVectorIvfMetric metric,
+                           const ObVectorQuantizerType quantizer, const int64_t nlist, const int64_t pq_m)
+{
+  int ret = OB_SUCCESS;
+  if (IS_INIT) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret));
+  } else if (OB_ISNULL(allocator_) || dim <= 0 || metric < VIVM_L2 || metric >= VIVM_MAX
+             || quantizer < VQT_FLAT || quantizer >= VQT_MAX || nlist <= 0 || nlist > MAX_NLIST
+             || (VQT_PQ == quantizer && (pq_m <= 0 || dim % pq_m != 0))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP_(allocator), K(dim), K(metric), K(quantizer), K(nlist), K(pq_m));
+  } else {
+    dim_ = dim;
+    metric_ = metric;
+    quantizer_ = quantizer;
+    nlist_ = nlist;
+    if (VQT_FLAT == quantizer) {
+      code_size_ = dim * sizeof(float);
+    } else if (VQT_SQ8 == quantizer) {
+      code_size_ = dim;
+    } else {
+      pq_m_ = pq_m;
+      pq_dsub_ = dim / pq_m;
+      code_size_ = pq_m;
+    }
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+void ObVectorIvfIndex::destroy_trained()
+{
+  if (OB_NOT_NULL(lists_)) {
+    for (int64_t i = 0; i < nlist_; ++i) {
+      free(lists_[i].vids_);
+      free(lists_[i].codes_);
+    }
+    free(lists_);
+    lists_ = nullptr;
+  }
+  free(centroids_);
+  centroids_ = nullptr;
+  free(sq8_min_);
+  sq8_min_ = nullptr;
+  free(sq8_diff_);
+  sq8_diff_ = nullptr;
+  free(pq_centroids_);
+  pq_centroids_ = nullptr;
+  is_trained_ = false;
+}
+
+void ObVectorIvfIndex::reset()
+{
+  destroy_trained();
+  free(pending_vids_);
+  pending_vids_ = nullptr;
+  free(pending_vectors_);
+  pending_vectors_ = nullptr;
+  pending_cnt_ = 0;
+  pending_cap_ = 0;
+  total_cnt_ = 0;
+  dim_ = 0;
+  metric_ = VIVM_MAX;
+  quantizer_ = VQT_MAX;
+  nlist_ = 0;
+  pq_m_ = 0;
+  pq_dsub_ = 0;
+  code_size_ = 0;
+  is_inited_ = false;
+}
+
+void *ObVectorIvfIndex::alloc(const int64_t size) const
+{
+  return size > 0 ? allocator_->Allocate(size) : nullptr;
+}
+
+void ObVectorIvfIndex::free(void *ptr) const
+{
+  if (OB_NOT_NULL(ptr)) {
+    allocator_->Deallocate(ptr);
+  }
+}
+
+uint64_t ObVectorIvfIndex::next_rand()
+{
+  rand_seed_ ^= rand_seed_ << 13;
+  rand_seed_ ^= rand_seed_ >> 7;
+  rand_seed_ ^= rand_seed_ << 17;
+  return rand_seed_;
+}
+
+int ObVectorIvfIndex::reserve(void *&ptr, const int64_t elem_size, const int64_t cnt, const int64_t new_cap)
+{
+  int ret = OB_SUCCESS;
+  void *new_ptr = nullptr;
+  if (OB_ISNULL(new_ptr = alloc(elem_size * new_cap))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc memory", K(ret), K(elem_size), K(new_cap));
+  } else {
+    if (cnt > 0) {
+      MEMCPY(new_ptr, ptr, elem_size * cnt);
+    }
+    free(ptr);
+    ptr = new_ptr;
+  }
+  return ret;
+}
+
+float ObVectorIvfIndex::calc_distance(const ObVectorIvfMetric metric, const float *a, const float *b,
+                                      const int64_t dim)
+{
+  float res = 0;
+#if OB_USE_MULTITARGET_CODE
+  if (is_arch_supported(ObTargetArch::AVX512)) {
+    res = VIVM_IP == metric ? 1 - specific::avx512::inner_product(a, b, dim) : specific::avx512::l2_square(a, b, dim);
+  } else if (is_arch_supported(ObTargetArch::AVX2)) {
+    res = VIVM_IP == metric ? 1 - specific::avx2::inner_product(a, b, dim) : specific::avx2::l2_square(a, b, dim);
+  } else
+#endif
+  if (VIVM_IP == metric) {
+    float ip = 0;
+    for (int64_t i = 0; i < dim; ++i) {
+      ip += a[i] * b[i];
+    }
+    res = 1 - ip;
+  } else {
+    for (int64_t i = 0; i < dim; ++i) {
+      const float diff = a[i] - b[i];
+      res += diff * diff;
+    }
+  }
+  return res;
+}
+
+int ObVectorIvfIndex::add(const float *vectors, const int64_t *vids, const int64_t dim, const int64_t cnt)
+{
+  int ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (dim != dim_ || cnt < 0 || (cnt > 0 && (OB_ISNULL(vectors) || OB_ISNULL(vids)))) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(dim), K_(dim), K(cnt), KP(vectors), KP(vids));
+  } else if (!is_trained_) {
+    if (OB_FAIL(append_pending(vectors, vids, cnt))) {
+      LOG_WARN("failed to append pending vectors", K(ret), K(cnt));
+    }
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < cnt; ++i) {
+      const float *vector = vectors + i * dim_;
+      if (OB_FAIL(append_list(nearest_centroid(vector), vids[i], vector))) {
+        LOG_WARN("failed to append list", K(ret), K(i));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObVectorIvfIndex::append_pending(const float *vectors, const int64_t *vids, const int64_t cnt)
+{
+  int ret = OB_SUCCESS;
+  if (pending_cnt_ + cnt > pending_cap_) {
+    const int64_t new_cap = std::max(std::max(pending_cap_ * 2, pending_cnt_ + cnt), 1024L);
+    void *new_vids = pending_vids_;
+    void *new_vectors = pending_vectors_;
+    if (OB_FAIL(reserve(new_vids, sizeof(int64_t), pending_cnt_, new_cap))) {
+      LOG_WARN("failed to reserve vids", K(ret), K(new_cap));
+    } else if (FALSE_IT(pending_vids_ = static_cast<int64_t *>(new_vids))) {
+    } else if (OB_FAIL(reserve(new_vectors, sizeof(float) * dim_, pending_cnt_, new_cap))) {
+      LOG_WARN("failed to reserve vectors", K(ret), K(new_cap));
+    } else {
+      pending_vectors_ = static_cast<float *>(new_vectors);
+      pending_cap_ = new_cap;
+    }
+  }
+  if (OB_SUCC(ret) && cnt > 0) {
+    MEMCPY(pending_vids_ + pending_cnt_, vids, sizeof(int64_t) * cnt);
+    MEMCPY(pending_vectors_ + pending_cnt_ * dim_, vectors, sizeof(float) * dim_ * cnt);
+    pending_cnt_ += cnt;
+    total_cnt_ += cnt;
+  }
+  return ret;
+}
+
+int ObVectorIvfIndex::append_list(const int64_t list_id, const int64_t vid, const float *vector)
+{
+  int ret = OB_SUCCESS;
+  InvList &list = lists_[list_id];
+  if (list.cnt_ == list.cap_) {
+    const int64_t new_cap = std::max(list.cap_ * 2, 16L);
+    void *new_vids = list.vids_;
+    void *new_codes = list.codes_;
+    if (OB_FAIL(reserve(new_vids, sizeof(int64_t), list.cnt_, new_cap))) {
+      LOG_WARN("failed to reserve vids", K(ret), K(new_cap));
+    } else if (FALSE_IT(list.vids_ = static_cast<int64_t *>(new_vids))) {
+    } else if (OB_FAIL(reserve(new_codes, code_size_, list.cnt_, new_cap))) {
+      LOG_WARN("failed to reserve codes", K(ret), K(new_cap));
+    } else {
+      list.codes_ = static_cast<uint8_t *>(new_codes);
+      list.cap_ = new_cap;
+    }
+  }
+  if (OB_SUCC(ret)) {
+    list.vids_[list.cnt_] = vid;
+    encode(vector, centroids_ + list_id * dim_, list.codes_ + list.cnt_ * code_size_);
+    ++list.cnt_;
+    ++total_cnt_;
+  }
+  return ret;
+}
+
+int64_t ObVectorIvfIndex::nearest_centroid(const float *vector) const
+{
+  int64_t nearest = 0;
+  float min_dist = FLT_MAX;
+  for (int64_t i = 0; i < nlist_; ++i) {
+    const float dist = calc_distance(metric_, vector, centroids_ + i * dim_, dim_);
+    if (dist < min_dist) {
+      min_dist = dist;
+      nearest = i;
+    }
+  }
+  return nearest;
+}
+
+void ObVectorIvfIndex::encode(const float *vector, const float *centroid, uint8_t *code) const
+{
+  if (VQT_FLAT == quantizer_) {
+    MEMCPY(code, vector, code_size_);
+  } else if (VQT_SQ8 == quantizer_) {
+    for (int64_t i = 0; i < dim_; ++i) {
+      float v = sq8_diff_[i] > 0 ? (vector[i] - sq8_min_[i]) / sq8_diff_[i] : 0;
+      v = v < 0 ? 0 : (v > 1 ? 1 : v);
+      code[i] = static_cast<uint8_t>(v * SQ8_LEVEL + 0.5f);
+    }
+  } else {
+    // pq encodes the residual to the list centroid
+    for (int64_t m = 0; m < pq_m_; ++m) {
+      const float *sub = vector + m * pq_dsub_;
+      const float *sub_centroid = centroid + m * pq_dsub_;
+      const float *sub_codebook = pq_centroids_ + m * PQ_KSUB * pq_dsub_;
+      int64_t nearest = 0;
+      float min_dist = FLT_MAX;
+      for (int64_t j = 0; j < PQ_KSUB; ++j) {
+        const float *codeword = sub_codebook + j * pq_dsub_;
+        float dist = 0;
+        for (int64_t d = 0; d < pq_dsub_; ++d) {
+          const float diff = sub[d] - sub_centroid[d] - codeword[d];
+          dist += diff * diff;
+        }
+        if (dist < min_dist) {
+          min_dist = dist;
+          nearest = j;
+        }
+      }
+      code[m] = static_cast<uint8_t>(nearest);
+    }
+  }
+}
+
+void ObVectorIvfIndex::build_pq_lut(const float *query, const float *centroid, float *pq_lut) const
+{
+  // l2: |q - c - r|^2 is the sum of the sub space distances of q - c to the residual codewords
+  // ip: q * (c + r) = q * c + the sum of the sub space inner products of q and the codewords
+  for (int64_t m = 0; m < pq_m_; ++m) {
+    const float *sub = query + m * pq_dsub_;
+    const float *sub_codebook = pq_centroids_ + m * PQ_KSUB * pq_dsub_;
+    for (int64_t j = 0; j < PQ_KSUB; ++j) {
+      const float *codeword = sub_codebook + j * pq_dsub_;
+      float v = 0;
+      if (VIVM_IP == metric_) {
+        for (int64_t d = 0; d < pq_dsub_; ++d) {
+          v += sub[d] * codeword[d];
+        }
+      } else {
+        const float *sub_centroid = centroid + m * pq_dsub_;
+        for (int64_t d = 0; d < pq_dsub_; ++d) {
+          const float diff = sub[d] - sub_centroid[d] - codeword[d];
+          v += diff * diff;
+        }
+      }
+      pq_lut[m * PQ_KSUB + j] = v;
+    }
+  }
+}
+
+float ObVectorIvfIndex::code_distance(const float *query, const float *pq_lut, const float pq_base,
+                                      const uint8_t *code) const
+{
+  float res = 0;
+  if (VQT_FLAT == quantizer_) {
+    res = calc_distance(metric_, query, reinterpret_cast<const float *>(code), dim_);
+  } else if (VQT_SQ8 == quantizer_) {
+    float acc = 0;
+    for (int64_t i = 0; i < dim_; ++i) {
+      const float v = sq8_min_[i] + code[i] * sq8_diff_[i] / SQ8_LEVEL;
+      if (VIVM_IP == metric_) {
+        acc += query[i] * v;
+      } else {
+        acc += (query[i] - v) * (query[i] - v);
+      }
+    }
+    res = VIVM_IP == metric_ ? 1 - acc : acc;
+  } else {
+    float acc = 0;
+    for (int64_t m = 0; m < pq_m_; ++m) {
+      acc += pq_lut[m * PQ_KSUB + code[m]];
+    }
+    res = VIVM_IP == metric_ ? 1 - (pq_base + acc) : acc;
+  }
+  return res;
+}
+
+int ObVectorIvfIndex::kmeans(const float *data, const int64_t n, const int64_t dim, const int64_t stride,
+                             const int64_t k, float *centroids)
+{
+  int ret = OB_SUCCESS;
+  static const float SPLIT_EPS = 1.0f / 1024;
+  int64_t *assign = nullptr;
+  int64_t *counts = nullptr;
+  float *sums = nullptr;
+  if (OB_UNLIKELY(k <= 0 || k > n)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), K(n), K(k));
+  } else if (OB_ISNULL(assign = static_cast<int64_t *>(alloc(sizeof(int64_t) * n)))
+             || OB_ISNULL(counts = static_cast<int64_t *>(alloc(sizeof(int64_t) * k)))
+             || OB_ISNULL(sums = static_cast<float *>(alloc(sizeof(float) * k * dim)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc kmeans buffer", K(ret), K(n), K(k), K(dim));
+  } else {
+    // pick k distinct points as the initial centroids by a partial shuffle
+    for (int64_t i = 0; i < n; ++i) {
+      assign[i] = i;
+    }
+    for (int64_t i = 0; i < k; ++i) {
+      const int64_t j = i + next_rand() % (n - i);
+      std::swap(assign[i], assign[j]);
+      MEMCPY(centroids + i * dim, data + assign[i] * stride, sizeof(float) * dim);
+    }
+    for (int64_t iter = 0; iter < KMEANS_ITER_CNT; ++iter) {
+      MEMSET(counts, 0, sizeof(int64_t) * k);
+      MEMSET(sums, 0, sizeof(float) * k * dim);
+      for (int64_t i = 0; i < n; ++i) {
+        const float *point = data + i * stride;
+        int64_t nearest = 0;
+        float min_dist = FLT_MAX;
+        for (int64_t c = 0; c < k; ++c) {
+          const float dist = calc_distance(VIVM_L2, point, centroids + c * dim, dim);
+          if (dist < min_dist) {
+            min_dist = dist;
+            nearest = c;
+          }
+        }
+        assign[i] = nearest;
+        ++counts[nearest];
+        float *sum = sums + nearest * dim;
+        for (int64_t d = 0; d < dim; ++d) {
+          sum[d] += point[d];
+        }
+      }
+      for (int64_t c = 0; c < k; ++c) {
+        if (counts[c] > 0) {
+          for (int64_t d = 0; d < dim; ++d) {
+            centroids[c * dim + d] = sums[c * dim + d] / counts[c];
+          }
+        }
+      }
+      // split the largest cluster into the empty ones
+      for (int64_t c = 0; c < k; ++c) {
+        if (0 == counts[c]) {
+          int64_t largest = 0;
+          for (int64_t l = 1; l < k; ++l) {
+            if (counts[l] > counts[largest]) {
+              largest = l;
+            }
+          }
+          for (int64_t d = 0; d < dim; ++d) {
+            const float v = centroids[largest * dim + d];
+            centroids[c * dim + d] = v * (1 + ((d & 1) ? SPLIT_EPS : -SPLIT_EPS));
+            centroids[largest * dim + d] = v * (1 + ((d & 1) ? -SPLIT_EPS : SPLIT_EPS));
+          }
+          counts[c] = counts[largest] / 2;
+          counts[largest] -= counts[c];
+        }
+      }
+    }
+  }
+  free(assign);
+  free(counts);
+  free(sums);
+  return ret;
+}
+
+int ObVectorIvfIndex::train_sq8(const float *data, const int64_t n)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(sq8_min_ = static_cast<float *>(alloc(sizeof(float) * dim_)))
+      || OB_ISNULL(sq8_diff_ = static_cast<float *>(alloc(sizeof(float) * dim_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc sq8 range", K(ret), K_(dim));
+  } else {
+    for (int64_t d = 0; d < dim_; ++d) {
+      float min_val = FLT_MAX;
+      float max_val = -FLT_MAX;
+      for (int64_t i = 0; i < n; ++i) {
+        const float v = data[i * dim_ + d];
+        min_val = std::min(min_val, v);
+        max_val = std::max(max_val, v);
+      }
+      sq8_min_[d] = min_val;
+      sq8_diff_[d] = max_val - min_val;
+    }
+  }
+  return ret;
+}
+
+int ObVectorIvfIndex::train_pq(const float *data, const int64_t n)
+{
+  int ret = OB_SUCCESS;
+  const int64_t ksub = std::min(n, PQ_KSUB);
+  if (OB_ISNULL(pq_centroids_ = static_cast<float *>(alloc(sizeof(float) * pq_m_ * PQ_KSUB * pq_dsub_)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc pq centroids", K(ret), K_(pq_m), K_(pq_dsub));
+  }
+  for (int64_t m = 0; OB_SUCC(ret) && m < pq_m_; ++m) {
+    float *sub_centroids = pq_centroids_ + m * PQ_KSUB * pq_dsub_;
+    if (OB_FAIL(kmeans(data + m * pq_dsub_, n, pq_dsub_, dim_, ksub, sub_centroids))) {
+      LOG_WARN("failed to train pq sub space", K(ret), K(m), K(n));
+    } else {
+      // too few samples, the codes beyond ksub repeat the trained centroids and are never chosen
+      for (int64_t j = ksub; j < PQ_KSUB; ++j) {
+        MEMCPY(sub_centroids + j * pq_dsub_, sub_centroids + (j % ksub) * pq_dsub_, sizeof(float) * pq_dsub_);
+      }
+    }
+  }
+  return ret;
+}
+
+int ObVectorIvfIndex::train()
+{
+  int ret = OB_SUCCESS;
+  float *samples = nullptr;
+  int64_t *sample_idxes = nullptr;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (is_trained_ || 0 == pending_cnt_) {
+    // nothing to train on
+  } else {
+    const int64_t n = pending_cnt_;
+    const int64_t nlist = std::min(nlist_, n);
+    const int64_t sample_per_centroid = VQT_PQ == quantizer_ ? std::max(nlist, PQ_KSUB) : nlist;
+    const int64_t sample_cnt = std::min(n, sample_per_centroid * TRAIN_POINTS_PER_CENTROID);
+    if (OB_ISNULL(samples = static_cast<float *>(alloc(sizeof(float) * sample_cnt * dim_)))
+        || OB_ISNULL(sample_idxes = static_cast<int64_t *>(alloc(sizeof(int64_t) * n)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc samples", K(ret), K(sample_cnt), K_(dim));
+    } else {
+      for (int64_t i = 0; i < n; ++i) {
+        sample_idxes[i] = i;
+      }
+      for (int64_t i = 0; i < sample_cnt; ++i) {
+        const int64_t j = i + next_rand() % (n - i);
+        std::swap(sample_idxes[i], sample_idxes[j]);
+        MEMCPY(samples + i * dim_, pending_vectors_ + sample_idxes[i] * dim_, sizeof(float) * dim_);
+      }
+      nlist_ = nlist;
+      if (OB_ISNULL(centroids_ = static_cast<float *>(alloc(sizeof(float) * nlist_ * dim_)))
+          || OB_ISNULL(lists_ = static_cast<InvList *>(alloc(sizeof(InvList) * nlist_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc centroids", K(ret), K_(nlist), K_(dim));
+      } else if (FALSE_IT(MEMSET(lists_, 0, sizeof(InvList) * nlist_))) {
+      } else if (OB_FAIL(kmeans(samples, sample_cnt, dim_, dim_, nlist_, centroids_))) {
+        LOG_WARN("failed to train centroids", K(ret), K(sample_cnt), K_(nlist));
+      } else if (VQT_SQ8 == quantizer_ && OB_FAIL(train_sq8(samples, sample_cnt))) {
+        LOG_WARN("failed to train sq8", K(ret), K(sample_cnt));
+      } else if (VQT_PQ == quantizer_) {
+        for (int64_t i = 0; i < sample_cnt; ++i) {
+          float *sample = samples + i * dim_;
+          const float *centroid = centroids_ + nearest_centroid(sample) * dim_;
+          for (int64_t d = 0; d < dim_; ++d) {
+            sample[d] -= centroid[d];
+          }
+        }
+        if (OB_FAIL(train_pq(samples, sample_cnt))) {
+          LOG_WARN("failed to train pq", K(ret), K(sample_cnt));
+        }
+      }
+      if (OB_FAIL(ret)) {
+      } else {
+        total_cnt_ -= n;
+        for (int64_t i = 0; OB_SUCC(ret) && i < n; ++i) {
+          const float *vector = pending_vectors_ + i * dim_;
+          if (OB_FAIL(append_list(nearest_centroid(vector), pending_vids_[i], vector))) {
+            LOG_WARN("failed to append list", K(ret), K(i));
+          }
+        }
+        if (OB_FAIL(ret)) {
+          total_cnt_ = n;
+        }
+      }
+      if (OB_SUCC(ret)) {
+        is_trained_ = true;
+        free(pending_vids_);
+        pending_vids_ = nullptr;
+        free(pending_vectors_);
+        pending_vectors_ = nullptr;
+        pending_cnt_ = 0;
+        pending_cap_ = 0;
+        LOG_INFO("train ivf index", KPC(this), "memory_usage", get_memory_usage());
+      } else {
+        // keep the vectors pending, they are still searchable
+        destroy_trained();
+      }
+    }
+  }
+  free(samples);
+  free(sample_idxes);
+  return ret;
+}
+
+int ObVectorIvfIndex::search(const float *query, const int64_t dim, const int64_t topk, const int64_t nprobe,
+                             const roaring::api::roaring64_bitmap_t *skip_bitmap,
+                             float *distances, int64_t *vids, int64_t &result_cnt) const
+{
+  int ret = OB_SUCCESS;
+  Candidate *items = nullptr;
+  Candidate *probes = nullptr;
+  float *pq_lut = nullptr;
+  result_cnt = 0;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_ISNULL(query) || dim != dim_ || topk <= 0 || OB_ISNULL(distances) || OB_ISNULL(vids)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid argument", K(ret), KP(query), K(dim), K_(dim), K(topk), KP(distances), KP(vids));
+  } else if (OB_ISNULL(items = static_cast<Candidate *>(alloc(sizeof(Candidate) * topk)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc candidates", K(ret), K(topk));
+  } else {
+    TopKHeap heap(items, topk);
+    for (int64_t i = 0; i < pending_cnt_; ++i) {
+      if (OB_ISNULL(skip_bitmap) || !roaring::api::roaring64_bitmap_contains(skip_bitmap, pending_vids_[i])) {
+        heap.push(calc_distance(metric_, query, pending_vectors_ + i * dim_, dim_), pending_vids_[i]);
+      }
+    }
+    if (is_trained_) {
+      const int64_t probe_cnt = std::min(std::max(nprobe, 1L), nlist_);
+      if (OB_ISNULL(probes = static_cast<Candidate *>(alloc(sizeof(Candidate) * nlist_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc probes", K(ret), K_(nlist));
+      } else if (VQT_PQ == quantizer_
+                 && OB_ISNULL(pq_lut = static_cast<float *>(alloc(sizeof(float) * pq_m_ * PQ_KSUB)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc pq lookup table", K(ret), K_(pq_m));
+      } else {
+        for (int64_t i = 0; i < nlist_; ++i) {
+          probes[i].dist_ = calc_distance(metric_, query, centroids_ + i * dim_, dim_);
+          probes[i].vid_ = i;
+        }
+        std::partial_sort(probes, probes + probe_cnt, probes + nlist_);
+        if (OB_NOT_NULL(pq_lut) && VIVM_IP == metric_) {
+          build_pq_lut(query, nullptr, pq_lut);
+        }
+        for (int64_t p = 0; p < probe_cnt; ++p) {
+          const int64_t list_id = probes[p].vid_;
+          const InvList &list = lists_[list_id];
+          // the inner product of the query and the list centroid
+          const float pq_base = 1 - probes[p].dist_;
+          if (OB_NOT_NULL(pq_lut) && VIVM_L2 == metric_ && list.cnt_ > 0) {
+            build_pq_lut(query, centroids_ + list_id * dim_, pq_lut);
+          }
+          for (int64_t i = 0; i < list.cnt_; ++i) {
+            if (OB_ISNULL(skip_bitmap) || !roaring::api::roaring64_bitmap_contains(skip_bitmap, list.vids_[i])) {
+              heap.push(code_distance(query, pq_lut, pq_base, list.codes_ + i * code_size_), list.vids_[i]);
+            }
+          }
+        }
+      }
+    }
+    if (OB_SUCC(ret)) {
+      result_cnt = heap.finish();
+      for (int64_t i = 0; i < result_cnt; ++i) {
+        distances[i] = items[i].dist_;
+        vids[i] = items[i].vid_;
+      }
+    }
+  }
+  free(items);
+  free(probes);
+  free(pq_lut);
+  return ret;
+}
+
+int64_t ObVectorIvfIndex::get_memory_usage() const
+{
+  int64_t size = pending_cap_ * (sizeof(int64_t) + sizeof(float) * dim_);
+  if (is_trained_) {
+    size += sizeof(float) * nlist_ * dim_ + sizeof(InvList) * nlist_;
+    if (VQT_SQ8 == quantizer_) {
+      size += sizeof(float) * dim_ * 2;
+    } else if (VQT_PQ == quantizer_) {
+      size += sizeof(float) * pq_m_ * PQ_KSUB * pq_dsub_;
+    }
+    for (int64_t i = 0; i < nlist_; ++i) {
+      size += lists_[i].cap_ * (sizeof(int64_t) + code_size_);
+    }
+  }
+  return size;
+}
+
+int ObVectorIvfIndex::write_buf(std::ostream &out, const void *buf, const int64_t size) const
+{
+  int ret = OB_SUCCESS;
+  if (size > 0 && !out.write(static_cast<const char *>(buf), size).good()) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to write ivf index", K(ret), K(size));
+  }
+  return ret;
+}
+
+int ObVectorIvfIndex::read_buf(std::istream &in, void *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  if (size > 0 && in.read(static_cast<char *>(buf), size).gcount() != size) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("failed to read ivf index", K(ret), K(size));
+  }
+  return ret;
+}
+
+int ObVectorIvfIndex::serialize(std::ostream &out) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t header[] = { MAGIC, VERSION, dim_, metric_, quantizer_, nlist_, pq_m_,
+                             is_trained_, total_cnt_, pending_cnt_ };
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("not init", K(ret));
+  } else if (OB_FAIL(write_buf(out, header, sizeof(header)))) {
+  } else if (OB_FAIL(write_buf(out, pending_vids_, sizeof(int64_t) * pending_cnt_))) {
+  } else if (OB_FAIL(write_buf(out, pending_vectors_, sizeof(float) * dim_ * pending_cnt_))) {
+  } else if (!is_trained_) {
+  } else if (OB_FAIL(write_buf(out, centroids_, sizeof(float) * nlist_ * dim_))) {
+  } else if (VQT_SQ8 == quantizer_ && (OB_FAIL(write_buf(out, sq8_min_, sizeof(float) * dim_))
+                                       || OB_FAIL(write_buf(out, sq8_diff_, sizeof(float) * dim_)))) {
+  } else if (VQT_PQ == quantizer_
+             && OB_FAIL(write_buf(out, pq_centroids_, sizeof(float) * pq_m_ * PQ_KSUB * pq_dsub_))) {
+  } else {
+    for (int64_t i = 0; OB_SUCC(ret) && i < nlist_; ++i) {
+      const InvList &list = lists_[i];
+      if (OB_FAIL(write_buf(out, &list.cnt_, sizeof(list.cnt_)))) {
+      } else if (OB_FAIL(write_buf(out, list.vids_, sizeof(int64_t) * list.cnt_))) {
+      } else if (OB_FAIL(write_buf(out, list.codes_, code_size_ * list.cnt_))) {
+      }
+    }
+  }
+  return ret;
+}
+
+int ObVectorIvfIndex::deserialize(std::istream &in)
+{
+  int ret = OB_SUCCESS;
+  int64_t header[10];
+  reset();
+  if (OB_FAIL(read_buf(in, header, sizeof(header)))) {
+  } else if (MAGIC != header[0] || VERSION != header[1]) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid ivf index header", K(ret), K(header[0]), K(header[1]));
+  } else if (OB_FAIL(init(header[2], static_cast<ObVectorIvfMetric>(header[3]),
+                          static_cast<ObVectorQuantizerType>(header[4]), header[5], header[6]))) {
+    LOG_WARN("failed to init ivf index", K(ret));
+  } else {
+    const bool is_trained = header[7];
+    const int64_t total_cnt = header[8];
+    const int64_t pending_cnt = header[9];
+    void *buf = nullptr;
+    if (pending_cnt > 0) {
+      if (OB_FAIL(reserve(buf, sizeof(int64_t), 0, pending_cnt))) {
+      } else if (FALSE_IT(pending_vids_ = static_cast<int64_t *>(buf))) {
+      } else if (FALSE_IT(buf = nullptr)) {
+      } else if (OB_FAIL(reserve(buf, sizeof(float) * dim_, 0, pending_cnt))) {
+      } else if (FALSE_IT(pending_vectors_ = static_cast<float *>(buf))) {
+      } else if (FALSE_IT(pending_cap_ = pending_cnt)) {
+      } else if (OB_FAIL(read_buf(in, pending_vids_, sizeof(int64_t) * pending_cnt))) {
+      } else if (OB_FAIL(read_buf(in, pending_vectors_, sizeof(float) * dim_ * pending_cnt))) {
+      } else {
+        pending_cnt_ = pending_cnt;
+      }
+    }
+    if (OB_FAIL(ret) || !is_trained) {
+    } else if (OB_ISNULL(centroids_ = static_cast<float *>(alloc(sizeof(float) * nlist_ * dim_)))
+               || OB_ISNULL(lists_ = static_cast<InvList *>(alloc(sizeof(InvList) * nlist_)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to alloc centroids", K(ret), K_(nlist), K_(dim));
+    } else if (FALSE_IT(MEMSET(lists_, 0, sizeof(InvList) * nlist_))) {
+    } else if (OB_FAIL(read_buf(in, centroids_, sizeof(float) * nlist_ * dim_))) {
+    } else if (VQT_SQ8 == quantizer_) {
+      if (OB_ISNULL(sq8_min_ = static_cast<float *>(alloc(sizeof(float) * dim_)))
+          || OB_ISNULL(sq8_diff_ = static_cast<float *>(alloc(sizeof(float) * dim_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc sq8 range", K(ret), K_(dim));
+      } else if (OB_FAIL(read_buf(in, sq8_min_, sizeof(float) * dim_))) {
+      } else if (OB_FAIL(read_buf(in, sq8_diff_, sizeof(float) * dim_))) {
+      }
+    } else if (VQT_PQ == quantizer_) {
+      if (OB_ISNULL(pq_centroids_ = static_cast<float *>(alloc(sizeof(float) * pq_m_ * PQ_KSUB * pq_dsub_)))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("failed to alloc pq centroids", K(ret), K_(pq_m), K_(pq_dsub));
+      } else if (OB_FAIL(read_buf(in, pq_centroids_, sizeof(float) * pq_m_ * PQ_KSUB * pq_dsub_))) {
+      }
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && is_trained && i < nlist_; ++i) {
+      InvList &list = lists_[i];
+      int64_t cnt = 0;
+      buf = nullptr;
+      if (OB_FAIL(read_buf(in, &cnt, sizeof(cnt)))) {
+      } else if (cnt <= 0) {
+      } else if (OB_FAIL(reserve(buf, sizeof(int64_t), 0, cnt))) {
+      } else if (FALSE_IT(list.vids_ = static_cast<int64_t *>(buf))) {
+      } else if (FALSE_IT(buf = nullptr)) {
+      } else if (OB_FAIL(reserve(buf, code_size_, 0, cnt))) {
+      } else if (FALSE_IT(list.codes_ = static_cast<uint8_t *>(buf))) {
+      } else if (FALSE_IT(list.cap_ = cnt)) {
+      } else if (OB_FAIL(read_buf(in, list.vids_, sizeof(int64_t) * cnt))) {
+      } else if (OB_FAIL(read_buf(in, list.codes_, code_size_ * cnt))) {
+      } else {
+        list.cnt_ = cnt;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      is_trained_ = is_trained;
+      total_cnt_ = total_cnt;
+    }
+  }
+  if (OB_FAIL(ret)) {
+    LOG_WARN("failed to deserialize ivf index", K(ret));
+    reset();
+  }
+  return ret;
+}
+
+} // namespace common
+} // namespace oceanbase
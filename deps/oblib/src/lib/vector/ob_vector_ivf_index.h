@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OB_VECTOR_IVF_INDEX_H
+#define OB_VECTOR_IVF_INDEX_H
+
+#include <stdint.h>
+#include <float.h>
+#include <iostream>
+#include <vsag/allocator.h>
+#include "roaring/roaring64.h"
+#include "lib/utility/ob_print_utils.h"
+
+namespace oceanbase
+{
+namespace common
+{
+
+enum ObVectorIvfMetric
+{
+  VIVM_L2 = 0, // squared euclidean distance
+  VIVM_IP = 1, // 1 - inner product, the same as vsag
+  VIVM_MAX
+};
+
+// how the vectors are stored in the inverted lists
+enum ObVectorQuantizerType
+{
+  VQT_FLAT = 0, // full precision float
+  VQT_SQ8 = 1,  // one byte per dimension, scaled by the per dimension value range
+  VQT_PQ = 2,   // one byte per sub space, the id of the nearest sub space centroid
+  VQT_MAX
+};
+
+// ObVectorIvfIndex is an in memory IVF index. The vectors are partitioned into nlist inverted
+// lists by k-means centroids, and a query only scans the nprobe lists whose centroids are the
+// nearest to it. The vectors of the lists are kept flat, or quantized by SQ8 or PQ to cut the
+// memory footprint, in which case the distances are approximate and the caller is expected to
+// re-rank a larger candidate set against the full vectors.
+//
+// The centroids and the quantizer need the data to be trained on. Vectors added before train()
+// are kept as full floats and searched exhaustively, train() moves them into the lists. Vectors
+// added after train() are encoded and appended to the list of their nearest centroid at once.
+// All the memory is taken from the vsag allocator, so it is charged like the hnsw indexes.
+// The index is not thread safe, the caller protects it with a rwlock.
+class ObVectorIvfIndex
+{
+public:
+  static const int64_t PQ_KSUB = 256;
+  static const int64_t SQ8_LEVEL = 255;
+  static const int64_t KMEANS_ITER_CNT = 10;
+  static const int64_t TRAIN_POINTS_PER_CENTROID = 64;
+  static const int64_t MAX_NLIST = 65536;
+  explicit ObVectorIvfIndex(vsag::Allocator *allocator);
+  ~ObVectorIvfIndex() { reset(); }
+  int init(const int64_t dim, const ObVectorIvfMetric metric, const ObVectorQuantizerType quantizer,
+           const int64_t nlist, const int64_t pq_m);
+  void reset();
+  int add(const float *vectors, const int64_t *vids, const int64_t dim, const int64_t cnt);
+  // train the centroids and the quantizer on the vectors added so far, do nothing if trained
+  int train();
+  // @skip_bitmap: vids not to return, may be null
+  // @distances and @vids must hold @topk elements, the results are sorted by distance
+  int search(const float *query, const int64_t dim, const int64_t topk, const int64_t nprobe,
+             const roaring::api::roaring64_bitmap_t *skip_bitmap,
+             float *distances, int64_t *vids, int64_t &result_cnt) const;
+  int serialize(std::ostream &out) const;
+  int deserialize(std::istream &in);
+  OB_INLINE bool is_inited() const { return is_inited_; }
+  OB_INLINE bool is_trained() const { return is_trained_; }
+  OB_INLINE int64_t get_count() const { return total_cnt_; }
+  OB_INLINE int64_t get_dim() const { return dim_; }
+  OB_INLINE int64_t get_code_size() const { return code_size_; }
+  // bytes held by the centroids, the quantizer, the lists and the untrained vectors
+  int64_t get_memory_usage() const;
+  static float calc_distance(const ObVectorIvfMetric metric, const float *a, const float *b, const int64_t dim);
+  TO_STRING_KV(K_(is_inited), K_(is_trained), K_(dim), K_(metric), K_(quantizer), K_(nlist),
+               K_(pq_m), K_(code_size), K_(total_cnt), K_(pending_cnt));
+private:
+  static const int64_t MAGIC = 0x4656494345564F42; // "BOVECIVF"
+  static const int64_t VERSION = 1;
+  struct InvList
+  {
+    int64_t cnt_;
+    int64_t cap_;
+    int64_t *vids_;
+    uint8_t *codes_;
+  };
+  struct Candidate
+  {
+    float dist_;
+    int64_t vid_;
+    bool operator<(const Candidate &other) const { return dist_ < other.dist_; }
+  };
+  // bounded max heap of the nearest candidates
+  class TopKHeap
+  {
+  public:
+    TopKHeap(Candidate *items, const int64_t capacity) : items_(items), capacity_(capacity), cnt_(0) {}
+    void push(const float dist, const int64_t vid);
+    // sort the candidates ascending and return the count
+    int64_t finish();
+  private:
+    Candidate *items_;
+    int64_t capacity_;
+    int64_t cnt_;
+  };
+  void *alloc(const int64_t size) const;
+  void free(void *ptr) const;
+  int reserve(void *&ptr, const int64_t elem_size, const int64_t cnt, const int64_t new_cap);
+  void destroy_trained();
+  uint64_t next_rand();
+  int append_pending(const float *vectors, const int64_t *vids, const int64_t cnt);
+  int append_list(const int64_t list_id, const int64_t vid, const float *vector);
+  int64_t nearest_centroid(const float *vector) const;
+  void encode(const float *vector, const float *centroid, uint8_t *code) const;
+  void build_pq_lut(const float *query, const float *centroid, float *pq_lut) const;
+  float code_distance(const float *query, const float *pq_lut, const float pq_base, const uint8_t *code) const;
+  int kmeans(const float *data, const int64_t n, const int64_t dim, const int64_t stride,
+             const int64_t k, float *centroids);
+  int train_sq8(const float *data, const int64_t n);
+  int train_pq(const float *data, const int64_t n);
+  int write_buf(std::ostream &out, const void *buf, const int64_t size) const;
+  int read_buf(std::istream &in, void *buf, const int64_t size);
+private:
+  bool is_inited_;
+  bool is_trained_;
+  vsag::Allocator *allocator_;
+  int64_t dim_;
+  ObVectorIvfMetric metric_;
+  ObVectorQuantizerType quantizer_;
+  int64_t nlist_;
+  int64_t pq_m_;
+  int64_t pq_dsub_;
+  int64_t code_size_;
+  int64_t total_cnt_;
+  float *centroids_;      // nlist_ * dim_
+  float *sq8_min_;        // dim_
+  float *sq8_diff_;       // dim_
+  float *pq_centroids_;   // pq_m_ * PQ_KSUB * pq_dsub_
+  InvList *lists_;        // nlist_
+  int64_t pending_cnt_;
+  int64_t pending_cap_;
+  int64_t *pending_vids_;
+  float *pending_vectors_;
+  uint64_t rand_seed_;
+  DISALLOW_COPY_AND_ASSIGN(ObVectorIvfIndex);
+};
+
+} // namespace common
+} // namespace oceanbase
+#endif /* OB_VECTOR_IVF_INDEX_H */
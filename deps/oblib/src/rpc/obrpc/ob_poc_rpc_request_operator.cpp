@@ -32,7 +32,6 @@ void ObPocRpcRequestOperator::response_result(ObRequest* req, obrpc::ObRpcPacket
 {
   obmysql::request_finish_callback();
   get_poc_handle_context(req)->resp(pkt);
-  get_poc_handle_context(req)->destroy();
 
 }
 
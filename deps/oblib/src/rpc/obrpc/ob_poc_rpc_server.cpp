@@ -147,6 +147,11 @@ int ObPocServerHandleContext::create(int64_t resp_id, const char* buf, int64_t s
   return ret;
 }
 
+static void resp_pool_release(void* arg)
+{
+  static_cast<ObRpcMemPool*>(arg)->destroy();
+}
+
 void ObPocServerHandleContext::resp(ObRpcPacket* pkt)
 {
   int ret = OB_SUCCESS;
@@ -154,11 +159,33 @@ void ObPocServerHandleContext::resp(ObRpcPacket* pkt)
   char reserve_buf[2048]; // reserve stack memory for response packet buf
   char* buf = reserve_buf;
   int64_t sz = 0;
+  bool zero_copy = false;
+  struct iovec content_iov;
+  // this context is allocated from pool_, keep what is needed on stack
+  ObRpcMemPool& pool = pool_;
+  const uint64_t resp_id = resp_id_;
+  const int64_t resp_expired_abs_us = resp_expired_abs_us_;
   char rpc_timeguard_str[ObPocRpcServer::RPC_TIMEGUARD_STRING_SIZE] = {'\0'};
   ObTimeGuard timeguard("rpc_resp", 10 * 1000);
   if (NULL == pkt) {
     // do nothing
-  } else if (OB_FAIL(rpc_encode_ob_packet(pool_, pkt, buf, sz, sizeof(reserve_buf)))) {
+  } else if (pkt->get_clen() >= RESP_ZERO_COPY_SIZE && pool.contains(pkt->get_cdata(), pkt->get_clen())) {
+    // only the rpc header is copied, the content is written from pool by writev and
+    // the pool is released by pnio after the response is flushed
+    if (OB_FAIL(pkt->encode_header(buf, sizeof(reserve_buf), sz))) {
+      RPC_LOG(WARN, "encode header fail", KP(pkt), K(sz));
+      buf = NULL;
+      sz = 0;
+    } else {
+      zero_copy = true;
+      content_iov.iov_base = const_cast<char*>(pkt->get_cdata());
+      content_iov.iov_len = pkt->get_clen();
+      IGNORE_RETURN snprintf(rpc_timeguard_str, sizeof(rpc_timeguard_str), "sz=%ld,pcode=%x,id=%ld",
+                            sz + pkt->get_clen(),
+                            pkt->get_pcode(),
+                            pkt->get_tenant_id());
+    }
+  } else if (OB_FAIL(rpc_encode_ob_packet(pool, pkt, buf, sz, sizeof(reserve_buf)))) {
     RPC_LOG(WARN, "rpc_encode_ob_packet fail", KP(pkt), K(sz));
     buf = NULL;
     sz = 0;
@@ -169,8 +196,15 @@ void ObPocServerHandleContext::resp(ObRpcPacket* pkt)
                           pkt->get_tenant_id());
   }
   timeguard.click(rpc_timeguard_str);
-  if ((sys_err = pn_resp(resp_id_, buf, sz, resp_expired_abs_us_)) != 0) {
-    RPC_LOG(WARN, "pn_resp fail", K(resp_id_), K(sys_err));
+  if (zero_copy) {
+    if ((sys_err = pn_resp_iov(resp_id, buf, sz, &content_iov, 1, resp_expired_abs_us, resp_pool_release, &pool)) != 0) {
+      RPC_LOG(WARN, "pn_resp_iov fail", K(resp_id), K(sys_err));
+    }
+  } else {
+    if ((sys_err = pn_resp(resp_id, buf, sz, resp_expired_abs_us)) != 0) {
+      RPC_LOG(WARN, "pn_resp fail", K(resp_id), K(sys_err));
+    }
+    pool.destroy();
   }
 }
 
@@ -351,6 +385,15 @@ int ObPocRpcServer::update_server_standby_fetch_log_bandwidth_limit(int64_t valu
   return ret;
 }
 
+int ObPocRpcServer::update_write_coalesce_time(int64_t coalesce_us) {
+  int ret = OB_SUCCESS;
+  if (pn_set_write_coalesce_us(coalesce_us) != coalesce_us) {
+    ret = OB_INVALID_ARGUMENT;
+    RPC_LOG(WARN, "invalid write coalesce time", K(coalesce_us));
+  }
+  return ret;
+}
+
 int64_t ObPocRpcServer:: get_ratelimit() {
   return pn_get_ratelimit(RATELIMIT_PNIO_GROUP);
 }
@@ -32,6 +32,8 @@ public:
   enum {
     OBCG_ELECTION = 2
   }; // same as src/share/resource_manager/ob_group_list.h
+  // response content not smaller than this is written by pnio without copy
+  enum { RESP_ZERO_COPY_SIZE = 1<<16 };
   ObPocServerHandleContext(ObRpcMemPool& pool, uint64_t resp_id, int64_t resp_expired_abs_us):
       pool_(pool), resp_id_(resp_id), resp_expired_abs_us_(resp_expired_abs_us), peer_()
   {}
@@ -40,6 +42,7 @@ public:
   }
   static int create(int64_t resp_id, const char* buf, int64_t sz, rpc::ObRequest*& req);
   void destroy() { pool_.destroy(); }
+  // send response and release the memory pool, the context itself is not accessible after it returns
   void resp(ObRpcPacket* pkt);
   static int resp_error(uint64_t resp_id, int err_code, const char* b, const int64_t sz);
   ObAddr get_peer();
@@ -75,6 +78,7 @@ public:
   bool has_start() {return has_start_;}
   int update_tcp_keepalive_params(int64_t user_timeout);
   int update_server_standby_fetch_log_bandwidth_limit(int64_t value);
+  int update_write_coalesce_time(int64_t coalesce_us);
   bool client_use_pkt_nio();
   int64_t get_ratelimit();
   uint64_t get_ratelimit_rxbytes();
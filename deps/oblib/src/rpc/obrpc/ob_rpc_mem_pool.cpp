@@ -95,6 +95,15 @@ void* ObRpcMemPool::alloc(int64_t sz)
   return ret;
 }
 
+bool ObRpcMemPool::contains(const void* ptr, int64_t sz) const
+{
+  bool bret = false;
+  for (Page* cur = last_; !bret && NULL != cur; cur = cur->next_) {
+    bret = (const char*)ptr >= cur->base_ && (const char*)ptr + sz <= cur->base_ + cur->cur_;
+  }
+  return bret;
+}
+
 void ObRpcMemPool::destroy()
 {
   Page* cur = last_;
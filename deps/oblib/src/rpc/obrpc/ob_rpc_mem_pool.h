@@ -28,6 +28,7 @@ public:
   ~ObRpcMemPool() { destroy(); }
   static ObRpcMemPool* create(int64_t tenant_id, const char* label, int64_t req_sz);
   void* alloc(int64_t sz);
+  bool contains(const void* ptr, int64_t sz) const;
   void set_tenant_id(int64_t tenant_id) { tenant_id_ = tenant_id; }
   void reuse();
   void destroy();
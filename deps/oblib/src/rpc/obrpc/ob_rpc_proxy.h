@@ -96,6 +96,10 @@ public:
     virtual void destroy() {}
 
   protected:
+    // The object which the response is deserialized into. Callbacks which hand the
+    // response over to other threads may deserialize it into their own storage
+    // directly, instead of copying result_ once more in process().
+    virtual Response &get_decode_result() { return result_; }
 
   protected:
     /*
@@ -363,7 +363,7 @@ int ObRpcProxy::AsyncCB<pcodeStruct>::decode(void *pkt)
         RPC_OBRPC_LOG(WARN, "decode result code fail", K(*rpkt), K(ret));
       } else if (rcode_.rcode_ != OB_SUCCESS) {
         // RPC_OBRPC_LOG(WARN, "execute rpc fail", K_(rcode));
-      } else if (OB_FAIL(result_.deserialize(buf, len, pos))) {
+      } else if (OB_FAIL(get_decode_result().deserialize(buf, len, pos))) {
         RPC_OBRPC_LOG(WARN, "decode packet fail", K(ret));
       } else {
         // do nothing
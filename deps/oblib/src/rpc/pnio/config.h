@@ -33,3 +33,9 @@
 #define MAX_REQ_QUEUE_COUNT   4096
 #define MAX_WRITE_QUEUE_COUNT 4096
 #define MAX_CATEG_COUNT 1024
+// max external segments referenced by one packet, they are written by writev without copy
+#define PNIO_MAX_EXT_IOV 16
+// write coalescing: a busy socket waits at most pnio_write_coalesce_us for more packets
+// before writev, unless PNIO_WRITE_COALESCE_BYTES or PNIO_WRITE_COALESCE_COUNT is reached.
+#define PNIO_WRITE_COALESCE_BYTES (16 * 1024)
+#define PNIO_WRITE_COALESCE_COUNT 64
@@ -53,6 +53,7 @@ static int pn_has_listened = 0;
 int64_t pnio_keepalive_timeout;
 int64_t pnio_read_bytes;
 int64_t pnio_write_bytes;
+int64_t pnio_write_coalesce_us;
 
 void reset_pnio_statistics(int64_t *read_bytes, int64_t *write_bytes)
 {
@@ -66,6 +67,13 @@ PN_API int64_t pn_set_keepalive_timeout(int64_t user_timeout) {
   }
   return pnio_keepalive_timeout;
 }
+
+PN_API int64_t pn_set_write_coalesce_us(int64_t coalesce_us) {
+  if (coalesce_us >= 0) {
+    STORE(&pnio_write_coalesce_us, coalesce_us);
+  }
+  return LOAD(&pnio_write_coalesce_us);
+}
 static pn_listen_t* locate_listen(int idx)
 {
   return pn_listen_array + idx;
@@ -234,6 +242,7 @@ static pn_t* pn_create(int listen_id, int gid, int tid)
   if (NULL == (pn = pn_alloc())) {
   } else if (0 != (err = eloop_init(&pn->ep))) {
   } else if (0 != (err = eloop_rl_init(&pn->ep, &pn->ep.rl_impl))) {
+  } else if (0 != (err = eloop_wc_init(&pn->ep, &pn->ep.wc_impl))) {
   } else if (0 != (err = pktc_init(&pn->pktc, &pn->ep, calc_dispatch_id(gid, tid))))  {
   } else if (0 != (err = pn_init_pkts(listen_id, pn))) {
   } else {
@@ -382,6 +391,8 @@ static pktc_req_t* pn_create_pktc_req(pn_t* pn, uint64_t pkt_id, addr_t dest, co
   r->flush_cb = pn_pktc_flush_cb;
   r->resp_cb = cb;
   r->dest = dest;
+  r->ext_iov = NULL;
+  r->ext_iov_cnt = 0;
   r->categ_id = pkt->categ_id;
   r->sk = NULL;
   dlink_init(&r->link);
@@ -511,6 +522,8 @@ typedef struct pn_resp_ctx_t
   void* req_handle;
   uint64_t sock_id;
   uint64_t pkt_id;
+  resp_done_cb_t done_cb;
+  void* done_arg;
   char reserve[sizeof(pkts_req_t)];
 } pn_resp_ctx_t;
 
@@ -524,10 +537,20 @@ static pn_resp_ctx_t* create_resp_ctx(pn_t* pn, void* req_handle, uint64_t sock_
     ctx->req_handle = req_handle;
     ctx->sock_id = sock_id;
     ctx->pkt_id = pkt_id;
+    ctx->done_cb = NULL;
+    ctx->done_arg = NULL;
   }
   return ctx;
 }
 
+static void pn_resp_ctx_free(pn_resp_ctx_t* ctx)
+{
+  if (NULL != ctx->done_cb) {
+    ctx->done_cb(ctx->done_arg);
+  }
+  fifo_free(ctx);
+}
+
 static int pn_pkts_handle_func(pkts_t* pkts, void* req_handle, const char* b, int64_t s, uint64_t chid)
 {
   int err = 0;
@@ -554,9 +577,9 @@ static void pn_pkts_flush_cb_func(pkts_req_t* req)
 {
   pn_resp_t* resp = structof(req, pn_resp_t, req);
   if ((uint64_t)resp->ctx->reserve == (uint64_t)resp) {
-    fifo_free(resp->ctx);
+    pn_resp_ctx_free(resp->ctx);
   } else {
-    fifo_free(resp->ctx);
+    pn_resp_ctx_free(resp->ctx);
     cfifo_free(resp);
   }
 }
@@ -564,17 +587,35 @@ static void pn_pkts_flush_cb_func(pkts_req_t* req)
 static void pn_pkts_flush_cb_error_func(pkts_req_t* req)
 {
   pn_resp_ctx_t* ctx = (typeof(ctx))structof(req, pn_resp_ctx_t, reserve);
-  fifo_free(ctx);
+  pn_resp_ctx_free(ctx);
 }
 
 PN_API int pn_resp(uint64_t req_id, const char* buf, int64_t sz, int64_t resp_expired_abs_us)
+{
+  return pn_resp_iov(req_id, buf, sz, NULL, 0, resp_expired_abs_us, NULL, NULL);
+}
+
+PN_API int pn_resp_iov(uint64_t req_id, const char* buf, int64_t sz, const struct iovec* ext_iov, int ext_iov_cnt,
+                       int64_t resp_expired_abs_us, resp_done_cb_t done_cb, void* done_arg)
 {
   pn_resp_ctx_t* ctx = (typeof(ctx))req_id;
   pn_resp_t* resp = NULL;
-  if (sizeof(pn_resp_t) + sz <= sizeof(ctx->reserve)) {
+  int64_t ext_sz = 0;
+  for (int i = 0; i < ext_iov_cnt; i++) {
+    ext_sz += ext_iov[i].iov_len;
+  }
+  // crc is calculated on contiguous memory, too many segments can not be written by one writev,
+  // copy the segments into the packet in these cases.
+  const bool need_copy = PNIO_ENABLE_CRC || ext_iov_cnt > PNIO_MAX_EXT_IOV;
+  const int64_t inline_sz = need_copy? sz + ext_sz: sz;
+  const int64_t iov_offset = (sizeof(*resp) + inline_sz + 7) & ~7;
+  const int64_t alloc_sz = need_copy? sizeof(*resp) + inline_sz: iov_offset + ext_iov_cnt * sizeof(struct iovec);
+  ctx->done_cb = done_cb;
+  ctx->done_arg = done_arg;
+  if (0 == ext_iov_cnt && sizeof(pn_resp_t) + sz <= sizeof(ctx->reserve)) {
     resp = (typeof(resp))(ctx->reserve);
   } else {
-    resp = (typeof(resp))cfifo_alloc(&ctx->pn->server_resp_alloc, sizeof(*resp) + sz);
+    resp = (typeof(resp))cfifo_alloc(&ctx->pn->server_resp_alloc, alloc_sz);
   }
   pkts_req_t* r = NULL;
   if (NULL != resp) {
@@ -583,14 +624,34 @@ PN_API int pn_resp(uint64_t req_id, const char* buf, int64_t sz, int64_t resp_ex
     r->errcode = 0;
     r->flush_cb = pn_pkts_flush_cb_func;
     r->sock_id = ctx->sock_id;
+    r->ext_iov = NULL;
+    r->ext_iov_cnt = 0;
     r->categ_id = 0;
     r->expire_us = resp_expired_abs_us;
-    eh_copy_msg(&r->msg, ctx->pkt_id, buf, sz);
+    if (0 == ext_iov_cnt) {
+      eh_copy_msg(&r->msg, ctx->pkt_id, buf, sz);
+    } else if (need_copy) {
+      char* p = (char*)r->msg.b + sizeof(easy_head_t);
+      memcpy(p, buf, sz);
+      p += sz;
+      for (int i = 0; i < ext_iov_cnt; i++) {
+        memcpy(p, ext_iov[i].iov_base, ext_iov[i].iov_len);
+        p += ext_iov[i].iov_len;
+      }
+      eh_copy_msg(&r->msg, ctx->pkt_id, r->msg.b + sizeof(easy_head_t), inline_sz);
+    } else {
+      r->ext_iov = (struct iovec*)((char*)resp + iov_offset);
+      r->ext_iov_cnt = ext_iov_cnt;
+      memcpy(r->ext_iov, ext_iov, ext_iov_cnt * sizeof(struct iovec));
+      eh_copy_msg_with_ext(&r->msg, ctx->pkt_id, buf, sz, ext_sz);
+    }
   } else {
     r = (typeof(r))(ctx->reserve);
     r->errcode = ENOMEM;
     r->flush_cb = pn_pkts_flush_cb_error_func;
     r->sock_id = ctx->sock_id;
+    r->ext_iov = NULL;
+    r->ext_iov_cnt = 0;
     r->categ_id = 0;
     r->expire_us = resp_expired_abs_us;
   }
@@ -712,28 +773,36 @@ void pn_print_diag_info(pn_comm_t* pn_comm) {
   pn_t* pn = (pn_t*)pn_comm;
   int64_t client_cnt = 0;
   int64_t server_cnt = 0;
+  char write_hist_buf[256];
+  char read_hist_buf[256];
   // print socket diag info
   dlink_for(&pn->pktc.sk_list, p) {
     pktc_sk_t* s = structof(p, pktc_sk_t, list_link);
-    rk_info("client:%p_%s_%s_%d_%ld_%d, write_queue=%lu/%lu, write=%lu/%lu, read=%lu/%lu, doing=%lu, done=%lu, write_time=%lu, read_time=%lu, process_time=%lu",
+    rk_info("client:%p_%s_%s_%d_%ld_%d, write_queue=%lu/%lu, write=%lu/%lu, read=%lu/%lu, doing=%lu, done=%lu, write_time=%lu, read_time=%lu, process_time=%lu, "
+            "write_pkts_hist=%s, read_pkts_hist=%s",
               s, T2S(addr, s->sk_diag_info.local_addr), T2S(addr, s->dest), s->fd, s->sk_diag_info.establish_time, s->conn_ok,
               s->wq.cnt, s->wq.sz,
               s->sk_diag_info.write_cnt, s->sk_diag_info.write_size,
               s->sk_diag_info.read_cnt, s->sk_diag_info.read_size,
               s->sk_diag_info.doing_cnt, s->sk_diag_info.done_cnt,
-              s->sk_diag_info.write_wait_time, s->sk_diag_info.read_time, s->sk_diag_info.read_process_time);
+              s->sk_diag_info.write_wait_time, s->sk_diag_info.read_time, s->sk_diag_info.read_process_time,
+              pkts_hist_str(write_hist_buf, sizeof(write_hist_buf), s->sk_diag_info.write_pkts_hist),
+              pkts_hist_str(read_hist_buf, sizeof(read_hist_buf), s->sk_diag_info.read_pkts_hist));
     client_cnt++;
   }
   if (pn->pkts.sk_list.next != NULL) {
     dlink_for(&pn->pkts.sk_list, p) {
       pkts_sk_t* s = structof(p, pkts_sk_t, list_link);
-      rk_info("server:%p_%s_%d_%ld, write_queue=%lu/%lu, write=%lu/%lu, read=%lu/%lu, doing=%lu, done=%lu, write_time=%lu, read_time=%lu, process_time=%lu",
+      rk_info("server:%p_%s_%d_%ld, write_queue=%lu/%lu, write=%lu/%lu, read=%lu/%lu, doing=%lu, done=%lu, write_time=%lu, read_time=%lu, process_time=%lu, "
+              "write_pkts_hist=%s, read_pkts_hist=%s",
                 s, T2S(addr, s->peer), s->fd, s->sk_diag_info.establish_time,
                 s->wq.cnt, s->wq.sz,
                 s->sk_diag_info.write_cnt, s->sk_diag_info.write_size,
                 s->sk_diag_info.read_cnt, s->sk_diag_info.read_size,
                 s->sk_diag_info.doing_cnt, s->sk_diag_info.done_cnt,
-                s->sk_diag_info.write_wait_time, s->sk_diag_info.read_time, s->sk_diag_info.read_process_time);
+                s->sk_diag_info.write_wait_time, s->sk_diag_info.read_time, s->sk_diag_info.read_process_time,
+                pkts_hist_str(write_hist_buf, sizeof(write_hist_buf), s->sk_diag_info.write_pkts_hist),
+                pkts_hist_str(read_hist_buf, sizeof(read_hist_buf), s->sk_diag_info.read_pkts_hist));
       server_cnt++;
     }
   }
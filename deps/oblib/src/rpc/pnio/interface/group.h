@@ -13,6 +13,7 @@
 #pragma once
 #include <stdint.h>
 #include <netinet/in.h>
+#include <sys/uio.h>
 #ifndef PN_API
 #define PN_API
 #endif
@@ -35,6 +36,7 @@
 
 typedef int (*serve_cb_t)(int grp, const char* b, int64_t sz, uint64_t req_id);
 typedef int (*client_cb_t)(void* arg, int io_err, const char* b, int64_t sz);
+typedef void (*resp_done_cb_t)(void* arg);
 
 #ifndef RK_CACHE_ALIGNED
 #define RK_CACHE_ALIGNED __attribute__((aligned(64)))
@@ -73,6 +75,8 @@ typedef struct pn_pkt_t
 } pn_pkt_t;
 
 PN_API int64_t pn_set_keepalive_timeout(int64_t user_timeout);
+// 0 disables write coalescing
+PN_API int64_t pn_set_write_coalesce_us(int64_t coalesce_us);
 PN_API int pn_listen(int port, serve_cb_t cb);
 // if listen_id == -1,  act as client only
 // make sure grp != 0
@@ -80,6 +84,10 @@ PN_API int pn_provision(int listen_id, int grp, int thread_count);
 // gid_tid = (gid<<8) | tid
 PN_API int pn_send(uint64_t gtid, struct sockaddr_storage* sock_addr, const pn_pkt_t* pkt, uint32_t* pkt_id_ret);
 PN_API int pn_resp(uint64_t req_id, const char* buf, int64_t sz, int64_t resp_expired_abs_us);
+// buf is copied, ext_iov segments are referenced and written by writev directly,
+// they must be valid until done_cb(done_arg) is called after the response is flushed or dropped.
+PN_API int pn_resp_iov(uint64_t req_id, const char* buf, int64_t sz, const struct iovec* ext_iov, int ext_iov_cnt,
+                       int64_t resp_expired_abs_us, resp_done_cb_t done_cb, void* done_arg);
 PN_API int pn_get_peer(uint64_t req_id, struct sockaddr_storage* addr);
 PN_API int pn_ratelimit(int grp_id, int64_t value);
 PN_API int64_t pn_get_ratelimit(int grp_id);
@@ -93,6 +101,7 @@ PN_API int pn_terminate_pkt(uint64_t gtid, uint32_t pkt_id);
 extern int64_t pnio_keepalive_timeout;
 extern int64_t pnio_read_bytes;
 extern int64_t pnio_write_bytes;
+extern int64_t pnio_write_coalesce_us;
 void reset_pnio_statistics(int64_t *read_bytes, int64_t *write_bytes);
 pn_comm_t* get_current_pnio();
 void pn_release(pn_comm_t* pn_comm);
@@ -24,3 +24,16 @@ inline void iov_consume_one(struct iovec* iov, int64_t bytes) {
   iov->iov_base = (void*)((uint64_t)iov->iov_base + bytes);
   iov->iov_len -= bytes;
 }
+
+// skip the consumed bytes which may span several iovs, return the index of the first iov to write
+inline int iov_consume(struct iovec* iov, int cnt, int64_t bytes) {
+  int idx = 0;
+  while(idx < cnt && bytes > 0 && bytes >= (int64_t)iov[idx].iov_len) {
+    bytes -= iov[idx].iov_len;
+    idx++;
+  }
+  if (idx < cnt) {
+    iov_consume_one(iov + idx, bytes);
+  }
+  return idx;
+}
@@ -27,6 +27,7 @@ typedef int (*handle_event_t)(struct sock_t*);
   handle_event_t handle_event;                  \
   dlink_t ready_link;                           \
   dlink_t rl_ready_link;                        \
+  dlink_t wc_ready_link;                        \
   int fd;                                       \
   int ep_fd;                                    \
   addr_t peer;                                  \
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+
+static int eloop_wc_fire(wc_impl_t* wc_impl, int64_t delay_us) {
+  if (delay_us <= 0) {
+    delay_us = 1;
+  }
+  struct itimerspec it = {{0, 0}, {delay_us/1000000, 1000 * (delay_us % 1000000)}};
+  return timerfd_settime(wc_impl->wcfd.fd, 0, &it, NULL)? errno: 0;
+}
+
+void wc_sock_push(wc_impl_t* wc_impl, sock_t* sk, int64_t delay_us) {
+  if (NULL != sk->wc_ready_link.next) {
+    // socket has already in wc queue
+  } else {
+    bool empty = dlink_is_empty(&wc_impl->ready_link);
+    dlink_insert_before(&wc_impl->ready_link, &sk->wc_ready_link);
+    if (empty) {
+      // every socket waits for the same coalesce time, the head of the queue expires first
+      eloop_wc_fire(wc_impl, delay_us);
+    }
+  }
+}
+
+static int wc_timerfd_handle_event(wc_timerfd_t* s) {
+  evfd_drain(s->fd);
+  wc_impl_t* wc_impl = structof(s, wc_impl_t, wcfd);
+  eloop_t* ep = structof(wc_impl, eloop_t, wc_impl);
+  // wake up all sockets, the ones not expired yet are pushed back and rearm the timer
+  dlink_for(&wc_impl->ready_link, p) {
+    sock_t* sk = structof(p, sock_t, wc_ready_link);
+    dlink_delete(&sk->wc_ready_link);
+    eloop_fire(ep, sk);
+  }
+  return EAGAIN;
+}
+
+int eloop_wc_init(eloop_t* ep, wc_impl_t* wc_impl) {
+  int err = 0;
+  dlink_init(&wc_impl->ready_link);
+  wc_timerfd_t* s = &wc_impl->wcfd;
+  sk_init((sock_t*)s, NULL, (void*)wc_timerfd_handle_event, timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK|TFD_CLOEXEC));
+  if (s->fd < 0) {
+    err = EIO;
+  } else {
+    err = eloop_regist(ep, (sock_t*)s, EPOLLIN);
+  }
+  if (0 != err && s->fd >= 0) {
+    close(s->fd);
+  }
+  return err;
+}
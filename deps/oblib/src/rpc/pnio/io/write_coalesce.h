@@ -0,0 +1,24 @@
+/**
+ * Copyright (c) 2023 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+
+// sockets that delay their writev for write coalescing sleep in ready_link until wcfd fires
+typedef struct wc_timerfd_t {
+  SOCK_COMMON;
+} wc_timerfd_t;
+
+typedef struct wc_impl_t {
+  dlink_t ready_link;
+  wc_timerfd_t wcfd;
+} wc_impl_t;
+
+void wc_sock_push(wc_impl_t* wc_impl, sock_t* sk, int64_t delay_us);
@@ -12,6 +12,19 @@
 
 str_t* sfl(dlink_t* l) { return (str_t*)(l+1); }
 int64_t cidfl(dlink_t* l) {return  *((int64_t*)l-1); }
+int64_t eiovcfl(dlink_t* l) {return  *((int64_t*)l-2); }
+struct iovec* eiovfl(dlink_t* l) {return  *((struct iovec**)l-3); }
+
+// bytes of a request on the wire: the inline msg followed by its external segments
+int64_t wq_req_bytes(dlink_t* l) {
+  int64_t bytes = sfl(l)->s;
+  struct iovec* ext = eiovfl(l);
+  for(int64_t i = 0; i < eiovcfl(l); i++) {
+    bytes += ext[i].iov_len;
+  }
+  return bytes;
+}
+
 static int iov_from_blist(struct iovec* iov, int64_t limit, dlink_t* head) {
   int cnt = 0;
   dlink_for(head, p) {
@@ -20,6 +33,10 @@ static int iov_from_blist(struct iovec* iov, int64_t limit, dlink_t* head) {
     }
     iov_set_from_str(iov + cnt, sfl(p));
     cnt++;
+    struct iovec* ext = eiovfl(p);
+    for(int64_t i = 0; i < eiovcfl(p) && cnt < limit; i++) {
+      iov[cnt++] = ext[i];
+    }
   }
   return cnt;
 }
@@ -28,15 +45,15 @@ static int sk_flush_blist(sock_t* s, dlink_t* head, int64_t last_pos, int64_t* w
   int err = 0;
   struct iovec iov[64];
   int cnt = iov_from_blist(iov, arrlen(iov), head);
-  if (cnt > 0) {
-    iov_consume_one(iov, last_pos);
-    err = sk_writev(s, iov, cnt, wbytes);
+  int idx = iov_consume(iov, cnt, last_pos);
+  if (idx < cnt) {
+    err = sk_writev(s, iov + idx, cnt - idx, wbytes);
   }
   return err;
 }
 
 void wq_inc(write_queue_t* wq, dlink_t* l) {
-  int64_t bytes = sfl(l)->s;
+  int64_t bytes = wq_req_bytes(l);
   wq->cnt ++;
   wq->sz += bytes;
   int64_t cid = cidfl(l);
@@ -44,7 +61,7 @@ void wq_inc(write_queue_t* wq, dlink_t* l) {
 }
 
 void wq_dec(write_queue_t* wq, dlink_t* l) {
-  int64_t bytes = sfl(l)->s;
+  int64_t bytes = wq_req_bytes(l);
   wq->cnt --;
   wq->sz -= bytes;
   int64_t cid = cidfl(l);
@@ -55,11 +72,11 @@ static dlink_t* wq_consume(write_queue_t* wq, int64_t bytes) {
   int64_t s = 0;
   dlink_t* top = dqueue_top(&wq->queue);
   dlink_t* h = top;
-  if((s = sfl(h)->s - wq->pos) <= bytes) {
+  if((s = wq_req_bytes(h) - wq->pos) <= bytes) {
     bytes -= s;
     wq_dec(wq, h);
     h = h->next;
-    while(bytes > 0 && (s = sfl(h)->s) <= bytes) {
+    while(bytes > 0 && (s = wq_req_bytes(h)) <= bytes) {
       bytes -= s;
       wq_dec(wq, h);
       h = h->next;
@@ -77,6 +94,9 @@ void wq_init(write_queue_t* wq) {
   wq->pos = 0;
   wq->cnt = 0;
   wq->sz = 0;
+  wq->last_flush_us = 0;
+  wq->last_flush_cnt = 0;
+  wq->delay_start_us = 0;
   memset(wq->categ_count_bucket, 0, sizeof(wq->categ_count_bucket));
 }
 
@@ -103,9 +123,36 @@ inline int wq_delete(write_queue_t* wq, dlink_t* l) {
 int wq_flush(sock_t* s, write_queue_t* wq, dlink_t** old_head) {
   int err = 0;
   int64_t wbytes = 0;
+  int64_t cnt = wq->cnt;
   err = sk_flush_blist((sock_t*)s, &wq->queue.head, wq->pos, &wbytes);
   if (0 == err && wbytes > 0) {
     *old_head = wq_consume(wq, wbytes);
+    wq->last_flush_us = rk_get_us();
+    wq->last_flush_cnt = cnt - wq->cnt;
+    wq->delay_start_us = 0;
   }
   return err;
 }
+
+/*
+ * Nagle-like write coalescing with a microsecond deadline.
+ * Only a busy socket is delayed: the previous writev was issued recently and carried more than one packet.
+ * An idle socket or a socket serving one request at a time is flushed immediately.
+ * Return the time to wait before flushing, 0 means flush now.
+ */
+int64_t wq_delay_flush(write_queue_t* wq, int64_t cur_us) {
+  int64_t delay_us = 0;
+  int64_t coalesce_us = LOAD(&pnio_write_coalesce_us);
+  if (coalesce_us <= 0 || dqueue_empty(&wq->queue) || wq->pos > 0) {
+    // partial written packet should be flushed without delay
+  } else if (wq->sz >= PNIO_WRITE_COALESCE_BYTES || wq->cnt >= PNIO_WRITE_COALESCE_COUNT) {
+  } else if (0 == wq->delay_start_us) {
+    if (wq->last_flush_cnt > 1 && cur_us - wq->last_flush_us < coalesce_us) {
+      wq->delay_start_us = cur_us;
+      delay_us = coalesce_us;
+    }
+  } else if (cur_us - wq->delay_start_us < coalesce_us) {
+    delay_us = coalesce_us - (cur_us - wq->delay_start_us);
+  }
+  return delay_us;
+}
@@ -16,10 +16,15 @@ typedef struct write_queue_t {
   int64_t pos;
   int64_t cnt;
   int64_t sz;
+  int64_t last_flush_us;
+  int64_t last_flush_cnt;
+  int64_t delay_start_us;
   int16_t categ_count_bucket[BUCKET_SIZE];
 } write_queue_t;
 
+extern int64_t wq_req_bytes(dlink_t* l);
 extern void wq_init(write_queue_t* wq);
 extern void wq_push(write_queue_t* wq, dlink_t* l);
 extern int wq_flush(sock_t* s, write_queue_t* wq, dlink_t** old_head);
 extern int wq_delete(write_queue_t* wq, dlink_t* l);
+extern int64_t wq_delay_flush(write_queue_t* wq, int64_t cur_us);
@@ -69,3 +69,12 @@ static void eh_copy_msg(str_t* m, uint32_t pkt_id, const char* b, int64_t s)
   }
   PNIO_CRC(h->reserved_ = calc_crc(b, s));
 }
+
+// the packet body is b followed by ext_sz bytes of external segments, only b is copied into msg
+static void eh_copy_msg_with_ext(str_t* m, uint32_t pkt_id, const char* b, int64_t s, int64_t ext_sz)
+{
+  easy_head_t* h = (typeof(h))m->b;
+  m->s = s + sizeof(*h);
+  eh_set(h, s + ext_sz, pkt_id);
+  memcpy((void*)(h + 1), b, s);
+}
@@ -30,6 +30,15 @@
 static int my_sk_flush(my_sk_t* s, int64_t time_limit) {
   int err = 0;
   int64_t remain = INT64_MAX;
+  int64_t delay_us = wq_delay_flush(&s->wq, rk_get_us());
+  if (delay_us > 0) {
+    // sleep until the coalesce timer or a new response wakes the sock up,
+    // the following responses are written by the same writev
+    my_t* io = structof(s->fty, my_t, sf);
+    wc_sock_push(&io->ep->wc_impl, (sock_t*)s, delay_us);
+    return EAGAIN;
+  }
+  dlink_delete(&s->wc_ready_link);
   while(0 == err && remain > 0 && !is_epoll_handle_timeout(time_limit)) {
     if (0 != (err = my_sk_do_flush(s, &remain))) {
       if (EAGAIN != err) {
@@ -51,6 +60,7 @@ int my_sk_consume(my_sk_t* s, int64_t time_limit, int64_t* avail_bytes) {
     err = EAGAIN;
   }
   int64_t rbytes = 0;
+  int64_t msg_cnt = 0;
   while(0 == err && !is_epoll_handle_timeout(time_limit)) {
     if (0 != (err = my_sk_do_decode(s, &msg, avail_bytes))) {
       if (EAGAIN != err) {
@@ -60,11 +70,13 @@ int my_sk_consume(my_sk_t* s, int64_t time_limit, int64_t* avail_bytes) {
       // not read a complete package yet
     } else {
       s->sk_diag_info.read_process_time += (rk_get_us() - msg.ctime_us);
+      msg_cnt++;
       if (0 != (err = my_sk_handle_msg(s, &msg))) {
         rk_info("handle msg fail: %d", err);
       }
     }
   }
+  pkts_hist_inc(s->sk_diag_info.read_pkts_hist, msg_cnt);
   return err;
 }
 
@@ -35,6 +35,8 @@ struct pktc_req_t {
   pktc_flush_cb_func_t flush_cb;
   pktc_cb_t* resp_cb;
   addr_t dest;
+  struct iovec* ext_iov; // segments sent after msg without copy, see wq_req_bytes()
+  int64_t ext_iov_cnt;
   int64_t categ_id; // ATTENTION! Cannot add new structure field from categ_id!
   dlink_t link;
   str_t msg;
@@ -28,6 +28,8 @@ typedef struct pkts_req_t {
   pkts_flush_cb_func_t flush_cb;
   uint64_t sock_id;
   int64_t expire_us;
+  struct iovec* ext_iov; // segments sent after msg without copy, see wq_req_bytes()
+  int64_t ext_iov_cnt;
   int64_t categ_id; // ATTENTION! Cannot add new structure field from categ_id!
   dlink_t link;
   str_t msg;
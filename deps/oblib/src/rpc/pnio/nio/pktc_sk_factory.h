@@ -53,6 +53,7 @@ static int pktc_sk_init(pktc_sf_t* sf, pktc_sk_t* s) {
   dlink_init(&s->cb_head);
   dlink_init(&s->list_link);
   s->rl_ready_link.next = NULL;
+  s->wc_ready_link.next = NULL;
   s->user_keepalive_timeout = 0;
   return 0;
 }
@@ -87,6 +88,7 @@ static void pktc_sk_delete(pktc_sf_t* sf, pktc_sk_t* s) {
   pktc_resp_cb_on_sk_destroy(io, s);
   ib_destroy(&s->ib);
   dlink_delete(&s->rl_ready_link);
+  dlink_delete(&s->wc_ready_link);
   pktc_sk_free(s);
 }
 
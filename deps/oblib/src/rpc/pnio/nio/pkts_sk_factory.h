@@ -18,6 +18,7 @@ static int pkts_sk_init(pkts_sf_t* sf, pkts_sk_t* s) {
   wq_init(&s->wq);
   ib_init(&s->ib, MOD_PKTS_INBUF);
   s->rl_ready_link.next = NULL;
+  s->wc_ready_link.next = NULL;
   s->id = idm_set(&pkts->sk_map, s);
   dlink_insert(&pkts->sk_list, &s->list_link);
   rk_info("set pkts_sk_t sock_id s=%p, s->id=%ld", s, s->id);
@@ -59,6 +60,7 @@ static void pkts_sk_delete(pkts_sf_t* sf, pkts_sk_t* s) {
   pkts_write_queue_on_sk_destroy(io, s);
   ib_destroy(&s->ib);
   dlink_delete(&s->rl_ready_link);
+  dlink_delete(&s->wc_ready_link);
   pkts_sk_free(s);
 }
 
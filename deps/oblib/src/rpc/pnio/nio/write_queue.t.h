@@ -36,11 +36,12 @@ static int my_sk_do_flush(my_sk_t* s, int64_t* remain) {
   int64_t flushed_time_us = rk_get_us();
   if (0 == err && NULL != h) {
     dlink_t* stop = dqueue_top(&s->wq.queue);
+    pkts_hist_inc(s->sk_diag_info.write_pkts_hist, s->wq.last_flush_cnt);
     while(h != stop) {
       my_req_t* req = structof(h, my_req_t, link);
       h = h->next;
       s->sk_diag_info.write_cnt ++;
-      s->sk_diag_info.write_size += req->msg.s;
+      s->sk_diag_info.write_size += wq_req_bytes(&req->link);
       s->sk_diag_info.write_wait_time += (flushed_time_us - req->ctime_us);
       my_flush_cb_after_flush(io, req);
     }
@@ -47,6 +47,7 @@
 #include "io/timerfd.c"
 #include "io/time_wheel.c"
 #include "io/rate_limit.c"
+#include "io/write_coalesce.c"
 
 #include "nio/addr.c"
 #include "nio/inet.c"
@@ -22,6 +22,8 @@ typedef struct diag_info_t
   uint64_t send_size;
   uint64_t sc_queue_time;
 } diag_info_t;
+// histogram of packets per syscall, bucket i counts [2^i, 2^(i+1)) packets
+#define PNIO_PKTS_HIST_SIZE 8
 typedef struct socket_diag_info_t
 {
   int64_t establish_time;
@@ -35,9 +37,24 @@ typedef struct socket_diag_info_t
   uint64_t read_process_time;
   uint64_t doing_cnt;
   uint64_t done_cnt;
+  uint64_t write_pkts_hist[PNIO_PKTS_HIST_SIZE];
+  uint64_t read_pkts_hist[PNIO_PKTS_HIST_SIZE];
   addr_t local_addr;
 } socket_diag_info_t;
 
+static inline void pkts_hist_inc(uint64_t* hist, int64_t cnt) {
+  if (cnt > 0) {
+    int idx = 63 - __builtin_clzll(cnt);
+    hist[idx < PNIO_PKTS_HIST_SIZE? idx: PNIO_PKTS_HIST_SIZE - 1] ++;
+  }
+}
+
+static inline char* pkts_hist_str(char* buf, int64_t len, uint64_t* hist) {
+  snprintf(buf, len, "%lu/%lu/%lu/%lu/%lu/%lu/%lu/%lu",
+           hist[0], hist[1], hist[2], hist[3], hist[4], hist[5], hist[6], hist[7]);
+  return buf;
+}
+
 
 extern __thread int64_t eloop_malloc_count;
 extern __thread int64_t eloop_malloc_time;
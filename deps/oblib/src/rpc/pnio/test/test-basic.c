@@ -38,6 +38,8 @@ pkts_req_t* create_resp(int64_t sz, uint64_t pkt_id, uint64_t sock_id)
   r->errcode = 0;
   r->flush_cb = pkts_flush_cb_func;
   r->sock_id = sock_id;
+  r->ext_iov = NULL;
+  r->ext_iov_cnt = 0;
   mock_msg_init(&r->msg, pkt_id, sz);
   return r;
 }
@@ -84,6 +86,8 @@ pktc_req_t* create_req_with_cb(int64_t id, int64_t sz)
   r->flush_cb = pktc_flush_cb_func;
   r->resp_cb = cb;
   r->dest = dest_addr;
+  r->ext_iov = NULL;
+  r->ext_iov_cnt = 0;
   mock_msg_init(&r->msg, id, sz);
   return r;
 }
@@ -93,6 +97,8 @@ pktc_req_t* create_req(int64_t sz)
   pktc_req_t* r = mod_alloc(sizeof(pktc_req_t) + sizeof(easy_head_t) + sz, MOD_PKTC_REQ);
   r->resp_cb = NULL;
   r->dest = dest_addr;
+  r->ext_iov = NULL;
+  r->ext_iov_cnt = 0;
   mock_msg_init(&r->msg, 0, sz);
   return r;
 }
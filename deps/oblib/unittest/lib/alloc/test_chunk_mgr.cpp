@@ -11,6 +11,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <iostream>
+#include "lib/time/ob_time_utility.h"
 #define private public
 #define protected public
 #include "lib/resource/achunk_mgr.h"
@@ -339,4 +341,69 @@ TEST_F(TestChunkMgr, sync_wash)
   EXPECT_EQ(0, hold_);
   EXPECT_EQ(0, slots_[0]->count());
   EXPECT_EQ(0, slots_[1]->count());
-}
\ No newline at end of file
+}
+TEST_F(TestChunkMgr, numa_prefer_local)
+{
+  int NORMAL_SIZE = OB_MALLOC_BIG_BLOCK_SIZE;
+  AChunk *chunks[3] = {};
+  for (int i = 0; i < 3; ++i) {
+    chunks[i] = alloc_chunk(NORMAL_SIZE);
+    chunks[i]->numa_node_ = i;
+  }
+  for (int i = 0; i < 3; ++i) {
+    free_chunk(chunks[i]);
+  }
+  EXPECT_EQ(3, slots_[0]->count());
+  AChunk *chunk = pop_chunk_with_size(aligned(NORMAL_SIZE), 2);
+  EXPECT_EQ(chunks[2], chunk);
+  chunk = pop_chunk_with_size(aligned(NORMAL_SIZE), 3);
+  EXPECT_EQ(chunks[0], chunk);
+  chunk = pop_chunk_with_size(aligned(NORMAL_SIZE));
+  EXPECT_EQ(chunks[1], chunk);
+  EXPECT_EQ(0, slots_[0]->count());
+}
+
+// scan_mb=4096 n_read=100000000 ./test_chunk_mgr --gtest_also_run_disabled_tests --gtest_filter=*scan_bench*
+TEST_F(TestChunkMgr, DISABLED_scan_bench)
+{
+  const int64_t scan_size = atoll(getenv("scan_mb") ?: "256") << 20;
+  const int64_t n_read = atoll(getenv("n_read") ?: "10000000");
+  const int64_t chunk_size = OB_MALLOC_BIG_BLOCK_SIZE;
+  const int64_t chunk_cnt = scan_size / chunk_size;
+  const int large_page_types[] = {ObLargePageHelper::NO_LARGE_PAGE,
+                                  ObLargePageHelper::TRANSPARENT_LARGE_PAGE,
+                                  ObLargePageHelper::PREFER_LARGE_PAGE};
+  const char *names[] = {"4K page", "transparent huge page", "hugetlb"};
+  const int orig_type = ObLargePageHelper::large_page_type_;
+  set_limit(scan_size * 2);
+  set_numa_aware(true);
+  AChunk **chunks = new AChunk*[chunk_cnt];
+  for (int t = 0; t < ARRAYSIZEOF(large_page_types); ++t) {
+    ObLargePageHelper::large_page_type_ = large_page_types[t];
+    for (int64_t i = 0; i < chunk_cnt; ++i) {
+      chunks[i] = alloc_chunk(chunk_size);
+      ASSERT_TRUE(NULL != chunks[i]);
+      memset(chunks[i]->data_, (int)i, chunk_size);
+    }
+    // random reads over the whole area, dominated by tlb misses with 4K pages
+    uint64_t seed = 1;
+    int64_t sum = 0;
+    const int64_t start_us = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < n_read; ++i) {
+      seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+      const uint64_t r = seed >> 16;
+      sum += chunks[r % chunk_cnt]->data_[(r >> 20) % chunk_size];
+    }
+    const int64_t cost_us = MAX(1, ObTimeUtility::current_time() - start_us);
+    std::cout << names[t] << ": reads/s=" << n_read * 1000000 / cost_us << " sum=" << sum
+              << " large_page_maps=" << get_large_page_maps()
+              << " numa_local_allocs=" << get_numa_local_allocs()
+              << " numa_remote_allocs=" << get_numa_remote_allocs() << std::endl;
+    for (int64_t i = 0; i < chunk_cnt; ++i) {
+      free_chunk(chunks[i]);
+    }
+    sync_wash();
+  }
+  delete [] chunks;
+  ObLargePageHelper::large_page_type_ = orig_type;
+}
@@ -19,6 +19,8 @@
 #include "lib/utility/ob_test_util.h"
 #include "lib/coro/testing.h"
 #include <gtest/gtest.h>
+#include <thread>
+#include <atomic>
 
 using namespace oceanbase::lib;
 using namespace oceanbase::common;
@@ -222,6 +224,130 @@ TEST_F(TestObjectMgr, TestFragmentWash)
   }
 }
 
+static int64_t get_alloc_bytes(ObjectMgr &obj_mgr)
+{
+  int64_t alloc_bytes = 0;
+  for (int i = 0; i < obj_mgr.sub_cnt_; i++) {
+    if (nullptr != obj_mgr.sub_mgrs_[i]) {
+      alloc_bytes += obj_mgr.sub_mgrs_[i]->os_.get_alloc_bytes();
+    }
+  }
+  return alloc_bytes;
+}
+
+TEST_F(TestObjectMgr, TestObjectCache)
+{
+  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  auto &obj_mgr = static_cast<ObjectMgr&>(ta->get_block_mgr());
+  ObjectCache &obj_cache = obj_mgr.get_obj_cache();
+  obj_cache.flush();
+  ASSERT_EQ(0, obj_cache.get_hold());
+  const int64_t alloc_bytes = get_alloc_bytes(obj_mgr);
+
+  void *ptr = ob_malloc(100, "mod");
+  ASSERT_NE(nullptr, ptr);
+  AObject *obj = reinterpret_cast<AObject*>((char*)ptr - AOBJECT_HEADER_SIZE);
+  int64_t used = obj_mgr.get_stat().used_;
+  ASSERT_EQ(alloc_bytes + 100, get_alloc_bytes(obj_mgr));
+  ob_free(ptr);
+  // the freed object stays in the cache and is still occupied in the ObjectSet
+  ASSERT_FALSE(obj->in_use_);
+  ASSERT_TRUE(obj->in_cache_);
+  ASSERT_TRUE(obj->is_occupied());
+  ASSERT_EQ(100, obj_cache.get_hold());
+  ASSERT_EQ(used, obj_mgr.get_stat().used_);
+  // a smaller request of the same size class reuses it with the new size
+  void *ptr2 = ob_malloc(90, "mod");
+  ASSERT_EQ(ptr, ptr2);
+  ASSERT_TRUE(obj->in_use_);
+  ASSERT_FALSE(obj->in_cache_);
+  ASSERT_EQ(90, obj->alloc_bytes_);
+  ASSERT_EQ(AOBJECT_TAIL_MAGIC_CODE, reinterpret_cast<uint64_t&>(obj->data_[90]));
+  ASSERT_EQ(alloc_bytes + 90, get_alloc_bytes(obj_mgr));
+  ASSERT_EQ(0, obj_cache.get_hold());
+  // bigger objects are not cached
+  void *ptr3 = ob_malloc(4096, "mod");
+  ob_free(ptr3);
+  ASSERT_EQ(0, obj_cache.get_hold());
+  ob_free(ptr2);
+  ASSERT_EQ(90, obj_cache.get_hold());
+  // wash gives the cached objects back
+  ta->sync_wash(INT64_MAX);
+  ASSERT_EQ(0, obj_cache.get_hold());
+  ASSERT_EQ(alloc_bytes, get_alloc_bytes(obj_mgr));
+
+  // the cached bytes of a thread slot are bounded
+  void *ptrs[ObjectCache::CLASS_CNT * ObjectCache::MAG_SIZE];
+  for (int i = 0; i < ARRAYSIZEOF(ptrs); i++) {
+    ptrs[i] = ob_malloc(1500, "mod");
+    ASSERT_NE(nullptr, ptrs[i]);
+  }
+  for (int i = 0; i < ARRAYSIZEOF(ptrs); i++) {
+    ob_free(ptrs[i]);
+  }
+  ASSERT_GE(ObjectCache::MAX_SLOT_HOLD, obj_cache.get_hold());
+  obj_cache.flush();
+  ASSERT_EQ(0, obj_cache.get_hold());
+  ASSERT_EQ(alloc_bytes, get_alloc_bytes(obj_mgr));
+}
+
+TEST_F(TestObjectMgr, TestObjectCacheDoubleFree)
+{
+  ASSERT_DEATH({
+    void *ptr = ob_malloc(100, "mod");
+    ob_free(ptr);
+    // the object is in the cache now, freeing it again must abort instead of caching it twice
+    ob_free(ptr);
+  }, "");
+}
+
+TEST_F(TestObjectMgr, TestObjectCacheConcurrent)
+{
+  auto ta = ObMallocAllocator::get_instance()->get_tenant_ctx_allocator(
+      OB_SERVER_TENANT_ID, ObCtxIds::DEFAULT_CTX_ID);
+  auto &obj_mgr = static_cast<ObjectMgr&>(ta->get_block_mgr());
+  ObjectCache &obj_cache = obj_mgr.get_obj_cache();
+  obj_cache.flush();
+  const int64_t alloc_bytes = get_alloc_bytes(obj_mgr);
+  const int n_thread = 16;
+  const int64_t loop = 2000;
+  std::atomic<int64_t> corrupted(0);
+  vector<thread> ths;
+  for (int i = 0; i < n_thread; i++) {
+    ths.push_back(thread([&, i]() {
+      char *p[16] = {};
+      int64_t sizes[16] = {};
+      uint64_t seed = i + 1;
+      for (int64_t j = 0; j < loop; j++) {
+        for (int k = 0; k < ARRAYSIZEOF(p); k++) {
+          seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+          sizes[k] = 16 + (seed >> 33) % 1024;
+          p[k] = static_cast<char*>(ob_malloc(sizes[k], "mod"));
+          abort_unless(p[k] != nullptr);
+          MEMSET(p[k], i * 16 + k, sizes[k]);
+        }
+        // an object handed out twice would be overwritten by another owner
+        for (int k = 0; k < ARRAYSIZEOF(p); k++) {
+          for (int64_t b = 0; b < sizes[k]; b++) {
+            if (p[k][b] != static_cast<char>(i * 16 + k)) {
+              corrupted++;
+              break;
+            }
+          }
+          ob_free(p[k]);
+        }
+      }
+    }));
+  }
+  for (auto &th : ths) {
+    th.join();
+  }
+  ASSERT_EQ(0, corrupted.load());
+  obj_cache.flush();
+  ASSERT_EQ(0, obj_cache.get_hold());
+  ASSERT_EQ(alloc_bytes, get_alloc_bytes(obj_mgr));
+}
 
 TEST_F(TestObjectMgr, TestSubObjectMgr)
 {
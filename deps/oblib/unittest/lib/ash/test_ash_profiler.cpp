@@ -0,0 +1,180 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "lib/ash/ob_ash_profiler.h"
+#undef private
+#include "lib/oblog/ob_log.h"
+#include "lib/time/ob_time_utility.h"
+
+namespace oceanbase
+{
+namespace common
+{
+static void make_entry(const int64_t stack_id, const int64_t sample_time, ObAshProfiler::Entry &entry)
+{
+  entry.reset();
+  entry.tenant_id_ = 1001;
+  entry.event_no_ = 0;
+  entry.plan_line_id_ = 1;
+  STRCPY(entry.sql_id_, "ASHPROFILETEST");
+  entry.depth_ = 2;
+  entry.frames_[0] = reinterpret_cast<void*>(stack_id);
+  entry.frames_[1] = reinterpret_cast<void*>(0x1000);
+  entry.count_ = 1;
+  entry.last_sample_time_ = sample_time;
+}
+
+static int64_t count_entries(ObAshProfiler &profiler, const int64_t min_time, const int64_t max_time)
+{
+  int64_t cnt = 0;
+  auto fn = [&](const ObAshProfiler::Entry &entry) {
+    if (entry.last_sample_time_ >= min_time && entry.last_sample_time_ < max_time) {
+      cnt++;
+    }
+    return OB_SUCCESS;
+  };
+  EXPECT_EQ(OB_SUCCESS, profiler.for_each_entry(fn));
+  return cnt;
+}
+
+TEST(ObAshProfiler, aggregate)
+{
+  ObAshProfiler &profiler = ObAshProfiler::get_instance();
+  ObAshProfiler::Entry entry;
+  profiler.reset();
+  make_entry(1, 1, entry);
+  profiler.add_entry(entry);
+  make_entry(1, 2, entry);
+  profiler.add_entry(entry);
+  make_entry(2, 3, entry);
+  profiler.add_entry(entry);
+  // same sql with another plan line is another entry
+  make_entry(2, 4, entry);
+  entry.plan_line_id_ = 2;
+  profiler.add_entry(entry);
+
+  int64_t entry_cnt = 0;
+  int64_t sample_cnt = 0;
+  auto fn = [&](const ObAshProfiler::Entry &e) {
+    entry_cnt++;
+    sample_cnt += e.count_;
+    if (reinterpret_cast<void*>(1) == e.frames_[0]) {
+      EXPECT_EQ(2, e.count_);
+      EXPECT_EQ(2, e.last_sample_time_);
+    }
+    return OB_SUCCESS;
+  };
+  ASSERT_EQ(OB_SUCCESS, profiler.for_each_entry(fn));
+  ASSERT_EQ(3, entry_cnt);
+  ASSERT_EQ(4, sample_cnt);
+  ASSERT_EQ(0, profiler.get_evicted_cnt());
+
+  char buf[1024];
+  make_entry(1, 1, entry);
+  const int64_t len = entry.to_folded(buf, sizeof(buf));
+  ASSERT_EQ(0, STRNCMP(buf, "tenant_1001;ASHPROFILETEST;line_1;ON CPU;", len));
+
+  profiler.reset();
+  ASSERT_EQ(0, count_entries(profiler, 0, INT64_MAX));
+}
+
+TEST(ObAshProfiler, evict_least_recently_sampled)
+{
+  ObAshProfiler &profiler = ObAshProfiler::get_instance();
+  const int64_t table_size = ObAshProfiler::TABLE_SIZE;
+  ObAshProfiler::Entry entry;
+  profiler.reset();
+  for (int64_t i = 1; i <= 3 * table_size; i++) {
+    make_entry(i, i, entry);
+    profiler.add_entry(entry);
+  }
+  const int64_t old_cnt = count_entries(profiler, 0, table_size + 1);
+  const int64_t new_cnt = count_entries(profiler, 2 * table_size + 1, INT64_MAX);
+  COMMON_LOG(INFO, "ash profile eviction", K(old_cnt), K(new_cnt), K(profiler.get_evicted_cnt()));
+  ASSERT_GT(profiler.get_evicted_cnt(), 0);
+  ASSERT_LE(count_entries(profiler, 0, INT64_MAX), table_size);
+  // new stacks are never lost, old ones make room for them
+  ASSERT_GT(new_cnt, old_cnt);
+
+  // the last stack is kept and keeps aggregating
+  make_entry(3 * table_size, 3 * table_size + 1, entry);
+  profiler.add_entry(entry);
+  int64_t last_cnt = 0;
+  auto fn = [&](const ObAshProfiler::Entry &e) {
+    if (reinterpret_cast<void*>(3 * table_size) == e.frames_[0]) {
+      last_cnt = e.count_;
+    }
+    return OB_SUCCESS;
+  };
+  ASSERT_EQ(OB_SUCCESS, profiler.for_each_entry(fn));
+  ASSERT_EQ(2, last_cnt);
+  profiler.reset();
+  ASSERT_EQ(0, profiler.get_evicted_cnt());
+}
+
+TEST(ObAshProfiler, stat_in_signal)
+{
+  ActiveSessionStat stat;
+  ObActiveSessionGuard::setup_ash(stat);
+  ASSERT_EQ(&stat, ObActiveSessionGuard::get_stat_in_signal());
+  ASSERT_EQ(&stat, &ObActiveSessionGuard::get_stat());
+  ObActiveSessionGuard::setup_default_ash();
+  ASSERT_NE(&stat, ObActiveSessionGuard::get_stat_in_signal());
+  ASSERT_TRUE(nullptr != ObActiveSessionGuard::get_stat_in_signal());
+}
+
+TEST(ObAshProfiler, sample_on_cpu)
+{
+  ObAshProfiler &profiler = ObAshProfiler::get_instance();
+  ActiveSessionStat stat;
+  stat.tenant_id_ = 1002;
+  STRCPY(stat.sql_id_, "ASHPROFILEBUSY");
+  ObActiveSessionGuard::setup_ash(stat);
+  ASSERT_EQ(OB_SUCCESS, profiler.set_interval(1000));
+  const int64_t begin = ObTimeUtility::current_time();
+  volatile int64_t sum = 0;
+  while (ObTimeUtility::current_time() - begin < 300 * 1000) {
+    for (int64_t i = 0; i < 10000; i++) {
+      sum = sum + i;
+    }
+  }
+  profiler.drain();
+  int64_t sample_cnt = 0;
+  char buf[1024];
+  auto fn = [&](const ObAshProfiler::Entry &e) {
+    if (1002 == e.tenant_id_) {
+      sample_cnt += e.count_;
+      EXPECT_EQ(0, STRCMP(e.sql_id_, "ASHPROFILEBUSY"));
+      EXPECT_GE(e.depth_, 1);
+      e.to_folded(buf, sizeof(buf));
+      EXPECT_EQ(0, STRNCMP(buf, "tenant_1002;ASHPROFILEBUSY;", STRLEN("tenant_1002;ASHPROFILEBUSY;")));
+    }
+    return OB_SUCCESS;
+  };
+  ASSERT_EQ(OB_SUCCESS, profiler.for_each_entry(fn));
+  ObActiveSessionGuard::setup_default_ash();
+  ASSERT_GT(sample_cnt, 0);
+  // disabling the profiler clears the profile
+  ASSERT_EQ(OB_SUCCESS, profiler.set_interval(0));
+  ASSERT_EQ(0, count_entries(profiler, 0, INT64_MAX));
+}
+
+} // end namespace common
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
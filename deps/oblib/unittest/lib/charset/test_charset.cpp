@@ -236,6 +236,39 @@ TEST_F(TestCharset, sortkey)
   //size1 = ObCharset::sortkey(CS_TYPE_UTF8MB4_GENERAL_CI, true, p, 0, aa1, 10);
 }
 
+TEST_F(TestCharset, sortkey_var_len_uca)
+{
+  // memcmp of variable length sortkeys keeps the order of strnncollsp
+  const char *strs[] = {"", " ", "a", "A", "a ", "a  ", "a b", "a  b", "a\t", "a \t", "ab",
+                        "aB", "b", "\xc3\xa0", "\xe4\xbd\xa0\xe5\xa5\xbd", "z  ", "_"};
+  const int64_t str_cnt = sizeof(strs) / sizeof(strs[0]);
+  ObCollationType cs_types[] = {CS_TYPE_UTF8MB4_UNICODE_CI, CS_TYPE_UTF8MB4_0900_AI_CI};
+  char key1[128];
+  char key2[128];
+  for (int64_t c = 0; c < 2; ++c) {
+    for (int64_t i = 0; i < str_cnt; ++i) {
+      for (int64_t j = 0; j < str_cnt; ++j) {
+        bool is_valid1 = false;
+        bool is_valid2 = false;
+        size_t len1 = ObCharset::sortkey_var_len(cs_types[c], strs[i], strlen(strs[i]), key1,
+                                                 sizeof(key1), false, is_valid1);
+        size_t len2 = ObCharset::sortkey_var_len(cs_types[c], strs[j], strlen(strs[j]), key2,
+                                                 sizeof(key2), false, is_valid2);
+        ASSERT_TRUE(len1 > 0 && len2 > 0);
+        ASSERT_TRUE(is_valid1 && is_valid2);
+        int cmp = ObCharset::strcmpsp(cs_types[c], strs[i], strlen(strs[i]), strs[j], strlen(strs[j]), false);
+        int key_cmp = memcmp(key1, key2, std::min(len1, len2));
+        key_cmp = 0 != key_cmp ? key_cmp : static_cast<int>(len1) - static_cast<int>(len2);
+        ASSERT_EQ(cmp > 0, key_cmp > 0) << cs_types[c] << " " << i << " " << j;
+        ASSERT_EQ(cmp < 0, key_cmp < 0) << cs_types[c] << " " << i << " " << j;
+      }
+    }
+  }
+  // too small buffer
+  bool is_valid = false;
+  ASSERT_EQ(0, ObCharset::sortkey_var_len(CS_TYPE_UTF8MB4_UNICODE_CI, "abc", 3, key1, 4, false, is_valid));
+}
+
 TEST_F(TestCharset, casedn)
 {
   char a1[14] = "Variable_name";
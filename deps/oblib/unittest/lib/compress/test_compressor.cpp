@@ -15,6 +15,7 @@
 #include "lib/hash/ob_hashmap.h"
 #include "lib/container/ob_array.h"
 #include "lib/compress/ob_compressor_pool.h"
+#include "lib/compress/ob_compress_dict.h"
 #include "lib/alloc/alloc_func.h"
 #include "lib/ob_define.h"
 #include "zlib.h"
@@ -380,6 +381,113 @@ TEST_F(ObCompressorTest, test_zstd)
   test_normal(zstd_compressor);
 }
 
+TEST(ObCompressDict, zstd_1_3_8_dict)
+{
+  ObMalloc alloc;
+  zstd_1_3_8::ObZstdCompressor_1_3_8 compressor(alloc);
+  ObCompressDictTrainer trainer(alloc);
+  ObCompressDictMgr &dict_mgr = ObCompressDictMgr::get_instance();
+  const int64_t block_size = 4096;
+  const int64_t block_cnt = 256;
+  char *blocks = static_cast<char *>(alloc.alloc(block_size * block_cnt));
+  ASSERT_TRUE(NULL != blocks);
+  // repetitive string rows, which compress poorly in small blocks without a dictionary
+  int64_t pos = 0;
+  for (int64_t i = 0; pos < block_size * block_cnt - 128; i++) {
+    pos += snprintf(blocks + pos, 128, "{\"status\":\"delivered\",\"carrier\":\"express-%ld\",\"order_id\":%ld}",
+        i % 7, i * 7919 % 100003);
+  }
+  ASSERT_EQ(OB_SUCCESS, trainer.init());
+  for (int64_t i = 0; i < block_cnt && !trainer.is_ready(); i++) {
+    ASSERT_EQ(OB_SUCCESS, trainer.add_sample(blocks + i * block_size, block_size));
+  }
+  ASSERT_TRUE(trainer.is_ready());
+  char dict_buf[ObCompressDictTrainer::DEFAULT_DICT_SIZE];
+  int64_t dict_len = 0;
+  ASSERT_EQ(OB_SUCCESS, trainer.train(dict_buf, sizeof(dict_buf), dict_len));
+  ASSERT_GE(dict_len, ObCompressDictTrainer::MIN_DICT_SIZE);
+
+  ObCompressDict *dict = NULL;
+  ObCompressDict *same_dict = NULL;
+  ASSERT_EQ(OB_SUCCESS, dict_mgr.acquire(dict_buf, dict_len, dict));
+  ASSERT_EQ(OB_SUCCESS, dict_mgr.acquire(dict_buf, dict_len, same_dict));
+  ASSERT_EQ(dict, same_dict);
+  ASSERT_EQ(2, dict->get_ref());
+  dict_mgr.revert(same_dict);
+  // the reader gets the dict id stored in the sstable meta
+  const ObDecompressDict decompress_dict(dict_buf, dict_len,
+                                         ObCompressDictMgr::calc_dict_id(dict_buf, dict_len));
+  ASSERT_EQ(dict->get_dict_id(), decompress_dict.dict_id_);
+
+  const int64_t dst_size = block_size * 2;
+  char *dst = static_cast<char *>(alloc.alloc(dst_size));
+  char *decomp = static_cast<char *>(alloc.alloc(block_size));
+  int64_t total_size = 0;
+  int64_t total_dict_size = 0;
+  for (int64_t i = 0; i < block_cnt; i++) {
+    const char *block = blocks + i * block_size;
+    int64_t comp_size = 0;
+    int64_t decomp_size = 0;
+    ASSERT_EQ(OB_SUCCESS, compressor.compress(block, block_size, dst, dst_size, comp_size));
+    total_size += comp_size;
+    ASSERT_EQ(OB_SUCCESS, compressor.compress(block, block_size, dst, dst_size, comp_size, *dict));
+    total_dict_size += comp_size;
+    ASSERT_EQ(OB_SUCCESS, compressor.decompress(dst, comp_size, decomp, block_size, decomp_size,
+                                                decompress_dict));
+    ASSERT_EQ(block_size, decomp_size);
+    ASSERT_EQ(0, MEMCMP(block, decomp, block_size));
+  }
+  COMMON_LOG(INFO, "dict compression", K(dict_len), K(total_size), K(total_dict_size));
+  ASSERT_LT(total_dict_size, total_size);
+
+  // the dictionary is required by decompression, and only the registry of the writers is
+  // released here, the reader passes the bytes of the dictionary
+  int64_t comp_size = 0;
+  int64_t decomp_size = 0;
+  ASSERT_EQ(OB_SUCCESS, compressor.compress(blocks, block_size, dst, dst_size, comp_size, *dict));
+  dict_mgr.revert(dict);
+  ASSERT_EQ(0, dict_mgr.get_dict_cnt());
+  ASSERT_EQ(OB_ERR_COMPRESS_DECOMPRESS_DATA,
+            compressor.decompress(dst, comp_size, decomp, block_size, decomp_size));
+  ASSERT_EQ(OB_SUCCESS, compressor.decompress(dst, comp_size, decomp, block_size, decomp_size,
+                                              decompress_dict));
+  ASSERT_EQ(0, MEMCMP(blocks, decomp, block_size));
+  // another dictionary is rejected by the dict id
+  char other_dict[ObCompressDictTrainer::DEFAULT_DICT_SIZE];
+  MEMCPY(other_dict, dict_buf, dict_len);
+  other_dict[0] ^= 0x1;
+  const ObDecompressDict other_decompress_dict(other_dict, dict_len,
+                                               ObCompressDictMgr::calc_dict_id(other_dict, dict_len));
+  ASSERT_EQ(OB_ERR_COMPRESS_DECOMPRESS_DATA,
+            compressor.decompress(dst, comp_size, decomp, block_size, decomp_size,
+                                  other_decompress_dict));
+  // the cached context of the thread follows the dictionary of the block
+  int64_t other_comp_size = 0;
+  ObCompressDict *other = NULL;
+  char *other_dst = static_cast<char *>(alloc.alloc(dst_size));
+  ASSERT_TRUE(NULL != other_dst);
+  ASSERT_EQ(OB_SUCCESS, dict_mgr.acquire(other_dict, dict_len, other));
+  ASSERT_EQ(OB_SUCCESS, compressor.compress(blocks, block_size, other_dst, dst_size, other_comp_size, *other));
+  dict_mgr.revert(other);
+  for (int64_t i = 0; i < 4; i++) {
+    ASSERT_EQ(OB_SUCCESS, compressor.decompress(other_dst, other_comp_size, decomp, block_size,
+                                                decomp_size, other_decompress_dict));
+    ASSERT_EQ(0, MEMCMP(blocks, decomp, block_size));
+    ASSERT_EQ(OB_SUCCESS, compressor.decompress(dst, comp_size, decomp, block_size, decomp_size,
+                                                decompress_dict));
+    ASSERT_EQ(0, MEMCMP(blocks, decomp, block_size));
+  }
+  alloc.free(other_dst);
+  // a block compressed without dictionary is still readable with the dictionary
+  ASSERT_EQ(OB_SUCCESS, compressor.compress(blocks, block_size, dst, dst_size, comp_size));
+  ASSERT_EQ(OB_SUCCESS, compressor.decompress(dst, comp_size, decomp, block_size, decomp_size,
+                                              decompress_dict));
+  ASSERT_EQ(0, MEMCMP(blocks, decomp, block_size));
+  alloc.free(blocks);
+  alloc.free(dst);
+  alloc.free(decomp);
+}
+
 TEST(ObCompressorStress, compress_stable)
 {
   int ret = OB_SUCCESS;
@@ -18,6 +18,7 @@
 #include "lib/random/ob_random.h"
 #include "lib/utility/ob_template_utils.h"
 #include "lib/thread/thread_pool.h"
+#include "lib/stat/ob_diagnose_info.h"
 #include "gtest/gtest.h"
 #define private public
 #include "lib/worker.h"
@@ -293,6 +294,68 @@ TEST(ObLatch,wr2rdlock)
   stress.wait();
 }
 
+class TestLatchHandoff: public lib::ThreadPool
+{
+public:
+  TestLatchHandoff() : cnt_(0) {}
+  void run1() final
+  {
+    for (int i = 0; i < max_cnt; ++i) {
+      ASSERT_EQ(OB_SUCCESS, latch_.wrlock(ObLatchIds::TABLET_BUCKET_LOCK));
+      for (int j = 0; j < 10; ++j) {
+        ObRandom::rand(1, 1000);
+      }
+      ++cnt_;
+      ASSERT_EQ(OB_SUCCESS, latch_.unlock());
+    }
+  }
+  ObLatch latch_;
+  int64_t cnt_;
+};
+
+TEST(ObLatch, handoff)
+{
+  ASSERT_EQ(ObLatchPolicy::LATCH_FIFO_HANDOFF, OB_LATCHES[ObLatchIds::TABLET_BUCKET_LOCK].policy_);
+  TestLatchHandoff test;
+  test.set_thread_count(MUTEX_THR);
+  test.start();
+  test.wait();
+  ASSERT_EQ(MUTEX_THR * max_cnt, test.cnt_);
+  ASSERT_FALSE(test.latch_.is_locked());
+}
+
+TEST(ObLatch, adaptive_spin)
+{
+  ObLatch latch;
+  const uint32_t latch_id = ObLatchIds::DEFAULT_SPIN_RWLOCK;
+  for (int i = 0; i < 10 * ObLatchHoldStat::SAMPLE_INTERVAL; ++i) {
+    ASSERT_EQ(OB_SUCCESS, latch.wrlock(latch_id));
+    ::usleep(1);
+    ASSERT_EQ(OB_SUCCESS, latch.unlock());
+  }
+  ASSERT_GT(ObLatchHoldStat::get_hold_ns(latch_id), 0);
+  ASSERT_LE(ObLatchHoldStat::get_spin_cnt(latch_id), OB_LATCHES[latch_id].max_spin_cnt_);
+  ASSERT_GE(ObLatchHoldStat::get_spin_cnt(latch_id), ObLatchHoldStat::MIN_SPIN_CNT);
+}
+
+TEST(ObLatch, time_hist)
+{
+  ObLatchTimeHist hist;
+  hist.inc(0);
+  hist.inc(255);
+  hist.inc(256);
+  hist.inc(1023);
+  hist.inc(1024);
+  hist.inc(100L * 1000 * 1000);
+  ASSERT_EQ(2, hist.buckets_[0]);
+  ASSERT_EQ(2, hist.buckets_[1]);
+  ASSERT_EQ(1, hist.buckets_[2]);
+  ASSERT_EQ(1, hist.buckets_[ObLatchTimeHist::BUCKET_CNT - 1]);
+  char buf[OB_MAX_CHAR_LENGTH];
+  const int64_t len = hist.to_string(buf, sizeof(buf));
+  ASSERT_EQ(0, strncmp("<256ns:2,<1us:2,<4us:1,>=16ms:1", buf, len));
+}
+
 TEST(ObLatch, invaid_unlock)
 {
   lib::ObMutex mutex;
@@ -0,0 +1,228 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include "lib/allocator/ob_malloc.h"
+#include "lib/queue/ob_priority_queue.h"
+#include "lib/thread/thread_pool.h"
+#include <iostream>
+
+using namespace oceanbase::lib;
+using namespace oceanbase::common;
+using namespace std;
+
+// Same priority layout as the tenant request queue: 1 high, 2 normal and 3 low priorities.
+enum { HIGH_PRIOS = 1, NORMAL_PRIOS = 2, LOW_PRIOS = 3, PRIO_CNT = HIGH_PRIOS + NORMAL_PRIOS + LOW_PRIOS };
+
+struct QData: public ObLink
+{
+  QData(int64_t prio, int64_t ts): prio_(prio), ts_(ts) {}
+  ~QData() {}
+  int64_t prio_;
+  int64_t ts_;
+};
+
+template <typename Queue>
+class TestQueue: public ThreadPool
+{
+public:
+  enum { BATCH = 64 };
+  TestQueue(const char *name, const int64_t limit)
+    : name_(name), push_seq_(0), pop_seq_(0), pop_cnt_(), wait_us_(), limit_(limit), stop_(false) {}
+  virtual ~TestQueue() {}
+  void do_stress()
+  {
+    set_thread_count(atoi(getenv("n_thread")?: "8"));
+    n_pusher_ = atoi(getenv("n_pusher")?: "4");
+    queue_.set_limit(65536);
+    int ret = OB_SUCCESS;
+    const int64_t start_ts = ObTimeUtility::current_time();
+    if (OB_FAIL(start())) {
+      LIB_LOG(ERROR, "start fail", K(ret), K(errno));
+      exit(-1);
+    }
+    wait();
+    const int64_t cost_us = max(ObTimeUtility::current_time() - start_ts, 1L);
+    // consumers give up once the producers stop, pop what they left
+    QData *data = NULL;
+    while (OB_SUCCESS == queue_.pop((ObLink*&)data, 0)) {
+      ATOMIC_INC(&pop_cnt_[data->prio_]);
+      delete data;
+    }
+    cout << name_ << " tps: " << BATCH * limit_ * 1000000 / cost_us << endl;
+    int64_t total_pop_cnt = 0;
+    for (int i = 0; i < PRIO_CNT; i++) {
+      cout << name_ << " queue[" << i << "] pop_cnt: " << pop_cnt_[i]
+           << " avg_wait_us: " << (0 == pop_cnt_[i] ? 0 : wait_us_[i] / pop_cnt_[i]) << endl;
+      total_pop_cnt += pop_cnt_[i];
+    }
+    // no request is lost or popped twice
+    ASSERT_EQ(BATCH * limit_, total_pop_cnt);
+    ASSERT_EQ(0, queue_.size());
+  }
+  int64_t get_seq(int64_t &seq) {
+    return ATOMIC_FAA(&seq, 1);
+  }
+  int insert(int64_t seq) {
+    QData* data = new QData(seq % PRIO_CNT, ObTimeUtility::current_time());
+    return queue_.push(data, static_cast<int>(data->prio_));
+  }
+  int del(uint64_t idx) {
+    int err;
+    QData* data = NULL;
+    // workers are dispatched in the same way as the tenant: one worker for
+    // high priority, one for normal and the others for all priorities.
+    if (idx == 0) {
+      err = queue_.pop_high((ObLink*&)data, 10000);
+    } else if (idx == 1) {
+      err = queue_.pop_normal((ObLink*&)data, 10000);
+    } else {
+      err = queue_.pop((ObLink*&)data, 10000);
+    }
+    if (NULL != data) {
+      ATOMIC_INC(&pop_cnt_[data->prio_]);
+      ATOMIC_AAF(&wait_us_[data->prio_], ObTimeUtility::current_time() - data->ts_);
+    }
+    delete data;
+    return err;
+  }
+
+  void run1() override
+  {
+    int ret = OB_SUCCESS;
+    int64_t seq = 0;
+    const uint64_t idx = get_thread_idx();
+    if (idx >= get_thread_count() - n_pusher_) {
+      while((seq = get_seq(push_seq_)) < limit_) {
+        for(int i = 0; i < BATCH; i++) {
+          do { ret = insert(seq * BATCH + i); } while (OB_FAIL(ret));
+        }
+      }
+      ATOMIC_STORE(&stop_, true);
+    } else {
+      while((seq = get_seq(pop_seq_)) < limit_) {
+        for(int i = 0; i < BATCH; i++) {
+          do { ret = del(idx); } while (OB_FAIL(ret) && !ATOMIC_LOAD(&stop_));
+        }
+      }
+    }
+  }
+private:
+  const char *name_;
+  int64_t push_seq_ CACHE_ALIGNED;
+  int64_t pop_seq_ CACHE_ALIGNED;
+  int64_t pop_cnt_[PRIO_CNT] CACHE_ALIGNED;
+  int64_t wait_us_[PRIO_CNT];
+  int64_t limit_;
+  int64_t n_pusher_;
+  Queue queue_;
+  bool stop_;
+};
+
+typedef ObShardedPriorityQueue<HIGH_PRIOS, NORMAL_PRIOS, LOW_PRIOS> ShardedQueue;
+
+TEST(TestShardedPriorityQueue, priority_order)
+{
+  ShardedQueue queue;
+  QData *data = NULL;
+  int priority = -1;
+  // push from low to high priority, several requests for each
+  for (int64_t i = 0; i < 4 * PRIO_CNT; i++) {
+    const int64_t prio = PRIO_CNT - 1 - i / 4;
+    ASSERT_EQ(OB_SUCCESS, queue.push(new QData(prio, i), static_cast<int>(prio)));
+  }
+  ASSERT_EQ(4 * PRIO_CNT, queue.size());
+  for (int i = 0; i < PRIO_CNT; i++) {
+    ASSERT_EQ(4, queue.queue_size(i));
+  }
+  // high priority workers never see the lower ones
+  ASSERT_EQ(OB_SUCCESS, queue.pop_high((ObLink*&)data, 0, &priority));
+  ASSERT_EQ(0, priority);
+  ASSERT_EQ(0, data->prio_);
+  delete data;
+  // requests come out in priority order whichever shard they were pushed to
+  int64_t last_prio = 0;
+  for (int64_t i = 1; i < 4 * PRIO_CNT; i++) {
+    ASSERT_EQ(OB_SUCCESS, queue.pop((ObLink*&)data, 0, &priority));
+    ASSERT_EQ(data->prio_, priority);
+    ASSERT_GE(data->prio_, last_prio);
+    last_prio = data->prio_;
+    delete data;
+  }
+  ASSERT_EQ(0, queue.size());
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, queue.pop((ObLink*&)data, 0));
+  ASSERT_TRUE(NULL == data);
+}
+
+TEST(TestShardedPriorityQueue, pop_normal_skip_low)
+{
+  ShardedQueue queue;
+  QData *data = NULL;
+  ASSERT_EQ(OB_SUCCESS, queue.push(new QData(PRIO_CNT - 1, 0), PRIO_CNT - 1));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, queue.pop_normal((ObLink*&)data, 0));
+  ASSERT_EQ(OB_ENTRY_NOT_EXIST, queue.pop_high((ObLink*&)data, 0));
+  ASSERT_EQ(OB_SUCCESS, queue.push(new QData(HIGH_PRIOS, 1), HIGH_PRIOS));
+  ASSERT_EQ(OB_SUCCESS, queue.pop_normal((ObLink*&)data, 0));
+  ASSERT_EQ(HIGH_PRIOS, data->prio_);
+  delete data;
+  ASSERT_EQ(OB_SUCCESS, queue.pop((ObLink*&)data, 0));
+  ASSERT_EQ(PRIO_CNT - 1, data->prio_);
+  delete data;
+  ASSERT_EQ(OB_INVALID_ARGUMENT, queue.push(NULL, 0));
+  ASSERT_EQ(0, queue.size());
+}
+
+TEST(TestShardedPriorityQueue, limit)
+{
+  ShardedQueue queue;
+  QData *data = NULL;
+  queue.set_limit(4);
+  // low priority requests have no extra room
+  for (int64_t i = 0; i < 5; i++) {
+    ASSERT_EQ(OB_SUCCESS, queue.push(new QData(PRIO_CNT - 1, i), PRIO_CNT - 1));
+  }
+  data = new QData(PRIO_CNT - 1, 5);
+  ASSERT_EQ(OB_SIZE_OVERFLOW, queue.push(data, PRIO_CNT - 1));
+  delete data;
+  ASSERT_EQ(5, queue.size());
+  while (OB_SUCCESS == queue.pop((ObLink*&)data, 0)) {
+    delete data;
+  }
+  ASSERT_EQ(0, queue.size());
+}
+
+TEST(TestShardedPriorityQueue, concurrent)
+{
+  TestQueue<ShardedQueue> tq("sharded_priority_queue", 1000);
+  tq.do_stress();
+}
+
+// benchmark, run with --gtest_also_run_disabled_tests
+TEST(TestShardedPriorityQueue, DISABLED_bench_priority_queue2)
+{
+  TestQueue<ObPriorityQueue2<HIGH_PRIOS, NORMAL_PRIOS, LOW_PRIOS>> tq("priority_queue2",
+                                                                      atoll(getenv("limit")?: "100000"));
+  tq.do_stress();
+}
+
+TEST(TestShardedPriorityQueue, DISABLED_bench_sharded_priority_queue)
+{
+  TestQueue<ShardedQueue> tq("sharded_priority_queue", atoll(getenv("limit")?: "100000"));
+  tq.do_stress();
+}
+
+int main(int argc, char *argv[])
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,132 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "lib/oblog/ob_log.h"
+#include "lib/time/ob_time_utility.h"
+#include "lib/vector/ob_vector_distance_simd.h"
+
+using namespace oceanbase::common;
+using namespace std;
+
+#if OB_USE_MULTITARGET_CODE
+class TestVectorDistanceSimd : public ::testing::Test
+{
+public:
+  void SetUp() override
+  {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-10, 10);
+    a_.resize(MAX_LEN);
+    b_.resize(MAX_LEN);
+    for (int64_t i = 0; i < MAX_LEN; ++i) {
+      a_[i] = dist(gen);
+      b_[i] = dist(gen);
+    }
+  }
+  void expect_near(const double expect, const double value)
+  {
+    ASSERT_NEAR(expect, value, 1e-9 * std::max(1.0, fabs(expect)));
+  }
+  void check(const int64_t len)
+  {
+    const float *a = a_.data();
+    const float *b = b_.data();
+    double l2 = 0;
+    double ip = 0;
+    double l1 = 0;
+    double norm_a = 0;
+    double norm_b = 0;
+    for (int64_t i = 0; i < len; ++i) {
+      const double diff = a[i] - b[i];
+      l2 += diff * diff;
+      ip += static_cast<double>(a[i]) * b[i];
+      l1 += fabs(a[i] - b[i]);
+      norm_a += static_cast<double>(a[i]) * a[i];
+      norm_b += static_cast<double>(b[i]) * b[i];
+    }
+    double cos_ip = 0;
+    double cos_a = 0;
+    double cos_b = 0;
+    if (is_arch_supported(ObTargetArch::AVX2)) {
+      expect_near(l2, specific::avx2::l2_square(a, b, len));
+      expect_near(ip, specific::avx2::inner_product(a, b, len));
+      expect_near(l1, specific::avx2::l1_distance(a, b, len));
+      specific::avx2::cosine_calculate(a, b, len, cos_ip, cos_a, cos_b);
+      expect_near(ip, cos_ip);
+      expect_near(norm_a, cos_a);
+      expect_near(norm_b, cos_b);
+    }
+    if (is_arch_supported(ObTargetArch::AVX512)) {
+      expect_near(l2, specific::avx512::l2_square(a, b, len));
+      expect_near(ip, specific::avx512::inner_product(a, b, len));
+      expect_near(l1, specific::avx512::l1_distance(a, b, len));
+      specific::avx512::cosine_calculate(a, b, len, cos_ip, cos_a, cos_b);
+      expect_near(ip, cos_ip);
+      expect_near(norm_a, cos_a);
+      expect_near(norm_b, cos_b);
+    }
+  }
+protected:
+  static const int64_t MAX_LEN = 2048;
+  vector<float> a_;
+  vector<float> b_;
+};
+
+TEST_F(TestVectorDistanceSimd, kernels)
+{
+  // lengths around the vector widths exercise the scalar tails
+  for (int64_t len = 0; len <= 65; ++len) {
+    check(len);
+  }
+  check(128);
+  check(1000);
+  check(MAX_LEN);
+}
+
+TEST_F(TestVectorDistanceSimd, bench)
+{
+  const int64_t dim = 128;
+  const int64_t row_cnt = MAX_LEN / dim;
+  const int64_t loop_cnt = 100000;
+  double sum = 0;
+  int64_t begin_us = ObTimeUtility::current_time();
+  for (int64_t i = 0; i < loop_cnt; ++i) {
+    const float *b = b_.data() + (i % row_cnt) * dim;
+    double diff = 0;
+    for (int64_t j = 0; j < dim; ++j) {
+      diff = a_[j] - b[j];
+      sum += diff * diff;
+    }
+  }
+  const int64_t normal_us = ObTimeUtility::current_time() - begin_us;
+  int64_t simd_us = 0;
+  if (is_arch_supported(ObTargetArch::AVX2)) {
+    begin_us = ObTimeUtility::current_time();
+    for (int64_t i = 0; i < loop_cnt; ++i) {
+      sum += specific::avx2::l2_square(a_.data(), b_.data() + (i % row_cnt) * dim, dim);
+    }
+    simd_us = ObTimeUtility::current_time() - begin_us;
+  }
+  cout << "dim=" << dim << " loop=" << loop_cnt << " normal_us=" << normal_us
+       << " avx2_us=" << simd_us << " sum=" << sum << endl;
+}
+#endif
+
+int main(int argc, char *argv[])
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,215 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <sstream>
+#include <random>
+#include <set>
+#include "lib/allocator/ob_malloc.h"
+#include "lib/time/ob_time_utility.h"
+#include "lib/vector/ob_vector_ivf_index.h"
+
+using namespace oceanbase::common;
+using namespace std;
+
+class TestVsagAllocator : public vsag::Allocator
+{
+public:
+  std::string Name() override { return "TestVsagAlloc"; }
+  void *Allocate(size_t size) override { return ob_malloc(size, ObMemAttr(OB_SERVER_TENANT_ID, "TestIvf")); }
+  void Deallocate(void *p) override { ob_free(p); }
+  void *Reallocate(void *p, size_t size) override { return ob_realloc(p, size, ObMemAttr(OB_SERVER_TENANT_ID, "TestIvf")); }
+};
+
+// synthetic embeddings: gaussian clusters around random centers
+class TestVectorIvfIndex : public ::testing::Test
+{
+public:
+  static const int64_t DIM = 128;
+  static const int64_t CLUSTER_CNT = 100;
+  static const int64_t TOPK = 10;
+  static const int64_t NLIST = 128;
+  static const int64_t NPROBE = 8;
+  void SetUp() override
+  {
+    row_cnt_ = atoll(getenv("row_cnt") ?: "20000");
+    query_cnt_ = atoll(getenv("query_cnt") ?: "200");
+    std::mt19937 gen(42);
+    std::normal_distribution<float> normal;
+    vector<float> centers(CLUSTER_CNT * DIM);
+    for (float &v : centers) {
+      v = normal(gen) * 2;
+    }
+    vectors_.resize(row_cnt_ * DIM);
+    vids_.resize(row_cnt_);
+    for (int64_t i = 0; i < row_cnt_; ++i) {
+      vids_[i] = i;
+      for (int64_t d = 0; d < DIM; ++d) {
+        vectors_[i * DIM + d] = centers[(i % CLUSTER_CNT) * DIM + d] + normal(gen);
+      }
+    }
+    queries_.resize(query_cnt_ * DIM);
+    for (int64_t i = 0; i < query_cnt_; ++i) {
+      for (int64_t d = 0; d < DIM; ++d) {
+        queries_[i * DIM + d] = centers[(i * 7 % CLUSTER_CNT) * DIM + d] + normal(gen);
+      }
+    }
+  }
+  void exact_top_k(const ObVectorIvfMetric metric, const float *query, const int64_t *candidates,
+                   const int64_t candidate_cnt, vector<int64_t> &result)
+  {
+    vector<pair<float, int64_t>> dists;
+    for (int64_t i = 0; i < candidate_cnt; ++i) {
+      const int64_t vid = nullptr == candidates ? i : candidates[i];
+      dists.push_back(make_pair(ObVectorIvfIndex::calc_distance(metric, query, &vectors_[vid * DIM], DIM), vid));
+    }
+    const int64_t cnt = min(TOPK, candidate_cnt);
+    partial_sort(dists.begin(), dists.begin() + cnt, dists.end());
+    result.clear();
+    for (int64_t i = 0; i < cnt; ++i) {
+      result.push_back(dists[i].second);
+    }
+  }
+  // build the index, then search every query for refine_k * TOPK candidates, re-rank them against
+  // the full vectors and report recall@TOPK, qps and memory footprint
+  void bench(const ObVectorIvfMetric metric, const ObVectorQuantizerType quantizer, const int64_t refine_k,
+             double &recall, int64_t &memory)
+  {
+    TestVsagAllocator allocator;
+    ObVectorIvfIndex index(&allocator);
+    const int64_t pq_m = DIM / 4;
+    const int64_t batch = 1000;
+    ASSERT_EQ(OB_SUCCESS, index.init(DIM, metric, quantizer, NLIST, pq_m));
+    for (int64_t i = 0; i < row_cnt_; i += batch) {
+      ASSERT_EQ(OB_SUCCESS, index.add(&vectors_[i * DIM], &vids_[i], DIM, min(batch, row_cnt_ - i)));
+    }
+    int64_t build_us = ObTimeUtility::current_time();
+    ASSERT_EQ(OB_SUCCESS, index.train());
+    build_us = ObTimeUtility::current_time() - build_us;
+    ASSERT_TRUE(index.is_trained());
+    ASSERT_EQ(row_cnt_, index.get_count());
+
+    const int64_t candidate_cnt = TOPK * refine_k;
+    vector<float> distances(candidate_cnt);
+    vector<int64_t> candidates(candidate_cnt);
+    vector<int64_t> result;
+    vector<int64_t> truth;
+    int64_t hit = 0;
+    int64_t search_us = 0;
+    for (int64_t i = 0; i < query_cnt_; ++i) {
+      const float *query = &queries_[i * DIM];
+      int64_t result_cnt = 0;
+      int64_t begin_us = ObTimeUtility::current_time();
+      ASSERT_EQ(OB_SUCCESS, index.search(query, DIM, candidate_cnt, NPROBE, nullptr,
+                                         distances.data(), candidates.data(), result_cnt));
+      exact_top_k(metric, query, candidates.data(), result_cnt, result);
+      search_us += ObTimeUtility::current_time() - begin_us;
+      exact_top_k(metric, query, nullptr, row_cnt_, truth);
+      set<int64_t> truth_set(truth.begin(), truth.end());
+      for (int64_t vid : result) {
+        hit += truth_set.count(vid);
+      }
+    }
+    recall = static_cast<double>(hit) / (query_cnt_ * TOPK);
+    memory = index.get_memory_usage();
+    cout << "metric=" << metric << " quantizer=" << quantizer << " refine_k=" << refine_k
+         << " rows=" << row_cnt_ << " dim=" << DIM
+         << " memory=" << memory << " raw=" << row_cnt_ * DIM * sizeof(float)
+         << " recall@" << TOPK << "=" << recall
+         << " qps=" << query_cnt_ * 1000000 / max(search_us, 1L)
+         << " build_us=" << build_us << endl;
+  }
+protected:
+  int64_t row_cnt_;
+  int64_t query_cnt_;
+  vector<float> vectors_;
+  vector<int64_t> vids_;
+  vector<float> queries_;
+};
+
+TEST_F(TestVectorIvfIndex, bench)
+{
+  double flat_recall = 0;
+  double sq8_recall = 0;
+  double pq_recall = 0;
+  int64_t flat_memory = 0;
+  int64_t sq8_memory = 0;
+  int64_t pq_memory = 0;
+  for (int64_t metric = VIVM_L2; metric < VIVM_MAX; ++metric) {
+    bench(static_cast<ObVectorIvfMetric>(metric), VQT_FLAT, 1, flat_recall, flat_memory);
+    bench(static_cast<ObVectorIvfMetric>(metric), VQT_SQ8, 4, sq8_recall, sq8_memory);
+    bench(static_cast<ObVectorIvfMetric>(metric), VQT_PQ, 4, pq_recall, pq_memory);
+    ASSERT_GT(flat_recall, 0.9);
+    ASSERT_GT(sq8_recall, 0.9);
+    ASSERT_GT(pq_recall, 0.8);
+    ASSERT_LT(sq8_memory, flat_memory / 3);
+    ASSERT_LT(pq_memory, sq8_memory);
+  }
+}
+
+TEST_F(TestVectorIvfIndex, untrained_and_filter)
+{
+  TestVsagAllocator allocator;
+  ObVectorIvfIndex index(&allocator);
+  const int64_t row_cnt = 1000;
+  float distances[TOPK];
+  int64_t vids[TOPK];
+  int64_t result_cnt = 0;
+  vector<int64_t> truth;
+  ASSERT_EQ(OB_SUCCESS, index.init(DIM, VIVM_L2, VQT_SQ8, NLIST, 0));
+  ASSERT_EQ(OB_INVALID_ARGUMENT, index.add(vectors_.data(), vids_.data(), DIM + 1, row_cnt));
+  ASSERT_EQ(OB_SUCCESS, index.add(vectors_.data(), vids_.data(), DIM, row_cnt));
+  // untrained index is searched exhaustively with exact distances
+  ASSERT_EQ(OB_SUCCESS, index.search(&vectors_[5 * DIM], DIM, TOPK, NPROBE, nullptr, distances, vids, result_cnt));
+  ASSERT_EQ(TOPK, result_cnt);
+  ASSERT_EQ(5, vids[0]);
+  ASSERT_EQ(0, distances[0]);
+
+  roaring::api::roaring64_bitmap_t *skip_bitmap = roaring::api::roaring64_bitmap_create();
+  roaring::api::roaring64_bitmap_add(skip_bitmap, 5);
+  ASSERT_EQ(OB_SUCCESS, index.search(&vectors_[5 * DIM], DIM, TOPK, NPROBE, skip_bitmap, distances, vids, result_cnt));
+  for (int64_t i = 0; i < result_cnt; ++i) {
+    ASSERT_NE(5, vids[i]);
+  }
+
+  // train then serialize, the deserialized index returns the same results
+  ASSERT_EQ(OB_SUCCESS, index.train());
+  ASSERT_EQ(OB_SUCCESS, index.add(&vectors_[row_cnt * DIM], &vids_[row_cnt], DIM, row_cnt));
+  ASSERT_EQ(2 * row_cnt, index.get_count());
+  std::stringstream stream;
+  ASSERT_EQ(OB_SUCCESS, index.serialize(stream));
+  ObVectorIvfIndex other(&allocator);
+  ASSERT_EQ(OB_SUCCESS, other.deserialize(stream));
+  ASSERT_TRUE(other.is_trained());
+  ASSERT_EQ(index.get_count(), other.get_count());
+  ASSERT_EQ(index.get_memory_usage() >= other.get_memory_usage(), true);
+  float other_distances[TOPK];
+  int64_t other_vids[TOPK];
+  int64_t other_cnt = 0;
+  for (int64_t i = 0; i < 10; ++i) {
+    const float *query = &queries_[i * DIM];
+    ASSERT_EQ(OB_SUCCESS, index.search(query, DIM, TOPK, NPROBE, skip_bitmap, distances, vids, result_cnt));
+    ASSERT_EQ(OB_SUCCESS, other.search(query, DIM, TOPK, NPROBE, skip_bitmap, other_distances, other_vids, other_cnt));
+    ASSERT_EQ(result_cnt, other_cnt);
+    for (int64_t j = 0; j < result_cnt; ++j) {
+      ASSERT_EQ(vids[j], other_vids[j]);
+    }
+  }
+  roaring::api::roaring64_bitmap_free(skip_bitmap);
+}
+
+int main(int argc, char *argv[])
+{
+  oceanbase::common::ObLogger::get_logger().set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -129,6 +129,16 @@ public:
     uint64_t len,
     bool set_uft8,
     ObString& data);
+  void query_check_lob_data(
+    char *data,
+    ObIAllocator &allocator,
+    uint64_t lob_id,
+    uint64_t byte_size,
+    uint64_t offset,
+    uint64_t len,
+    uint64_t read_size,
+    bool is_reverse,
+    bool use_piece);
 protected:
   uint64_t tenant_id_;
   share::ObLSID ls_id_;
@@ -738,6 +748,106 @@ void TestLobManager::scan_lob_meta(
   tx_service->release_tx(*tx_desc);
 }
 
+void TestLobManager::query_check_lob_data(
+    char *data,
+    ObIAllocator &allocator,
+    uint64_t lob_id,
+    uint64_t byte_size,
+    uint64_t offset,
+    uint64_t len,
+    uint64_t read_size,
+    bool is_reverse,
+    bool use_piece)
+{
+  EXPECT_EQ(OB_SYS_TENANT_ID, MTL_ID());
+  ObLobManager *mgr = MTL(ObLobManager*);
+  char lob_data[1024];
+  ObLobCommon *lob_common = new(lob_data)ObLobCommon();
+  lob_common->is_init_ = 1;
+  lob_common->in_row_ = 0;
+  ObLobData *loc = new(lob_common->buffer_)ObLobData();
+  loc->id_.tablet_id_ = tablet_id_.id();
+  loc->id_.lob_id_ = lob_id;
+  loc->byte_size_ = byte_size;
+
+  // prepare table schema
+  share::schema::ObTableSchema table_schema;
+  TestLobCommon::build_lob_meta_table_schema(tenant_id_, table_schema);
+
+  // build table param
+  share::schema::ObTableParam table_param(allocator);
+  ObSArray<uint64_t> colunm_ids;
+  for (int i = 0; i < ObLobMetaUtil::LOB_META_COLUMN_CNT; i++) {
+    colunm_ids.push_back(OB_APP_MIN_COLUMN_ID + i);
+  }
+  ASSERT_EQ(OB_SUCCESS, TestDmlCommon::build_table_param(table_schema, colunm_ids, table_param));
+
+  transaction::ObTxDesc *tx_desc = nullptr;
+  ASSERT_EQ(OB_SUCCESS, TestDmlCommon::build_tx_desc(tenant_id_, tx_desc));
+  ObTxIsolationLevel isolation = ObTxIsolationLevel::RC;
+  int64_t expire_ts = ObTimeUtility::current_time() + 12 * 1000 * 1000;
+  ObTxReadSnapshot read_snapshot;
+  transaction::ObTransService *tx_service = MTL(transaction::ObTransService*);
+  ASSERT_EQ(OB_SUCCESS, tx_service->get_read_snapshot(*tx_desc, isolation, expire_ts, read_snapshot));
+
+  ObLobAccessParam param;
+  param.tx_desc_ = tx_desc;
+  param.snapshot_ = read_snapshot;
+  param.tx_id_ = tx_desc->get_tx_id();
+  param.sql_mode_ = SMO_DEFAULT;
+  param.allocator_ = &allocator;
+  param.meta_table_schema_ = &table_schema;
+  param.meta_tablet_param_ = &table_param;
+  param.ls_id_ = ls_id_;
+  param.tablet_id_ = tablet_id_;
+  param.coll_type_ = CS_TYPE_BINARY;
+  param.lob_common_ = lob_common;
+  param.byte_size_ = byte_size;
+  param.handle_size_ = 1024;
+  param.timeout_ = expire_ts;
+  param.scan_backward_ = is_reverse;
+  param.offset_ = offset;
+  param.len_ = len;
+  printf("[QUERY] query [%lu, %lu], read size %lu, reverse %d, piece %d\n",
+         offset, offset + len, read_size, is_reverse, use_piece);
+  ObLobQueryIter *iter = NULL;
+  ASSERT_EQ(OB_SUCCESS, mgr->query(param, iter));
+  char *read_ptr = reinterpret_cast<char*>(allocator.alloc(read_size));
+  ASSERT_NE(nullptr, read_ptr);
+  int ret = OB_SUCCESS;
+  uint64_t read_len = 0;
+  int64_t read_cnt = 0;
+  while (OB_SUCC(ret)) {
+    ObString read_str;
+    if (use_piece && read_cnt > 0) {
+      // refers to the meta row, valid until next call
+      ret = iter->get_next_piece(read_str);
+    } else {
+      read_str.assign_buffer(read_ptr, read_size);
+      ret = iter->get_next_row(read_str);
+    }
+    if (OB_SUCC(ret)) {
+      read_cnt++;
+      ASSERT_LT(0, read_str.length());
+      ASSERT_GE(len, read_len + read_str.length());
+      if (use_piece && read_cnt > 1) {
+        ASSERT_TRUE(read_str.ptr() < read_ptr || read_str.ptr() >= read_ptr + read_size);
+      }
+      // data of a reverse query is handed out from the end of the range
+      const char *expect = is_reverse ? data + offset + len - read_len - read_str.length() : data + offset + read_len;
+      ASSERT_EQ(0, MEMCMP(read_str.ptr(), expect, read_str.length()));
+      read_len += read_str.length();
+    }
+  }
+  ASSERT_EQ(OB_ITER_END, ret);
+  ASSERT_TRUE(iter->is_end());
+  ASSERT_EQ(len, read_len);
+  iter->reset();
+  OB_DELETE(ObLobQueryIter, "unused", iter);
+  allocator.free(read_ptr);
+  tx_service->release_tx(*tx_desc);
+}
+
 // void TestLobManager::
 TEST_F(TestLobManager, basic)
 {
@@ -934,6 +1044,70 @@ TEST_F(TestLobManager, basic)
   ASSERT_EQ(OB_SUCCESS, MTL(ObLSService*)->remove_ls(ls_id_));
 }
 
+TEST_F(TestLobManager, outrow_bin_piece_query)
+{
+  ObArenaAllocator allocator;
+  int ret = OB_SUCCESS;
+  ret = TestLobCommon::create_data_tablet(tenant_id_, ls_id_, tablet_id_, lob_meta_tablet_id_, lob_piece_tablet_id_);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  // mock ls tablet service and access service
+  ObLSTabletService *tablet_service = nullptr;
+  ret = TestDmlCommon::mock_ls_tablet_service(ls_id_, tablet_service);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_NE(nullptr, tablet_service);
+
+  MockObAccessService *access_service = nullptr;
+  ret = TestDmlCommon::mock_access_service(tablet_service, access_service);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_NE(nullptr, access_service);
+
+  // 5 inline meta rows of 200K binary data
+  uint64_t lob_id = 333;
+  uint64_t piece_len = 200000;
+  uint64_t total_len = 5 * piece_len;
+  char *data = nullptr;
+  prepare_random_data(allocator, total_len, &data);
+  ObLobMetaInfo infos[5];
+  for (int i = 0; i < 5; i++) {
+    ObLobMetaInfo *info = &infos[i];
+    info->lob_id_.tablet_id_ = tablet_id_.id();
+    info->lob_id_.lob_id_ = lob_id;
+    int seq_num[2];
+    seq_num[0] = i/2;
+    seq_num[1] = 5;
+    if (i%2 != 0) {
+      info->seq_id_.assign_ptr(reinterpret_cast<char*>(seq_num), sizeof(int) * 2);
+    } else {
+      info->seq_id_.assign_ptr(reinterpret_cast<char*>(seq_num), sizeof(int));
+    }
+    info->byte_len_ = piece_len;
+    info->char_len_ = piece_len;
+    info->piece_id_ = ObLobMetaUtil::LOB_META_INLINE_PIECE_ID;
+    info->lob_data_.assign_ptr(data + i * piece_len, piece_len);
+    insert_lob_meta(access_service, allocator, *info);
+  }
+
+  for (int i = 0; i < 2; i++) {
+    bool is_reverse = (i == 1);
+    // read buffer smaller than a meta row, the remain of each row is kept by the iter
+    query_check_lob_data(data, allocator, lob_id, total_len, 0, total_len, 70000, is_reverse, false);
+    // read buffer larger than a meta row, one read spans two rows
+    query_check_lob_data(data, allocator, lob_id, total_len, 0, total_len, 300000, is_reverse, false);
+    // range starts and ends inside meta rows
+    query_check_lob_data(data, allocator, lob_id, total_len, 150000, 500000, 70000, is_reverse, false);
+    // remain of the first read is handed out as a piece, then one piece per meta row
+    query_check_lob_data(data, allocator, lob_id, total_len, 0, total_len, 70000, is_reverse, true);
+    query_check_lob_data(data, allocator, lob_id, total_len, 150000, 500000, 30000, is_reverse, true);
+  }
+  allocator.free(data);
+
+  // clean env
+  TestDmlCommon::delete_mocked_access_service(access_service);
+  TestDmlCommon::delete_mocked_ls_tablet_service(tablet_service);
+  ASSERT_EQ(OB_SUCCESS, MTL(ObLSService*)->remove_ls(ls_id_));
+}
+
 // TEST_F(TestLobManager, basic2)
 // {
   // EXPECT_EQ(OB_SYS_TENANT_ID, MTL_ID());
@@ -1776,6 +1950,54 @@ TEST_F(TestLobManager, inrow_bin_reverse_query)
   allocator.free(lob_data);
 }
 
+TEST_F(TestLobManager, inrow_bin_piece_query)
+{
+  ObArenaAllocator allocator;
+
+  ObLobManager *mgr = MTL(ObLobManager*);
+  char *lob_data = reinterpret_cast<char*>(allocator.alloc(4096));
+  ObLobCommon *loc = new(lob_data)ObLobCommon();
+
+  char *tmp_buf;
+  uint32_t data_len = 900;
+  prepare_random_data(allocator, data_len, &tmp_buf);
+
+  ObLobAccessParam param;
+  param.tx_desc_ = nullptr;
+  param.sql_mode_ = SMO_DEFAULT;
+  param.allocator_ = &allocator;
+  param.ls_id_ = ls_id_;
+  param.tablet_id_ = tablet_id_;
+  param.scan_backward_ = false;
+  param.lob_common_ = loc;
+  param.handle_size_ = 4096;
+  param.asscess_ptable_ = false;
+  param.coll_type_ = CS_TYPE_BINARY;
+  param.timeout_ = ObTimeUtility::current_time() + 12 * 1000 * 1000;
+  ObString appeng_buf;
+  appeng_buf.assign_ptr(tmp_buf, data_len);
+  ASSERT_EQ(OB_SUCCESS, mgr->append(param, appeng_buf));
+
+  // [300, 900] refers to lob data without copy
+  for (int i = 0; i < 2; i++) {
+    param.scan_backward_ = (i == 1);
+    param.offset_ = 300;
+    param.len_ = 600;
+    ObLobQueryIter *iter = NULL;
+    ASSERT_EQ(OB_SUCCESS, mgr->query(param, iter));
+    ObString piece;
+    ASSERT_EQ(OB_SUCCESS, iter->get_next_piece(piece));
+    ASSERT_EQ(600, piece.length());
+    ASSERT_EQ(0, MEMCMP(piece.ptr(), tmp_buf + 300, piece.length()));
+    ASSERT_EQ(OB_ITER_END, iter->get_next_piece(piece));
+    ASSERT_TRUE(iter->is_end());
+    iter->reset();
+    OB_DELETE(ObLobQueryIter, "unused", iter);
+  }
+
+  allocator.free(lob_data);
+}
+
 TEST_F(TestLobManager, inrow_utf8_reverse_query)
 {
   ObArenaAllocator allocator;
@@ -1735,6 +1735,356 @@ TEST_F(TestTmpFile, test_aio_pread)
 
   LOG_INFO("test_cached_read");
 }
+
+// returns the file offset where the data item holding `offset` ends, or -1 if the page of `offset` is not on disk
+static int64_t get_data_item_end_offset(ObSharedNothingTmpFile &file, const int64_t offset)
+{
+  int64_t end_offset = -1;
+  common::ObArray<ObSharedNothingTmpFileDataItem> data_items;
+  if (OB_SUCCESS == file.meta_tree_.search_data_items(offset, ObTmpFileGlobal::PAGE_SIZE, data_items)
+      && !data_items.empty()) {
+    const ObSharedNothingTmpFileDataItem &data_item = data_items.at(0);
+    end_offset = (data_item.virtual_page_id_ + data_item.physical_page_num_) * ObTmpFileGlobal::PAGE_SIZE;
+  }
+  return end_offset;
+}
+
+// returns whether the disk page holding `offset` is in tmp page cache
+static bool is_page_cached(ObSharedNothingTmpFile &file, const int64_t offset)
+{
+  bool is_cached = false;
+  common::ObArray<ObSharedNothingTmpFileDataItem> data_items;
+  if (OB_SUCCESS == file.meta_tree_.search_data_items(offset, ObTmpFileGlobal::PAGE_SIZE, data_items)
+      && !data_items.empty()) {
+    const ObSharedNothingTmpFileDataItem &data_item = data_items.at(0);
+    const int64_t physical_page_id = data_item.physical_page_id_ +
+                                     offset / ObTmpFileGlobal::PAGE_SIZE - data_item.virtual_page_id_;
+    tmp_file::ObTmpPageCacheKey key(data_item.block_index_, physical_page_id, MTL_ID());
+    tmp_file::ObTmpPageValueHandle handle;
+    is_cached = OB_SUCCESS == tmp_file::ObTmpPageCache::get_instance().get_page(key, handle);
+  }
+  return is_cached;
+}
+
+// generate 4MB random data (will not trigger flush and evict logic)
+// 1. the read-ahead window doubles on each sequential read until the max size
+// 2. random reads reset the read-ahead window
+TEST_F(TestTmpFile, test_read_ahead_window)
+{
+  int ret = OB_SUCCESS;
+  const int64_t write_size = 4 * 1024 * 1024; // 4MB
+  char *write_buf = new char [write_size];
+  for (int64_t i = 0; i < write_size;) {
+    int64_t random_length = generate_random_int(1024, 8 * 1024);
+    int64_t random_int = generate_random_int(0, 256);
+    for (int64_t j = 0; j < random_length && i + j < write_size; ++j) {
+      write_buf[i + j] = random_int;
+    }
+    i += random_length;
+  }
+
+  int64_t dir = -1;
+  int64_t fd = -1;
+  ret = MTL(ObTenantTmpFileManager *)->alloc_dir(dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = MTL(ObTenantTmpFileManager *)->open(fd, dir);
+  std::cout << "open temporary file: " << fd << std::endl;
+  ASSERT_EQ(OB_SUCCESS, ret);
+  tmp_file::ObTmpFileHandle file_handle;
+  ret = MTL(ObTenantTmpFileManager *)->get_sn_file_manager().get_tmp_file(fd, file_handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ObSharedNothingTmpFile *file = file_handle.get();
+
+  ObTmpFileIOInfo io_info;
+  io_info.fd_ = fd;
+  io_info.io_desc_.set_wait_event(2);
+  io_info.buf_ = write_buf;
+  io_info.size_ = write_size;
+  io_info.io_timeout_ms_ = DEFAULT_IO_WAIT_TIME_MS;
+  ret = MTL(ObTenantTmpFileManager *)->write(io_info);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(-1, file->last_read_end_offset_);
+  ASSERT_EQ(0, file->read_ahead_size_);
+
+  const int64_t read_size = ObTmpFileGlobal::PAGE_SIZE;
+  char *read_buf = new char [read_size];
+  ObTmpFileIOHandle handle;
+  io_info.buf_ = read_buf;
+  io_info.size_ = read_size;
+
+  // 1. the first read is not sequential
+  int64_t read_offset = 0;
+  ret = MTL(ObTenantTmpFileManager *)->pread(io_info, read_offset, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(read_size, handle.get_done_size());
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_offset, read_size));
+  handle.reset();
+  ASSERT_EQ(0, file->read_ahead_size_);
+  ASSERT_EQ(read_offset + read_size, file->last_read_end_offset_);
+
+  // 2. sequential reads, 64KB -> 128KB -> 256KB -> 512KB -> 1MB -> 1MB
+  int64_t expected_read_ahead_size = ObTmpFileGlobal::TMP_FILE_MIN_READ_AHEAD_SIZE;
+  for (int64_t i = 0; i < 6; ++i) {
+    read_offset += read_size;
+    ret = MTL(ObTenantTmpFileManager *)->pread(io_info, read_offset, handle);
+    ASSERT_EQ(OB_SUCCESS, ret);
+    ASSERT_EQ(read_size, handle.get_done_size());
+    ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_offset, read_size));
+    handle.reset();
+    ASSERT_EQ(expected_read_ahead_size, file->read_ahead_size_);
+    ASSERT_EQ(read_offset + read_size, file->last_read_end_offset_);
+    expected_read_ahead_size = MIN(expected_read_ahead_size * 2, ObTmpFileGlobal::TMP_FILE_MAX_READ_AHEAD_SIZE);
+  }
+  ASSERT_EQ(ObTmpFileGlobal::TMP_FILE_MAX_READ_AHEAD_SIZE, file->read_ahead_size_);
+
+  // 3. a forward random read resets the window
+  read_offset = write_size / 2;
+  ret = MTL(ObTenantTmpFileManager *)->pread(io_info, read_offset, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_offset, read_size));
+  handle.reset();
+  ASSERT_EQ(0, file->read_ahead_size_);
+
+  // 4. the window grows from the min size again
+  read_offset += read_size;
+  ret = MTL(ObTenantTmpFileManager *)->pread(io_info, read_offset, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_offset, read_size));
+  handle.reset();
+  ASSERT_EQ(ObTmpFileGlobal::TMP_FILE_MIN_READ_AHEAD_SIZE, file->read_ahead_size_);
+
+  // 5. a backward read is random too
+  read_offset = 0;
+  ret = MTL(ObTenantTmpFileManager *)->pread(io_info, read_offset, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_offset, read_size));
+  handle.reset();
+  ASSERT_EQ(0, file->read_ahead_size_);
+  delete[] read_buf;
+  delete[] write_buf;
+
+  file_handle.reset();
+  ret = MTL(ObTenantTmpFileManager *)->remove(fd);
+  ASSERT_EQ(OB_SUCCESS, ret);
+
+  LOG_INFO("test_read_ahead_window");
+}
+
+// generate 8MB random data (will trigger flush)
+// 1. read-ahead loads the pages behind a sequential disk read into page cache
+// 2. read-ahead stops at the first page in wbp even if the page has been flushed
+TEST_F(TestTmpFile, test_read_ahead_not_exceed_wbp)
+{
+  int ret = OB_SUCCESS;
+  const int64_t write_size = 8 * 1024 * 1024; // 8MB
+  const int64_t wbp_mem_limit = MTL(ObTenantTmpFileManager *)->get_sn_file_manager().page_cache_controller_.write_buffer_pool_.get_memory_limit();
+  ASSERT_GT(write_size, wbp_mem_limit);
+  char *write_buf = new char [write_size];
+  for (int64_t i = 0; i < write_size;) {
+    int64_t random_length = generate_random_int(1024, 8 * 1024);
+    int64_t random_int = generate_random_int(0, 256);
+    for (int64_t j = 0; j < random_length && i + j < write_size; ++j) {
+      write_buf[i + j] = random_int;
+    }
+    i += random_length;
+  }
+
+  int64_t dir = -1;
+  int64_t fd = -1;
+  ret = MTL(ObTenantTmpFileManager *)->alloc_dir(dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ret = MTL(ObTenantTmpFileManager *)->open(fd, dir);
+  std::cout << "open temporary file: " << fd << std::endl;
+  ASSERT_EQ(OB_SUCCESS, ret);
+  tmp_file::ObTmpFileHandle file_handle;
+  ret = MTL(ObTenantTmpFileManager *)->get_sn_file_manager().get_tmp_file(fd, file_handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  file_handle.get()->page_idx_cache_.max_bucket_array_capacity_ = SMALL_WBP_IDX_CACHE_MAX_CAPACITY;
+  ObSharedNothingTmpFile *file = file_handle.get();
+
+  ObTmpFileIOInfo io_info;
+  io_info.fd_ = fd;
+  io_info.io_desc_.set_wait_event(2);
+  io_info.buf_ = write_buf;
+  io_info.size_ = write_size;
+  io_info.io_timeout_ms_ = DEFAULT_IO_WAIT_TIME_MS;
+
+  // 1. Write data and wait flushing over
+  ret = MTL(ObTenantTmpFileManager *)->write(io_info);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  sleep(2);
+
+  const int64_t wbp_begin_offset = file->cal_wbp_begin_offset();
+  const int64_t read_ahead_page_num = ObTmpFileGlobal::TMP_FILE_MIN_READ_AHEAD_SIZE / ObTmpFileGlobal::PAGE_SIZE;
+  ASSERT_EQ(wbp_begin_offset % ObTmpFileGlobal::PAGE_SIZE, 0);
+  ASSERT_GT(wbp_begin_offset, 4 * read_ahead_page_num * ObTmpFileGlobal::PAGE_SIZE);
+
+  const int64_t read_size = ObTmpFileGlobal::PAGE_SIZE;
+  char *read_buf = new char [read_size];
+  ObTmpFileIOHandle handle;
+  io_info.buf_ = read_buf;
+  io_info.size_ = read_size;
+  io_info.disable_page_cache_ = false;
+  io_info.disable_block_cache_ = true;
+
+  // 2. the window of the second read covers pages far before wbp
+  int64_t read_offset = 0;
+  for (int64_t i = 0; i < 2; ++i) {
+    ret = MTL(ObTenantTmpFileManager *)->pread(io_info, read_offset, handle);
+    ASSERT_EQ(OB_SUCCESS, ret);
+    ASSERT_EQ(read_size, handle.get_done_size());
+    ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_offset, read_size));
+    handle.reset();
+    read_offset += read_size;
+  }
+  ASSERT_EQ(ObTmpFileGlobal::TMP_FILE_MIN_READ_AHEAD_SIZE, file->read_ahead_size_);
+  // read-ahead stays inside the data item of the last read page
+  int64_t prefetch_end_offset = MIN(read_offset + ObTmpFileGlobal::TMP_FILE_MIN_READ_AHEAD_SIZE,
+                                    get_data_item_end_offset(*file, read_offset - read_size));
+  for (int64_t offset = read_offset; offset < prefetch_end_offset; offset += ObTmpFileGlobal::PAGE_SIZE) {
+    ASSERT_TRUE(is_page_cached(*file, offset));
+  }
+  ASSERT_FALSE(is_page_cached(*file, prefetch_end_offset));
+
+  // 3. the window of the second read goes past wbp_begin_offset
+  read_offset = wbp_begin_offset - read_ahead_page_num / 2 * ObTmpFileGlobal::PAGE_SIZE - 2 * read_size;
+  for (int64_t i = 0; i < 2; ++i) {
+    ret = MTL(ObTenantTmpFileManager *)->pread(io_info, read_offset, handle);
+    ASSERT_EQ(OB_SUCCESS, ret);
+    ASSERT_EQ(read_size, handle.get_done_size());
+    ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_offset, read_size));
+    handle.reset();
+    read_offset += read_size;
+  }
+  ASSERT_EQ(ObTmpFileGlobal::TMP_FILE_MIN_READ_AHEAD_SIZE, file->read_ahead_size_);
+  ASSERT_GT(read_offset + file->read_ahead_size_, wbp_begin_offset);
+  ASSERT_EQ(wbp_begin_offset, file->cal_wbp_begin_offset());
+  prefetch_end_offset = MIN(wbp_begin_offset, get_data_item_end_offset(*file, read_offset - read_size));
+  for (int64_t offset = read_offset; offset < prefetch_end_offset; offset += ObTmpFileGlobal::PAGE_SIZE) {
+    ASSERT_TRUE(is_page_cached(*file, offset));
+  }
+  // flushed pages which are still in wbp are never read ahead
+  for (int64_t offset = wbp_begin_offset; offset < read_offset + file->read_ahead_size_;
+       offset += ObTmpFileGlobal::PAGE_SIZE) {
+    ASSERT_FALSE(is_page_cached(*file, offset));
+  }
+
+  // 4. read the rest of file sequentially across wbp_begin_offset
+  delete[] read_buf;
+  const int64_t rest_size = write_size - read_offset;
+  read_buf = new char [rest_size];
+  io_info.buf_ = read_buf;
+  io_info.size_ = rest_size;
+  ret = MTL(ObTenantTmpFileManager *)->pread(io_info, read_offset, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(rest_size, handle.get_done_size());
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_offset, rest_size));
+  handle.reset();
+  delete[] read_buf;
+  delete[] write_buf;
+
+  file_handle.reset();
+  ret = MTL(ObTenantTmpFileManager *)->remove(fd);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, MTL(ObTenantTmpFileManager *)->get_sn_file_manager().page_cache_controller_.flush_priority_mgr_.get_file_size());
+  ASSERT_EQ(0, MTL(ObTenantTmpFileManager *)->get_sn_file_manager().page_cache_controller_.evict_mgr_.get_file_size());
+
+  LOG_INFO("test_read_ahead_not_exceed_wbp");
+}
+
+// 1. a file which has been read to the end is moved to the head of data eviction list
+// 2. prioritizing the head of list or a file out of list changes nothing
+TEST_F(TestTmpFile, test_prioritize_consumed_file)
+{
+  int ret = OB_SUCCESS;
+  const int64_t write_size = 4 * ObTmpFileGlobal::PAGE_SIZE;
+  char *write_buf = new char [write_size];
+  for (int64_t i = 0; i < write_size; ++i) {
+    write_buf[i] = static_cast<char>(i % 256);
+  }
+  ObTmpFileEvictionManager &evict_mgr = MTL(ObTenantTmpFileManager *)->get_sn_file_manager().page_cache_controller_.evict_mgr_;
+  ASSERT_EQ(0, evict_mgr.get_file_size());
+
+  int64_t dir = -1;
+  ret = MTL(ObTenantTmpFileManager *)->alloc_dir(dir);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  int64_t fds[2] = {-1, -1};
+  tmp_file::ObTmpFileHandle file_handles[2];
+  ObTmpFileIOInfo io_info;
+  io_info.io_desc_.set_wait_event(2);
+  io_info.io_timeout_ms_ = DEFAULT_IO_WAIT_TIME_MS;
+  for (int64_t i = 0; i < 2; ++i) {
+    ret = MTL(ObTenantTmpFileManager *)->open(fds[i], dir);
+    std::cout << "open temporary file: " << fds[i] << std::endl;
+    ASSERT_EQ(OB_SUCCESS, ret);
+    ret = MTL(ObTenantTmpFileManager *)->get_sn_file_manager().get_tmp_file(fds[i], file_handles[i]);
+    ASSERT_EQ(OB_SUCCESS, ret);
+    io_info.fd_ = fds[i];
+    io_info.buf_ = write_buf;
+    io_info.size_ = write_size;
+    ret = MTL(ObTenantTmpFileManager *)->write(io_info);
+    ASSERT_EQ(OB_SUCCESS, ret);
+  }
+  ObSharedNothingTmpFile &file0 = *file_handles[0].get();
+  ObSharedNothingTmpFile &file1 = *file_handles[1].get();
+
+  // the data is too small to be flushed, put the files into eviction list by hand
+  ASSERT_FALSE(file0.is_in_data_eviction_list_);
+  ASSERT_FALSE(file1.is_in_data_eviction_list_);
+  ASSERT_EQ(OB_SUCCESS, evict_mgr.add_file(false/*is_meta*/, file0));
+  file0.is_in_data_eviction_list_ = true;
+  ASSERT_EQ(OB_SUCCESS, evict_mgr.add_file(false/*is_meta*/, file1));
+  file1.is_in_data_eviction_list_ = true;
+  ASSERT_EQ(2, evict_mgr.get_file_size());
+  ASSERT_EQ(&file0.get_data_eviction_node(), evict_mgr.file_data_eviction_list_.get_first());
+  ASSERT_EQ(&file1.get_data_eviction_node(), evict_mgr.file_data_eviction_list_.get_last());
+
+  // 1. reading a part of file1 keeps the order
+  const int64_t read_size = write_size / 2;
+  char *read_buf = new char [read_size];
+  ObTmpFileIOHandle handle;
+  io_info.fd_ = fds[1];
+  io_info.buf_ = read_buf;
+  io_info.size_ = read_size;
+  ret = MTL(ObTenantTmpFileManager *)->pread(io_info, 0, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf, read_size));
+  handle.reset();
+  ASSERT_EQ(&file0.get_data_eviction_node(), evict_mgr.file_data_eviction_list_.get_first());
+
+  // 2. file1 has been consumed to the end
+  ret = MTL(ObTenantTmpFileManager *)->pread(io_info, read_size, handle);
+  ASSERT_EQ(OB_SUCCESS, ret);
+  ASSERT_EQ(0, memcmp(handle.get_buffer(), write_buf + read_size, read_size));
+  handle.reset();
+  ASSERT_EQ(2, evict_mgr.get_file_size());
+  ASSERT_EQ(&file1.get_data_eviction_node(), evict_mgr.file_data_eviction_list_.get_first());
+  ASSERT_EQ(&file0.get_data_eviction_node(), evict_mgr.file_data_eviction_list_.get_last());
+
+  // 3. prioritize the head of list
+  ASSERT_EQ(OB_SUCCESS, evict_mgr.prioritize_file(false/*is_meta*/, file1));
+  ASSERT_EQ(2, evict_mgr.get_file_size());
+  ASSERT_EQ(&file1.get_data_eviction_node(), evict_mgr.file_data_eviction_list_.get_first());
+
+  // 4. prioritize a file which is not in list
+  ASSERT_EQ(OB_SUCCESS, evict_mgr.remove_file(false/*is_meta*/, file0));
+  file0.is_in_data_eviction_list_ = false;
+  ASSERT_EQ(OB_SUCCESS, evict_mgr.prioritize_file(false/*is_meta*/, file0));
+  ASSERT_EQ(1, evict_mgr.get_file_size());
+  ASSERT_EQ(&file1.get_data_eviction_node(), evict_mgr.file_data_eviction_list_.get_first());
+  ASSERT_TRUE(NULL == file0.get_data_eviction_node().get_next());
+  delete[] read_buf;
+  delete[] write_buf;
+
+  for (int64_t i = 0; i < 2; ++i) {
+    file_handles[i].reset();
+    ret = MTL(ObTenantTmpFileManager *)->remove(fds[i]);
+    ASSERT_EQ(OB_SUCCESS, ret);
+  }
+  ASSERT_EQ(0, evict_mgr.get_file_size());
+
+  LOG_INFO("test_prioritize_consumed_file");
+}
 } // namespace oceanbase
 
 int main(int argc, char **argv)
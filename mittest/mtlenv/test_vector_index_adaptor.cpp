@@ -27,11 +27,15 @@
 #include "lib/allocator/ob_mod_define.h"
 #include "lib/allocator/page_arena.h"
 #include "lib/vector/ob_vector_util.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 #undef private
 #undef protected
 #include <random>
 #include<iostream>
+#include <algorithm>
+#include <set>
+#include <vector>
 
 namespace oceanbase {
 
@@ -1155,6 +1159,185 @@ TEST_F(TestVectorIndexAdaptor, mem_ctx)
 
 }
 
+TEST_F(TestVectorIndexAdaptor, filter_skip_bitmap)
+{
+  ObArenaAllocator allocator(ObModIds::TEST);
+  lib::ContextParam param;
+  lib::MemoryContext mem_context;
+  param.set_mem_attr(MTL_ID()).set_page_size(OB_MALLOC_MIDDLE_BLOCK_SIZE);
+  ASSERT_EQ(ROOT_CONTEXT->CREATE_CONTEXT(mem_context, param), 0);
+  ObPluginVectorIndexAdaptor adaptor(&allocator, mem_context);
+  ObVectorQueryAdaptorResultContext ctx(&allocator, &allocator);
+  ASSERT_EQ(ctx.init_bitmaps(), 0);
+
+  // vids 1..20 were in the table when the filter was built, 50 is inserted later
+  for (uint64_t vid = 1; vid <= 20; ++vid) {
+    roaring64_bitmap_add(ctx.bitmaps_->insert_bitmap_, vid);
+  }
+  roaring64_bitmap_add(ctx.bitmaps_->insert_bitmap_, 50);
+  roaring64_bitmap_add(ctx.bitmaps_->delete_bitmap_, 7);
+
+  ObVectorQueryConditions query_cond;
+  query_cond.filter_bitmap_ = roaring64_bitmap_create();
+  query_cond.filter_max_vid_ = 20;
+  roaring64_bitmap_add(query_cond.filter_bitmap_, 2);
+  roaring64_bitmap_add(query_cond.filter_bitmap_, 4);
+  roaring64_bitmap_add(query_cond.filter_bitmap_, 6);
+
+  roaring::api::roaring64_bitmap_t *ibitmap = roaring64_bitmap_create();
+  roaring::api::roaring64_bitmap_t *dbitmap = ctx.bitmaps_->delete_bitmap_;
+  roaring::api::roaring64_bitmap_t *filter_skip_bitmap = nullptr;
+  ASSERT_EQ(adaptor.merge_filter_bitmap(&ctx, &query_cond, ibitmap, dbitmap, filter_skip_bitmap), 0);
+  ASSERT_EQ(dbitmap, filter_skip_bitmap);
+  for (uint64_t vid = 0; vid <= 50; ++vid) {
+    const bool is_pass = (2 == vid || 4 == vid || 6 == vid);
+    // the vids above the filter scan are skipped as well
+    ASSERT_EQ(!is_pass, roaring64_bitmap_contains(ibitmap, vid)) << vid;
+    ASSERT_EQ(!is_pass, roaring64_bitmap_contains(dbitmap, vid)) << vid;
+  }
+
+  // the results above every bitmap are dropped after the search
+  int64_t res_vids[5] = {2, 3, 60, 4, 6};
+  int64_t res_cnt = 5;
+  adaptor.remove_filtered_vids(&query_cond, res_cnt, res_vids);
+  ASSERT_EQ(3, res_cnt);
+  ASSERT_EQ(2, res_vids[0]);
+  ASSERT_EQ(4, res_vids[1]);
+  ASSERT_EQ(6, res_vids[2]);
+
+  roaring64_bitmap_free(filter_skip_bitmap);
+  roaring64_bitmap_free(ibitmap);
+  roaring64_bitmap_free(query_cond.filter_bitmap_);
+}
+
+TEST_F(TestVectorIndexAdaptor, filtered_knn_search)
+{
+  ObArenaAllocator allocator(ObModIds::TEST);
+  lib::ContextParam param;
+  lib::MemoryContext mem_context;
+  param.set_mem_attr(MTL_ID()).set_page_size(OB_MALLOC_MIDDLE_BLOCK_SIZE);
+  ASSERT_EQ(ROOT_CONTEXT->CREATE_CONTEXT(mem_context, param), 0);
+  ObPluginVectorIndexAdaptor adaptor(&allocator, mem_context);
+  ObVectorQueryAdaptorResultContext ctx(&allocator, &allocator);
+  ASSERT_EQ(ctx.init_bitmaps(), 0);
+
+  obvectorlib::VectorIndexPtr index_handler = nullptr;
+  std::mt19937 rng;
+  rng.seed(47);
+  std::uniform_real_distribution<> distrib_real;
+  const int dim = 16;
+  const int ef_search = 200;
+  const int64_t topk = 10;
+  // 2000 rows are seen by the filter scan, 100 more are inserted into the index afterwards
+  const int64_t filter_vector_cnt = 2000;
+  const int64_t num_vectors = 2100;
+  ASSERT_EQ(obvectorutil::create_index(index_handler, obvectorlib::HNSW_TYPE, "float32", "l2",
+                                       dim, 16/*max_degree*/, 100/*ef_construction*/, ef_search), 0);
+  int64_t *ids = new int64_t[num_vectors];
+  float *vecs = new float[dim * num_vectors];
+  for (int64_t i = 0; i < num_vectors; ++i) {
+    ids[i] = i;
+    roaring64_bitmap_add(ctx.bitmaps_->insert_bitmap_, i);
+  }
+  for (int64_t i = 0; i < num_vectors * dim; ++i) {
+    vecs[i] = distrib_real(rng);
+  }
+  ASSERT_EQ(0, obvectorutil::build_index(index_handler, vecs, ids, dim, num_vectors));
+
+  // one row out of ten passes the filters
+  ObVectorQueryConditions query_cond;
+  query_cond.filter_bitmap_ = roaring64_bitmap_create();
+  query_cond.filter_max_vid_ = filter_vector_cnt - 1;
+  for (int64_t i = 0; i < filter_vector_cnt; ++i) {
+    if (3 == i % 10) {
+      roaring64_bitmap_add(query_cond.filter_bitmap_, i);
+    }
+  }
+  roaring::api::roaring64_bitmap_t *ibitmap = roaring64_bitmap_create();
+  roaring::api::roaring64_bitmap_t *dbitmap = ctx.bitmaps_->delete_bitmap_;
+  roaring::api::roaring64_bitmap_t *filter_skip_bitmap = nullptr;
+  ASSERT_EQ(adaptor.merge_filter_bitmap(&ctx, &query_cond, ibitmap, dbitmap, filter_skip_bitmap), 0);
+
+  float query_vec[dim];
+  for (int64_t i = 0; i < dim; ++i) {
+    query_vec[i] = distrib_real(rng);
+  }
+  const float *result_dist = nullptr;
+  const int64_t *result_ids = nullptr;
+  int64_t result_size = 0;
+  ASSERT_EQ(0, obvectorutil::knn_search(index_handler, query_vec, dim, topk,
+                                        result_dist, result_ids, result_size, ef_search, dbitmap));
+  ASSERT_EQ(topk, result_size);
+
+  // exhaustive search over the rows passing the filters
+  std::vector<std::pair<float, int64_t>> exact;
+  for (int64_t i = 0; i < filter_vector_cnt; ++i) {
+    if (roaring64_bitmap_contains(query_cond.filter_bitmap_, i)) {
+      float dist = 0;
+      for (int64_t j = 0; j < dim; ++j) {
+        const float diff = vecs[i * dim + j] - query_vec[j];
+        dist += diff * diff;
+      }
+      exact.push_back(std::make_pair(dist, i));
+    }
+  }
+  std::sort(exact.begin(), exact.end());
+  std::set<int64_t> exact_topk;
+  for (int64_t i = 0; i < topk; ++i) {
+    exact_topk.insert(exact[i].second);
+  }
+  int64_t hit_cnt = 0;
+  for (int64_t i = 0; i < result_size; ++i) {
+    ASSERT_TRUE(roaring64_bitmap_contains(query_cond.filter_bitmap_, result_ids[i])) << result_ids[i];
+    if (i > 0) {
+      ASSERT_LE(result_dist[i - 1], result_dist[i]);
+    }
+    hit_cnt += exact_topk.count(result_ids[i]);
+  }
+  // the filtered out rows don't take the top k slots, the recall stays close to the unfiltered one
+  ASSERT_GE(hit_cnt, topk * 8 / 10);
+
+  obvectorutil::delete_index(index_handler);
+  roaring64_bitmap_free(filter_skip_bitmap);
+  roaring64_bitmap_free(ibitmap);
+  roaring64_bitmap_free(query_cond.filter_bitmap_);
+  delete [] ids;
+  delete [] vecs;
+}
+
+TEST_F(TestVectorIndexAdaptor, brute_force_threshold)
+{
+  ObArenaAllocator allocator(ObModIds::TEST);
+  lib::ContextParam param;
+  lib::MemoryContext mem_context;
+  param.set_mem_attr(MTL_ID()).set_page_size(OB_MALLOC_MIDDLE_BLOCK_SIZE);
+  ASSERT_EQ(ROOT_CONTEXT->CREATE_CONTEXT(mem_context, param), 0);
+  ObPluginVectorIndexAdaptor adaptor(&allocator, mem_context);
+  omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+  ASSERT_TRUE(tenant_config.is_valid());
+  tenant_config->_vector_index_brute_force_threshold = 100;
+
+  ObVectorQueryConditions query_cond;
+  query_cond.filter_bitmap_ = nullptr;
+  query_cond.filter_max_vid_ = 0;
+  // not filtered
+  ASSERT_FALSE(adaptor.need_brute_force(&query_cond));
+
+  query_cond.filter_bitmap_ = roaring64_bitmap_create();
+  ASSERT_TRUE(adaptor.need_brute_force(&query_cond));
+  roaring64_bitmap_add_range_closed(query_cond.filter_bitmap_, 1, 100);
+  query_cond.filter_max_vid_ = 1000;
+  ASSERT_TRUE(adaptor.need_brute_force(&query_cond));
+  roaring64_bitmap_add(query_cond.filter_bitmap_, 500);
+  ASSERT_FALSE(adaptor.need_brute_force(&query_cond));
+
+  // 0 always searches the vector index when some rows pass the filters
+  tenant_config->_vector_index_brute_force_threshold = 0;
+  ASSERT_FALSE(adaptor.need_brute_force(&query_cond));
+  tenant_config->_vector_index_brute_force_threshold = 4096;
+  roaring64_bitmap_free(query_cond.filter_bitmap_);
+}
+
 #if 0
 TEST_F(TestVectorIndexAdaptor, vsag_alloc)
 {
@@ -107,6 +107,28 @@ void ObLobDataGetCtx::reset(
   }
 }
 
+bool ObLobDataGetCtx::is_partial_lob() const
+{
+  bool bret = false;
+  const ObLobDataOutRowCtx *lob_data_out_row_ctx = nullptr;
+
+  if (OB_NOT_NULL(new_lob_data_)
+      && OB_NOT_NULL(lob_data_out_row_ctx = reinterpret_cast<const ObLobDataOutRowCtx *>(new_lob_data_->buffer_))) {
+    switch (lob_data_out_row_ctx->op_) {
+      case ObLobDataOutRowCtx::OpType::APPEND:
+      case ObLobDataOutRowCtx::OpType::INSERT:
+      case ObLobDataOutRowCtx::OpType::WRITE:
+      case ObLobDataOutRowCtx::OpType::ERASE:
+        bret = true;
+        break;
+      default:
+        break;
+    }
+  }
+
+  return bret;
+}
+
 int ObLobDataGetCtx::get_lob_out_row_ctx(const ObLobDataOutRowCtx *&lob_data_out_row_ctx) const
 {
   int ret = OB_SUCCESS;
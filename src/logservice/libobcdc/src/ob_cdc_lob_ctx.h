@@ -83,6 +83,9 @@ struct ObLobDataGetCtx
   bool is_update() const { return dml_flag_.is_update(); }
   bool is_delete() const { return dml_flag_.is_delete(); }
   bool is_ext_info_log() const { return ObLobDataGetTaskType::EXT_INFO_LOG == type_; }
+  // APPEND/INSERT/WRITE/ERASE only log the modified pieces of the lob, the full new value
+  // can not be rebuilt from the redo of the trans
+  bool is_partial_lob() const;
 
   const common::ObLobData *get_lob_data(const bool is_new_col) const
   {
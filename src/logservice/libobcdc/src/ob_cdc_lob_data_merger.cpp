@@ -210,6 +210,13 @@ int ObCDCLobDataMerger::push_lob_column_(
   } else if (OB_ISNULL(lob_data_out_row_ctx)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_ERROR("lob_data_out_row_ctx is nullptr", KR(ret), K(lob_data_get_ctx));
+  } else if (OB_UNLIKELY(lob_data_get_ctx.is_partial_lob())) {
+    // the redo only contains the modified pieces and the previous lob image is not
+    // available, output them as the column value would be a corrupted value
+    ret = OB_NOT_SUPPORTED;
+    LOG_ERROR("[FATAL] [OUTROW_LOB] partial lob modification is not supported, "
+        "set binlog_row_image to FULL to log the full lob value",
+        KR(ret), KPC(lob_data_out_row_ctx), K(lob_data_get_ctx));
   } else {
     LOG_DEBUG("push_lob_column_", K(lob_data_get_ctx), K(lob_data_out_row_ctx_list));
     const bool is_empty_sql = lob_data_out_row_ctx->is_empty_sql();
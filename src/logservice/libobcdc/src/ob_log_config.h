@@ -164,6 +164,11 @@ public:
   // tenant_name.tablegroup_name
   DEF_STR(tablegroup_white_list, OB_CLUSTER_PARAMETER, "*.*", "tablegroup-select white list");
   DEF_STR(tablegroup_black_list, OB_CLUSTER_PARAMETER, "|", "tablegroup-select black list");
+  // tenant_name.database_name.table_name.column_name, columns of tables in tb_white_list that are not output,
+  // wildcard is supported and multiple patterns are separated by vertical line, for example
+  // tb_column_black_list=tenant1.db1.t1.c1|*.*.t2.*_bak
+  // Note: rowkey columns are always output
+  DEF_STR(tb_column_black_list, OB_CLUSTER_PARAMETER, "|", "column-select black list");
 
   DEF_STR(data_start_schema_version, OB_CLUSTER_PARAMETER, "|", "tenant:schema_version");
   // cluster id black list, using vertical line separation, for example cluster_id_black_list=100|200|300
@@ -135,7 +135,9 @@ int FetchLogSRpc::set_resp(const obrpc::ObRpcResultCode &rcode,
     rcode_ = rcode;
 
     if (OB_SUCCESS == rcode.rcode_) {
-      if (OB_FAIL(resp_.assign(*resp))) {
+      // resp has been deserialized into resp_ by the RPC callback, no need to copy
+      if (&resp_ == resp) {
+      } else if (OB_FAIL(resp_.assign(*resp))) {
         LOG_ERROR("assign new fetch log resp fail", KR(ret), KPC(resp), K(resp_));
       }
     }
@@ -642,7 +644,8 @@ int FetchLogARpc::mark_request_stop()
 
 int FetchLogARpc::handle_rpc_response(RpcRequest &rpc_req,
     const obrpc::ObRpcResultCode &rcode,
-    const obrpc::ObCdcLSFetchLogResp *resp)
+    const obrpc::ObCdcLSFetchLogResp *resp,
+    FetchLogARpcResult *&decoded_result)
 {
   int ret = OB_SUCCESS;
   int64_t start_proc_time = get_timestamp();
@@ -694,10 +697,13 @@ int FetchLogARpc::handle_rpc_response(RpcRequest &rpc_req,
     else if (OB_FAIL(generate_rpc_result_(rpc_req, rcode, resp, start_proc_time,
         need_stop_rpc,
         rpc_stop_reason,
+        decoded_result,
         need_dispatch_stream_task))) {
       LOG_ERROR("generate_rpc_result_ fail", KR(ret), K(rpc_req), K(rcode), K(resp),
           K(start_proc_time), K(need_stop_rpc), K(rpc_stop_reason));
     } else {
+      // Note: resp may belong to the result pushed into the queue just now, it is still valid here
+      // because the result can only be popped with lock_ held.
       // Print monitoring logs
       print_handle_info_(rpc_req, resp, next_upper_limit, need_stop_rpc, rpc_stop_reason,
           need_dispatch_stream_task);
@@ -784,6 +790,7 @@ int FetchLogARpc::generate_rpc_result_(RpcRequest &rpc_req,
     const int64_t rpc_callback_start_time,
     const bool need_stop_rpc,
     const RpcStopReason rpc_stop_reason,
+    FetchLogARpcResult *&decoded_result,
     bool &need_dispatch_stream_task)
 {
   int ret = OB_SUCCESS;
@@ -796,8 +803,14 @@ int FetchLogARpc::generate_rpc_result_(RpcRequest &rpc_req,
     LOG_ERROR("invalid result pool", K(result_pool_));
     ret = OB_INVALID_ERROR;
   }
-  // Assign an RPC result
-  else if (OB_FAIL(result_pool_->alloc(result))) {
+  // Assign an RPC result, take over the result which the response has been deserialized into if exists
+  else if (NULL != decoded_result) {
+    result = decoded_result;
+    decoded_result = NULL;
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (NULL == result && OB_FAIL(result_pool_->alloc(result))) {
     LOG_ERROR("alloc rpc result fail", KR(ret));
   } else if (OB_ISNULL(result)) {
     LOG_ERROR("invalid result", K(result));
@@ -931,8 +944,9 @@ int FetchLogARpc::launch_async_rpc_(RpcRequest &rpc_req,
       // This function initiates the RPC request, and only determines whether the dispatch task is needed
       // when the RPC result is processed by the asynchronous callback
       bool need_dispatch_stream_task = false;
+      FetchLogARpcResult *decoded_result = NULL;
       if (OB_FAIL(generate_rpc_result_(rpc_req, rcode, NULL, start_proc_time,
-          rpc_stopped, reason, need_dispatch_stream_task))) {
+          rpc_stopped, reason, decoded_result, need_dispatch_stream_task))) {
         LOG_ERROR("generate rpc result fail", KR(ret), K(rpc_req), K(rcode), K(start_proc_time),
             K(rpc_stopped), K(reason));
       }
@@ -1112,21 +1126,51 @@ rpc::frame::ObReqTransport::AsyncCB *FetchLogARpc::RpcCB::clone(const rpc::frame
   return cb;
 }
 
+obrpc::ObCdcLSFetchLogResp &FetchLogARpc::RpcCB::get_decode_result()
+{
+  int ret = OB_SUCCESS;
+  IFetchLogARpcResultPool *result_pool = host_.host_.result_pool_;
+
+  if (NULL != decoded_result_) {
+    // already allocated
+  } else if (OB_ISNULL(result_pool)) {
+    // use RpcCBBase::result_
+  } else if (OB_FAIL(result_pool->alloc(decoded_result_))) {
+    LOG_WARN("alloc rpc result for decoding fail, decode into callback result", KR(ret), K_(host));
+    decoded_result_ = NULL;
+  } else if (OB_NOT_NULL(decoded_result_)) {
+    decoded_result_pool_ = result_pool;
+  }
+
+  return NULL != decoded_result_ ? decoded_result_->resp_ : RpcCBBase::result_;
+}
+
+void FetchLogARpc::RpcCB::revert_decoded_result_()
+{
+  if (NULL != decoded_result_ && NULL != decoded_result_pool_) {
+    decoded_result_pool_->free(decoded_result_);
+  }
+  decoded_result_ = NULL;
+  decoded_result_pool_ = NULL;
+}
+
 int FetchLogARpc::RpcCB::process()
 {
   int ret = OB_SUCCESS;
-  ObCdcLSFetchLogResp &result = RpcCBBase::result_;
+  ObCdcLSFetchLogResp &result = (NULL != decoded_result_) ? decoded_result_->resp_ : RpcCBBase::result_;
   ObRpcResultCode &rcode = RpcCBBase::rcode_;
   const common::ObAddr &svr = RpcCBBase::dst_;
 
   if (OB_FAIL(do_process_(rcode, &result))) {
     if (OB_IN_STOP_STATE != ret) {
-      LOG_ERROR("process fetch log callback fail", KR(ret), K(result), K(rcode), K(svr), K_(host));
+      LOG_ERROR("process fetch log callback fail", KR(ret), K(rcode), K(svr), K_(host));
     }
   }
   // Aone:
   // Note: Active destructe response after asynchronous RPC processing
-  result.reset();
+  // The decoded result is handed over to the result queue if it is consumed, otherwise revert it.
+  revert_decoded_result_();
+  RpcCBBase::result_.reset();
 
   return ret;
 }
@@ -1160,6 +1204,9 @@ void FetchLogARpc::RpcCB::on_invalid()
       "fetch log rpc response packet is invalid, svr=%s",
       to_cstring(svr));
 
+  // The response may have been partially deserialized into the decoded result
+  revert_decoded_result_();
+
   if (OB_FAIL(do_process_(rcode, NULL))) {
     if (OB_IN_STOP_STATE != ret) {
       LOG_ERROR("process fetch log callback on invalid fail", KR(ret), K(rcode), K(svr), K_(host));
@@ -1178,7 +1225,7 @@ int FetchLogARpc::RpcCB::do_process_(const ObRpcResultCode &rcode, const ObCdcLS
     ret = OB_INVALID_ERROR;
   }
   // Processing RPC response results
-  else if (OB_FAIL(rpc_host.handle_rpc_response(rpc_req, rcode, resp))) {
+  else if (OB_FAIL(rpc_host.handle_rpc_response(rpc_req, rcode, resp, decoded_result_))) {
     if (OB_IN_STOP_STATE != ret) {
       LOG_ERROR("set fetch log response fail", KR(ret), K(resp), K(rcode), K(rpc_req));
     }
@@ -1342,7 +1389,9 @@ int FetchLogARpcResult::set(const obrpc::ObRpcResultCode &rcode,
 
     // The result is valid when no error occurs
     if (OB_SUCCESS == rcode.rcode_) {
-      if (OB_FAIL(resp_.assign(*resp))) {
+      // resp has been deserialized into resp_ by the RPC callback, no need to copy
+      if (&resp_ == resp) {
+      } else if (OB_FAIL(resp_.assign(*resp))) {
         LOG_ERROR("assign new fetch log resp fail", KR(ret), KPC(resp), K(resp_));
       }
     } else {
@@ -242,9 +242,13 @@ public:
   // 1. If it matches the current RPC request, push the result to the request queue
   // 2. If it doesn't match the current RPC request, it is a deprecated RPC request, so the RPC result is discarded and the deprecated RPC request is recycled
   // 3. Based on the request result, decide whether to launch the next RPC request immediately
+  //
+  // @param [in/out] decoded_result  result which resp has been deserialized into by the RPC callback,
+  //                                 it's taken over and reset to NULL if it is consumed
   int handle_rpc_response(RpcRequest &rpc_request,
     const obrpc::ObRpcResultCode &rcode,
-    const obrpc::ObCdcLSFetchLogResp *resp);
+    const obrpc::ObCdcLSFetchLogResp *resp,
+    FetchLogARpcResult *&decoded_result);
 
   static const char *print_state(State state);
 
@@ -263,6 +267,7 @@ private:
       const int64_t rpc_callback_start_time,
       const bool need_stop_rpc,
       const RpcStopReason rpc_stop_reason,
+      FetchLogARpcResult *&decoded_result,
       bool &need_dispatch_stream_task);
   int launch_async_rpc_(RpcRequest &request,
       const palf::LSN &req_start_lsn,
@@ -294,8 +299,8 @@ private:
   class RpcCB : public RpcCBBase
   {
   public:
-    explicit RpcCB(RpcRequest &host) : host_(host) {}
-    virtual ~RpcCB() {}
+    explicit RpcCB(RpcRequest &host) : host_(host), decoded_result_(NULL), decoded_result_pool_(NULL) {}
+    virtual ~RpcCB() { revert_decoded_result_(); }
 
   public:
     rpc::frame::ObReqTransport::AsyncCB *clone(const rpc::frame::SPAlloc &alloc) const;
@@ -305,13 +310,26 @@ private:
     typedef typename obrpc::ObCdcProxy::ObRpc<obrpc::OB_LS_FETCH_LOG2> ProxyRpc;
     void set_args(const typename ProxyRpc::Request &args) { UNUSED(args); }
 
-    TO_STRING_KV("host", reinterpret_cast<void *>(&host_));
+    TO_STRING_KV("host", reinterpret_cast<void *>(&host_), KP_(decoded_result));
+
+  protected:
+    // Deserialize the response into a FetchLogARpcResult allocated from the result pool directly,
+    // so that the log entries are not copied once more when the result is generated.
+    // Fall back to RpcCBBase::result_ if the result pool is exhausted.
+    obrpc::ObCdcLSFetchLogResp &get_decode_result();
 
   private:
     int do_process_(const obrpc::ObRpcResultCode &rcode, const obrpc::ObCdcLSFetchLogResp *resp);
+    void revert_decoded_result_();
 
   private:
     RpcRequest &host_;
+    // Result which the response is deserialized into, owned by the callback until it is
+    // pushed into the result queue.
+    // Note: the pool is cached here because the RpcRequest may have been destroyed when
+    // the discarded response is handled.
+    FetchLogARpcResult              *decoded_result_;
+    IFetchLogARpcResultPool         *decoded_result_pool_;
 
   private:
     DISALLOW_COPY_AND_ASSIGN(RpcCB);
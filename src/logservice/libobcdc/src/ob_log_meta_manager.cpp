@@ -16,6 +16,8 @@
 
 #include "ob_log_meta_manager.h"
 
+#include <fnmatch.h>                              // fnmatch, FNM_CASEFOLD
+
 #include "lib/atomic/ob_atomic.h"                 // ATOMIC_*
 #include "observer/mysql/obsm_utils.h"            // ObSMUtils
 #include "rpc/obmysql/ob_mysql_global.h"          // obmysql
@@ -821,6 +823,8 @@ int ObLogMetaManager::build_table_meta_(
 template<class TABLE_SCHEMA>
 int ObLogMetaManager::build_column_idx_mappings_(
     const TABLE_SCHEMA *table_schema,
+    const char *tenant_name,
+    const char *db_name,
     const ObIArray<uint64_t> &usr_def_col_ids,
     const common::ObIArray<share::schema::ObColDesc> &column_ids,
     ObIArray<int16_t> &store_idx_to_usr_idx,
@@ -861,6 +865,8 @@ int ObLogMetaManager::build_column_idx_mappings_(
           K(column_id), K(column_stored_idx), K(stored_column_cnt), "map_size", col_id_to_usr_col_idx.count());
     } else if (OB_FAIL(check_column_(*table_schema,
         *column_table_schema,
+        tenant_name,
+        db_name,
         is_usr_column,
         is_heap_table_pk_increment_column))) {
       LOG_ERROR("filter_column_ fail", KR(ret), K(is_usr_column),
@@ -968,6 +974,8 @@ int ObLogMetaManager::build_column_metas_(
     // the to_string method of ObSEArray requires the to_string method of IColMeta
     // so we use void* to bypass the requirement
     ObSEArray<void*, 16> col_metas;
+    TenantSchemaInfo tenant_schema_info;
+    DBSchemaInfo db_schema_info;
 
     // build Meta for each column
     // iter all column:
@@ -977,8 +985,15 @@ int ObLogMetaManager::build_column_metas_(
     // 2.2. inc usr_column_idx and recorded into column_schema, which will used to decide format
     //      idata into br or not.
 
-    if (OB_FAIL(build_column_idx_mappings_(table_schema, usr_def_col_ids, column_ids,
-        column_stored_idx_to_usr_idx, usr_column_cnt, stop_flag))) {
+    if (OB_FAIL(get_tenant_and_db_schema_info_(schema_mgr, tenant_id, table_schema->get_database_id(),
+        tenant_schema_info, db_schema_info, stop_flag))) {
+      // caller deal with error code OB_TENANT_HAS_BEEN_DROPPED
+      if (OB_IN_STOP_STATE != ret) {
+        LOG_ERROR("get_tenant_and_db_schema_info_ fail", KR(ret), K(tenant_id),
+            "db_id", table_schema->get_database_id(), "table_name", table_schema->get_table_name());
+      }
+    } else if (OB_FAIL(build_column_idx_mappings_(table_schema, tenant_schema_info.name_, db_schema_info.name_,
+        usr_def_col_ids, column_ids, column_stored_idx_to_usr_idx, usr_column_cnt, stop_flag))) {
       LOG_ERROR("build column idx mapping failed", K(table_schema), K(usr_def_col_ids), K(column_ids));
     } else if (OB_FAIL(col_metas.prepare_allocate(usr_column_cnt))) {
       LOG_ERROR("reserve slots for col_metas failed", K(usr_column_cnt));
@@ -1085,6 +1100,8 @@ template<class TABLE_SCHEMA, class COLUMN_SCHEMA>
 int ObLogMetaManager::check_column_(
     const TABLE_SCHEMA &table_schema,
     const COLUMN_SCHEMA &column_schema,
+    const char *tenant_name,
+    const char *db_name,
     bool &is_user_column,
     bool &is_heap_table_pk_increment_column)
 {
@@ -1115,6 +1132,17 @@ int ObLogMetaManager::check_column_(
     is_user_column = false;
   } else if (column_schema.is_invisible_column() && !enable_output_invisible_column){
     is_user_column = false;
+  } else {
+    // column projection: columns in tb_column_black_list are never parsed and output
+    bool is_in_column_black_list = false;
+    if (OB_FAIL(match_column_black_list_(tenant_name, db_name, table_schema.get_table_name(),
+        column_schema.get_column_name(), is_in_column_black_list))) {
+      LOG_ERROR("match_column_black_list_ fail", KR(ret), K(tenant_name), K(db_name),
+          "table_name", table_schema.get_table_name(),
+          "column_name", column_schema.get_column_name());
+    } else if (is_in_column_black_list) {
+      is_user_column = false;
+    }
   }
 
   META_STAT_INFO("check_column_",
@@ -1136,6 +1164,107 @@ int ObLogMetaManager::check_column_(
   return ret;
 }
 
+int ObLogMetaManager::match_column_black_list_(
+    const char *tenant_name,
+    const char *db_name,
+    const char *table_name,
+    const char *column_name,
+    bool &is_matched)
+{
+  int ret = OB_SUCCESS;
+  const char *column_black_list = TCONF.tb_column_black_list.str();
+  char buf[common::OB_MAX_CONFIG_VALUE_LEN];
+  char *save_ptr = NULL;
+  is_matched = false;
+
+  if (OB_ISNULL(tenant_name) || OB_ISNULL(db_name) || OB_ISNULL(table_name) || OB_ISNULL(column_name)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_ERROR("invalid argument", KR(ret), KP(tenant_name), KP(db_name), KP(table_name), KP(column_name));
+  } else if (OB_ISNULL(column_black_list) || 0 == strcmp(column_black_list, "|")) {
+    // empty black list
+  } else if (OB_FAIL(databuff_printf(buf, sizeof(buf), "%s", column_black_list))) {
+    LOG_ERROR("copy tb_column_black_list fail", KR(ret), K(column_black_list));
+  } else {
+    for (char *pattern = strtok_r(buf, "|", &save_ptr);
+        ! is_matched && NULL != pattern;
+        pattern = strtok_r(NULL, "|", &save_ptr)) {
+      // tenant_name.db_name.table_name.column_name, the same form as tb_white_list
+      char *db_pattern = strchr(pattern, '.');
+      char *tb_pattern = (NULL == db_pattern) ? NULL : strchr(db_pattern + 1, '.');
+      char *column_pattern = (NULL == tb_pattern) ? NULL : strchr(tb_pattern + 1, '.');
+
+      if (NULL == column_pattern) {
+        LOG_WARN("invalid tb_column_black_list pattern, ignore it", K(pattern));
+      } else {
+        *db_pattern++ = '\0';
+        *tb_pattern++ = '\0';
+        *column_pattern++ = '\0';
+        // case-insensitive as table matching by default
+        is_matched = (0 == fnmatch(pattern, tenant_name, FNM_CASEFOLD))
+            && (0 == fnmatch(db_pattern, db_name, FNM_CASEFOLD))
+            && (0 == fnmatch(tb_pattern, table_name, FNM_CASEFOLD))
+            && (0 == fnmatch(column_pattern, column_name, FNM_CASEFOLD));
+      }
+    }
+
+    if (is_matched) {
+      LOG_INFO("column is filtered by tb_column_black_list", K(tenant_name), K(db_name), K(table_name),
+          K(column_name));
+    }
+  }
+
+  return ret;
+}
+
+int ObLogMetaManager::get_tenant_and_db_schema_info_(
+    ObLogSchemaGuard &schema_mgr,
+    const uint64_t tenant_id,
+    const uint64_t db_id,
+    TenantSchemaInfo &tenant_schema_info,
+    DBSchemaInfo &db_schema_info,
+    volatile bool &stop_flag)
+{
+  int ret = OB_SUCCESS;
+
+  RETRY_FUNC(stop_flag, schema_mgr, get_tenant_schema_info, tenant_id, tenant_schema_info,
+      GET_SCHEMA_TIMEOUT);
+
+  if (OB_FAIL(ret)) {
+    if (OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("get_tenant_schema_info fail", KR(ret), K(tenant_id), K(db_id));
+    }
+  } else {
+    RETRY_FUNC(stop_flag, schema_mgr, get_database_schema_info, tenant_id, db_id, db_schema_info,
+        GET_SCHEMA_TIMEOUT);
+
+    if (OB_FAIL(ret) && OB_IN_STOP_STATE != ret) {
+      LOG_ERROR("get_database_schema_info fail", KR(ret), K(tenant_id), K(db_id));
+    }
+  }
+
+  return ret;
+}
+
+int ObLogMetaManager::get_tenant_and_db_schema_info_(
+    ObDictTenantInfo &tenant_info,
+    const uint64_t tenant_id,
+    const uint64_t db_id,
+    TenantSchemaInfo &tenant_schema_info,
+    DBSchemaInfo &db_schema_info,
+    volatile bool &stop_flag)
+{
+  int ret = OB_SUCCESS;
+  UNUSED(stop_flag);
+
+  if (OB_FAIL(tenant_info.get_tenant_schema_info(tenant_schema_info))) {
+    LOG_ERROR("get_tenant_schema_info from dict_tenant_meta failed", KR(ret), K(tenant_id));
+  } else if (OB_FAIL(tenant_info.get_database_schema_info(db_id, db_schema_info))) {
+    LOG_ERROR("get_database_schema_info from dict_tenant_meta failed", KR(ret), K(tenant_id), K(db_id));
+  }
+
+  return ret;
+}
+
 template<class TABLE_SCHEMA, class COLUMN_SCHEMA>
 int ObLogMetaManager::set_column_meta_(
     IColMeta *col_meta,
@@ -348,6 +348,8 @@ private:
   template<class TABLE_SCHEMA>
   int build_column_idx_mappings_(
       const TABLE_SCHEMA *table_schema,
+      const char *tenant_name,
+      const char *db_name,
       const ObIArray<uint64_t> &usr_def_col_ids,
       const common::ObIArray<share::schema::ObColDesc> &column_ids,
       ObIArray<int16_t> &store_idx_to_usr_idx,
@@ -371,8 +373,32 @@ private:
   int check_column_(
       const TABLE_SCHEMA &table_schema,
       const COLUMN_SCHEMA &column_schema,
+      const char *tenant_name,
+      const char *db_name,
       bool &is_usr_column,
       bool &is_heap_table_pk_increment_column);
+  // match tenant_name.db_name.table_name.column_name with tb_column_black_list
+  int match_column_black_list_(
+      const char *tenant_name,
+      const char *db_name,
+      const char *table_name,
+      const char *column_name,
+      bool &is_matched);
+  // get tenant name and database name of the table, to match tb_column_black_list
+  int get_tenant_and_db_schema_info_(
+      ObLogSchemaGuard &schema_mgr,
+      const uint64_t tenant_id,
+      const uint64_t db_id,
+      TenantSchemaInfo &tenant_schema_info,
+      DBSchemaInfo &db_schema_info,
+      volatile bool &stop_flag);
+  int get_tenant_and_db_schema_info_(
+      ObDictTenantInfo &tenant_info,
+      const uint64_t tenant_id,
+      const uint64_t db_id,
+      TenantSchemaInfo &tenant_schema_info,
+      DBSchemaInfo &db_schema_info,
+      volatile bool &stop_flag);
   template<class TABLE_SCHEMA, class COLUMN_SCHEMA>
   int set_column_meta_(
       IColMeta *col_meta,
@@ -143,10 +143,9 @@ int MutatorRow::parse_columns_(
       ColumnSchemaInfo *column_schema_info = NULL;
       blocksstable::ObStorageDatum &datum = datum_row.storage_datums_[column_stored_idx];
 
-      if (OB_FAIL(deep_copy_encoded_column_value_(datum))) {
-        LOG_ERROR("deep_copy_encoded_column_value_ failed", KR(ret),
-            K(tenant_id), K(table_id), K(column_stored_idx), K(datum), K(is_parse_new_col));
-      } else if (OB_FAIL(get_column_info_(
+      // Note: check column before touching the datum, columns which user doesn't care
+      // (hidden column or column in tb_column_black_list) are never copied and converted
+      if (OB_FAIL(get_column_info_(
             tb_schema_info,
             all_ddl_operation_table_schema_info,
             column_stored_idx - column_offset,
@@ -213,7 +212,10 @@ int MutatorRow::parse_columns_(
           ObObjMeta obj_meta;
           ObObj obj;
 
-          if (OB_FAIL(set_obj_propertie_(
+          if (OB_FAIL(deep_copy_encoded_column_value_(datum))) {
+            LOG_ERROR("deep_copy_encoded_column_value_ failed", KR(ret),
+                K(tenant_id), K(table_id), K(column_stored_idx), K(datum), K(is_parse_new_col));
+          } else if (OB_FAIL(set_obj_propertie_(
               column_id,
               column_stored_idx - column_offset,
               column_schema_info,
@@ -1664,19 +1664,23 @@ bool ObLogReplayService::StatReplayProcessFunctor::operator()(const share::ObLSI
   int64_t unsubmitted_log_size = 0;
   int64_t replayed_log_size = 0;
   int64_t unreplayed_log_size = 0;
+  LSReplayStat replay_stat;
   if (OB_ISNULL(replay_status)) {
     ret = OB_ERR_UNEXPECTED;
     CLOG_LOG(WARN, "replay status is NULL", K(id), KR(ret));
   } else if (OB_FAIL(replay_status->get_replay_process(submitted_log_size, unsubmitted_log_size,
                                                        replayed_log_size, unreplayed_log_size))){
     CLOG_LOG(WARN, "get_replay_process failed", K(id), KR(ret), KPC(replay_status));
+  } else if (OB_FAIL(replay_status->stat(replay_stat))) {
+    CLOG_LOG(WARN, "replay status stat failed", K(id), KR(ret), KPC(replay_status));
   } else {
     submitted_log_size_ += submitted_log_size;
     unsubmitted_log_size_ += unsubmitted_log_size;
     replayed_log_size_ += replayed_log_size;
     unreplayed_log_size_ += unreplayed_log_size;
     CLOG_LOG(INFO, "get_replay_process success", K(id), K(submitted_log_size), K(unsubmitted_log_size),
-             K(replayed_log_size), K(unreplayed_log_size));
+             K(replayed_log_size), K(unreplayed_log_size), "max_queue_depth", replay_stat.max_queue_depth_,
+             "busy_queue_cnt", replay_stat.busy_queue_cnt_, "replay_lag_us", replay_stat.replay_lag_us_);
   }
   ret_code_ = ret;
   return true;
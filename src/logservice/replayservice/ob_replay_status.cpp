@@ -379,6 +379,7 @@ void ObReplayServiceReplayTask::reset()
     };
   }
   idx_ = -1;
+  task_count_ = 0;
   ObReplayServiceTask::reset();
 }
 
@@ -430,6 +431,7 @@ ObLink *ObReplayServiceReplayTask::pop()
 void ObReplayServiceReplayTask::push(Link *p)
 {
   need_batch_push_ = true;
+  ATOMIC_INC(&task_count_);
   queue_.push(p);
 }
 
@@ -1370,16 +1372,57 @@ int ObReplayStatus::stat(LSReplayStat &stat) const
     stat.role_ = role_;
     stat.enabled_ = is_enabled_;
     stat.pending_cnt_ = pending_task_count_;
+    SCN min_unreplayed_scn;
+    stat_replay_queue_(stat.max_queue_depth_, stat.busy_queue_cnt_, min_unreplayed_scn);
     if (OB_FAIL(submit_log_task_.get_next_to_submit_log_info(stat.unsubmitted_lsn_,
                                                              stat.unsubmitted_scn_))) {
       CLOG_LOG(WARN, "get_next_to_submit_log_info failed", KPC(this), K(ret));
     } else if (OB_FAIL(palf_handle_.get_end_lsn(stat.end_lsn_))) {
       CLOG_LOG(WARN, "get_end_lsn from palf failed", KPC(this), K(ret));
+    } else {
+      if (!min_unreplayed_scn.is_valid() && stat.unsubmitted_lsn_ < stat.end_lsn_) {
+        // all submitted logs have been replayed, the next log to submit is the oldest one
+        min_unreplayed_scn = stat.unsubmitted_scn_;
+      }
+      stat.replay_lag_us_ = (!is_enabled_ || !min_unreplayed_scn.is_valid()) ? 0 :
+          MAX(0, ObTimeUtility::current_time() - min_unreplayed_scn.convert_to_ts());
     }
   }
   return ret;
 }
 
+void ObReplayStatus::stat_replay_queue_(int64_t &max_queue_depth,
+                                        int64_t &busy_queue_cnt,
+                                        SCN &min_unreplayed_scn) const
+{
+  max_queue_depth = 0;
+  busy_queue_cnt = 0;
+  min_unreplayed_scn.reset();
+  for (int64_t i = 0; i < REPLAY_TASK_QUEUE_SIZE; ++i) {
+    ObReplayServiceReplayTask &task_queue = const_cast<ObReplayServiceReplayTask &>(task_queues_[i]);
+    const int64_t depth = task_queue.get_task_count();
+    if (depth > 0) {
+      LSN queue_lsn;
+      SCN queue_scn;
+      int64_t replay_hint = 0;
+      ObLogBaseType log_type = ObLogBaseType::INVALID_LOG_BASE_TYPE;
+      int64_t first_handle_ts = 0;
+      int64_t replay_cost = 0;
+      int64_t retry_cost = 0;
+      bool is_queue_empty = true;
+      busy_queue_cnt++;
+      max_queue_depth = MAX(max_queue_depth, depth);
+      if (OB_SUCCESS == task_queue.get_min_unreplayed_log_info(queue_lsn, queue_scn, replay_hint,
+                                                               log_type, first_handle_ts, replay_cost,
+                                                               retry_cost, is_queue_empty)
+          && !is_queue_empty
+          && (!min_unreplayed_scn.is_valid() || queue_scn < min_unreplayed_scn)) {
+        min_unreplayed_scn = queue_scn;
+      }
+    }
+  }
+}
+
 int ObReplayStatus::diagnose(ReplayDiagnoseInfo &diagnose_info)
 {
   int ret = OB_SUCCESS;
@@ -1420,6 +1463,10 @@ int ObReplayStatus::diagnose(ReplayDiagnoseInfo &diagnose_info)
   } else if (0 < retry_cost || 0 < replay_cost) {
     replay_ret = OB_EAGAIN;
   }
+  int64_t max_queue_depth = 0;
+  int64_t busy_queue_cnt = 0;
+  SCN unused_scn;
+  stat_replay_queue_(max_queue_depth, busy_queue_cnt, unused_scn);
   if (OB_SUCC(ret) || OB_STATE_NOT_MATCH == ret) {
     ret = OB_SUCCESS;
     if (OB_FAIL(diagnose_info.diagnose_str_.append_fmt("is_enabled:%s; "
@@ -1430,12 +1477,17 @@ int ObReplayStatus::diagnose(ReplayDiagnoseInfo &diagnose_info)
                                                        "log_type:%s; "
                                                        "replay_cost:%ld; "
                                                        "retry_cost:%ld; "
-                                                       "first_handle_time:%ld;" ,
+                                                       "first_handle_time:%ld; "
+                                                       "pending_cnt:%ld; "
+                                                       "max_queue_depth:%ld; "
+                                                       "busy_queue_cnt:%ld;" ,
                                                        is_enabled_? "true" : "false",
                                                        replay_ret, min_unreplayed_lsn.val_,
                                                        min_unreplayed_scn.get_val_for_inner_table_field(), replay_hint,
                                                        is_submit_err ? "REPLAY_SUBMIT" : log_type_str,
-                                                       replay_cost, retry_cost, first_handle_time))) {
+                                                       replay_cost, retry_cost, first_handle_time,
+                                                       ATOMIC_LOAD(&pending_task_count_),
+                                                       max_queue_depth, busy_queue_cnt))) {
       CLOG_LOG(WARN, "append diagnose str failed", K(ret), K(replay_ret), K(min_unreplayed_lsn), K(min_unreplayed_scn),
                K(replay_hint), K(is_submit_err), K(replay_cost), K(retry_cost), K(first_handle_time));
     }
@@ -60,6 +60,21 @@ enum class ObReplayServiceTaskType
 //虚拟表统计
 struct LSReplayStat
 {
+  LSReplayStat() { reset(); }
+  ~LSReplayStat() { reset(); }
+  void reset()
+  {
+    ls_id_ = 0;
+    role_ = common::ObRole::INVALID_ROLE;
+    end_lsn_.reset();
+    enabled_ = false;
+    unsubmitted_lsn_.reset();
+    unsubmitted_scn_.reset();
+    pending_cnt_ = 0;
+    max_queue_depth_ = 0;
+    busy_queue_cnt_ = 0;
+    replay_lag_us_ = 0;
+  }
   int64_t ls_id_;
   common::ObRole role_;
   palf::LSN end_lsn_;
@@ -67,6 +82,11 @@ struct LSReplayStat
   palf::LSN unsubmitted_lsn_;
   share::SCN unsubmitted_scn_;
   int64_t pending_cnt_;
+  // replay queue load, for finding skewed replay hints
+  int64_t max_queue_depth_;
+  int64_t busy_queue_cnt_;
+  // delay between now and the scn of the oldest unreplayed log
+  int64_t replay_lag_us_;
 
   TO_STRING_KV(K(ls_id_),
                K(role_),
@@ -74,7 +94,10 @@ struct LSReplayStat
                K(enabled_),
                K(unsubmitted_lsn_),
                K(unsubmitted_scn_),
-               K(pending_cnt_));
+               K(pending_cnt_),
+               K(max_queue_depth_),
+               K(busy_queue_cnt_),
+               K(replay_lag_us_));
 };
 
 struct ReplayDiagnoseInfo
@@ -352,6 +375,7 @@ public:
     type_ = ObReplayServiceTaskType::REPLAY_LOG_TASK;
     idx_ = -1;
     need_batch_push_ = false;
+    task_count_ = 0;
   }
   ~ObReplayServiceReplayTask() { destroy(); }
   // use base_scn init min_unreplayed_scn
@@ -377,17 +401,24 @@ public:
                                   bool &is_queue_empty);
   bool need_batch_push();
   void set_batch_push_finish();
+  // number of ObLogReplayTask waiting in this queue
+  int64_t get_task_count() const { return ATOMIC_LOAD(&task_count_); }
   INHERIT_TO_STRING_KV("ObReplayServiceReplayTask", ObReplayServiceTask,
-                       K(idx_));
+                       K(idx_), K(task_count_));
 private:
   Link *pop_()
   {
-    return queue_.pop();
+    Link *p = queue_.pop();
+    if (NULL != p) {
+      ATOMIC_DEC(&task_count_);
+    }
+    return p;
   }
 private:
   common::ObSpScLinkQueue queue_; //place ObLogReplayTask
   int64_t idx_; //热点行优化
   bool need_batch_push_; //batch push判断标志, 只有拉日志线程可以修改此值
+  int64_t task_count_;
 };
 
 class ObReplayFsCb : public palf::PalfFSCb
@@ -597,6 +628,9 @@ private:
   // 注销回调并清空任务
   int disable_();
   bool is_replay_enabled_() const;
+  void stat_replay_queue_(int64_t &max_queue_depth,
+                          int64_t &busy_queue_cnt,
+                          share::SCN &min_unreplayed_scn) const;
 
 private:
   static const int64_t PENDING_COUNT_THRESHOLD = 100;
@@ -100,6 +100,7 @@
 #include "storage/compaction/ob_compaction_diagnose.h"
 #include "storage/ob_file_system_router.h"
 #include "storage/blocksstable/ob_storage_cache_suite.h"
+#include "storage/blocksstable/ob_block_cache_snapshot.h"
 #include "storage/blocksstable/ob_object_manager.h"
 #include "storage/tablelock/ob_table_lock_rpc_client.h"
 #include "storage/compaction/ob_compaction_diagnose.h"
@@ -303,6 +304,7 @@ int ObServer::init(const ObServerOptions &opts, const ObPLogWriterCfg &log_cfg)
   }
   // set large page param
   ObLargePageHelper::set_param(config_.use_large_pages);
+  AChunkMgr::instance().set_numa_aware(config_._enable_numa_aware_chunk);
 
   if (is_arbitration_mode()) {
 #ifdef OB_BUILD_ARBITRATION
@@ -655,6 +657,10 @@ void ObServer::destroy()
     ObActiveSessHistTask::get_instance().destroy();
     FLOG_INFO("active session history task destroyed");
 
+    FLOG_INFO("begin to destroy block cache snapshot");
+    ObBlockCacheSnapshot::get_instance().destroy();
+    FLOG_INFO("block cache snapshot destroyed");
+
     FLOG_INFO("begin to destroy timer monitor");
     ObTimerMonitor::get_instance().destroy();
     FLOG_INFO("timer monitor destroyed");
@@ -1136,6 +1142,12 @@ int ObServer::start()
       FLOG_INFO("success to init active session history task");
     }
 
+    if (FAILEDx(ObBlockCacheSnapshot::get_instance().start())) {
+      LOG_ERROR("fail to start block cache snapshot", KR(ret));
+    } else {
+      FLOG_INFO("success to start block cache snapshot");
+    }
+
     if (FAILEDx(location_service_.start())) {
       LOG_ERROR("fail to start location service", KR(ret));
     } else {
@@ -1478,6 +1490,10 @@ int ObServer::stop()
     ObActiveSessHistTask::get_instance().stop();
     FLOG_INFO("active session history task stopped");
 
+    FLOG_INFO("begin to stop block cache snapshot");
+    ObBlockCacheSnapshot::get_instance().stop();
+    FLOG_INFO("block cache snapshot stopped");
+
     FLOG_INFO("begin to stop table store stat mgr");
     ObTableStoreStatMgr::get_instance().stop();
     FLOG_INFO("table store stat mgr stopped");
@@ -1800,6 +1816,10 @@ int ObServer::wait()
     ObActiveSessHistTask::get_instance().wait();
     FLOG_INFO("wait active session hist task success");
 
+    FLOG_INFO("begin to wait block cache snapshot");
+    ObBlockCacheSnapshot::get_instance().wait();
+    FLOG_INFO("wait block cache snapshot success");
+
     FLOG_INFO("begin to wait timer monitor");
     ObTimerMonitor::get_instance().wait();
     FLOG_INFO("wait timer monitor success");
@@ -3086,6 +3106,8 @@ int ObServer::init_storage()
                                     storage_env_.bf_cache_miss_count_threshold_,
                                     storage_env_.storage_meta_cache_priority_))) {
       LOG_WARN("Fail to init OB_STORE_CACHE, ", KR(ret), K(storage_env_.data_dir_));
+    } else if (OB_FAIL(ObBlockCacheSnapshot::get_instance().init(storage_env_.data_dir_))) {
+      LOG_WARN("fail to init block cache snapshot", KR(ret), K(storage_env_.data_dir_));
     } else if (OB_FAIL(OB_STORAGE_OBJECT_MGR.init(
         GCTX.is_shared_storage_mode(), storage_env_.default_block_size_))) {
       LOG_ERROR("init storage object mgr fail", KR(ret));
@@ -277,6 +277,8 @@ int ObSrvNetworkFrame::reload_config()
     LOG_WARN("Failed to set rpc tcp keepalive parameters.");
   } else if (OB_FAIL(obrpc::global_poc_server.update_tcp_keepalive_params(user_timeout))) {
     LOG_WARN("Failed to set pkt-nio rpc tcp keepalive parameters.");
+  } else if (OB_FAIL(obrpc::global_poc_server.update_write_coalesce_time(GCONF._pnio_write_coalesce_time))) {
+    LOG_WARN("Failed to set pkt-nio write coalesce time.");
   } else if (OB_FAIL(net_.update_sql_tcp_keepalive_params(user_timeout, enable_tcp_keepalive,
                                                           tcp_keepidle, tcp_keepintvl,
                                                           tcp_keepcnt))) {
@@ -83,6 +83,54 @@ void MultiLevelReqCnt::atomic_inc(const int32_t level)
   }
 }
 
+void ReqQueueWaitStat::add(const int prio, const int64_t wait_us)
+{
+  if (prio >= 0 && prio < RQ_MAX_PRIO) {
+    const int64_t wait = max(wait_us, 0L);
+    Slot &slot = slots_[icpu_id() & (SLOT_CNT - 1)];
+    ATOMIC_INC(&slot.pop_cnt_[prio]);
+    ATOMIC_AAF(&slot.wait_us_[prio], wait);
+    if (prio < QQ_MAX_PRIO) {
+      EVENT_INC(REQUEST_QUICK_QUEUE_DEQUEUE_COUNT);
+      EVENT_ADD(REQUEST_QUICK_QUEUE_TIME, wait);
+    } else if (RQ_HIGH == prio) {
+      EVENT_INC(REQUEST_HIGH_QUEUE_DEQUEUE_COUNT);
+      EVENT_ADD(REQUEST_HIGH_QUEUE_TIME, wait);
+    } else if (RQ_NORMAL == prio) {
+      EVENT_INC(REQUEST_NORMAL_QUEUE_DEQUEUE_COUNT);
+      EVENT_ADD(REQUEST_NORMAL_QUEUE_TIME, wait);
+    } else {
+      EVENT_INC(REQUEST_LOW_QUEUE_DEQUEUE_COUNT);
+      EVENT_ADD(REQUEST_LOW_QUEUE_TIME, wait);
+    }
+  }
+}
+
+void ReqQueueWaitStat::get(const int prio, int64_t &pop_cnt, int64_t &wait_us) const
+{
+  pop_cnt = 0;
+  wait_us = 0;
+  if (prio >= 0 && prio < RQ_MAX_PRIO) {
+    for (int64_t i = 0; i < SLOT_CNT; i++) {
+      pop_cnt += ATOMIC_LOAD(&slots_[i].pop_cnt_[prio]);
+      wait_us += ATOMIC_LOAD(&slots_[i].wait_us_[prio]);
+    }
+  }
+}
+
+int64_t ReqQueueWaitStat::to_string(char *buf, const int64_t buf_len) const
+{
+  int64_t pos = 0;
+  for (int prio = 0; prio < RQ_MAX_PRIO; prio++) {
+    int64_t pop_cnt = 0;
+    int64_t wait_us = 0;
+    get(prio, pop_cnt, wait_us);
+    common::databuff_printf(buf, buf_len, pos, "queue[%d]={pop_cnt:%ld, avg_wait_us:%ld} ",
+                            prio, pop_cnt, 0 == pop_cnt ? 0 : wait_us / pop_cnt);
+  }
+  return pos;
+}
+
 int ObPxPools::init(uint64_t tenant_id)
 {
   static int PX_POOL_COUNT = 128; // 128 groups, generally enough
@@ -1235,6 +1283,8 @@ int ObTenant::get_new_request(
 
   req = nullptr;
   int wk_level = 0;
+  // priority of req_queue_ which the request is popped from
+  int prio = -1;
   Thread::WaitGuard guard(Thread::WAIT_IN_TENANT_QUEUE);
   if (w.is_group_worker()) {
     w.set_large_query(false);
@@ -1305,16 +1355,16 @@ int ObTenant::get_new_request(
         if (OB_UNLIKELY(w.is_high_priority())) {
           // We must ensure at least one worker can process the highest
           // priority task.
-          ret = req_queue_.pop_high(task, timeout);
+          ret = req_queue_.pop_high(task, timeout, &prio);
         } else if (OB_UNLIKELY(w.is_normal_priority())) {
           // We must ensure at least number of tokens of workers which don't
           // process low priority task.
-          ret = req_queue_.pop_normal(task, timeout);
+          ret = req_queue_.pop_normal(task, timeout, &prio);
         } else {
           // If large requests exist and this worker doesn't have LQT but
           // can acquire, do it.
           ATOMIC_INC(&pop_normal_cnt_);
-          ret = req_queue_.pop(task, timeout);
+          ret = req_queue_.pop(task, timeout, &prio);
         }
       }
     }
@@ -1325,6 +1375,9 @@ int ObTenant::get_new_request(
     if (nullptr == req && nullptr != task) {
       req = static_cast<rpc::ObRequest*>(task);
     }
+    if (nullptr != req && prio >= 0) {
+      req_queue_wait_stat_.add(prio, ObTimeUtility::fast_current_time() - req->get_enqueue_timestamp());
+    }
     if (nullptr != req) {
       if (w.is_group_worker() && req->large_retry_flag()) {
         w.set_large_query();
@@ -226,6 +226,27 @@ private:
   volatile uint64_t cnt_[MAX_REQUEST_LEVEL];
 };
 
+// Queue wait time of requests popped from the tenant request queue by priority,
+// the statistics are sharded by cpu to avoid contention between workers. They are
+// also reported to the tenant sysstat by queue (quick, high, normal and low).
+class ReqQueueWaitStat {
+public:
+  ReqQueueWaitStat() : slots_() {}
+  ~ReqQueueWaitStat() {}
+  void add(const int prio, const int64_t wait_us);
+  void get(const int prio, int64_t &pop_cnt, int64_t &wait_us) const;
+  int64_t to_string(char *buf, const int64_t buf_len) const;
+private:
+  static const int64_t SLOT_CNT = 16;
+  struct Slot
+  {
+    Slot() : pop_cnt_(), wait_us_() {}
+    int64_t pop_cnt_[RQ_MAX_PRIO];
+    int64_t wait_us_[RQ_MAX_PRIO];
+  } CACHE_ALIGNED;
+  Slot slots_[SLOT_CNT];
+};
+
 class ObResourceGroupNode : public common::SpHashNode
 {
 public:
@@ -460,6 +481,7 @@ public:
                "workers", workers_.get_size(),
                "nesting workers", nesting_workers_.get_size(),
                K_(req_queue),
+               K_(req_queue_wait_stat),
                K_(multi_level_queue),
                K_(recv_level_rpc_cnt),
                K_(group_map),
@@ -560,7 +582,9 @@ protected:
 
   /// tenant task queue,
   // 'hp' for high priority and 'np' for normal priority
-  common::ObPriorityQueue2<1, QQ_MAX_PRIO - 1, RQ_MAX_PRIO - QQ_MAX_PRIO> req_queue_;
+  // requests are sharded by cpu, workers steal from other shards when the local one is empty
+  common::ObShardedPriorityQueue<1, QQ_MAX_PRIO - 1, RQ_MAX_PRIO - QQ_MAX_PRIO> req_queue_;
+  ReqQueueWaitStat req_queue_wait_stat_;
 
   //Create a request queue for each level of nested requests
   ObMultiLevelQueue *multi_level_queue_;
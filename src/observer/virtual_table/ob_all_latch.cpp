@@ -199,6 +199,20 @@ int ObAllLatch::inner_get_next_row(ObNewRow *&row)
             cells[cell_idx].set_int(latch_stat.wait_time_);
             break;
           }
+        case HOLD_TIME_HISTOGRAM: {
+            const int64_t len = latch_stat.hold_hist_.to_string(hold_hist_buf_, sizeof(hold_hist_buf_));
+            cells[cell_idx].set_varchar(hold_hist_buf_, static_cast<ObString::obstr_size_t>(len));
+            cells[cell_idx].set_collation_type(
+                ObCharset::get_default_collation(ObCharset::get_default_charset()));
+            break;
+          }
+        case WAIT_TIME_HISTOGRAM: {
+            const int64_t len = latch_stat.wait_hist_.to_string(wait_hist_buf_, sizeof(wait_hist_buf_));
+            cells[cell_idx].set_varchar(wait_hist_buf_, static_cast<ObString::obstr_size_t>(len));
+            cells[cell_idx].set_collation_type(
+                ObCharset::get_default_collation(ObCharset::get_default_charset()));
+            break;
+          }
         default: {
             ret = OB_ERR_UNEXPECTED;
             SERVER_LOG(WARN, "invalid column id", K(cell_idx), K_(output_column_ids), K(ret));
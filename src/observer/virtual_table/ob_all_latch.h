@@ -55,12 +55,16 @@ private:
     IMMEDIATE_GETS,
     IMMEDIATE_MISSES,
     SPIN_GETS,
-    WAIT_TIME
+    WAIT_TIME,
+    HOLD_TIME_HISTOGRAM,
+    WAIT_TIME_HISTOGRAM
   };
   common::ObAddr *addr_;
   int32_t iter_;
   int64_t latch_iter_;
   common::ObArray<std::pair<uint64_t, common::ObDiagnoseTenantInfo*> > tenant_dis_;
+  char hold_hist_buf_[common::OB_MAX_CHAR_LENGTH];
+  char wait_hist_buf_[common::OB_MAX_CHAR_LENGTH];
   DISALLOW_COPY_AND_ASSIGN(ObAllLatch);
 }; // end of class ObAllLatch
 
@@ -0,0 +1,171 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "ob_all_virtual_ash_profile.h"
+#include "observer/ob_server.h"
+#include "observer/ob_server_utils.h"
+
+using namespace oceanbase::common;
+
+namespace oceanbase
+{
+namespace observer
+{
+ObAllVirtualAshProfile::ObAllVirtualAshProfile()
+    : ObVirtualTableScannerIterator(),
+      entries_(),
+      idx_(0),
+      opened_(false)
+{}
+
+ObAllVirtualAshProfile::~ObAllVirtualAshProfile()
+{
+  reset();
+}
+
+int ObAllVirtualAshProfile::inner_open()
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(ObServerConfig::get_instance().self_addr_.ip_to_string(ip_buf_, sizeof(ip_buf_))
+              == false)) {
+    ret = OB_ERR_UNEXPECTED;
+    SERVER_LOG(WARN, "ip_to_string() fail", K(ret));
+  }
+  return ret;
+}
+
+void ObAllVirtualAshProfile::reset()
+{
+  entries_.reset();
+  idx_ = 0;
+  opened_ = false;
+}
+
+int ObAllVirtualAshProfile::inner_get_next_row(ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  if (!opened_) {
+    // take a snapshot, the profile table can't be held during the scan
+    ObAshProfiler &profiler = ObAshProfiler::get_instance();
+    const uint64_t tenant_id = effective_tenant_id_;
+    auto fn = [&](const ObAshProfiler::Entry &entry) {
+      int tmp_ret = OB_SUCCESS;
+      if (is_sys_tenant(tenant_id) || tenant_id == entry.tenant_id_) {
+        tmp_ret = entries_.push_back(entry);
+      }
+      return tmp_ret;
+    };
+    profiler.drain();
+    if (OB_FAIL(profiler.for_each_entry(fn))) {
+      SERVER_LOG(WARN, "failed to load ash profile", K(ret));
+    } else {
+      idx_ = 0;
+      opened_ = true;
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (idx_ >= entries_.count()) {
+    ret = OB_ITER_END;
+  } else if (OB_FAIL(fill_row(entries_.at(idx_), row))) {
+    SERVER_LOG(WARN, "failed to fill row", K(ret));
+  } else {
+    idx_++;
+  }
+  return ret;
+}
+
+int ObAllVirtualAshProfile::fill_row(const ObAshProfiler::Entry &entry, ObNewRow *&row)
+{
+  int ret = OB_SUCCESS;
+  ObObj *cells = NULL;
+  if (OB_ISNULL(cells = cur_row_.cells_)) {
+    ret = OB_ERR_UNEXPECTED;
+    SERVER_LOG(WARN, "cur row cell is NULL", K(ret));
+  } else {
+    const int64_t col_count = output_column_ids_.count();
+    for (int64_t i = 0; OB_SUCC(ret) && i < col_count; ++i) {
+      const uint64_t col_id = output_column_ids_.at(i);
+      switch (col_id) {
+      case SVR_IP: {
+          cells[i].set_varchar(ip_buf_);
+          cells[i].set_collation_type(
+              ObCharset::get_default_collation(ObCharset::get_default_charset()));
+          break;
+        }
+      case SVR_PORT: {
+          cells[i].set_int(GCONF.self_addr_.get_port());
+          break;
+        }
+      case TENANT_ID: {
+          cells[i].set_int(entry.tenant_id_);
+          break;
+        }
+      case SQL_ID: {
+          cells[i].set_varchar(entry.sql_id_);
+          cells[i].set_collation_type(
+              ObCharset::get_default_collation(ObCharset::get_default_charset()));
+          break;
+        }
+      case SQL_PLAN_LINE_ID: {
+          if (entry.plan_line_id_ < 0) {
+            cells[i].set_null();
+          } else {
+            cells[i].set_int(entry.plan_line_id_);
+          }
+          break;
+        }
+      case EVENT_NO: {
+          cells[i].set_int(entry.event_no_);
+          break;
+        }
+      case EVENT: {
+          if (entry.event_no_ > 0 && entry.event_no_ < ObWaitEventIds::WAIT_EVENT_DEF_END) {
+            cells[i].set_varchar(OB_WAIT_EVENTS[entry.event_no_].event_name_);
+          } else {
+            cells[i].set_varchar("ON CPU");
+          }
+          cells[i].set_collation_type(
+              ObCharset::get_default_collation(ObCharset::get_default_charset()));
+          break;
+        }
+      case SAMPLE_COUNT: {
+          cells[i].set_int(entry.count_);
+          break;
+        }
+      case LAST_SAMPLE_TIME: {
+          cells[i].set_timestamp(entry.last_sample_time_);
+          break;
+        }
+      case FOLDED_STACK: {
+          const int64_t len = entry.to_folded(stack_buf_, sizeof(stack_buf_));
+          cells[i].set_varchar(stack_buf_, static_cast<ObString::obstr_size_t>(len));
+          cells[i].set_collation_type(
+              ObCharset::get_default_collation(ObCharset::get_default_charset()));
+          break;
+        }
+      default: {
+          ret = OB_ERR_UNEXPECTED;
+          SERVER_LOG(WARN, "unexpected column id", K(col_id), K(i), K(ret));
+          break;
+        }
+      }
+    }
+  }
+  if (OB_SUCC(ret)) {
+    row = &cur_row_;
+  }
+  return ret;
+}
+
+}
+}
@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_OBSERVER_VIRTUAL_TABLE_OB_ALL_VIRTUAL_ASH_PROFILE_H_
+#define OCEANBASE_OBSERVER_VIRTUAL_TABLE_OB_ALL_VIRTUAL_ASH_PROFILE_H_
+
+#include "lib/container/ob_array.h"
+#include "lib/ash/ob_ash_profiler.h"
+#include "share/ob_virtual_table_scanner_iterator.h"
+
+namespace oceanbase
+{
+namespace observer
+{
+// rows of the ASH stack profiler, `folded_stack` with `sample_count` appended is the input
+// of flamegraph.pl:
+//   select concat(folded_stack, ' ', sample_count) from __all_virtual_ash_profile
+class ObAllVirtualAshProfile : public common::ObVirtualTableScannerIterator
+{
+public:
+  ObAllVirtualAshProfile();
+  virtual ~ObAllVirtualAshProfile();
+  virtual int inner_open();
+  virtual void reset();
+  virtual int inner_get_next_row(common::ObNewRow *&row);
+private:
+  int fill_row(const common::ObAshProfiler::Entry &entry, common::ObNewRow *&row);
+private:
+  enum CACHE_COLUMN
+  {
+    SVR_IP = common::OB_APP_MIN_COLUMN_ID,
+    SVR_PORT,
+    TENANT_ID,
+    SQL_ID,
+    SQL_PLAN_LINE_ID,
+    EVENT_NO,
+    EVENT,
+    SAMPLE_COUNT,
+    LAST_SAMPLE_TIME,
+    FOLDED_STACK,
+  };
+  char ip_buf_[common::OB_IP_STR_BUFF];
+  char stack_buf_[common::DEFAULT_BUF_LENGTH];
+  common::ObArray<common::ObAshProfiler::Entry> entries_;
+  int64_t idx_;
+  bool opened_;
+private:
+  DISALLOW_COPY_AND_ASSIGN(ObAllVirtualAshProfile);
+};
+}
+}
+
+#endif
@@ -19,6 +19,7 @@
 #include "observer/omt/ob_multi_tenant.h"
 #include "share/cache/ob_kv_storecache.h"
 #include "storage/tx_storage/ob_tenant_freezer.h"
+#include "sql/engine/ob_tenant_sql_memory_manager.h"
 
 namespace oceanbase
 {
@@ -187,6 +188,12 @@ int ObAllVirtualSysStat::update_all_stats_(const int64_t tenant_id, ObStatEventS
         (OB_SYS_TENANT_ID == tenant_id) ? lib::AChunkMgr::instance().get_used() : 0;
     stat_events.get(ObStatEventIds::MEMORY_FREE_SIZE - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
         (OB_SYS_TENANT_ID == tenant_id) ? lib::AChunkMgr::instance().get_freelist_hold() : 0;
+    stat_events.get(ObStatEventIds::MEMORY_LARGE_PAGE_MAPS - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
+        (OB_SYS_TENANT_ID == tenant_id) ? lib::AChunkMgr::instance().get_large_page_maps() : 0;
+    stat_events.get(ObStatEventIds::MEMORY_NUMA_LOCAL_ALLOCS - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
+        (OB_SYS_TENANT_ID == tenant_id) ? lib::AChunkMgr::instance().get_numa_local_allocs() : 0;
+    stat_events.get(ObStatEventIds::MEMORY_NUMA_REMOTE_ALLOCS - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
+        (OB_SYS_TENANT_ID == tenant_id) ? lib::AChunkMgr::instance().get_numa_remote_allocs() : 0;
     stat_events.get(ObStatEventIds::IS_MINI_MODE - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
         (OB_SYS_TENANT_ID == tenant_id) ? (lib::is_mini_mode() ? 1 : 0) : -1;
     stat_events.get(ObStatEventIds::STANDBY_FETCH_LOG_BYTES - ObStatEventIds::STAT_EVENT_ADD_END -1)->stat_value_ =
@@ -261,6 +268,16 @@ int ObAllVirtualSysStat::update_all_stats_(const int64_t tenant_id, ObStatEventS
         }
       }
 
+      sql::ObTenantSqlMemoryManager *sql_mem_mgr = MTL(sql::ObTenantSqlMemoryManager*);
+      if (NULL != sql_mem_mgr) {
+        stat_events.get(ObStatEventIds::SQL_WORKAREA_REDISTRIBUTE_COUNT - ObStatEventIds::STAT_EVENT_ADD_END - 1)->stat_value_
+            = sql_mem_mgr->get_redistribute_count();
+        stat_events.get(ObStatEventIds::SQL_WORKAREA_REDISTRIBUTE_GRANT_SIZE - ObStatEventIds::STAT_EVENT_ADD_END - 1)->stat_value_
+            = sql_mem_mgr->get_redistribute_grant_size();
+        stat_events.get(ObStatEventIds::SQL_WORKAREA_REDISTRIBUTE_RECLAIM_SIZE - ObStatEventIds::STAT_EVENT_ADD_END - 1)->stat_value_
+            = sql_mem_mgr->get_redistribute_reclaim_size();
+      }
+
 #ifdef OB_BUILD_SHARED_STORAGE
       int tmp_ret = OB_SUCCESS;
       if (GCTX.is_shared_storage_mode() && OB_TMP_FAIL(set_ss_stats(tenant_id, stat_events))) {
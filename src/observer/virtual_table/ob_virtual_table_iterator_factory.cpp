@@ -53,6 +53,7 @@
 #include "observer/virtual_table/ob_all_disk_stat.h"
 #include "observer/virtual_table/ob_mem_leak_checker_info.h"
 #include "observer/virtual_table/ob_all_virtual_malloc_sample_info.h"
+#include "observer/virtual_table/ob_all_virtual_ash_profile.h"
 #include "observer/virtual_table/ob_all_latch.h"
 #include "observer/virtual_table/ob_all_data_type_class_table.h"
 #include "observer/virtual_table/ob_all_data_type_table.h"
@@ -1464,6 +1465,14 @@ int ObVTIterCreator::create_vt_iter(ObVTableScanParam &params,
             }
             break;
           }
+          case OB_ALL_VIRTUAL_ASH_PROFILE_TID: {
+            ObAllVirtualAshProfile *ash_profile = NULL;
+            if (OB_SUCC(NEW_VIRTUAL_TABLE(ObAllVirtualAshProfile, ash_profile))) {
+              ash_profile->set_allocator(&allocator);
+              vt_iter = static_cast<ObVirtualTableIterator *>(ash_profile);
+            }
+            break;
+          }
           case OB_ALL_VIRTUAL_MEM_LEAK_CHECKER_INFO_TID: {
             ObMemLeakCheckerInfo *leak_checker = NULL;
             if (OB_SUCC(NEW_VIRTUAL_TABLE(ObMemLeakCheckerInfo, leak_checker))) {
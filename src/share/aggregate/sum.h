@@ -236,6 +236,40 @@ public:
     return ret;
   }
 
+  // sum(decint) over a fixed length param vector is accumulated by DecIntBatchSum, other
+  // formats and window function removal go through the per-row path.
+  int add_batch_rows(RuntimeContext &agg_ctx, const int32_t agg_col_id,
+                     const sql::ObBitVector &skip, const sql::EvalBound &bound, char *agg_cell,
+                     const RowSelector row_sel = RowSelector{}) override
+  {
+    int ret = OB_SUCCESS;
+    const ObAggrInfo &aggr_info = agg_ctx.aggr_infos_.at(agg_col_id);
+    if (is_decint_vec(in_tc) && is_decint_vec(out_tc)
+        && OB_LIKELY(row_sel.is_empty() && nullptr != agg_cell
+                     && !agg_ctx.removal_info_.enable_removal_opt_
+                     && 1 == aggr_info.param_exprs_.count()
+                     && !aggr_info.is_implicit_first_aggr()
+                     && VEC_FIXED == aggr_info.param_exprs_.at(0)->get_format(agg_ctx.eval_ctx_))) {
+      ObFixedLengthBase *columns =
+        static_cast<ObFixedLengthBase *>(aggr_info.param_exprs_.at(0)->get_vector(agg_ctx.eval_ctx_));
+      const sql::ObBitVector *nulls = columns->has_null() ? columns->get_nulls() : nullptr;
+      const sql::ObBitVector *skip_vec = bound.get_all_rows_active() ? nullptr : &skip;
+      bool has_value = false;
+      if (OB_FAIL(DecIntBatchSum<in_tc, out_tc>::do_op(columns->get_data(), nulls, skip_vec,
+                                                       bound.start(), bound.end(), agg_cell,
+                                                       has_value))) {
+        SQL_LOG(WARN, "decimal int batch sum failed", K(ret));
+      } else if (has_value) {
+        NotNullBitVector &not_nulls = agg_ctx.locate_notnulls_bitmap(agg_col_id, agg_cell);
+        not_nulls.set(agg_col_id);
+      }
+    } else {
+      ret = BatchAggregateWrapper<SumAggregate<in_tc, out_tc>>::add_batch_rows(
+        agg_ctx, agg_col_id, skip, bound, agg_cell, row_sel);
+    }
+    return ret;
+  }
+
   virtual int rollup_aggregation(RuntimeContext &agg_ctx, const int32_t agg_col_idx,
                                  AggrRowPtr group_row, AggrRowPtr rollup_row,
                                  int64_t cur_rollup_group_idx,
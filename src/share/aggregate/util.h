@@ -455,6 +455,81 @@ inline int sub_values(const L &l, const R &r, char *res_buf, const int32_t res_l
   return ret;
 }
 
+// batch summation of fixed length decimal ints.
+// values are accumulated in a local accumulator as wide as the param (int64 for int32 params),
+// the accumulator is spilled into the wider result only when the addition overflows.
+template <VecValueTypeClass in_tc, VecValueTypeClass out_tc,
+          bool is_decint = (is_decint_vec(in_tc) && is_decint_vec(out_tc))>
+struct DecIntBatchSum
+{
+  inline static int do_op(const char *data, const sql::ObBitVector *nulls,
+                          const sql::ObBitVector *skip, const int64_t start, const int64_t end,
+                          char *res_buf, bool &has_value)
+  {
+    UNUSEDx(data, nulls, skip, start, end, res_buf, has_value);
+    int ret = OB_NOT_SUPPORTED;
+    SQL_LOG(WARN, "not decimal int summation", K(ret), K(in_tc), K(out_tc));
+    return ret;
+  }
+};
+
+template <VecValueTypeClass in_tc, VecValueTypeClass out_tc>
+struct DecIntBatchSum<in_tc, out_tc, true>
+{
+  using ParamType = RTCType<in_tc>;
+  using ResultType = RTCType<out_tc>;
+  using AccType =
+    typename std::conditional<std::is_same<ParamType, int32_t>::value, int64_t, ParamType>::type;
+
+  // `nulls` and `skip` may be null if all rows in [start, end) are valid
+  inline static int do_op(const char *data, const sql::ObBitVector *nulls,
+                          const sql::ObBitVector *skip, const int64_t start, const int64_t end,
+                          char *res_buf, bool &has_value)
+  {
+    int ret = OB_SUCCESS;
+    const ParamType *vals = reinterpret_cast<const ParamType *>(data);
+    ResultType &res = *reinterpret_cast<ResultType *>(res_buf);
+    AccType acc = 0;
+    AccType tmp_acc = 0;
+    if (nullptr == nulls && nullptr == skip) {
+      for (int64_t i = start; OB_SUCC(ret) && i < end; i++) {
+        if (OB_LIKELY(!OverflowChecker::check_overflow(vals[i], acc, tmp_acc))) {
+          acc = tmp_acc;
+        } else if (OB_FAIL(spill(vals[i], acc, res))) {
+          SQL_LOG(WARN, "spill accumulator failed", K(ret));
+        }
+      }
+      has_value = (end > start);
+    } else {
+      for (int64_t i = start; OB_SUCC(ret) && i < end; i++) {
+        if ((nullptr != skip && skip->at(i)) || (nullptr != nulls && nulls->at(i))) {
+        } else if (FALSE_IT(has_value = true)) {
+        } else if (OB_LIKELY(!OverflowChecker::check_overflow(vals[i], acc, tmp_acc))) {
+          acc = tmp_acc;
+        } else if (OB_FAIL(spill(vals[i], acc, res))) {
+          SQL_LOG(WARN, "spill accumulator failed", K(ret));
+        }
+      }
+    }
+    if (OB_SUCC(ret) && acc != 0) {
+      ret = add_values(acc, res, res_buf, sizeof(ResultType));
+    }
+    return ret;
+  }
+private:
+  inline static int spill(const ParamType &val, AccType &acc, ResultType &res)
+  {
+    int ret = OB_SUCCESS;
+    char *res_buf = reinterpret_cast<char *>(&res);
+    if (OB_FAIL(add_values(acc, res, res_buf, sizeof(ResultType)))) {
+    } else if (OB_FAIL(add_values(val, res, res_buf, sizeof(ResultType)))) {
+    } else {
+      acc = 0;
+    }
+    return ret;
+  }
+};
+
 template<typename Input, typename Output>
 struct Caster
 {
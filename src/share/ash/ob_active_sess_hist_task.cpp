@@ -21,6 +21,8 @@
 #include "lib/utility/ob_tracepoint.h"
 #include "lib/statistic_event/ob_stat_event.h"
 #include "lib/time/ob_time_utility.h"
+#include "lib/ash/ob_ash_profiler.h"
+#include "share/config/ob_server_config.h"
 
 using namespace oceanbase::common;
 using namespace oceanbase::share;
@@ -110,6 +112,14 @@ void ObActiveSessHistTask::runTimerTask()
       }
     }
   }
+  // the profiler follows the parameter here, and its samples are aggregated every round
+  ObAshProfiler &profiler = ObAshProfiler::get_instance();
+  if (0 != is_ash_close) {
+    IGNORE_RETURN profiler.set_interval(0);
+  } else {
+    IGNORE_RETURN profiler.set_interval(GCONF._ash_profile_interval);
+  }
+  profiler.drain();
   EVENT_ADD(ASH_SCHEDULAR_ELAPSE_TIME, common::ObTimeUtility::current_time() - ash_begin_time);
 }
 
@@ -164,6 +164,54 @@ int ObKVCacheMap::get_batch_data_block_cache_key(
   return ret;
 }
 
+int ObKVCacheMap::get_batch_block_cache_hot_key(
+  int64_t &start_pos,
+  const int64_t bucket_count,
+  ObIArray<blocksstable::ObMicroBlockCacheHotKey> &hot_keys)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(!is_inited_)) {
+    ret = OB_NOT_INIT;
+    COMMON_LOG(WARN, "The ObKVCacheMap has not been inited", K(ret));
+  } else if (OB_UNLIKELY(start_pos < 0 || start_pos >= bucket_num_ || bucket_count <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Invalid argument", K(ret), K(start_pos), K(bucket_count), K_(bucket_num));
+  } else {
+    const int64_t end_pos = MIN(start_pos + bucket_count, bucket_num_);
+    ObKVCacheHazardGuard hazard_guard(global_hazard_station_);
+    if (OB_FAIL(hazard_guard.get_ret())) {
+      COMMON_LOG(WARN, "Fail to acquire hazard version", K(ret));
+    } else {
+      blocksstable::ObMicroBlockCacheHotKey hot_key;
+      for (int64_t i = start_pos; OB_SUCC(ret) && i < end_pos; i++) {
+        Node *iter = get_bucket_node(i);
+        while (OB_SUCC(ret) && nullptr != iter) {
+          if (iter->inst_->is_block_cache_ && store_->add_handle_ref(iter->mb_handle_, iter->seq_num_)) {
+            const blocksstable::ObMicroBlockCacheKey *key =
+                static_cast<const blocksstable::ObMicroBlockCacheKey *>(iter->key_);
+            const ObKVCacheConfig *config = iter->inst_->status_.config_;
+            if (!key->is_logic_key()) {
+              hot_key.tenant_id_ = key->get_tenant_id();
+              hot_key.micro_id_ = key->get_micro_block_id();
+              hot_key.heat_ = (iter->get_cnt_ + 1) * MAX(config->priority_, 1);
+              hot_key.is_index_ = 0 == STRNCMP(config->cache_name_, "index_block_cache", MAX_CACHE_NAME_LENGTH);
+              if (OB_FAIL(hot_keys.push_back(hot_key))) {
+                COMMON_LOG(WARN, "Fail to push back hot key", K(ret), K(hot_keys.count()), K(hot_key));
+              }
+            }
+            store_->de_handle_ref(iter->mb_handle_);
+          }
+          iter = iter->next_;
+        }
+      }
+      if (OB_SUCC(ret)) {
+        start_pos = end_pos >= bucket_num_ ? 0 : end_pos;
+      }
+    }
+  }
+  return ret;
+}
+
 int ObKVCacheMap::put(
   ObKVCacheInst &inst,
   const ObIKVCacheKey &key,
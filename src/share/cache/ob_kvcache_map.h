@@ -24,6 +24,7 @@ namespace oceanbase
 namespace blocksstable
 {
 class ObMicroBlockCacheKey;
+struct ObMicroBlockCacheHotKey;
 }
 namespace common
 {
@@ -61,6 +62,12 @@ public:
     ObKVMemBlockHandle *&out_handle);
   int erase(const int64_t cache_id, const ObIKVCacheKey &key);
   int get_batch_data_block_cache_key(const int bucket_count, ObIArray<blocksstable::ObMicroBlockCacheKey> &keys);
+  // collect the physical keys of the block caches in [start_pos, start_pos + bucket_count),
+  // start_pos is moved to the next bucket to visit, 0 when all buckets are visited
+  int get_batch_block_cache_hot_key(
+      int64_t &start_pos,
+      const int64_t bucket_count,
+      ObIArray<blocksstable::ObMicroBlockCacheHotKey> &hot_keys);
   OB_INLINE int64_t get_bucket_num() const { return bucket_num_; }
   void print_hazard_version_info();
 private:
@@ -8170,6 +8170,8 @@ def_table_schema(
   ('immediate_misses', 'int'),
   ('spin_gets', 'int'),
   ('wait_time', 'int'),
+  ('hold_time_histogram', 'varchar:OB_MAX_CHAR_LENGTH'),
+  ('wait_time_histogram', 'varchar:OB_MAX_CHAR_LENGTH'),
   ],
   vtable_route_policy = 'distributed',
   partition_columns = ['svr_ip', 'svr_port'],
@@ -12468,6 +12470,9 @@ def_table_schema(
     ('unsubmitted_lsn', 'uint'),
     ('unsubmitted_log_scn', 'uint'),
     ('pending_cnt', 'int'),
+    ('max_queue_depth', 'int'),
+    ('busy_queue_cnt', 'int'),
+    ('replay_lag_us', 'int'),
   ],
 
   partition_columns = ['svr_ip', 'svr_port'],
@@ -15050,6 +15055,31 @@ def_table_schema(
   vtable_route_policy = 'distributed',
 )
 
+def_table_schema(
+  owner = 'xiaochu.yh',
+  table_name     = '__all_virtual_ash_profile',
+  table_id       = '12506',
+  table_type = 'VIRTUAL_TABLE',
+  gm_columns     = [],
+  rowkey_columns = [],
+  in_tenant_space = True,
+
+  normal_columns = [
+    ('svr_ip', 'varchar:MAX_IP_ADDR_LENGTH'),
+    ('svr_port', 'int'),
+    ('tenant_id', 'int'),
+    ('sql_id', 'varchar:OB_MAX_SQL_ID_LENGTH', 'false', ''),
+    ('sql_plan_line_id', 'int', 'true'),
+    ('event_no', 'int'),
+    ('event', 'varchar:OB_MAX_WAIT_EVENT_NAME_LENGTH', 'false', ''),
+    ('sample_count', 'int'),
+    ('last_sample_time', 'timestamp'),
+    ('folded_stack', 'varchar:DEFAULT_BUF_LENGTH'),
+  ],
+  partition_columns = ['svr_ip', 'svr_port'],
+  vtable_route_policy = 'distributed',
+)
+
 # 余留位置（此行之前占位）
 # 本区域占位建议：采用真实表名进行占位
 ################################################################################
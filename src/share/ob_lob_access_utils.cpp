@@ -105,6 +105,10 @@ int ObTextStringIter::init(uint32_t buffer_len,
         ctx_ ->init();
         ctx_->lob_access_ctx_ = lob_access_ctx;
       }
+      if (OB_FAIL(ret) || !locator.is_delta_temp_lob() || !ob_is_text_tc(type_)) {
+      } else if (OB_FAIL(init_append_delta_lob(locator))) {
+        COMMON_LOG(WARN, "Lob: init append delta lob failed", K(ret), K(locator));
+      }
     }
   }
   if (OB_SUCC(ret)) {
@@ -221,6 +225,55 @@ int ObTextStringIter::get_outrow_lob_full_data(ObIAllocator *allocator /*nullptr
   return ret;
 }
 
+// stream pieces of outrow lob into output_data given by caller, each piece is copied only once
+int ObTextStringIter::read_outrow_lob_pieces(ObString &output_data)
+{
+  int ret = OB_SUCCESS;
+  storage::ObLobManager* lob_mngr = MTL(storage::ObLobManager*);
+  storage::ObLobAccessParam param;
+  storage::ObLobQueryIter *iter = nullptr;
+  if (!has_lob_header_ || !is_outrow_ || OB_ISNULL(ctx_)) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Lob: error condition", K(ret), K(has_lob_header_), K(is_outrow_), KP(ctx_));
+  } else if (OB_ISNULL(lob_mngr)) {
+    ret = OB_ERR_UNEXPECTED;
+    COMMON_LOG(WARN, "Lob: get lob manager failed.", K(ret));
+  } else if (OB_FAIL(init_lob_access_param(param, ctx_, cs_type_, tmp_alloc_))) {
+    COMMON_LOG(WARN, "Lob: init lob access param failed.", K(ret));
+  } else if (!param.ls_id_.is_valid() || !param.tablet_id_.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Lob: invalid param.", K(ret), K(param));
+  } else if (param.byte_size_ == 0) {
+    // empty lob
+  } else if (param.byte_size_ < 0 || param.byte_size_ > output_data.remain()) {
+    ret = OB_SIZE_OVERFLOW;
+    COMMON_LOG(WARN, "Lob: output buffer not enough.", K(ret), K(param), K(output_data.remain()));
+  } else if (FALSE_IT(param.len_ = param.byte_size_)) {
+  } else if (OB_FAIL(lob_mngr->query(param, iter))) {
+    COMMON_LOG(WARN, "Lob: falied to query lob iter.", K(ret), K(param));
+  } else {
+    ObString piece;
+    while (OB_SUCC(ret)) {
+      if (OB_FAIL(iter->get_next_piece(piece))) {
+        if (ret != OB_ITER_END) {
+          COMMON_LOG(WARN, "Lob: failed to get next piece.", K(ret), K(param));
+        }
+      } else if (output_data.write(piece.ptr(), piece.length()) != piece.length()) {
+        ret = OB_SIZE_OVERFLOW;
+        COMMON_LOG(WARN, "Lob: output buffer not enough.", K(ret), K(piece.length()), K(output_data.remain()));
+      }
+    }
+    if (ret == OB_ITER_END) {
+      ret = OB_SUCCESS;
+    }
+  }
+  if (OB_NOT_NULL(iter)) {
+    iter->reset();
+    OB_DELETE(ObLobQueryIter, "unused", iter);
+  }
+  return ret;
+}
+
 int ObTextStringIter::get_delta_lob_full_data(ObLobLocatorV2& lob_locator, ObIAllocator *allocator, ObString &data_str)
 {
   int ret = OB_SUCCESS;
@@ -296,6 +349,71 @@ int ObTextStringIter::get_delta_lob_full_data(ObLobLocatorV2& lob_locator, ObIAl
   return ret;
 }
 
+// merge on read: full data of the persist lob followed by the appended data
+int ObTextStringIter::get_append_delta_lob_full_data(ObLobLocatorV2& lob_locator, ObIAllocator *allocator, ObString &data_str)
+{
+  int ret = OB_SUCCESS;
+  ObLobAppendDeltaLob delta_lob;
+  storage::ObLobManager* lob_mngr = MTL(storage::ObLobManager*);
+  storage::ObLobAccessParam param;
+  if (OB_ISNULL(lob_mngr)) {
+    ret = OB_ERR_UNEXPECTED;
+    COMMON_LOG(WARN, "Lob: get lob manager failed.", K(ret));
+  } else if (OB_ISNULL(ctx_)) {
+    ret = OB_ERR_UNEXPECTED;
+    COMMON_LOG(WARN, "Lob: iter ctx is null", K(ret), K(lob_locator));
+  } else if (OB_FAIL(delta_lob.deserialize(lob_locator))) {
+    COMMON_LOG(WARN, "deserialize append delta lob fail", K(ret), K(lob_locator));
+  } else if (OB_FALSE_IT(ctx_->locator_ = delta_lob.get_persist_lob())) {
+  } else if (OB_FAIL(init_lob_access_param(param, ctx_, cs_type_, allocator))) {
+    COMMON_LOG(WARN, "init_lob_access_param fail", K(ret));
+  } else if (!param.ls_id_.is_valid() || !param.tablet_id_.is_valid()) {
+    ret = OB_INVALID_ARGUMENT;
+    COMMON_LOG(WARN, "Lob: invalid param.", K(ret), K(param));
+  } else if (param.byte_size_ + delta_lob.get_append_data().length() > OB_MAX_LONGTEXT_LENGTH) {
+    ret = OB_ERR_UNEXPECTED;
+    COMMON_LOG(WARN,"Lob: unable to read full data over 512M lob.", K(ret), K(param), K(delta_lob));
+  } else {
+    param.len_ = param.byte_size_;
+    ctx_->total_byte_len_ = param.byte_size_ + delta_lob.get_append_data().length();
+    ctx_->buff_byte_len_ = static_cast<uint32_t>(ctx_->total_byte_len_);
+    ctx_->buff_ = static_cast<char *>(ctx_->alloc_->alloc(ctx_->buff_byte_len_));
+    ObString output_data;
+    if (OB_ISNULL(ctx_->buff_)) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      COMMON_LOG(WARN,"Lob: failed to alloc output buffer",
+          K(ret), KP(ctx_->buff_), K(ctx_->buff_byte_len_));
+    } else if (OB_FALSE_IT(output_data.assign_buffer(ctx_->buff_, ctx_->buff_byte_len_))) {
+    } else if (param.byte_size_ > 0 && OB_FAIL(lob_mngr->query(param, output_data))) {
+      COMMON_LOG(WARN,"Lob: falied to query lob tablets.", K(ret), K(param));
+    } else if (output_data.write(delta_lob.get_append_data().ptr(), delta_lob.get_append_data().length())
+               != delta_lob.get_append_data().length()) {
+      ret = OB_SIZE_OVERFLOW;
+      COMMON_LOG(WARN, "Lob: output buffer not enough.", K(ret), K(output_data), K(delta_lob));
+    } else {
+      ctx_->content_byte_len_ = output_data.length();
+      data_str = output_data;
+    }
+  }
+  return ret;
+}
+
+// the append delta lob of CONCAT is merged on read once, every entry point of the iter
+// (length, blocks, prefix, full data) then sees the full value as plain text data
+int ObTextStringIter::init_append_delta_lob(ObLobLocatorV2 &locator)
+{
+  int ret = OB_SUCCESS;
+  ObString full_data;
+  if (OB_FAIL(get_append_delta_lob_full_data(locator, tmp_alloc_, full_data))) {
+    COMMON_LOG(WARN, "get_append_delta_lob_full_data fail", K(ret), K(locator));
+  } else {
+    datum_str_ = full_data;
+    has_lob_header_ = false;
+    is_outrow_ = false;
+  }
+  return ret;
+}
+
 int ObTextStringIter::get_outrow_prefix_data(uint32_t prefix_char_len)
 {
   int ret = OB_SUCCESS;
@@ -372,6 +490,7 @@ int ObTextStringIter::get_full_data(ObString &data_str)
   } else if (!is_lob_ || !has_lob_header_) { // string types or 4.0 compatiable text
     data_str.assign_ptr(datum_str_.ptr(), datum_str_.length());
   } else if (loc.is_delta_temp_lob()) {
+    // append delta lob of text is merged in init, only json delta lob comes here
     if (OB_FAIL(get_delta_lob_full_data(loc, tmp_alloc_, data_str))) {
       COMMON_LOG(WARN, "get_delta_lob_full_data fail", K(ret), K(loc));
     }
@@ -947,13 +1066,20 @@ int ObTextStringIter::append_outrow_lob_fulldata(ObObj &obj,
   } else if (obj.is_null() || obj.is_nop_value()) {
   } else {
     bool data_changed = false;
+    bool is_append_delta = false;
     ObLobLocatorV2 loc(obj.get_string(), obj.has_lob_header());
     if (!loc.is_valid()) {
       ret = OB_INVALID_ARGUMENT;
       COMMON_LOG(WARN, "Lob: invalid lob locator", K(ret), K(obj));
     } else if (loc.is_delta_temp_lob()) {
-      ret = OB_INVALID_ARGUMENT;
-      COMMON_LOG(WARN, "Lob: converting delta lob!", K(ret));
+      if (!ob_is_text_tc(type)) {
+        ret = OB_INVALID_ARGUMENT;
+        COMMON_LOG(WARN, "Lob: converting delta lob!", K(ret));
+      } else if (OB_FAIL(convert_append_delta_lob_to_templob(obj, obj, session, allocator))) {
+        COMMON_LOG(WARN, "Lob: convert append delta lob failed", K(ret));
+      } else {
+        is_append_delta = true; // full data is inrow already
+      }
     } else if (loc.has_inrow_data()) {
       int64_t real_loc_len = 0;
       if (OB_FAIL(loc.get_real_locator_len(real_loc_len))) {
@@ -964,7 +1090,7 @@ int ObTextStringIter::append_outrow_lob_fulldata(ObObj &obj,
       }
     }
 
-    if (OB_FAIL(ret)) { // do noting
+    if (OB_FAIL(ret) || is_append_delta) { // do noting
     } else if (loc.is_inrow() && !data_changed) { // do nothing
     } else if (OB_FAIL(loc.get_lob_data_byte_len(lob_data_byte_len))) {
       COMMON_LOG(WARN, "Lob: failed to get lob data byte length", K(ret), K(obj));
@@ -1001,6 +1127,19 @@ int ObTextStringIter::append_outrow_lob_fulldata(ObObj &obj,
         ObTextStringIter instr_iter(obj);
         if (OB_FAIL(instr_iter.init(0, session, &allocator, &tmp_alloc))) {
           COMMON_LOG(WARN, "Lob: init text string iter failed", K(instr_iter));
+        } else if (instr_iter.is_outrow_lob()) {
+          // read pieces into result buffer directly, skip the block buffer of iter
+          ObString output_data;
+          output_data.assign_buffer(buff + pos, static_cast<int32_t>(res_byte_len - pos));
+          if (OB_FAIL(instr_iter.read_outrow_lob_pieces(output_data))) {
+            COMMON_LOG(WARN, "Lob: read outrow lob pieces failed", K(ret), K(instr_iter));
+          } else if (output_data.length() != lob_data_byte_len) {
+            ret = OB_ERR_UNEXPECTED;
+            COMMON_LOG(WARN, "Lob: read size not match", K(ret), K(output_data.length()), K(lob_data_byte_len));
+          } else {
+            obj.set_lob_value(obj.get_type(), buff, static_cast<int32_t>(res_byte_len));
+            obj.set_has_lob_header(); // must has lob header
+          }
         } else {
           while (OB_SUCC(ret)
                 && pos < res_byte_len
@@ -1043,8 +1182,17 @@ int ObTextStringIter::convert_outrow_lob_to_inrow_templob(const ObObj &in_obj,
     } else if ((!loc.is_persist_lob() || allow_persist_inrow) &&
                (loc.is_inrow() || loc.is_simple())) { // do nothing
     } else if (loc.is_delta_temp_lob()) {
-      ret = OB_INVALID_ARGUMENT;
-      COMMON_LOG(WARN, "Lob: converting delta lob!", K(ret));
+      if (!ob_is_text_tc(type)) {
+        ret = OB_INVALID_ARGUMENT;
+        COMMON_LOG(WARN, "Lob: converting delta lob!", K(ret));
+      } else if (OB_ISNULL(allocator)) {
+        ret = OB_INVALID_ARGUMENT;
+        COMMON_LOG(WARN, "Lob: allocator is null", K(ret));
+      } else if (OB_FAIL(convert_append_delta_lob_to_templob(in_obj, out_obj, session, *allocator))) {
+        COMMON_LOG(WARN, "Lob: convert append delta lob failed", K(ret));
+      } else {
+        is_pass_thougth = false;
+      }
     } else if (OB_FAIL(loc.get_lob_data_byte_len(lob_data_byte_len))) {
       COMMON_LOG(WARN, "Lob: failed to get lob data byte length", K(ret), K(in_obj));
     } else if (lob_data_byte_len < 0 || lob_data_byte_len > UINT32_MAX) {
@@ -1097,6 +1245,35 @@ int ObTextStringIter::convert_outrow_lob_to_inrow_templob(const ObObj &in_obj,
   return ret;
 }
 
+// the append delta lob of CONCAT is only understood by storage, other consumers get its full value
+int ObTextStringIter::convert_append_delta_lob_to_templob(const ObObj &in_obj,
+                                                          ObObj &out_obj,
+                                                          const sql::ObBasicSessionInfo *session,
+                                                          ObIAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  const ObObjType type = in_obj.get_type();
+  ObString full_data;
+  ObString res;
+  ObTextStringIter instr_iter(in_obj);
+  ObTextStringResult new_tmp_lob(type, true, &allocator);
+  if (OB_FAIL(instr_iter.init(0, session, &allocator))) {
+    COMMON_LOG(WARN, "Lob: init text string iter failed", K(ret), K(instr_iter));
+  } else if (OB_FAIL(instr_iter.get_full_data(full_data))) {
+    COMMON_LOG(WARN, "Lob: get append delta lob full data failed", K(ret), K(instr_iter));
+  } else if (OB_FAIL(new_tmp_lob.init(full_data.length()))) {
+    COMMON_LOG(WARN, "Lob: init tmp lob failed", K(ret), K(full_data.length()));
+  } else if (OB_FAIL(new_tmp_lob.append(full_data))) {
+    COMMON_LOG(WARN, "Lob: tmp lob append failed", K(ret), K(full_data.length()), K(new_tmp_lob));
+  } else {
+    new_tmp_lob.get_result_buffer(res);
+    out_obj = in_obj; // copy meta
+    out_obj.set_lob_value(type, res.ptr(), res.length());
+    out_obj.set_has_lob_header(); // must has lob header
+  }
+  return ret;
+}
+
 // ----- implementations of ObTextStringResult -----
 
 int ObTextStringResult::calc_buffer_len(int64_t res_len)
@@ -1546,5 +1723,87 @@ int ObDeltaLob::has_diff(const ObLobLocatorV2 &locator, bool &res)
   return ret;
 }
 
+int64_t ObLobAppendDeltaLob::get_lob_diff_serialize_size() const
+{
+  int64_t size = 0;
+  if (get_lob_diff_cnt() > 0) {
+    // append data is stored as an inrow disk lob
+    size += sizeof(ObLobDiff) + sizeof(ObLobCommon) + append_data_.length();
+  }
+  return size;
+}
+
+int ObLobAppendDeltaLob::serialize_partial_data(char* buf, const int64_t buf_len, int64_t& pos) const
+{
+  int ret = OB_SUCCESS;
+  if (pos + persist_lob_.length() > buf_len) {
+    ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("buffer not enough", KR(ret), K(pos), K(buf_len), KPC(this));
+  } else {
+    MEMCPY(buf + pos, persist_lob_.ptr(), persist_lob_.length());
+    pos += persist_lob_.length();
+  }
+  return ret;
+}
+
+int ObLobAppendDeltaLob::serialize_lob_diffs(char* buf, const int64_t buf_len, ObLobDiffHeader *diff_header) const
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(diff_header)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("diff_header is null", KR(ret));
+  } else if (0 == diff_header->diff_cnt_) {
+  } else if (diff_header->get_inline_data_ptr() + sizeof(ObLobCommon) + append_data_.length() > buf + buf_len) {
+    ret = OB_SIZE_OVERFLOW;
+    LOG_WARN("buffer not enough", KR(ret), K(buf_len), KPC(diff_header), KPC(this));
+  } else {
+    char *data_ptr = diff_header->get_inline_data_ptr();
+    ObLobDiff *lob_diff = new (diff_header->get_diff_ptr()) ObLobDiff();
+    lob_diff->type_ = ObLobDiff::DiffType::APPEND;
+    lob_diff->ori_len_ = append_data_.length();
+    lob_diff->offset_ = 0;
+    lob_diff->byte_len_ = sizeof(ObLobCommon) + append_data_.length();
+    ObLobCommon *lob_common = new (data_ptr) ObLobCommon();
+    MEMCPY(lob_common->buffer_, append_data_.ptr(), append_data_.length());
+  }
+  return ret;
+}
+
+int ObLobAppendDeltaLob::deserialize_partial_data(ObLobDiffHeader *diff_header)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(diff_header)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("diff_header is null", KR(ret));
+  } else {
+    persist_lob_.assign_ptr(diff_header->data_, diff_header->persist_loc_size_);
+  }
+  return ret;
+}
+
+int ObLobAppendDeltaLob::deserialize_lob_diffs(char* buf, const int64_t buf_len, ObLobDiffHeader *diff_header)
+{
+  int ret = OB_SUCCESS;
+  append_data_.reset();
+  if (OB_ISNULL(diff_header)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("diff_header is null", KR(ret));
+  } else if (0 == diff_header->diff_cnt_) {
+  } else {
+    ObLobDiff *lob_diff = diff_header->get_diff_ptr();
+    char *data_ptr = diff_header->get_inline_data_ptr() + lob_diff->offset_;
+    if (1 != diff_header->diff_cnt_ || ObLobDiff::DiffType::APPEND != lob_diff->type_) {
+      ret = OB_INVALID_ARGUMENT;
+      LOG_WARN("not append delta lob", KR(ret), KPC(diff_header), KPC(lob_diff));
+    } else if (lob_diff->byte_len_ < sizeof(ObLobCommon) || data_ptr + lob_diff->byte_len_ > buf + buf_len) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("invalid append diff", KR(ret), K(buf_len), KPC(diff_header), KPC(lob_diff));
+    } else {
+      append_data_.assign_ptr(data_ptr + sizeof(ObLobCommon), lob_diff->byte_len_ - sizeof(ObLobCommon));
+    }
+  }
+  return ret;
+}
+
 }
 }
@@ -196,10 +196,17 @@ public:
                                                  ObIAllocator *allocator,
                                                  bool allow_persist_inrow = false,
                                                  bool need_deep_copy = false);
+  static int convert_append_delta_lob_to_templob(const ObObj &in_obj,
+                                                 ObObj &out_obj,
+                                                 const sql::ObBasicSessionInfo *session,
+                                                 ObIAllocator &allocator);
 
 private:
   int get_outrow_lob_full_data(ObIAllocator *allocator = nullptr);
+  int read_outrow_lob_pieces(ObString &output_data);
   int get_delta_lob_full_data(ObLobLocatorV2& lob_locator, ObIAllocator *allocator, ObString &data);
+  int get_append_delta_lob_full_data(ObLobLocatorV2& lob_locator, ObIAllocator *allocator, ObString &data);
+  int init_append_delta_lob(ObLobLocatorV2 &locator);
   int get_first_block(ObString &str);
   int get_next_block_inner(ObString &str);
   int get_outrow_prefix_data(uint32_t prefix_char_len);
@@ -219,7 +226,7 @@ private:
   uint32_t has_lob_header_ : 1;// 4.0 lob compatibility
   uint32_t reserved : 28;
   ObTextStringIterState state_;
-  const ObString datum_str_;
+  ObString datum_str_; // replaced by the merged data of an append delta lob in init
   ObLobTextIterCtx *ctx_;
   int err_ret_;
   ObIAllocator *tmp_alloc_;
@@ -360,6 +367,33 @@ public:
   virtual int deserialize_lob_diffs(char* buf, const int64_t buf_len, storage::ObLobDiffHeader *diff_header) = 0;
 };
 
+// delta lob that appends data to the end of a persist lob, the persist mem locator is kept as
+// partial data, so the delta lob can still be read as full data before it reaches storage.
+class ObLobAppendDeltaLob : public ObDeltaLob {
+public:
+  ObLobAppendDeltaLob() : persist_lob_(), append_data_() {}
+  ObLobAppendDeltaLob(const ObString &persist_lob, const ObString &append_data)
+    : persist_lob_(persist_lob), append_data_(append_data)
+  {}
+
+  int64_t get_partial_data_serialize_size() const { return persist_lob_.length(); }
+  int64_t get_lob_diff_serialize_size() const;
+  uint32_t get_lob_diff_cnt() const { return append_data_.empty() ? 0 : 1; }
+
+  int serialize_partial_data(char* buf, const int64_t buf_len, int64_t& pos) const;
+  int serialize_lob_diffs(char* buf, const int64_t buf_len, storage::ObLobDiffHeader *diff_header) const;
+  int deserialize_partial_data(storage::ObLobDiffHeader *diff_header);
+  int deserialize_lob_diffs(char* buf, const int64_t buf_len, storage::ObLobDiffHeader *diff_header);
+
+  const ObString &get_persist_lob() const { return persist_lob_; }
+  const ObString &get_append_data() const { return append_data_; }
+  TO_STRING_KV(K_(persist_lob), "append_len", append_data_.length());
+
+private:
+  ObString persist_lob_; // mem locator of the persist lob
+  ObString append_data_;
+};
+
 } // end namespace common
 } // end namespace oceanbase
 
@@ -510,6 +510,20 @@ int ObOrderPerservingEncoder::encode_from_string_varlen(
   if ((to_len + 7 * str.length() + safety_buf_size) > max_buf_len) {
     ret = OB_BUF_NOT_ENOUGH;
     LOG_TRACE("no enough memory to do encoding for string", K(ret));
+  } else if (cs == CS_TYPE_UTF8MB4_UNICODE_CI || cs == CS_TYPE_UTF8MB4_0900_AI_CI) {
+    // UCA weights of a character may need more space than reserved, 0 is returned then
+    int64_t res_len = ObCharset::sortkey_var_len(cs, str.ptr(), str.length(), (char *)to,
+                                                 max_buf_len - to_len - safety_buf_size,
+                                                 is_mem, is_valid_uni);
+    if (0 == res_len) {
+      ret = OB_BUF_NOT_ENOUGH;
+      LOG_TRACE("no enough memory to do encoding for string", K(ret));
+    } else if (!is_valid_uni) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_TRACE("too many spaces to encode", K(cs));
+    } else {
+      to_len += res_len;
+    }
   } else if (str.empty() ||  (str.length()==1 && *str.ptr()=='\0')) {
     if (OB_FAIL(encode_tails(to, max_buf_len, to_len, is_mem, cs, str.length()==1 && *str.ptr()=='\0'))) {
       LOG_WARN("failed to encode tails", K(ret));
@@ -562,6 +576,19 @@ int ObOrderPerservingEncoder::encode_from_string_varlen(
   if ((to_len + 7 * str.length() + safty_buf_size) > max_buf_len) {
     ret = OB_BUF_NOT_ENOUGH;
     LOG_TRACE("no enough memory to do encoding for string", K(ret));
+  } else if (cs == CS_TYPE_UTF8MB4_UNICODE_CI || cs == CS_TYPE_UTF8MB4_0900_AI_CI) {
+    // UCA weights of a character may need more space than reserved, 0 is returned then
+    int64_t res_len = ObCharset::sortkey_var_len(cs, str.ptr(), str.length(), (char *)to,
+                                                 max_buf_len - to_len - safty_buf_size,
+                                                 param.is_memcmp_, param.is_valid_uni_);
+    if (0 == res_len) {
+      ret = OB_BUF_NOT_ENOUGH;
+      LOG_TRACE("no enough memory to do encoding for string", K(ret));
+    } else if (!param.is_valid_uni_) {
+      // too many spaces to encode, do nothing
+    } else {
+      to_len += res_len;
+    }
   } else if (str.empty() || (str.length()==1 && *str.ptr()=='\0')) {
     if (OB_FAIL(encode_tails(to, max_buf_len, to_len, param.is_memcmp_, cs, str.length()==1 && *str.ptr()=='\0'))) {
       LOG_WARN("failed to encode tails", K(ret));
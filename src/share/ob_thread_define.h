@@ -52,6 +52,7 @@ TG_DEF(ServerTracerTimer, ServerTracerTimer, TIMER)
 // TG_DEF(RSqlPool, RSqlPool, TIMER)
 TG_DEF(KVCacheWash, KVCacheWash, TIMER)
 TG_DEF(KVCacheRep, KVCacheRep, TIMER)
+TG_DEF(BlockCacheSnapshot, BlkCacheSnap, TIMER)
 TG_DEF(ObHeartbeat, ObHeartbeat, TIMER)
 TG_DEF(PlanCacheEvict, PlanCacheEvict, TIMER)
 TG_DEF(TabletStatRpt, TabletStatRpt, TIMER)
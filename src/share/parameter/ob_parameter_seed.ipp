@@ -300,6 +300,10 @@ DEF_INT(_max_malloc_sample_interval, OB_CLUSTER_PARAMETER, "256", "[1, 10000]",
         "which is not less than _min_malloc_sample_interval. "
         "1 means to sample all malloc, Range: [1, 10000]",
         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_ash_profile_interval, OB_CLUSTER_PARAMETER, "0ms", "[0ms, 1s]",
+         "the cpu time between two samples of the ASH stack profiler, shown in __all_virtual_ash_profile. "
+         "0 means to disable the profiler, Range: [0ms, 1s]",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(_enable_values_table_folding, OB_CLUSTER_PARAMETER, "True",
          "whether enable values statement folds self params",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -510,6 +514,10 @@ DEF_INT(_pushdown_storage_level, OB_TENANT_PARAMETER, "4", "[0, 4]",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_WORK_AREA_POLICY(workarea_size_policy, OB_TENANT_PARAMETER, "AUTO", "policy used to size SQL working areas (MANUAL/AUTO)",
               ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_workarea_redistribution, OB_TENANT_PARAMETER, "False",
+         "specifies whether memory reclaimed from in-memory sort and unused work area memory are "
+         "granted to hash join to avoid dumping when workarea_size_policy is AUTO",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(_temporary_file_io_area_size, OB_TENANT_PARAMETER, "1", "[0, 50)",
          "memory buffer size of temporary file, as a percentage of total tenant memory. "
          "Range: [0, 50), percentage",
@@ -875,6 +883,10 @@ DEF_BOOL(_enable_pkt_nio, OB_CLUSTER_PARAMETER, "True",
          "enable pkt-nio, the new RPC framework"
          "Value:  True:turned on;  False: turned off",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_pnio_write_coalesce_time, OB_CLUSTER_PARAMETER, "0us", "[0us,1ms]",
+         "the maximum time a busy pkt-nio socket waits for more packets before writev, "
+         "0 means write coalescing is disabled. Range: [0us, 1ms]",
+         ObParameterAttr(Section::RPC, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(rpc_memory_limit_percentage, OB_TENANT_PARAMETER, "0", "[0,100]",
          "maximum memory for rpc in a tenant, as a percentage of total tenant memory, "
          "and 0 means no limit to rpc memory",
@@ -940,6 +952,14 @@ DEF_INT(bf_cache_miss_count_threshold, OB_CLUSTER_PARAMETER, "100", "[0,)", "bf
 DEF_INT(fuse_row_cache_priority, OB_CLUSTER_PARAMETER, "1", "[1,)", "fuse row cache priority. Range:[1, )", ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_INT(storage_meta_cache_priority, OB_CLUSTER_PARAMETER, "10", "[1,)", "storage meta cache priority. Range:[1, )",
         ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_TIME(_block_cache_snapshot_interval, OB_CLUSTER_PARAMETER, "10m", "[0s,)",
+         "the interval to persist the hottest micro blocks of the index and data block caches, "
+         "which are loaded back in the background after the observer restarts. 0 means disable. Range: [0s, +∞)",
+         ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_CAP(_block_cache_warm_up_bandwidth, OB_CLUSTER_PARAMETER, "64M", "[0M,)",
+        "the io bandwidth per second used to load the block cache snapshot after the observer restarts. "
+        "0 means not to load. Range: [0M, +∞)",
+        ObParameterAttr(Section::CACHE, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 
 // shared storage local disk cache config
 DEF_INT(_ss_major_compaction_prewarm_level, OB_TENANT_PARAMETER, "0", "[0, 2]",
@@ -1414,8 +1434,12 @@ DEF_BOOL(_bloom_filter_enabled, OB_TENANT_PARAMETER, "True",
 DEF_STR_WITH_CHECKER(use_large_pages, OB_CLUSTER_PARAMETER, "false",
                      common::ObConfigUseLargePagesChecker,
                      "used to manage the database's use of large pages, "
-                     "values: false, true, only",
+                     "values: false, true, only, transparent",
                      ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
+DEF_BOOL(_enable_numa_aware_chunk, OB_CLUSTER_PARAMETER, "False",
+         "bind memory chunks to the numa node of the allocating thread and prefer the cached chunks "
+         "of the same node. Value: True: turn on; False: turn off",
+         ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::STATIC_EFFECTIVE));
 
 DEF_STR(ob_ssl_invited_common_names, OB_TENANT_PARAMETER, "NONE",
         "when server use ssl, use it to control client identity with ssl subject common name. default NONE",
@@ -1906,6 +1930,10 @@ DEF_BOOL(_enable_column_store, OB_TENANT_PARAMETER, "True",
 DEF_BOOL(_enable_skip_index, OB_TENANT_PARAMETER, "True",
         "enable the skip index in storage engine",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_compress_dict, OB_TENANT_PARAMETER, "False",
+        "enable zstd_1.3.8 dictionary compression of the micro blocks in major merge, "
+        "the dictionary is trained from the sampled micro blocks of each sstable",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_STR_WITH_CHECKER(_ob_ddl_temp_file_compress_func, OB_TENANT_PARAMETER, "AUTO",
         common::ObConfigTempStoreFormatChecker,
         "specific compression in ObTempBlockStore."\
@@ -2092,6 +2120,9 @@ DEF_BOOL(_enable_memleak_light_backtrace, OB_CLUSTER_PARAMETER, "True",
 DEF_BOOL(_enable_dbms_lob_partial_update, OB_TENANT_PARAMETER, "False",
          "Enable the capability of dbms_lob to perform partial updates on LOB",
          ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_BOOL(_enable_lob_partial_append, OB_TENANT_PARAMETER, "False",
+         "Enable UPDATE ... SET c = CONCAT(c, ...) on LONGTEXT and LONGBLOB columns to only write the appended data, only takes effect when binlog_row_image is not FULL",
+         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
 DEF_BOOL(_enable_dbms_job_package, OB_CLUSTER_PARAMETER, "True",
          "Control whether can use DBMS_JOB package.",
          ObParameterAttr(Section::OBSERVER, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -2164,3 +2195,8 @@ DEF_INT(ob_vector_memory_limit_percentage, OB_TENANT_PARAMETER, "0",
         "[0,100)",
         "Used to control the upper limit percentage of memory resources that the vector_index module can use. Range:[0, 100)",
         ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
+DEF_INT(_vector_index_brute_force_threshold, OB_TENANT_PARAMETER, "4096",
+        "[0,)",
+        "the max number of rows passing the filters of a vector index query that are ranked by exact distances "
+        "instead of searching the vector index. 0 means always search the vector index. Range:[0, +∞)",
+        ObParameterAttr(Section::TENANT, Source::DEFAULT, EditLevel::DYNAMIC_EFFECTIVE));
@@ -2159,6 +2159,14 @@ int ObTableSqlService::update_table_options(ObISQLClient &sql_client,
     }
   }
 
+  if (OB_SUCC(ret)
+      && table_schema.get_compressor_type() != new_table_schema.get_compressor_type()
+      && new_table_schema.is_column_store_supported()) {
+    if (OB_FAIL(update_column_group_compressor(sql_client, table_schema, new_table_schema))) {
+      LOG_WARN("failed to update column group compressor", K(ret), K(new_table_schema));
+    }
+  }
+
   if (OB_SUCC(ret)) {
     if ((OB_DDL_DROP_TABLE_TO_RECYCLEBIN == operation_type)
         || (OB_DDL_TRUNCATE_DROP_TABLE_TO_RECYCLEBIN == operation_type)) {
@@ -5961,7 +5969,8 @@ int ObTableSqlService::update_single_column_group(ObISQLClient &sql_client,
       LOG_WARN("fail to gen column group dml", K(ret));
     } else if (OB_FAIL(exec.exec_update(OB_ALL_COLUMN_GROUP_TNAME, dml, affect_rows))) {
       LOG_WARN("fail to update all column group", K(ret));
-    } else if (affect_rows != (ori_cg_schema.get_column_group_name() != new_cg_schema.get_column_group_name())) {
+    } else if (affect_rows != (ori_cg_schema.get_column_group_name() != new_cg_schema.get_column_group_name()
+                               || ori_cg_schema.get_compressor_type() != new_cg_schema.get_compressor_type())) {
       /* for some ddl don't change propertype, affect rows should be 0, since all_column_group has no schema version*/
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("fail to update single row in all column group ", K(ret), K(affect_rows), K(ori_cg_schema), K(new_cg_schema));
@@ -5984,6 +5993,35 @@ int ObTableSqlService::update_single_column_group(ObISQLClient &sql_client,
   return ret;
 }
 
+// the column groups use the compressor of the table unless they have their own one,
+// so they follow the table when its compressor is altered
+int ObTableSqlService::update_column_group_compressor(ObISQLClient &sql_client,
+                                                      const ObTableSchema &table_schema,
+                                                      ObTableSchema &new_table_schema)
+{
+  int ret = OB_SUCCESS;
+  ObTableSchema::const_column_group_iterator iter = new_table_schema.column_group_begin();
+  for (; OB_SUCC(ret) && iter != new_table_schema.column_group_end(); ++iter) {
+    ObColumnGroupSchema *cg_schema = *iter;
+    ObColumnGroupSchema ori_cg_schema;
+    if (OB_ISNULL(cg_schema)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("column group should not be null", K(ret), K(new_table_schema));
+    } else if (cg_schema->get_compressor_type() != table_schema.get_compressor_type()) {
+      // the column group has its own compressor
+    } else if (OB_FAIL(ori_cg_schema.assign(*cg_schema))) {
+      LOG_WARN("fail to assign column group", K(ret), KPC(cg_schema));
+    } else {
+      cg_schema->set_compressor_type(new_table_schema.get_compressor_type());
+      cg_schema->set_schema_version(new_table_schema.get_schema_version());
+      if (OB_FAIL(update_single_column_group(sql_client, new_table_schema, ori_cg_schema, *cg_schema))) {
+        LOG_WARN("fail to update single column group", K(ret), K(ori_cg_schema), KPC(cg_schema));
+      }
+    }
+  }
+  return ret;
+}
+
 // Three scenes :
 // 1. drop fk parent table
 // 2. create child table with a fk references a mock fk parent table not exist
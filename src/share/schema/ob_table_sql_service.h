@@ -423,6 +423,9 @@ public:
                                  const ObTableSchema &new_table_schema,
                                  const ObColumnGroupSchema &ori_cg_schema,
                                  const ObColumnGroupSchema &new_cg_schema);
+  int update_column_group_compressor(ObISQLClient &sql_client,
+                                     const ObTableSchema &table_schema,
+                                     ObTableSchema &new_table_schema);
 private:
   int log_operation_wrapper(
       ObSchemaOperation &opt,
@@ -22,7 +22,9 @@
 #include "share/vector_index/ob_vector_index_util.h"
 #include "sql/das/ob_das_dml_vec_iter.h"
 #include "lib/vector/ob_vector_util.h"
+#include "lib/vector/ob_vector_ivf_index.h"
 #include "lib/random/ob_random.h"
+#include "observer/omt/ob_tenant_config_mgr.h"
 
 namespace oceanbase
 {
@@ -80,7 +82,11 @@ OB_DEF_SERIALIZE_SIZE(ObVectorIndexHNSWParam)
               dim_,
               m_,
               ef_construction_,
-              ef_search_);
+              ef_search_,
+              nlist_,
+              nprobe_,
+              pq_m_,
+              refine_k_);
   return len;
 }
 
@@ -94,7 +100,11 @@ OB_DEF_SERIALIZE(ObVectorIndexHNSWParam)
               dim_,
               m_,
               ef_construction_,
-              ef_search_);
+              ef_search_,
+              nlist_,
+              nprobe_,
+              pq_m_,
+              refine_k_);
   return ret;
 }
 
@@ -115,7 +125,11 @@ OB_DEF_DESERIALIZE(ObVectorIndexHNSWParam)
               dim_,
               m_,
               ef_construction_,
-              ef_search_);
+              ef_search_,
+              nlist_,
+              nprobe_,
+              pq_m_,
+              refine_k_);
   return ret;
 }
 
@@ -213,7 +227,13 @@ static void free_memdata_resource(ObVectorIndexRecordType type,
     }
   }
   if (OB_NOT_NULL(memdata->index_)) {
-    obvectorutil::delete_index(memdata->index_);
+    if (is_ivf_index_type(memdata->index_type_)) {
+      ObVectorIvfIndex *ivf_index = static_cast<ObVectorIvfIndex *>(memdata->index_);
+      ivf_index->~ObVectorIvfIndex();
+      memdata->mem_ctx_->Deallocate(ivf_index);
+    } else {
+      obvectorutil::delete_index(memdata->index_);
+    }
     LOG_INFO("delete vector index", K(type), KP(memdata->index_), K(lbt())); // remove later
     memdata->index_ = nullptr;
   }
@@ -244,6 +264,43 @@ static int try_free_memdata_resource(ObVectorIndexRecordType type,
   return ret;
 }
 
+// the ivf index is allocated from the vsag mem ctx of the memdata, so it is charged like the hnsw index
+static int create_ivf_index(const ObVectorIndexHNSWParam &param, ObVectorIndexMemData &memdata)
+{
+  int ret = OB_SUCCESS;
+  void *buf = nullptr;
+  ObVectorIvfIndex *ivf_index = nullptr;
+  const ObVectorIvfMetric metric = VIDA_IP == param.dist_algorithm_ ? VIVM_IP : VIVM_L2;
+  const ObVectorQuantizerType quantizer = VIAT_IVF_FLAT == param.type_ ? VQT_FLAT
+                                          : (VIAT_IVF_SQ8 == param.type_ ? VQT_SQ8 : VQT_PQ);
+  int64_t pq_m = param.pq_m_;
+  if (VQT_PQ == quantizer && 0 == pq_m) {
+    // 4 dimensions per sub space at least, the dim must be divisible by pq_m
+    pq_m = std::max(param.dim_ / 4, 1L);
+    while (pq_m > 1 && param.dim_ % pq_m != 0) {
+      --pq_m;
+    }
+  }
+  if (VIDA_L2 != param.dist_algorithm_ && VIDA_IP != param.dist_algorithm_) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("ivf index distance algorithm not support", K(ret), K(param));
+  } else if (OB_ISNULL(buf = memdata.mem_ctx_->Allocate(sizeof(ObVectorIvfIndex)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc ivf index", K(ret));
+  } else if (FALSE_IT(ivf_index = new(buf) ObVectorIvfIndex(memdata.mem_ctx_))) {
+  } else if (OB_FAIL(ivf_index->init(param.dim_, metric, quantizer, param.nlist_, pq_m))) {
+    LOG_WARN("failed to init ivf index", K(ret), K(param), K(pq_m));
+  } else {
+    memdata.index_ = ivf_index;
+    memdata.index_type_ = param.type_;
+  }
+  if (OB_FAIL(ret) && OB_NOT_NULL(ivf_index)) {
+    ivf_index->~ObVectorIvfIndex();
+    memdata.mem_ctx_->Deallocate(ivf_index);
+  }
+  return ret;
+}
+
 ObPluginVectorIndexAdaptor::ObPluginVectorIndexAdaptor(common::ObIAllocator *allocator, lib::MemoryContext &entity)
   : create_type_(CreateTypeMax), type_(VIAT_MAX),
     algo_data_(nullptr), incr_data_(nullptr), snap_data_(nullptr), vbitmap_data_(nullptr),
@@ -429,7 +486,10 @@ int ObPluginVectorIndexAdaptor::param_deserialize(char *ptr, int32_t length,
   } else {
     type = header.type_;
     switch(type) {
-      case VIAT_HNSW: {
+      case VIAT_HNSW:
+      case VIAT_IVF_FLAT:
+      case VIAT_IVF_SQ8:
+      case VIAT_IVF_PQ: {
         int64_t param_pos = 0;
         ObVectorIndexHNSWParam *hnsw_param = nullptr;
         if (OB_ISNULL(hnsw_param = static_cast<ObVectorIndexHNSWParam *>
@@ -466,7 +526,7 @@ int ObPluginVectorIndexAdaptor::get_dim(int64_t &dim)
 {
   INIT_SUCC(ret);
   // TODO [WORKDOC] work document NO.1
-  if (type_ == VIAT_HNSW) {
+  if (type_ >= VIAT_HNSW && type_ < VIAT_MAX) {
     ObVectorIndexHNSWParam *param = nullptr;
     if (OB_ISNULL(param = static_cast<ObVectorIndexHNSWParam*>(algo_data_))) {
       ret = OB_ERR_UNEXPECTED;
@@ -484,7 +544,8 @@ int ObPluginVectorIndexAdaptor::get_dim(int64_t &dim)
 int ObPluginVectorIndexAdaptor::get_hnsw_param(ObVectorIndexHNSWParam *&param)
 {
   INIT_SUCC(ret);
-  if (type_ == VIAT_HNSW) {
+  // the ivf types share the param
+  if (type_ >= VIAT_HNSW && type_ < VIAT_MAX) {
     if (OB_ISNULL(param = static_cast<ObVectorIndexHNSWParam*>(algo_data_))) {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("failed to get param.", K(ret));
@@ -552,6 +613,14 @@ int ObPluginVectorIndexAdaptor::fill_vector_index_info(ObVectorIndexInfo &info)
              info.statistics_, sizeof(info.statistics_), pos,
              "snap_data.scn=%lu;", snap_data_->scn_.get_val_for_inner_table_field()))) {
     LOG_WARN("failed to fill statistic", K(ret), K(this));
+  } else if (is_mem_data_init_atomic(VIRT_SNAP) && is_ivf_index_type(snap_data_->index_type_)) {
+    TCRLockGuard lock_guard(snap_data_->mem_data_rwlock_);
+    const ObVectorIvfIndex *ivf_index = static_cast<const ObVectorIvfIndex *>(snap_data_->index_);
+    if (OB_FAIL(databuff_printf(info.statistics_, sizeof(info.statistics_), pos,
+                "snap_data.ivf_cnt=%ld;snap_data.ivf_trained=%d;snap_data.ivf_mem=%ld;",
+                ivf_index->get_count(), ivf_index->is_trained(), ivf_index->get_memory_usage()))) {
+      LOG_WARN("failed to fill statistic", K(ret), K(this));
+    }
   }
   pos = 0;
   if (OB_FAIL(ret)) {
@@ -643,6 +712,13 @@ int ObPluginVectorIndexAdaptor::init_mem_data(ObVectorIndexRecordType type)
     if (!snap_data_->is_inited()) {
       if (OB_FAIL(snap_data_->mem_ctx_->init(parent_mem_ctx_, all_vsag_use_mem_))) {
         LOG_WARN("failed to init incr data mem ctx.", K(ret));
+      } else if (is_ivf_index_type(param->type_)) {
+        if (OB_FAIL(create_ivf_index(*param, *snap_data_))) {
+          LOG_WARN("failed to create ivf index.", K(ret), KPC(param));
+        } else {
+          snap_data_->set_inited();
+          LOG_INFO("create ivf snap data success.", K(ret), KP(snap_data_->index_), KPC(param));
+        }
       } else if (OB_FAIL(obvectorutil::create_index(snap_data_->index_,
                                                     obvectorlib::HNSW_TYPE,
                                                     DATATYPE_FLOAT32,
@@ -867,7 +943,11 @@ int ObPluginVectorIndexAdaptor::add_snap_index(float *vectors, int64_t *vids, in
     LOG_WARN("get invalid data.", K(ret));
   } else {
     TCWLockGuard lock_guard(snap_data_->mem_data_rwlock_);
-    if (OB_FAIL(obvectorutil::add_index(snap_data_->index_, vectors, vids, dim, num))) {
+    if (is_ivf_index_type(snap_data_->index_type_)) {
+      if (OB_FAIL(static_cast<ObVectorIvfIndex *>(snap_data_->index_)->add(vectors, vids, dim, num))) {
+        LOG_WARN("failed to add ivf index.", K(ret), K(dim), K(num));
+      }
+    } else if (OB_FAIL(obvectorutil::add_index(snap_data_->index_, vectors, vids, dim, num))) {
       ret = OB_ERR_VSAG_RETURN_ERROR;
       LOG_WARN("failed to build index.", K(ret), K(dim), K(num));
     }
@@ -1333,12 +1413,23 @@ int ObPluginVectorIndexAdaptor::serialize(ObIAllocator *allocator, ObOStreamBuf:
   if (!snap_data_->is_inited()) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("snap index is not init", K(ret));
-  } else if (OB_FAIL(obvectorutil::get_index_number(snap_data_->index_, snap_index_size))) {
-    ret = OB_ERR_VSAG_RETURN_ERROR;
+  } else if (OB_FAIL(get_snap_index_number(snap_index_size))) {
     LOG_WARN("failed to get snap index number.", K(ret));
   } else if (snap_index_size == 0) {
     // do nothing
     LOG_INFO("[vec index] empty snap index, do not need to serialize");
+  } else if (is_ivf_index_type(snap_data_->index_type_)) {
+    // all the rows of the snapshot are added, train the centroids and the quantizer on them
+    TCWLockGuard lock_guard(snap_data_->mem_data_rwlock_);
+    ObVectorIvfIndex *ivf_index = static_cast<ObVectorIvfIndex *>(snap_data_->index_);
+    if (OB_FAIL(ivf_index->train())) {
+      LOG_WARN("failed to train ivf index.", K(ret), KPC(ivf_index));
+    } else if (OB_FAIL(index_seri.serialize(*ivf_index, cb_param, cb))) {
+      LOG_WARN("serialize ivf index failed.", K(ret));
+    } else {
+      snap_data_->rb_flag_ = true;
+      LOG_INFO("[vec index] serialize ivf snap index", KPC(ivf_index), K(ivf_index->get_memory_usage()));
+    }
   } else if (OB_FAIL(index_seri.serialize(snap_data_->index_, cb_param, cb))) {
     LOG_WARN("serialize index failed.", K(ret));
   } else {
@@ -1347,6 +1438,40 @@ int ObPluginVectorIndexAdaptor::serialize(ObIAllocator *allocator, ObOStreamBuf:
   return ret;
 }
 
+int ObPluginVectorIndexAdaptor::deserialize_snap_index(ObVectorIndexSerializer &index_seri,
+                                                       ObIStreamBuf::CbParam &cb_param,
+                                                       ObIStreamBuf::Callback &cb)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(snap_data_) || !snap_data_->is_inited()) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("snap index is not init", K(ret), KP(snap_data_));
+  } else if (is_ivf_index_type(snap_data_->index_type_)) {
+    TCWLockGuard lock_guard(snap_data_->mem_data_rwlock_);
+    if (OB_FAIL(index_seri.deserialize(*static_cast<ObVectorIvfIndex *>(snap_data_->index_), cb_param, cb))) {
+      LOG_WARN("deserialize ivf index failed.", K(ret));
+    }
+  } else if (OB_FAIL(index_seri.deserialize(snap_data_->index_, cb_param, cb))) {
+    LOG_WARN("deserialize index failed.", K(ret));
+  }
+  return ret;
+}
+
+int ObPluginVectorIndexAdaptor::get_snap_index_number(int64_t &count)
+{
+  int ret = OB_SUCCESS;
+  count = 0;
+  if (OB_ISNULL(get_snap_index())) {
+    // do nothing
+  } else if (is_ivf_index_type(snap_data_->index_type_)) {
+    count = static_cast<const ObVectorIvfIndex *>(snap_data_->index_)->get_count();
+  } else if (OB_FAIL(obvectorutil::get_index_number(snap_data_->index_, count))) {
+    ret = OB_ERR_VSAG_RETURN_ERROR;
+    LOG_WARN("failed to get snap index number.", K(ret));
+  }
+  return ret;
+}
+
 int ObPluginVectorIndexAdaptor::generate_snapshot_valid_bitmap(ObVectorQueryAdaptorResultContext *ctx,
                                                                common::ObNewRowIterator *row_iter,
                                                                SCN query_scn)
@@ -1410,6 +1535,7 @@ int ObPluginVectorIndexAdaptor::vsag_query_vids(ObVectorQueryAdaptorResultContex
   INIT_SUCC(ret);
   roaring::api::roaring64_bitmap_t *ibitmap = nullptr;
   roaring::api::roaring64_bitmap_t *dbitmap = nullptr;
+  roaring::api::roaring64_bitmap_t *filter_skip_bitmap = nullptr;
 
   int64_t *merge_vids = nullptr;
   const int64_t *delta_vids = nullptr;
@@ -1418,11 +1544,17 @@ int ObPluginVectorIndexAdaptor::vsag_query_vids(ObVectorQueryAdaptorResultContex
   const float *snap_distances = nullptr;
   int64_t delta_res_cnt = 0;
   int64_t snap_res_cnt = 0;
+  bool is_ivf_snap = false;
+  bool need_refine = false;
+  ObVectorIndexHNSWParam *param = nullptr;
 
   if (OB_FAIL(check_vsag_mem_used())) {
     LOG_WARN("failed to check vsag mem used.", K(ret));
   } else if (OB_FAIL(merge_and_generate_bitmap(ctx, ibitmap, dbitmap))) {
     LOG_WARN("failed to merge and generate bitmap.", K(ret));
+  } else if (OB_NOT_NULL(query_cond->filter_bitmap_)
+             && OB_FAIL(merge_filter_bitmap(ctx, query_cond, ibitmap, dbitmap, filter_skip_bitmap))) {
+    LOG_WARN("failed to merge filter bitmap.", K(ret));
   }
 
   if (OB_SUCC(ret)) {
@@ -1441,7 +1573,20 @@ int ObPluginVectorIndexAdaptor::vsag_query_vids(ObVectorQueryAdaptorResultContex
       LOG_WARN("knn search delta failed.", K(ret), K(dim));
     }
   }
-  if (OB_SUCC(ret)) {
+  if (OB_SUCC(ret) && is_mem_data_init_atomic(VIRT_SNAP) && is_ivf_index_type(snap_data_->index_type_)) {
+    TCRLockGuard lock_guard(snap_data_->mem_data_rwlock_);
+    is_ivf_snap = true;
+    need_refine = is_quantized_index_type(snap_data_->index_type_);
+    if (OB_FAIL(get_hnsw_param(param))) {
+      LOG_WARN("get hnsw param failed.", K(ret));
+    } else if (OB_FAIL(ivf_query_snap(ctx,
+                                      need_refine ? query_cond->query_limit_ * std::max(param->refine_k_, 1L)
+                                                  : query_cond->query_limit_,
+                                      dim, query_vector, dbitmap,
+                                      snap_distances, snap_vids, snap_res_cnt))) {
+      LOG_WARN("ivf search snap failed.", K(ret), K(dim));
+    }
+  } else if (OB_SUCC(ret)) {
     TCRLockGuard lock_guard(snap_data_->mem_data_rwlock_);
     if (OB_FAIL(is_mem_data_init_atomic(VIRT_SNAP) &&
                 obvectorutil::knn_search(get_snap_index(),
@@ -1463,22 +1608,32 @@ int ObPluginVectorIndexAdaptor::vsag_query_vids(ObVectorQueryAdaptorResultContex
     const ObVsagQueryResult delta_data = {delta_res_cnt, delta_vids, delta_distances};
     const ObVsagQueryResult snap_data = {snap_res_cnt, snap_vids, snap_distances};
     uint64_t tmp_result_cnt = delta_res_cnt + snap_res_cnt;
-    uint64_t max_res_cnt = tmp_result_cnt < query_cond->query_limit_ ? tmp_result_cnt : query_cond->query_limit_;
+    // the quantized distances of snap are not comparable with the exact ones, all the candidates are re-ranked
+    uint64_t merge_limit = need_refine ? tmp_result_cnt : query_cond->query_limit_;
+    uint64_t max_res_cnt = tmp_result_cnt < merge_limit ? tmp_result_cnt : merge_limit;
+    // can't use tmp allocator for the final result of query, the refine candidates are only used by refine_result
+    ObIAllocator *merge_allocator = need_refine ? ctx->tmp_allocator_ : ctx->allocator_;
 
     if (max_res_cnt == 0) {
       // when max_res_cnt == 0, it means (snap_res_cnt == 0 && delta_res_cnt == 0), there is no data in table, do not need alloc memory for res_vid_array
       actual_res_cnt = 0;
-    } else if (OB_ISNULL(merge_vids = static_cast<int64_t*>(ctx->allocator_->alloc /*can't use tmp allocator here, its final result of query*/
+    } else if (OB_ISNULL(merge_vids = static_cast<int64_t*>(merge_allocator->alloc
                                   (sizeof(int64_t) * max_res_cnt)))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
       LOG_WARN("failed to allocator merge vids.", K(ret));
     } else if (OB_FAIL(ObPluginVectorIndexHelper::merge_delta_and_snap_vids(delta_data, snap_data,
-                                                                            query_cond->query_limit_,
+                                                                            merge_limit,
                                                                             actual_res_cnt, merge_vids))) {
       LOG_WARN("failed to merge delta and snap vids.", K(ret));
+    } else if (OB_NOT_NULL(query_cond->filter_bitmap_)) {
+      remove_filtered_vids(query_cond, actual_res_cnt, merge_vids);
     }
 
     if (OB_FAIL(ret)) {
+    } else if (need_refine && actual_res_cnt > 0) {
+      if (OB_FAIL(set_refine_candidates(ctx, dim, actual_res_cnt, merge_vids))) {
+        LOG_WARN("failed to set refine candidates.", K(ret), K(actual_res_cnt));
+      }
     } else if (OB_FAIL(vids_iter->init(actual_res_cnt, merge_vids, ctx->allocator_))) {
       LOG_WARN("iter init failed.", K(ret), K(actual_res_cnt), K(merge_vids), K(ctx->allocator_));
     }
@@ -1489,6 +1644,11 @@ int ObPluginVectorIndexAdaptor::vsag_query_vids(ObVectorQueryAdaptorResultContex
     ibitmap = nullptr;
   }
 
+  if (OB_NOT_NULL(filter_skip_bitmap)) {
+    roaring64_bitmap_free(filter_skip_bitmap);
+    filter_skip_bitmap = nullptr;
+  }
+
   if (delta_res_cnt != 0) {
     if (delta_distances != nullptr) {
       incr_data_->mem_ctx_->Deallocate((void *)delta_distances);
@@ -1501,7 +1661,7 @@ int ObPluginVectorIndexAdaptor::vsag_query_vids(ObVectorQueryAdaptorResultContex
     }
   }
 
-  if (snap_res_cnt != 0) {
+  if (snap_res_cnt != 0 && !is_ivf_snap) { // the ivf results are allocated from ctx tmp allocator
     if (snap_distances != nullptr) {
       snap_data_->mem_ctx_->Deallocate((void *)snap_distances);
       snap_distances = nullptr;
@@ -1515,6 +1675,223 @@ int ObPluginVectorIndexAdaptor::vsag_query_vids(ObVectorQueryAdaptorResultContex
   return ret;
 }
 
+int ObPluginVectorIndexAdaptor::ivf_query_snap(ObVectorQueryAdaptorResultContext *ctx,
+                                               const int64_t topk, const int64_t dim, float *query_vector,
+                                               roaring::api::roaring64_bitmap_t *dbitmap,
+                                               const float *&distances, const int64_t *&vids, int64_t &res_cnt)
+{
+  INIT_SUCC(ret);
+  ObVectorIndexHNSWParam *param = nullptr;
+  float *distance_buf = nullptr;
+  int64_t *vid_buf = nullptr;
+  res_cnt = 0;
+  if (OB_FAIL(get_hnsw_param(param))) {
+    LOG_WARN("get hnsw param failed.", K(ret));
+  } else if (OB_ISNULL(distance_buf = static_cast<float *>(ctx->tmp_allocator_->alloc(sizeof(float) * topk)))
+             || OB_ISNULL(vid_buf = static_cast<int64_t *>(ctx->tmp_allocator_->alloc(sizeof(int64_t) * topk)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc ivf result.", K(ret), K(topk));
+  } else if (OB_FAIL(static_cast<const ObVectorIvfIndex *>(snap_data_->index_)->search(
+             query_vector, dim, topk, param->nprobe_, dbitmap, distance_buf, vid_buf, res_cnt))) {
+    LOG_WARN("failed to search ivf index.", K(ret), K(dim), K(topk), KPC(param));
+  } else {
+    distances = distance_buf;
+    vids = vid_buf;
+  }
+  return ret;
+}
+
+int ObPluginVectorIndexAdaptor::set_refine_candidates(ObVectorQueryAdaptorResultContext *ctx, const int64_t dim,
+                                                      const int64_t cnt, const int64_t *vids)
+{
+  INIT_SUCC(ret);
+  ObObj *vid_objs = nullptr;
+  if (OB_ISNULL(vid_objs = static_cast<ObObj *>(ctx->tmp_allocator_->alloc(sizeof(ObObj) * cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to allocator.", K(ret), K(cnt));
+  } else if (OB_ISNULL(ctx->vec_data_.vectors_ = static_cast<ObObj *>(ctx->tmp_allocator_->alloc(sizeof(ObObj) * cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to allocator.", K(ret), K(cnt));
+  } else {
+    for (int64_t i = 0; i < cnt; i++) {
+      vid_objs[i].reset();
+      vid_objs[i].set_int(vids[i]);
+      ctx->vec_data_.vectors_[i].reset();
+    }
+    ctx->vec_data_.dim_ = dim;
+    ctx->vec_data_.count_ = cnt;
+    ctx->vec_data_.vids_ = vid_objs;
+    ctx->status_ = PVQ_REFINE;
+  }
+  return ret;
+}
+
+bool ObPluginVectorIndexAdaptor::need_brute_force(const ObVectorQueryConditions *query_cond) const
+{
+  bool bret = false;
+  if (OB_NOT_NULL(query_cond->filter_bitmap_)) {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    const uint64_t filter_cnt = roaring64_bitmap_get_cardinality(query_cond->filter_bitmap_);
+    const int64_t threshold = tenant_config.is_valid() ? tenant_config->_vector_index_brute_force_threshold : 0;
+    bret = filter_cnt <= static_cast<uint64_t>(threshold);
+  }
+  return bret;
+}
+
+int ObPluginVectorIndexAdaptor::brute_force_query_vids(ObVectorQueryAdaptorResultContext *ctx,
+                                                       ObVectorQueryConditions *query_cond,
+                                                       int64_t dim,
+                                                       ObVectorQueryVidIterator *&vids_iter)
+{
+  INIT_SUCC(ret);
+  const uint64_t filter_cnt = roaring64_bitmap_get_cardinality(query_cond->filter_bitmap_);
+  uint64_t *filter_vids = nullptr;
+  if (filter_cnt == 0) {
+    // no row passes the filters
+    if (OB_FAIL(vids_iter->init(0, nullptr, ctx->allocator_))) {
+      LOG_WARN("iter init failed.", K(ret));
+    }
+  } else if (OB_ISNULL(filter_vids = static_cast<uint64_t *>(ctx->tmp_allocator_->alloc(sizeof(uint64_t) * filter_cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc filter vids.", K(ret), K(filter_cnt));
+  } else if (FALSE_IT(roaring64_bitmap_to_uint64_array(query_cond->filter_bitmap_, filter_vids))) {
+  } else if (OB_FAIL(set_refine_candidates(ctx, dim, filter_cnt, reinterpret_cast<const int64_t *>(filter_vids)))) {
+    // all the rows passing the filters are ranked by exact distances in refine_result
+    LOG_WARN("failed to set refine candidates.", K(ret), K(filter_cnt));
+  } else {
+    LOG_TRACE("[vec index] brute force query", K(filter_cnt), K(query_cond->query_limit_));
+  }
+  return ret;
+}
+
+int ObPluginVectorIndexAdaptor::merge_filter_bitmap(ObVectorQueryAdaptorResultContext *ctx,
+                                                    ObVectorQueryConditions *query_cond,
+                                                    roaring::api::roaring64_bitmap_t *ibitmap,
+                                                    roaring::api::roaring64_bitmap_t *&dbitmap,
+                                                    roaring::api::roaring64_bitmap_t *&filter_skip_bitmap)
+{
+  INIT_SUCC(ret);
+  uint64_t skip_max = 0;
+  // the vids failing the filters are skipped while searching the indexes, instead of being
+  // dropped from the top k results afterwards. vids inserted after the filter scan are above
+  // filter_max_vid_, the complement covers them up to the max vid known to the indexes
+  if (OB_ISNULL(ctx) || OB_ISNULL(ctx->bitmaps_) || OB_ISNULL(ibitmap) || OB_ISNULL(dbitmap)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get invalid bitmap.", K(ret), KP(ctx), KP(ibitmap), KP(dbitmap));
+  } else if (FALSE_IT(skip_max = MAX(query_cond->filter_max_vid_,
+                                     MAX(roaring64_bitmap_maximum(ctx->bitmaps_->insert_bitmap_),
+                                         roaring64_bitmap_maximum(dbitmap))))) {
+  } else if (OB_ISNULL(filter_skip_bitmap = roaring64_bitmap_flip_closed(query_cond->filter_bitmap_,
+                                                                         0, skip_max))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to create filter skip bitmap.", K(ret), K(query_cond->filter_max_vid_), K(skip_max));
+  } else {
+    roaring64_bitmap_or_inplace(ibitmap, filter_skip_bitmap);
+    roaring64_bitmap_or_inplace(filter_skip_bitmap, dbitmap);
+    dbitmap = filter_skip_bitmap;
+  }
+  return ret;
+}
+
+void ObPluginVectorIndexAdaptor::remove_filtered_vids(const ObVectorQueryConditions *query_cond,
+                                                     int64_t &res_cnt,
+                                                     int64_t *vids)
+{
+  // the snapshot index may hold vids above every bitmap, keep only the ones passing the filters
+  int64_t pass_cnt = 0;
+  for (int64_t i = 0; i < res_cnt; ++i) {
+    if (roaring64_bitmap_contains(query_cond->filter_bitmap_, static_cast<uint64_t>(vids[i]))) {
+      vids[pass_cnt++] = vids[i];
+    }
+  }
+  res_cnt = pass_cnt;
+}
+
+int ObPluginVectorIndexAdaptor::refine_result(ObVectorQueryAdaptorResultContext *ctx,
+                                              ObVectorQueryConditions *query_cond,
+                                              ObVectorQueryVidIterator *&vids_iter)
+{
+  INIT_SUCC(ret);
+  struct RefineItem
+  {
+    bool operator<(const RefineItem &other) const { return dist_ < other.dist_; }
+    float dist_;
+    int64_t vid_;
+  };
+  int64_t dim = 0;
+  int64_t item_cnt = 0;
+  int64_t res_cnt = 0;
+  float *query_vector = nullptr;
+  RefineItem *items = nullptr;
+  int64_t *res_vids = nullptr;
+  void *iter_buff = nullptr;
+  ObVectorIndexHNSWParam *param = nullptr;
+
+  if (OB_ISNULL(ctx) || OB_ISNULL(query_cond)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get ctx invalid.", K(ret));
+  } else if (ctx->status_ != PVQ_REFINE || OB_ISNULL(ctx->vec_data_.vids_) || OB_ISNULL(ctx->vec_data_.vectors_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get invalid refine ctx.", K(ret), K(ctx->status_));
+  } else if (OB_FAIL(get_hnsw_param(param))) {
+    LOG_WARN("get hnsw param failed.", K(ret));
+  } else if (FALSE_IT(dim = param->dim_)) {
+  } else if (query_cond->query_vector_.length() / sizeof(float) != dim) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get vector objct unexpect.", K(ret), K(query_cond->query_vector_.length()), K(dim));
+  } else if (OB_ISNULL(query_vector = reinterpret_cast<float *>(query_cond->query_vector_.ptr()))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("failed to cast vectors.", K(ret), K(query_cond->query_vector_));
+  } else if (OB_ISNULL(items = static_cast<RefineItem *>(ctx->tmp_allocator_->alloc(sizeof(RefineItem) * ctx->get_count())))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to alloc refine items.", K(ret), K(ctx->get_count()));
+  } else {
+    const ObVectorIvfMetric metric = VIDA_IP == param->dist_algorithm_ ? VIVM_IP : VIVM_L2;
+    for (int64_t i = 0; OB_SUCC(ret) && i < ctx->get_count(); i++) {
+      const ObObj &vector = ctx->vec_data_.vectors_[i];
+      if (vector.is_null() || vector.get_string().empty()) {
+        // the row is deleted after the snapshot
+      } else if (vector.get_string().length() != dim * sizeof(float)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("get invalid string.", K(ret), K(vector), K(dim));
+      } else {
+        items[item_cnt].dist_ = ObVectorIvfIndex::calc_distance(
+            metric, query_vector, reinterpret_cast<const float *>(vector.get_string().ptr()), dim);
+        items[item_cnt].vid_ = ctx->vec_data_.vids_[i].get_int();
+        item_cnt++;
+      }
+    }
+    if (OB_SUCC(ret)) {
+      res_cnt = std::min(item_cnt, static_cast<int64_t>(query_cond->query_limit_));
+      std::partial_sort(items, items + res_cnt, items + item_cnt);
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (res_cnt > 0 && OB_ISNULL(res_vids = static_cast<int64_t *>(ctx->allocator_->alloc(sizeof(int64_t) * res_cnt)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to allocator res vids.", K(ret), K(res_cnt));
+  } else if (OB_ISNULL(vids_iter)) {
+    if (OB_ISNULL(iter_buff = ctx->allocator_->alloc(sizeof(ObVectorQueryVidIterator)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to allocator iter.", K(ret));
+    } else {
+      vids_iter = new(iter_buff) ObVectorQueryVidIterator();
+    }
+  }
+  if (OB_SUCC(ret)) {
+    for (int64_t i = 0; i < res_cnt; i++) {
+      res_vids[i] = items[i].vid_;
+    }
+    if (OB_FAIL(vids_iter->init(res_cnt, res_vids, ctx->allocator_))) {
+      LOG_WARN("iter init failed.", K(ret), K(res_cnt));
+    } else {
+      ctx->status_ = PVQ_OK;
+    }
+  }
+  return ret;
+}
+
 int ObPluginVectorIndexAdaptor::query_result(ObVectorQueryAdaptorResultContext *ctx,
                                              ObVectorQueryConditions *query_cond,
                                              ObVectorQueryVidIterator *&vids_iter)
@@ -1546,6 +1923,11 @@ int ObPluginVectorIndexAdaptor::query_result(ObVectorQueryAdaptorResultContext *
     ret = OB_ALLOCATE_MEMORY_FAILED;
     LOG_WARN("failed to allocator iter.", K(ret));
   } else if (OB_FALSE_IT(vids_iter = new(iter_buff) ObVectorQueryVidIterator())) {
+  } else if (need_brute_force(query_cond)) {
+    // few rows pass the filters, rank them by exact distances without searching the indexes
+    if (OB_FAIL(brute_force_query_vids(ctx, query_cond, dim, vids_iter))) {
+      LOG_WARN("failed to brute force query vids.", K(ret), K(dim));
+    }
   } else if (ctx->flag_ == PVQP_FIRST) {
     if (OB_FAIL(vsag_query_vids(ctx, query_cond, dim, query_vector, vids_iter))) {
       LOG_WARN("failed to query vids.", K(ret), K(dim));
@@ -1567,7 +1949,7 @@ int ObPluginVectorIndexAdaptor::query_result(ObVectorQueryAdaptorResultContext *
       ObIStreamBuf::Callback cb = callback;
 
       ObVectorIndexSerializer index_seri(tmp_allocator);
-      if (OB_FAIL(index_seri.deserialize(snap_data_->index_, param, cb))) {
+      if (OB_FAIL(deserialize_snap_index(index_seri, param, cb))) {
         LOG_WARN("serialize index failed.", K(ret));
       } else {
         close_snap_data_rb_flag();
@@ -1905,11 +2287,8 @@ int ObPluginVectorIndexAdaptor::check_need_sync_to_follower(bool &need_sync)
     }
 
     int64_t current_snapshot_count = 0;
-    if (OB_NOT_NULL(get_snap_index())) {
-      if (OB_FAIL(obvectorutil::get_index_number(get_snap_index(), current_snapshot_count))) {
-        ret = OB_ERR_VSAG_RETURN_ERROR;
-        LOG_WARN("fail to get snap index number", K(ret));
-      }
+    if (OB_FAIL(get_snap_index_number(current_snapshot_count))) {
+      LOG_WARN("fail to get snap index number", K(ret));
     }
 
     if (current_incr_count > follower_sync_statistics_.incr_count_ + VEC_INDEX_INCR_DATA_SYNC_THRESHOLD
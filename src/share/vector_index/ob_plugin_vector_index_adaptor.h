@@ -81,12 +81,27 @@ enum ObVectorIndexAlgorithmLib
   VIAL_MAX
 };
 
+// the incremental index is always hnsw, ivf types only change the snapshot index
 enum ObVectorIndexAlgorithmType
 {
   VIAT_HNSW = 0,
+  VIAT_IVF_FLAT = 1,
+  VIAT_IVF_SQ8 = 2,
+  VIAT_IVF_PQ = 3,
   VIAT_MAX
 };
 
+OB_INLINE bool is_ivf_index_type(const ObVectorIndexAlgorithmType type)
+{
+  return VIAT_IVF_FLAT <= type && type <= VIAT_IVF_PQ;
+}
+
+// the ivf distances of sq8 and pq codes are approximate, the candidates need to be re-ranked
+OB_INLINE bool is_quantized_index_type(const ObVectorIndexAlgorithmType type)
+{
+  return VIAT_IVF_SQ8 == type || VIAT_IVF_PQ == type;
+}
+
 struct ObVectorIndexAlgorithmHeader
 {
   ObVectorIndexAlgorithmType type_;
@@ -96,7 +111,8 @@ struct ObVectorIndexAlgorithmHeader
 struct ObVectorIndexHNSWParam
 {
   ObVectorIndexHNSWParam() :
-    type_(VIAT_MAX), lib_(VIAL_MAX), dim_(0), m_(0), ef_construction_(0), ef_search_(0)
+    type_(VIAT_MAX), lib_(VIAL_MAX), dim_(0), m_(0), ef_construction_(0), ef_search_(0),
+    nlist_(0), nprobe_(0), pq_m_(0), refine_k_(0)
   {}
   void reset() {
     type_ = VIAT_MAX;
@@ -106,6 +122,10 @@ struct ObVectorIndexHNSWParam
     m_ = 0;
     ef_construction_ = 0;
     ef_search_ = 0;
+    nlist_ = 0;
+    nprobe_ = 0;
+    pq_m_ = 0;
+    refine_k_ = 0;
   };
   ObVectorIndexAlgorithmType type_;
   ObVectorIndexAlgorithmLib lib_;
@@ -114,9 +134,15 @@ struct ObVectorIndexHNSWParam
   int64_t m_;
   int64_t ef_construction_;
   int64_t ef_search_;
+  // ivf snapshot index only
+  int64_t nlist_;
+  int64_t nprobe_;
+  int64_t pq_m_; // 0 means decided by dim
+  int64_t refine_k_; // sq8 and pq search refine_k_ * limit candidates to re-rank
   OB_UNIS_VERSION(1);
 public:
-  TO_STRING_KV(K_(type), K_(lib), K_(dist_algorithm), K_(dim), K_(m), K_(ef_construction), K_(ef_search));
+  TO_STRING_KV(K_(type), K_(lib), K_(dist_algorithm), K_(dim), K_(m), K_(ef_construction), K_(ef_search),
+               K_(nlist), K_(nprobe), K_(pq_m), K_(refine_k));
 };
 
 enum ObVectorIndexRecordType
@@ -153,6 +179,7 @@ enum PluginVectorQueryResStatus
   PVQ_OK, // ok
   PVQ_COM_DATA,
   PVQ_INVALID_SCN,
+  PVQ_REFINE, // candidates need full vectors to be re-ranked
   PVQ_MAX
 };
 
@@ -211,6 +238,9 @@ struct ObVectorQueryConditions {
   ObString query_vector_;
   SCN query_scn_;
   common::ObNewRowIterator *row_iter_; // index_snapshot_data_table iter
+  // vids of the rows passing the relational predicates, null means not filtered
+  roaring::api::roaring64_bitmap_t *filter_bitmap_;
+  uint64_t filter_max_vid_; // the max vid of the table when filter_bitmap_ is built
 };
 
 struct ObVectorIndexMemData
@@ -222,12 +252,13 @@ struct ObVectorIndexMemData
       bitmap_rwlock_(),
       scn_(),
       ref_cnt_(0),
+      index_type_(VIAT_HNSW),
       index_(nullptr),
       bitmap_(nullptr),
       mem_ctx_(nullptr) {}
 
 public:
-  TO_STRING_KV(K(rb_flag_), K_(is_init), K_(scn), K_(ref_cnt), KP_(index), KPC_(bitmap), KP_(mem_ctx));
+  TO_STRING_KV(K(rb_flag_), K_(is_init), K_(scn), K_(ref_cnt), K_(index_type), KP_(index), KPC_(bitmap), KP_(mem_ctx));
   void free_resource(ObIAllocator *allocator_);
   bool is_inited() const { return is_init_; }
   void set_inited() { is_init_ = true; }
@@ -250,6 +281,7 @@ public:
   TCRWLock bitmap_rwlock_;
   SCN scn_;
   uint64_t ref_cnt_;
+  ObVectorIndexAlgorithmType index_type_; // index_ is ObVectorIvfIndex for ivf types, vsag index otherwise
   void *index_;
   ObVectorIndexRoaringBitMap *bitmap_;
   ObVsagMemContext *mem_ctx_;
@@ -417,6 +449,10 @@ public:
   int query_result(ObVectorQueryAdaptorResultContext *ctx,
                    ObVectorQueryConditions *query_cond,
                    ObVectorQueryVidIterator *&vids_iter);
+  // re-rank the candidates of PVQ_REFINE with the full vectors filled in ctx
+  int refine_result(ObVectorQueryAdaptorResultContext *ctx,
+                    ObVectorQueryConditions *query_cond,
+                    ObVectorQueryVidIterator *&vids_iter);
   static int param_deserialize(char *ptr, int32_t length,
                                     ObIAllocator *allocator,
                                     ObVectorIndexAlgorithmType &type,
@@ -444,6 +480,10 @@ public:
                              ObArray<uint64_t> &i_vids,
                              ObVectorQueryAdaptorResultContext *ctx);
   int serialize(ObIAllocator *allocator, ObOStreamBuf::CbParam &cb_param, ObOStreamBuf::Callback &cb);
+  // snap_data_ must be inited
+  int deserialize_snap_index(ObVectorIndexSerializer &index_seri,
+                             ObIStreamBuf::CbParam &cb_param,
+                             ObIStreamBuf::Callback &cb);
   int complete_delta_mem_data(roaring::api::roaring64_bitmap_t *gene_bitmap,
                               roaring::api::roaring64_bitmap_t *delta_bitmap,
                               ObIAllocator *allocator);
@@ -509,6 +549,24 @@ private:
                       ObVectorQueryConditions *query_cond,
                       int64_t dim, float *query_vector,
                       ObVectorQueryVidIterator *&vids_iter);
+  int ivf_query_snap(ObVectorQueryAdaptorResultContext *ctx,
+                     const int64_t topk, const int64_t dim, float *query_vector,
+                     roaring::api::roaring64_bitmap_t *dbitmap,
+                     const float *&distances, const int64_t *&vids, int64_t &res_cnt);
+  int set_refine_candidates(ObVectorQueryAdaptorResultContext *ctx, const int64_t dim,
+                            const int64_t cnt, const int64_t *vids);
+  bool need_brute_force(const ObVectorQueryConditions *query_cond) const;
+  int brute_force_query_vids(ObVectorQueryAdaptorResultContext *ctx,
+                             ObVectorQueryConditions *query_cond,
+                             int64_t dim,
+                             ObVectorQueryVidIterator *&vids_iter);
+  int merge_filter_bitmap(ObVectorQueryAdaptorResultContext *ctx,
+                          ObVectorQueryConditions *query_cond,
+                          roaring::api::roaring64_bitmap_t *ibitmap,
+                          roaring::api::roaring64_bitmap_t *&dbitmap,
+                          roaring::api::roaring64_bitmap_t *&filter_skip_bitmap);
+  void remove_filtered_vids(const ObVectorQueryConditions *query_cond, int64_t &res_cnt, int64_t *vids);
+  int get_snap_index_number(int64_t &count);
 
 private:
   ObAdapterCreateType create_type_;
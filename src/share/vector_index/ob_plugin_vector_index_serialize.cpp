@@ -15,6 +15,7 @@
 #include "sql/engine/expr/ob_expr_lob_utils.h"
 #include "storage/lob/ob_lob_manager.h"
 #include "deps/oblib/src/lib/vector/ob_vector_util.h"
+#include "lib/vector/ob_vector_ivf_index.h"
 #include "share/vector_index/ob_vector_index_util.h"
 #include "storage/access/ob_table_scan_iterator.h"
 
@@ -173,20 +174,43 @@ int ObIStreamBuf::do_callback()
  * ObVectorIndexSerializer implement
  * */
 int ObVectorIndexSerializer::serialize(void *index, ObOStreamBuf::CbParam &cb_param, ObOStreamBuf::Callback &cb, const int64_t capacity)
+{
+  return inner_serialize(index, nullptr, cb_param, cb, capacity);
+}
+
+int ObVectorIndexSerializer::serialize(ObVectorIvfIndex &index, ObOStreamBuf::CbParam &cb_param, ObOStreamBuf::Callback &cb, const int64_t capacity)
+{
+  return inner_serialize(nullptr, &index, cb_param, cb, capacity);
+}
+
+int ObVectorIndexSerializer::deserialize(void *&index, ObIStreamBuf::CbParam &cb_param, ObIStreamBuf::Callback &cb)
+{
+  return inner_deserialize(index, nullptr, cb_param, cb);
+}
+
+int ObVectorIndexSerializer::deserialize(ObVectorIvfIndex &index, ObIStreamBuf::CbParam &cb_param, ObIStreamBuf::Callback &cb)
+{
+  void *vsag_index = nullptr;
+  return inner_deserialize(vsag_index, &index, cb_param, cb);
+}
+
+int ObVectorIndexSerializer::inner_serialize(void *index, ObVectorIvfIndex *ivf_index,
+                                             ObOStreamBuf::CbParam &cb_param, ObOStreamBuf::Callback &cb,
+                                             const int64_t capacity)
 {
   int ret = OB_SUCCESS;
   char *data = nullptr;
-  if (OB_ISNULL(index) || 0 > capacity) {
+  if ((OB_ISNULL(index) && OB_ISNULL(ivf_index)) || 0 > capacity) {
     ret = OB_INVALID_ARGUMENT;
-    LOG_WARN("invalid argument", K(ret), K(index), K(capacity));
+    LOG_WARN("invalid argument", K(ret), K(index), KP(ivf_index), K(capacity));
   } else if (OB_ISNULL(data = static_cast<char*>(allocator_.alloc(capacity * sizeof(char))))) {
     ret = OB_ALLOCATE_MEMORY_FAILED;
     LOG_WARN("failed to alloc serialize buffer", K(ret), K(capacity));
   } else {
     ObOStreamBuf streambuf(data, capacity, cb_param, cb);
     std::ostream out(&streambuf);
-    if (OB_FAIL(obvectorutil::fserialize(index, out))) {
-      LOG_WARN("fail to do vsag serialize", K(ret));
+    if (OB_NOT_NULL(ivf_index) ? OB_FAIL(ivf_index->serialize(out)) : OB_FAIL(obvectorutil::fserialize(index, out))) {
+      LOG_WARN("fail to do vsag serialize", K(ret), KP(ivf_index));
     } else {
       streambuf.check_finish(); // do last callback to ensure all the data is written
       if (OB_FAIL(streambuf.get_error_code())) {
@@ -197,13 +221,14 @@ int ObVectorIndexSerializer::serialize(void *index, ObOStreamBuf::CbParam &cb_pa
   return ret;
 }
 
-int ObVectorIndexSerializer::deserialize(void *&index, ObIStreamBuf::CbParam &cb_param, ObIStreamBuf::Callback &cb)
+int ObVectorIndexSerializer::inner_deserialize(void *&index, ObVectorIvfIndex *ivf_index,
+                                               ObIStreamBuf::CbParam &cb_param, ObIStreamBuf::Callback &cb)
 {
   int ret = OB_SUCCESS;
   char *data = nullptr;
-  if (OB_ISNULL(index)) {
+  if (OB_ISNULL(index) && OB_ISNULL(ivf_index)) {
     ret = OB_INVALID_ARGUMENT;
-    LOG_WARN("invalid argument", K(ret), K(index));
+    LOG_WARN("invalid argument", K(ret), K(index), KP(ivf_index));
   } else {
     ObIStreamBuf streambuf(nullptr, 0, cb_param, cb);
     std::istream in(&streambuf);
@@ -214,8 +239,8 @@ int ObVectorIndexSerializer::deserialize(void *&index, ObIStreamBuf::CbParam &cb
       } else {
         LOG_WARN("failed to init istreambuf", K(ret));
       }
-    } else if (OB_FAIL(obvectorutil::fdeserialize(index, in))) {
-      LOG_WARN("fail to do vsag deserialize", K(ret));
+    } else if (OB_NOT_NULL(ivf_index) ? OB_FAIL(ivf_index->deserialize(in)) : OB_FAIL(obvectorutil::fdeserialize(index, in))) {
+      LOG_WARN("fail to do vsag deserialize", K(ret), KP(ivf_index));
     } else if (OB_FAIL(streambuf.get_error_code())) {
       if (ret == OB_ITER_END) {
         LOG_INFO("[vec index deserialize] read table finish, just return");
@@ -20,6 +20,10 @@
 
 namespace oceanbase
 {
+namespace common
+{
+class ObVectorIvfIndex;
+}
 namespace share
 {
 
@@ -186,8 +190,16 @@ public:
 
   int serialize(void *index, ObOStreamBuf::CbParam &cb_param, ObOStreamBuf::Callback &cb, const int64_t capacity = DEFAULT_OUTBUF_CAPACITY);
   int deserialize(void *&index, ObIStreamBuf::CbParam &cb_param, ObIStreamBuf::Callback &cb);
+  // ivf snapshot index
+  int serialize(common::ObVectorIvfIndex &index, ObOStreamBuf::CbParam &cb_param, ObOStreamBuf::Callback &cb, const int64_t capacity = DEFAULT_OUTBUF_CAPACITY);
+  int deserialize(common::ObVectorIvfIndex &index, ObIStreamBuf::CbParam &cb_param, ObIStreamBuf::Callback &cb);
 private:
   static const int64_t DEFAULT_OUTBUF_CAPACITY = 64LL * 1024LL; // 64KB
+  // exactly one of @index and @ivf_index is not null
+  int inner_serialize(void *index, common::ObVectorIvfIndex *ivf_index,
+                      ObOStreamBuf::CbParam &cb_param, ObOStreamBuf::Callback &cb, const int64_t capacity);
+  int inner_deserialize(void *&index, common::ObVectorIvfIndex *ivf_index,
+                        ObIStreamBuf::CbParam &cb_param, ObIStreamBuf::Callback &cb);
 
 private:
   bool is_inited_;
@@ -480,7 +480,7 @@ int ObPluginVectorIndexUtils::try_sync_snapshot_memdata(ObLSID &ls_id,
     } else if (OB_ISNULL(snap_memdata)) {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("invalid snap memdata", K(ret), KPC(adapter));
-    } else if (OB_FAIL(index_seri.deserialize(snap_memdata->index_, param, cb))) {
+    } else if (OB_FAIL(adapter->deserialize_snap_index(index_seri, param, cb))) {
       LOG_WARN("serialize index failed.", K(ret));
     } else {
       adapter->close_snap_data_rb_flag();
@@ -40,6 +40,9 @@ int ObVectorIndexUtil::parser_params_from_string(
     const int64_t default_m_value = 16;
     const int64_t default_ef_construction_value = 200;
     const int64_t default_ef_search_value = 64;
+    const int64_t default_nlist_value = 128;
+    const int64_t default_nprobe_value = 8;
+    const int64_t default_refine_k_value = 4;
     const ObVectorIndexAlgorithmLib default_lib = ObVectorIndexAlgorithmLib::VIAL_VSAG;
 
     for (int64_t i = 0; OB_SUCC(ret) && i < tmp_param_strs.count(); ++i) {
@@ -73,6 +76,12 @@ int ObVectorIndexUtil::parser_params_from_string(
         } else if (new_param_name == "TYPE") {
           if (new_param_value == "HNSW") {
             param.type_ = ObVectorIndexAlgorithmType::VIAT_HNSW;
+          } else if (new_param_value == "IVF_FLAT") {
+            param.type_ = ObVectorIndexAlgorithmType::VIAT_IVF_FLAT;
+          } else if (new_param_value == "IVF_SQ8") {
+            param.type_ = ObVectorIndexAlgorithmType::VIAT_IVF_SQ8;
+          } else if (new_param_value == "IVF_PQ") {
+            param.type_ = ObVectorIndexAlgorithmType::VIAT_IVF_PQ;
           } else {
             ret = OB_NOT_SUPPORTED;
             LOG_WARN("not support vector index type", K(ret), K(new_param_value));
@@ -107,17 +116,66 @@ int ObVectorIndexUtil::parser_params_from_string(
             ret = OB_NOT_SUPPORTED;
             LOG_WARN("not support vector index ef_search value", K(ret), K(int_value), K(new_param_value));
           }
+        } else if (new_param_name == "NLIST") {
+          int64_t int_value = 0;
+          if (OB_FAIL(ObSchemaUtils::str_to_int(new_param_value, int_value))) {
+            LOG_WARN("fail to str_to_int", K(ret), K(new_param_value));
+          } else if (int_value >= 1 && int_value <= 65536) {
+            param.nlist_ = int_value;
+          } else {
+            ret = OB_NOT_SUPPORTED;
+            LOG_WARN("not support vector index nlist value", K(ret), K(int_value), K(new_param_value));
+          }
+        } else if (new_param_name == "NPROBE") {
+          int64_t int_value = 0;
+          if (OB_FAIL(ObSchemaUtils::str_to_int(new_param_value, int_value))) {
+            LOG_WARN("fail to str_to_int", K(ret), K(new_param_value));
+          } else if (int_value >= 1 && int_value <= 65536) {
+            param.nprobe_ = int_value;
+          } else {
+            ret = OB_NOT_SUPPORTED;
+            LOG_WARN("not support vector index nprobe value", K(ret), K(int_value), K(new_param_value));
+          }
+        } else if (new_param_name == "PQ_M") {
+          int64_t int_value = 0;
+          if (OB_FAIL(ObSchemaUtils::str_to_int(new_param_value, int_value))) {
+            LOG_WARN("fail to str_to_int", K(ret), K(new_param_value));
+          } else if (int_value >= 1 && int_value <= 4096) {
+            param.pq_m_ = int_value;
+          } else {
+            ret = OB_NOT_SUPPORTED;
+            LOG_WARN("not support vector index pq_m value", K(ret), K(int_value), K(new_param_value));
+          }
+        } else if (new_param_name == "REFINE_K") {
+          int64_t int_value = 0;
+          if (OB_FAIL(ObSchemaUtils::str_to_int(new_param_value, int_value))) {
+            LOG_WARN("fail to str_to_int", K(ret), K(new_param_value));
+          } else if (int_value >= 1 && int_value <= 100) {
+            param.refine_k_ = int_value;
+          } else {
+            ret = OB_NOT_SUPPORTED;
+            LOG_WARN("not support vector index refine_k value", K(ret), K(int_value), K(new_param_value));
+          }
         } else {
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("unexpected vector index param name", K(ret), K(new_param_name));
         }
       }
     }
+    if (OB_SUCC(ret) && param.pq_m_ != 0 && param.type_ != ObVectorIndexAlgorithmType::VIAT_IVF_PQ) {
+      ret = OB_NOT_SUPPORTED;
+      LOG_WARN("vector index pq_m is only supported by ivf_pq", K(ret), K(param));
+    }
     if (OB_SUCC(ret)) {  // if vector parram not set, set default
       if (param.m_ == 0) { param.m_ = default_m_value; }
       if (param.ef_construction_ == 0) { param.ef_construction_ = default_ef_construction_value; }
       if (param.ef_search_ == 0) { param.ef_search_ = default_ef_search_value; }
       if (param.lib_ == ObVectorIndexAlgorithmLib::VIAL_MAX) { param.lib_ = default_lib; }
+      if (is_ivf_index_type(param.type_)) {
+        if (param.nlist_ == 0) { param.nlist_ = default_nlist_value; }
+        if (param.nprobe_ == 0) { param.nprobe_ = default_nprobe_value; }
+        if (param.refine_k_ == 0) { param.refine_k_ = default_refine_k_value; }
+      }
       param.dim_ = 0; // TODO@xiajin: fill dim
     }
     LOG_DEBUG("parser vector index param", K(ret), K(index_param_str), K(param));
@@ -396,6 +454,20 @@ int ObVectorIndexUtil::get_vector_dim_from_extend_type_info(const ObIArray<ObStr
   return ret;
 }
 
+// pq splits the vector into pq_m sub spaces of the same dim
+int ObVectorIndexUtil::check_ivf_pq_m(const int64_t dim, const int64_t pq_m)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(dim <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid vector dim", K(ret), K(dim), K(pq_m));
+  } else if (pq_m <= 0 || 0 != dim % pq_m) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("vector dim is not divisible by pq_m", K(ret), K(dim), K(pq_m));
+  }
+  return ret;
+}
+
 /*
   To obtain the dimension of the vector index。
   it is currently only supported to retrieve it from table 345, as only table 345 contains vector column information.
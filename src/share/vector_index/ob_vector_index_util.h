@@ -64,6 +64,9 @@ public:
   static int get_vector_dim_from_extend_type_info(
       const ObIArray<ObString> &extend_type_info,
       int64_t &dim);
+  static int check_ivf_pq_m(
+      const int64_t dim,
+      const int64_t pq_m);
   static int generate_new_index_name(
       ObIAllocator &allocator,
       ObString &new_index_name);
@@ -11,6 +11,7 @@
  */
 
 #include "ob_vector_cosine_distance.h"
+#include "lib/vector/ob_vector_distance_simd.h"
 namespace oceanbase
 {
 namespace common
@@ -58,6 +59,25 @@ OB_INLINE int ObVectorCosineDistance::cosine_calculate_normal(const float *a, co
   return ret;
 }
 
+int ObVectorCosineDistance::cosine_calculate_simd(const float *a, const float *b, const int64_t len, double &ip, double &abs_dist_a, double &abs_dist_b)
+{
+  int ret = OB_SUCCESS;
+#if OB_USE_MULTITARGET_CODE
+  if (is_arch_supported(ObTargetArch::AVX512)) {
+    specific::avx512::cosine_calculate(a, b, len, ip, abs_dist_a, abs_dist_b);
+  } else {
+    specific::avx2::cosine_calculate(a, b, len, ip, abs_dist_a, abs_dist_b);
+  }
+  if (OB_UNLIKELY(0 != ::isinf(ip) || 0 != ::isinf(abs_dist_a) || 0 != ::isinf(abs_dist_b))) {
+    ret = OB_NUMERIC_OVERFLOW;
+    LIB_LOG(WARN, "value is overflow", K(ret), K(ip), K(abs_dist_a), K(abs_dist_b));
+  }
+#else
+  ret = cosine_calculate_normal(a, b, len, ip, abs_dist_a, abs_dist_b);
+#endif
+  return ret;
+}
+
 OB_INLINE int ObVectorCosineDistance::cosine_similarity_normal(const float *a, const float *b, const int64_t len, double &similarity)
 {
   int ret = OB_SUCCESS;
@@ -65,7 +85,9 @@ OB_INLINE int ObVectorCosineDistance::cosine_similarity_normal(const float *a, c
   double abs_dist_a = 0;
   double abs_dist_b = 0;
   similarity = 0;
-  if (OB_FAIL(cosine_calculate_normal(a, b, len, ip, abs_dist_a, abs_dist_b))) {
+  if (OB_FAIL(is_arch_supported(ObTargetArch::AVX2)
+              ? cosine_calculate_simd(a, b, len, ip, abs_dist_a, abs_dist_b)
+              : cosine_calculate_normal(a, b, len, ip, abs_dist_a, abs_dist_b))) {
     LIB_LOG(WARN, "failed to cal cosine", K(ret), K(ip));
   } else if (0 == abs_dist_a || 0 == abs_dist_b) {
     ret = OB_ERR_NULL_VALUE;
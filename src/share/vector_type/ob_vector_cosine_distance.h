@@ -31,7 +31,8 @@ struct ObVectorCosineDistance
   OB_INLINE static int cosine_similarity_normal(const float *a, const float *b, const int64_t len, double &similarity);
   OB_INLINE static int cosine_calculate_normal(const float *a, const float *b, const int64_t len, double &ip, double &abs_dist_a, double &abs_dist_b);
   OB_INLINE static double get_cosine_distance(double similarity);
-  // TODO(@jingshui) add simd func
+  // simd func, AVX2 or AVX512 by the cpu
+  static int cosine_calculate_simd(const float *a, const float *b, const int64_t len, double &ip, double &abs_dist_a, double &abs_dist_b);
 };
 } // common
 } // oceanbase
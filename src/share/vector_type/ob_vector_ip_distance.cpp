@@ -11,13 +11,31 @@
  */
 
 #include "ob_vector_ip_distance.h"
+#include "lib/vector/ob_vector_distance_simd.h"
 namespace oceanbase
 {
 namespace common
 {
 int ObVectorIpDistance::ip_distance_func(const float *a, const float *b, const int64_t len, double &distance)
 {
-return ip_distance_normal(a, b, len, distance);
+  return is_arch_supported(ObTargetArch::AVX2) ? ip_distance_simd(a, b, len, distance) : ip_distance_normal(a, b, len, distance);
+}
+
+int ObVectorIpDistance::ip_distance_simd(const float *a, const float *b, const int64_t len, double &distance)
+{
+  int ret = OB_SUCCESS;
+#if OB_USE_MULTITARGET_CODE
+  distance += is_arch_supported(ObTargetArch::AVX512)
+      ? specific::avx512::inner_product(a, b, len)
+      : specific::avx2::inner_product(a, b, len);
+  if (OB_UNLIKELY(0 != ::isinf(distance))) {
+    ret = OB_NUMERIC_OVERFLOW;
+    LIB_LOG(WARN, "value is overflow", K(ret), K(distance));
+  }
+#else
+  ret = ip_distance_normal(a, b, len, distance);
+#endif
+  return ret;
 }
 
 OB_INLINE int ObVectorIpDistance::ip_distance_normal(const float *a, const float *b, const int64_t len, double &distance)
@@ -28,7 +28,8 @@ struct ObVectorIpDistance
 
   // normal func
   OB_INLINE static int ip_distance_normal(const float *a, const float *b, const int64_t len, double &distance);
-  // TODO(@jingshui) add simd func
+  // simd func, AVX2 or AVX512 by the cpu
+  static int ip_distance_simd(const float *a, const float *b, const int64_t len, double &distance);
 };
 
 } // common
@@ -11,13 +11,33 @@
  */
 
 #include "ob_vector_l1_distance.h"
+#include "lib/vector/ob_vector_distance_simd.h"
 namespace oceanbase
 {
 namespace common
 {
 int ObVectorL1Distance::l1_distance_func(const float *a, const float *b, const int64_t len, double &distance)
 {
-return l1_distance_normal(a, b, len, distance);
+  return is_arch_supported(ObTargetArch::AVX2) ? l1_distance_simd(a, b, len, distance) : l1_distance_normal(a, b, len, distance);
+}
+
+int ObVectorL1Distance::l1_distance_simd(const float *a, const float *b, const int64_t len, double &distance)
+{
+  int ret = OB_SUCCESS;
+#if OB_USE_MULTITARGET_CODE
+  const double sum = is_arch_supported(ObTargetArch::AVX512)
+      ? specific::avx512::l1_distance(a, b, len)
+      : specific::avx2::l1_distance(a, b, len);
+  if (OB_UNLIKELY(0 != ::isinf(sum))) {
+    ret = OB_NUMERIC_OVERFLOW;
+    LIB_LOG(WARN, "value is overflow", K(ret), K(sum));
+  } else {
+    distance = sum;
+  }
+#else
+  ret = l1_distance_normal(a, b, len, distance);
+#endif
+  return ret;
 }
 
 OB_INLINE int ObVectorL1Distance::l1_distance_normal(const float *a, const float *b, const int64_t len, double &distance)
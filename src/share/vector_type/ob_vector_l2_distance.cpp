@@ -11,13 +11,33 @@
  */
 
 #include "ob_vector_l2_distance.h"
+#include "lib/vector/ob_vector_distance_simd.h"
 namespace oceanbase
 {
 namespace common
 {
 int ObVectorL2Distance::l2_square_func(const float *a, const float *b, const int64_t len, double &square)
 {
-  return l2_square_normal(a, b, len, square);
+  return is_arch_supported(ObTargetArch::AVX2) ? l2_square_simd(a, b, len, square) : l2_square_normal(a, b, len, square);
+}
+
+int ObVectorL2Distance::l2_square_simd(const float *a, const float *b, const int64_t len, double &square)
+{
+  int ret = OB_SUCCESS;
+#if OB_USE_MULTITARGET_CODE
+  const double sum = is_arch_supported(ObTargetArch::AVX512)
+      ? specific::avx512::l2_square(a, b, len)
+      : specific::avx2::l2_square(a, b, len);
+  if (OB_UNLIKELY(0 != ::isinf(sum))) {
+    ret = OB_NUMERIC_OVERFLOW;
+    LIB_LOG(WARN, "value is overflow", K(ret), K(sum));
+  } else {
+    square = sum;
+  }
+#else
+  ret = l2_square_normal(a, b, len, square);
+#endif
+  return ret;
 }
 
 int ObVectorL2Distance::l2_distance_func(const float *a, const float *b, const int64_t len, double &distance)
@@ -29,7 +29,8 @@ struct ObVectorL2Distance
 
   // normal func
   OB_INLINE static int l2_square_normal(const float *a, const float *b, const int64_t len, double &square);
-  // TODO(@jingshui) add simd func
+  // simd func, AVX2 or AVX512 by the cpu
+  static int l2_square_simd(const float *a, const float *b, const int64_t len, double &square);
 };
 
 } // common
@@ -1141,6 +1141,19 @@ int ObTscCgService::extract_das_output_column_ids(const ObLogTableScan &op,
       }
     }
   }
+  if (OB_SUCC(ret) && op.is_vec_idx_scan() && op.get_index_back()
+      && table_id == op.get_ref_table_id() && ObTSCIRScanType::OB_VEC_COM_AUX_SCAN != scan_ctdef.ir_scan_type_) {
+    // the pre-filter of the vector index maps the filtered main table rows back to their vids by rowkey
+    ObSEArray<uint64_t, 4> rowkey_cids;
+    if (OB_FAIL(index_schema.get_rowkey_column_ids(rowkey_cids))) {
+      LOG_WARN("get rowkey column ids failed", K(ret));
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && i < rowkey_cids.count(); ++i) {
+      if (OB_FAIL(add_var_to_array_no_dup(output_cids, rowkey_cids.at(i)))) {
+        LOG_WARN("store rowkey column id failed", K(ret), K(rowkey_cids.at(i)));
+      }
+    }
+  }
   return ret;
 }
 int ObTscCgService::extract_das_column_ids(const ObIArray<ObRawExpr*> &column_exprs,
@@ -1339,6 +1352,8 @@ int ObTscCgService::generate_vec_ir_ctdef(const ObLogTableScan &op,
         vec_scan_ctdef->children_[3] = snapshot_ctdef;
         vec_scan_ctdef->children_[4] = com_aux_ctdef;
         vec_scan_ctdef->dim_ = dim;
+        vec_scan_ctdef->row_count_ = op.get_table_row_count();
+        vec_scan_ctdef->selectivity_ = nullptr == op.get_est_cost_info() ? 1.0 : op.get_est_cost_info()->table_filter_sel_;
       }
     }
 
@@ -1526,6 +1541,10 @@ int ObTscCgService::generate_text_ir_ctdef(const ObLogTableScan &op,
         sort_ctdef))) {
       LOG_WARN("generate sort ctdef failed", K(ret));
     } else {
+      const ObTextRetrievalInfo &tr_info = op.get_text_retrieval_info();
+      ir_scan_ctdef->has_relevance_topk_ = nullptr != tr_info.topk_limit_expr_
+          && !tr_info.with_ties_
+          && is_descending_direction(tr_info.sort_key_.order_type_);
       root_ctdef = sort_ctdef;
     }
   }
@@ -374,6 +374,10 @@ int ObDASIterUtils::create_text_retrieval_tree(ObTableScanParam &scan_param,
     } else if (OB_FAIL(create_sort_sub_tree(alloc, sort_ctdef, sort_rtdef, text_retrieval_result, sort_result))) {
       LOG_WARN("failed to create sort sub tree", K(ret));
     } else {
+      if (ir_scan_ctdef->need_topk_pruning()) {
+        const int64_t top_k = static_cast<ObDASSortIter *>(sort_result)->get_top_k();
+        static_cast<ObDASTextRetrievalMergeIter *>(text_retrieval_result)->set_topk_limit(top_k);
+      }
       root_iter = sort_result;
     }
   }
@@ -67,9 +67,7 @@ int ObDASSortIter::inner_init(ObDASIterParam &param)
       }
 
       if (OB_SUCC(ret)) {
-        const bool top_k_overflow = INT64_MAX - limit_param_.offset_ < limit_param_.limit_;
-        const int64_t top_k = (limit_param_.is_valid() && !top_k_overflow)
-            ? (limit_param_.limit_ + limit_param_.offset_) : INT64_MAX;
+        const int64_t top_k = get_top_k();
         if (OB_FAIL(sort_impl_.init(MTL_ID(),
                                     &sort_ctdef_->sort_collations_,
                                     &sort_ctdef_->sort_cmp_funcs_,
@@ -140,9 +138,7 @@ int ObDASSortIter::do_table_scan()
 int ObDASSortIter::rescan()
 {
   int ret = OB_SUCCESS;
-  const bool top_k_overflow = INT64_MAX - limit_param_.offset_ < limit_param_.limit_;
-  const int64_t top_k = (limit_param_.is_valid() && !top_k_overflow)
-      ? (limit_param_.limit_ + limit_param_.offset_) : INT64_MAX;
+  const int64_t top_k = get_top_k();
   if (OB_FAIL(child_->rescan())) {
     LOG_WARN("failed to rescan child", K(ret));
   } else if (OB_FAIL(sort_impl_.init(MTL_ID(),
@@ -62,6 +62,12 @@ public:
   virtual int do_table_scan() override;
   virtual int rescan() override;
   virtual void clear_evaluated_flag() override;
+  // count of rows kept by the sort, INT64_MAX if there is no limit
+  int64_t get_top_k() const
+  {
+    const bool top_k_overflow = INT64_MAX - limit_param_.offset_ < limit_param_.limit_;
+    return (limit_param_.is_valid() && !top_k_overflow) ? (limit_param_.limit_ + limit_param_.offset_) : INT64_MAX;
+  }
 
 protected:
   virtual int inner_init(ObDASIterParam &param) override;
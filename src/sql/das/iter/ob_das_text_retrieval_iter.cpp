@@ -39,6 +39,9 @@ ObDASTextRetrievalIter::ObDASTextRetrievalIter()
     inverted_idx_agg_iter_(nullptr),
     forward_idx_iter_(nullptr),
     fwd_range_objs_(nullptr),
+    inv_range_objs_(nullptr),
+    skip_range_objs_(nullptr),
+    skip_doc_id_(),
     doc_token_cnt_expr_(nullptr),
     token_doc_cnt_(0),
     need_fwd_idx_agg_(false),
@@ -67,6 +70,74 @@ int ObDASTextRetrievalIter::set_query_token(const ObString &query_token)
     LOG_WARN("failed to add scan range for inv idx scan", K(ret));
   } else if (need_inv_idx_agg_ && OB_FAIL(inv_idx_agg_param_.key_ranges_.push_back(inv_idx_scan_range))) {
     LOG_WARN("failed to add scan range for inv idx agg", K(ret));
+  } else {
+    inv_range_objs_ = inv_idx_scan_range.start_key_.get_obj_ptr();
+  }
+  return ret;
+}
+
+int ObDASTextRetrievalIter::advance_to(const ObDocId &target_doc_id)
+{
+  int ret = OB_SUCCESS;
+  const bool is_vectorized = inv_idx_scan_param_.op_->is_vectorized();
+  const ObString target = target_doc_id.get_string();
+  ObDocId cur_doc_id;
+  bool reached = false;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("text retrieval iter not inited", K(ret));
+  } else if (OB_ISNULL(inv_range_objs_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null inverted index range", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && !reached && i < MAX_SEQUENTIAL_SKIP_CNT; ++i) {
+    if (OB_FAIL(get_next_single_row(is_vectorized, inverted_idx_scan_iter_))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("failed to get next row from inverted index", K(ret));
+      }
+    } else if (OB_FAIL(get_inv_idx_scan_doc_id(cur_doc_id))) {
+      LOG_WARN("failed to get current doc id", K(ret));
+    } else {
+      reached = cur_doc_id.get_string().compare(target) >= 0;
+    }
+  }
+  if (OB_SUCC(ret) && !reached && nullptr == skip_range_objs_) {
+    void *buf = nullptr;
+    constexpr int64_t obj_cnt = INV_IDX_ROWKEY_COL_CNT * 2;
+    if (OB_ISNULL(buf = mem_context_->get_arena_allocator().alloc(sizeof(ObObj) * obj_cnt))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("failed to allocate memory for skip range obj", K(ret));
+    } else {
+      skip_range_objs_ = new (buf) ObObj[obj_cnt];
+    }
+  }
+  if (OB_SUCC(ret) && !reached) {
+    // reopen the scan of the token from the target document
+    ObNewRange skip_range;
+    skip_doc_id_ = target_doc_id;
+    for (int64_t i = 0; i < INV_IDX_ROWKEY_COL_CNT * 2; ++i) {
+      skip_range_objs_[i] = inv_range_objs_[i];
+    }
+    skip_range_objs_[1].set_varbinary(skip_doc_id_.get_string());
+    skip_range.table_id_ = ir_ctdef_->get_inv_idx_scan_ctdef()->ref_table_id_;
+    skip_range.start_key_.assign(skip_range_objs_, INV_IDX_ROWKEY_COL_CNT);
+    skip_range.end_key_.assign(&skip_range_objs_[2], INV_IDX_ROWKEY_COL_CNT);
+    skip_range.border_flag_.set_inclusive_start();
+    skip_range.border_flag_.set_inclusive_end();
+    if (OB_FAIL(inverted_idx_scan_iter_->reuse())) {
+      LOG_WARN("failed to reuse inverted index iter", K(ret));
+    } else if (OB_FAIL(inv_idx_scan_param_.key_ranges_.push_back(skip_range))) {
+      LOG_WARN("failed to add skip range for inv idx scan", K(ret), K(skip_range));
+    } else if (OB_FAIL(inverted_idx_scan_iter_->rescan())) {
+      LOG_WARN("failed to rescan inverted index iter", K(ret));
+    } else if (OB_FAIL(get_next_single_row(is_vectorized, inverted_idx_scan_iter_))) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("failed to get next row from inverted index", K(ret));
+      }
+    }
+  }
+  if (OB_SUCC(ret) && ir_ctdef_->need_calc_relevance() && OB_FAIL(calc_relevance())) {
+    LOG_WARN("failed to calc relevance", K(ret));
   }
   return ret;
 }
@@ -153,6 +224,7 @@ int ObDASTextRetrievalIter::inner_reuse()
 
   if (OB_SUCC(ret)) {
     inv_idx_agg_evaluated_ = false;
+    skip_range_objs_ = nullptr;
   }
 
   return ret;
@@ -183,6 +255,8 @@ int ObDASTextRetrievalIter::inner_release()
   inverted_idx_agg_iter_ = nullptr;
   forward_idx_iter_ = nullptr;
   fwd_range_objs_ = nullptr;
+  inv_range_objs_ = nullptr;
+  skip_range_objs_ = nullptr;
   doc_token_cnt_expr_ = nullptr;
   tx_desc_ = nullptr;
   snapshot_ = nullptr;
@@ -257,20 +331,27 @@ int ObDASTextRetrievalIter::inner_get_next_row()
     LOG_DEBUG("get one invert index scan row", "row",
         ROWEXPR2STR(*ir_rtdef_->get_inv_idx_scan_rtdef()->eval_ctx_,
         *inv_idx_scan_param_.output_exprs_));
-    if (ir_ctdef_->need_calc_relevance()) {
-      clear_row_wise_evaluated_flag();
-      if (OB_FAIL(get_next_doc_token_cnt(need_fwd_idx_agg_))) {
-        LOG_WARN("failed to get next doc token count", K(ret));
-      } else if (OB_FAIL(fill_token_doc_cnt())) {
-        LOG_WARN("failed to get token doc cnt", K(ret));
-      } else if (OB_FAIL(project_relevance_expr())) {
-        LOG_WARN("failed to evaluate simarity expr", K(ret));
-      }
+    if (ir_ctdef_->need_calc_relevance() && OB_FAIL(calc_relevance())) {
+      LOG_WARN("failed to calc relevance", K(ret));
     }
   }
   return ret;
 }
 
+int ObDASTextRetrievalIter::calc_relevance()
+{
+  int ret = OB_SUCCESS;
+  clear_row_wise_evaluated_flag();
+  if (OB_FAIL(get_next_doc_token_cnt(need_fwd_idx_agg_))) {
+    LOG_WARN("failed to get next doc token count", K(ret));
+  } else if (OB_FAIL(fill_token_doc_cnt())) {
+    LOG_WARN("failed to get token doc cnt", K(ret));
+  } else if (OB_FAIL(project_relevance_expr())) {
+    LOG_WARN("failed to evaluate simarity expr", K(ret));
+  }
+  return ret;
+}
+
 int ObDASTextRetrievalIter::inner_get_next_rows(int64_t &count, int64_t capacity)
 {
   UNUSEDx(count, capacity);
@@ -61,6 +61,10 @@ public:
   virtual int rescan() override;
 
   int set_query_token(const ObString &query_token);
+  // move to the first posting of the token whose doc id is not less than @target_doc_id,
+  // the current posting should be less than @target_doc_id
+  int advance_to(const ObDocId &target_doc_id);
+  int64_t get_token_doc_cnt() const { return token_doc_cnt_; }
   void set_ls_tablet_ids(
       const share::ObLSID &ls_id,
       const ObTabletID &inv_tablet_id,
@@ -90,6 +94,7 @@ private:
       transaction::ObTxDesc *tx_desc,
       transaction::ObTxReadSnapshot *snapshot,
       ObTableScanParam &scan_param);
+  int calc_relevance();
   int get_next_doc_token_cnt(const bool use_fwd_idx_agg);
   int do_doc_cnt_agg();
   int do_token_cnt_agg(const ObDocId &doc_id, int64_t &token_count);
@@ -119,6 +124,8 @@ private:
 private:
   static const int64_t FWD_IDX_ROWKEY_COL_CNT = 2;
   static const int64_t INV_IDX_ROWKEY_COL_CNT = 2;
+  // a short skip over the postings is cheaper than reopening the inverted index scan
+  static const int64_t MAX_SEQUENTIAL_SKIP_CNT = 8;
 private:
   lib::MemoryContext mem_context_;
   const ObDASIRScanCtDef *ir_ctdef_;
@@ -136,6 +143,10 @@ private:
   ObDASScanIter *inverted_idx_agg_iter_;
   ObDASScanIter *forward_idx_iter_;
   ObObj *fwd_range_objs_;
+  ObObj *inv_range_objs_;
+  // copy of inv_range_objs_ with the start doc id moved by advance_to, the token range is kept intact
+  ObObj *skip_range_objs_;
+  ObDocId skip_doc_id_;
   sql::ObExpr *doc_token_cnt_expr_;
   int64_t token_doc_cnt_;
   bool need_fwd_idx_agg_;
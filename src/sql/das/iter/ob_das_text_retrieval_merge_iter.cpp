@@ -15,6 +15,7 @@
 #include "ob_das_text_retrieval_merge_iter.h"
 #include "ob_das_text_retrieval_iter.h"
 #include "sql/das/ob_das_ir_define.h"
+#include "sql/engine/expr/ob_expr_bm25.h"
 #include "share/text_analysis/ob_text_analyzer.h"
 #include "storage/fts/ob_fts_plugin_helper.h"
 
@@ -94,6 +95,14 @@ ObDASTextRetrievalMergeIter::ObDASTextRetrievalMergeIter()
     whole_doc_cnt_iter_(nullptr),
     whole_doc_agg_param_(),
     limit_param_(),
+    topk_relevance_cmp_(),
+    topk_relevances_(topk_relevance_cmp_),
+    topk_cursors_(),
+    token_max_relevances_(),
+    topk_cursor_order_(),
+    topk_limit_(0),
+    topk_cursor_cnt_(0),
+    topk_cursor_inited_(false),
     input_row_cnt_(0),
     output_row_cnt_(0),
     doc_cnt_calculated_(false),
@@ -223,6 +232,12 @@ int ObDASTextRetrievalMergeIter::inner_reuse()
   next_batch_iter_idxes_.reuse();
   iter_row_heap_->reuse();
   next_batch_cnt_ = 0;
+  topk_relevances_.reset();
+  topk_cursors_.reuse();
+  token_max_relevances_.reuse();
+  topk_cursor_order_.reuse();
+  topk_cursor_cnt_ = 0;
+  topk_cursor_inited_ = false;
   doc_cnt_calculated_ = false;
   input_row_cnt_ = 0;
   output_row_cnt_ = 0;
@@ -257,6 +272,10 @@ int ObDASTextRetrievalMergeIter::inner_release()
   whole_doc_cnt_iter_ = nullptr;
   token_iters_.reset();
   next_batch_iter_idxes_.reset();
+  topk_relevances_.reset();
+  topk_cursors_.reset();
+  token_max_relevances_.reset();
+  topk_cursor_order_.reset();
   if (nullptr != mem_context_)  {
     mem_context_->reset_remain_one_page();
     DESTROY_CONTEXT(mem_context_);
@@ -267,6 +286,9 @@ int ObDASTextRetrievalMergeIter::inner_release()
   output_row_cnt_ = 0;
   limit_param_.offset_ = 0;
   limit_param_.limit_ = -1;
+  topk_limit_ = 0;
+  topk_cursor_cnt_ = 0;
+  topk_cursor_inited_ = false;
   doc_cnt_calculated_ = false;
   doc_cnt_iter_acquired_ = false;
   is_inited_ = false;
@@ -298,12 +320,19 @@ int ObDASTextRetrievalMergeIter::inner_get_next_row()
 
   bool filter_valid = false;
   bool got_valid_document = false;
+  double relevance = 0.0;
   ObExpr *match_filter = ir_ctdef_->need_calc_relevance() ? ir_ctdef_->match_filter_ : nullptr;
   ObDatum *filter_res = nullptr;
   while (OB_SUCC(ret) && !got_valid_document) {
     clear_evaluated_infos();
     filter_valid = false;
-    if (OB_FAIL(pull_next_batch_rows())) {
+    if (need_topk_pruning()) {
+      if (OB_FAIL(next_topk_document(relevance))) {
+        if (OB_UNLIKELY(OB_ITER_END != ret)) {
+          LOG_WARN("failed to get next top-k candidate document", K(ret));
+        }
+      }
+    } else if (OB_FAIL(pull_next_batch_rows())) {
       if (OB_UNLIKELY(OB_ITER_END != ret)) {
         LOG_WARN("failed to pull next batch rows from iterator", K(ret));
       }
@@ -317,6 +346,11 @@ int ObDASTextRetrievalMergeIter::inner_get_next_row()
       filter_valid = !(filter_res->is_null() || 0 == filter_res->get_int());
     }
 
+    if (OB_FAIL(ret)) {
+    } else if (filter_valid && need_topk_pruning() && OB_FAIL(update_topk_threshold(relevance))) {
+      LOG_WARN("failed to update top-k relevance threshold", K(ret), K(relevance));
+    }
+
     if (OB_SUCC(ret)) {
       if (filter_valid) {
         ++input_row_cnt_;
@@ -446,6 +480,9 @@ int ObDASTextRetrievalMergeIter::set_merge_iters(const ObIArray<ObDASIter *> &re
   } else if (0 == query_tokens_.count()) {
     // no valid tokens
   } else if (FALSE_IT(next_batch_iter_idxes_.set_allocator(&mem_context_->get_arena_allocator()))) {
+  } else if (FALSE_IT(topk_cursors_.set_allocator(&mem_context_->get_arena_allocator()))) {
+  } else if (FALSE_IT(token_max_relevances_.set_allocator(&mem_context_->get_arena_allocator()))) {
+  } else if (FALSE_IT(topk_cursor_order_.set_allocator(&mem_context_->get_arena_allocator()))) {
   } else if (OB_FAIL(next_batch_iter_idxes_.init(query_tokens_.count()))) {
     LOG_WARN("failed to init next batch iter idxes array", K(ret));
   } else if (OB_FAIL(next_batch_iter_idxes_.prepare_allocate(query_tokens_.count()))) {
@@ -535,6 +572,184 @@ int ObDASTextRetrievalMergeIter::next_disjunctive_document()
   return ret;
 }
 
+int ObDASTextRetrievalMergeIter::init_topk_cursors()
+{
+  int ret = OB_SUCCESS;
+  const int64_t iter_cnt = token_iters_.count();
+  topk_cursor_cnt_ = 0;
+  next_batch_cnt_ = 0;
+  if (OB_UNLIKELY(!ir_ctdef_->need_calc_relevance())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("top-k pruning without relevance", K(ret));
+  } else if (OB_FAIL(topk_cursors_.init(iter_cnt))) {
+    LOG_WARN("failed to init top-k cursors", K(ret));
+  } else if (OB_FAIL(topk_cursors_.prepare_allocate(iter_cnt))) {
+    LOG_WARN("failed to prepare allocate top-k cursors", K(ret));
+  } else if (OB_FAIL(token_max_relevances_.init(iter_cnt))) {
+    LOG_WARN("failed to init token max relevances", K(ret));
+  } else if (OB_FAIL(token_max_relevances_.prepare_allocate(iter_cnt))) {
+    LOG_WARN("failed to prepare allocate token max relevances", K(ret));
+  } else if (OB_FAIL(topk_cursor_order_.init(iter_cnt))) {
+    LOG_WARN("failed to init top-k cursor order", K(ret));
+  } else if (OB_FAIL(topk_cursor_order_.prepare_allocate(iter_cnt))) {
+    LOG_WARN("failed to prepare allocate top-k cursor order", K(ret));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < iter_cnt; ++i) {
+    token_max_relevances_[i] = 0.0;
+    if (OB_FAIL(advance_topk_cursor(i, nullptr))) {
+      LOG_WARN("failed to get first posting of token", K(ret), K(i));
+    } else if (topk_cursors_[i].iter_idx_ >= 0) {
+      topk_cursor_order_[topk_cursor_cnt_++] = i;
+    }
+  }
+  if (OB_SUCC(ret) && topk_cursor_cnt_ > 0) {
+    // total document count is evaluated with the relevance of the first postings
+    const ObExpr *total_doc_cnt_expr = ir_ctdef_->relevance_expr_->args_[ObExprBM25::TOTAL_DOC_CNT_PARAM_IDX];
+    const int64_t total_doc_cnt = total_doc_cnt_expr->locate_expr_datum(*ir_rtdef_->eval_ctx_).get_int();
+    for (int64_t i = 0; i < iter_cnt; ++i) {
+      token_max_relevances_[i] = ObExprBM25::relevance_upper_bound(
+          token_iters_.at(i)->get_token_doc_cnt(), total_doc_cnt);
+    }
+    LOG_TRACE("init top-k cursors", K(ret), K_(topk_limit), K(total_doc_cnt), K_(token_max_relevances));
+  }
+  if (OB_SUCC(ret)) {
+    topk_cursor_inited_ = true;
+  }
+  return ret;
+}
+
+int ObDASTextRetrievalMergeIter::next_topk_document(double &relevance)
+{
+  int ret = OB_SUCCESS;
+  bool got_document = false;
+  if (!topk_cursor_inited_ && OB_FAIL(init_topk_cursors())) {
+    LOG_WARN("failed to init top-k cursors", K(ret));
+  }
+  // cursors on the last returned document are moved after it is projected and consumed
+  for (int64_t i = 0; OB_SUCC(ret) && i < next_batch_cnt_; ++i) {
+    if (OB_FAIL(advance_topk_cursor(next_batch_iter_idxes_[i], nullptr))) {
+      LOG_WARN("failed to advance top-k cursor", K(ret), K(i));
+    }
+  }
+  next_batch_cnt_ = 0;
+  while (OB_SUCC(ret) && !got_document) {
+    const double threshold = topk_relevances_.count() < topk_limit_ ? 0.0 : topk_relevances_.top();
+    double max_relevance_sum = 0.0;
+    int64_t pivot = -1;
+    sort_topk_cursors();
+    for (int64_t i = 0; -1 == pivot && i < topk_cursor_cnt_; ++i) {
+      max_relevance_sum += token_max_relevances_[topk_cursor_order_[i]];
+      if (max_relevance_sum > threshold) {
+        pivot = i;
+      }
+    }
+    if (-1 == pivot) {
+      // no remaining document is able to enter the top-k
+      ret = OB_ITER_END;
+    } else {
+      const ObDocId pivot_doc_id = topk_cursors_[topk_cursor_order_[pivot]].doc_id_;
+      if (topk_cursors_[topk_cursor_order_[0]].doc_id_ == pivot_doc_id) {
+        relevance = 0.0;
+        for (int64_t i = 0; i < topk_cursor_cnt_; ++i) {
+          const ObIRIterLoserTreeItem &cursor = topk_cursors_[topk_cursor_order_[i]];
+          if (cursor.doc_id_ == pivot_doc_id) {
+            relevance += cursor.relevance_;
+            next_batch_iter_idxes_[next_batch_cnt_++] = cursor.iter_idx_;
+          }
+        }
+        if (relevance > threshold) {
+          if (OB_FAIL(project_result(topk_cursors_[topk_cursor_order_[0]], relevance))) {
+            LOG_WARN("failed to project relevance", K(ret));
+          } else {
+            got_document = true;
+          }
+        } else {
+          for (int64_t i = 0; OB_SUCC(ret) && i < next_batch_cnt_; ++i) {
+            if (OB_FAIL(advance_topk_cursor(next_batch_iter_idxes_[i], nullptr))) {
+              LOG_WARN("failed to advance top-k cursor", K(ret), K(i));
+            }
+          }
+          next_batch_cnt_ = 0;
+        }
+      } else {
+        // documents before the pivot document can not enter the top-k, skip their postings
+        for (int64_t i = 0; i < pivot; ++i) {
+          const ObIRIterLoserTreeItem &cursor = topk_cursors_[topk_cursor_order_[i]];
+          if (cursor.doc_id_.get_string().compare(pivot_doc_id.get_string()) < 0) {
+            next_batch_iter_idxes_[next_batch_cnt_++] = cursor.iter_idx_;
+          }
+        }
+        for (int64_t i = 0; OB_SUCC(ret) && i < next_batch_cnt_; ++i) {
+          if (OB_FAIL(advance_topk_cursor(next_batch_iter_idxes_[i], &pivot_doc_id))) {
+            LOG_WARN("failed to skip top-k cursor to pivot", K(ret), K(i), K(pivot_doc_id));
+          }
+        }
+        next_batch_cnt_ = 0;
+      }
+    }
+  }
+  return ret;
+}
+
+int ObDASTextRetrievalMergeIter::advance_topk_cursor(const int64_t iter_idx, const ObDocId *target_doc_id)
+{
+  int ret = OB_SUCCESS;
+  ObDASTextRetrievalIter *iter = token_iters_.at(iter_idx);
+  if (OB_ISNULL(iter)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected null token iter ptr", K(ret), K(iter_idx));
+  } else {
+    ret = nullptr == target_doc_id ? iter->get_next_row() : iter->advance_to(*target_doc_id);
+    if (OB_FAIL(ret)) {
+      if (OB_UNLIKELY(OB_ITER_END != ret)) {
+        LOG_WARN("failed to get next posting of token", K(ret), K(iter_idx));
+      } else {
+        // the cursor is removed from the order at next sort
+        topk_cursors_[iter_idx].iter_idx_ = -1;
+        ret = OB_SUCCESS;
+      }
+    } else if (OB_FAIL(fill_loser_tree_item(*iter, iter_idx, topk_cursors_[iter_idx]))) {
+      LOG_WARN("failed to fill top-k cursor", K(ret), K(iter_idx));
+    }
+  }
+  return ret;
+}
+
+void ObDASTextRetrievalMergeIter::sort_topk_cursors()
+{
+  // few cursors are moved every round, insertion sort is almost linear
+  int64_t cnt = 0;
+  for (int64_t i = 0; i < topk_cursor_cnt_; ++i) {
+    const int64_t iter_idx = topk_cursor_order_[i];
+    if (topk_cursors_[iter_idx].iter_idx_ >= 0) {
+      const ObString doc_id = topk_cursors_[iter_idx].doc_id_.get_string();
+      int64_t j = cnt;
+      while (j > 0 && topk_cursors_[topk_cursor_order_[j - 1]].doc_id_.get_string().compare(doc_id) > 0) {
+        topk_cursor_order_[j] = topk_cursor_order_[j - 1];
+        --j;
+      }
+      topk_cursor_order_[j] = iter_idx;
+      ++cnt;
+    }
+  }
+  topk_cursor_cnt_ = cnt;
+}
+
+int ObDASTextRetrievalMergeIter::update_topk_threshold(const double relevance)
+{
+  int ret = OB_SUCCESS;
+  if (topk_relevances_.count() < topk_limit_) {
+    if (OB_FAIL(topk_relevances_.push(relevance))) {
+      LOG_WARN("failed to push relevance to top-k heap", K(ret));
+    }
+  } else if (relevance > topk_relevances_.top()) {
+    if (OB_FAIL(topk_relevances_.replace_top(relevance))) {
+      LOG_WARN("failed to replace top of top-k heap", K(ret));
+    }
+  }
+  return ret;
+}
+
 int ObDASTextRetrievalMergeIter::project_result(const ObIRIterLoserTreeItem &item, const double relevance)
 {
   int ret = OB_SUCCESS;
@@ -15,6 +15,7 @@
 
 #include "ob_das_iter.h"
 #include "lib/container/ob_loser_tree.h"
+#include "lib/container/ob_heap.h"
 
 namespace oceanbase
 {
@@ -52,6 +53,14 @@ private:
 };
 typedef common::ObLoserTree<ObIRIterLoserTreeItem, ObIRIterLoserTreeCmp, OB_MAX_TEXT_RETRIEVAL_TOKEN_CNT> ObIRIterLoserTree;
 
+// min heap of the relevance of the best documents found so far
+struct ObIRTopKRelevanceCmp
+{
+  bool operator()(const double l, const double r) const { return l > r; }
+  int get_error_code() const { return common::OB_SUCCESS; }
+};
+typedef common::ObBinaryHeap<double, ObIRTopKRelevanceCmp, 16> ObIRTopKRelevanceHeap;
+
 
 
 struct ObDASTextRetrievalMergeIterParam : public ObDASIterParam
@@ -107,6 +116,8 @@ public:
   int set_related_tablet_ids(const ObLSID &ls_id, const ObDASRelatedTabletID &related_tablet_ids);
   int set_merge_iters(const ObIArray<ObDASIter *> &retrieval_iters);
   const ObIArray<ObString> &get_query_tokens() { return query_tokens_; }
+  // the parent sorts the documents by relevance and keeps @topk_limit of them
+  void set_topk_limit(const int64_t topk_limit) { topk_limit_ = topk_limit; }
 protected:
   virtual int inner_init(ObDASIterParam &param) override;
   virtual int inner_reuse() override;
@@ -127,6 +138,15 @@ private:
       const int64_t iter_idx,
       ObIRIterLoserTreeItem &item);
   int next_disjunctive_document();
+  // top-k retrieval with dynamic pruning (WAND): the relevance of a token in any document
+  // is bounded by its query token weight, so documents whose bound sum can not exceed the
+  // relevance of the k-th best document are skipped without reading their postings.
+  OB_INLINE bool need_topk_pruning() const { return topk_limit_ > 0 && INT64_MAX != topk_limit_; }
+  int init_topk_cursors();
+  int next_topk_document(double &relevance);
+  int advance_topk_cursor(const int64_t iter_idx, const ObDocId *target_doc_id);
+  void sort_topk_cursors();
+  int update_topk_threshold(const double relevance);
   int init_total_doc_cnt_param(transaction::ObTxDesc *tx_desc, transaction::ObTxReadSnapshot *snapshot);
   int do_total_doc_cnt();
   int project_result(const ObIRIterLoserTreeItem &item, const double relevance);
@@ -153,6 +173,15 @@ private:
   ObDASScanIter *whole_doc_cnt_iter_;
   ObTableScanParam whole_doc_agg_param_;
   common::ObLimitParam limit_param_;
+  ObIRTopKRelevanceCmp topk_relevance_cmp_;
+  ObIRTopKRelevanceHeap topk_relevances_;
+  ObFixedArray<ObIRIterLoserTreeItem, ObIAllocator> topk_cursors_;
+  ObFixedArray<double, ObIAllocator> token_max_relevances_;
+  // token iters not reaching the end, in the order of their current doc id
+  ObFixedArray<int64_t, ObIAllocator> topk_cursor_order_;
+  int64_t topk_limit_;
+  int64_t topk_cursor_cnt_;
+  bool topk_cursor_inited_;
   int64_t input_row_cnt_;
   int64_t output_row_cnt_;
   bool doc_cnt_calculated_;
@@ -40,6 +40,9 @@ public:
   bool need_proj_relevance_score() const { return nullptr != relevance_proj_col_; }
   bool need_fwd_idx_agg() const { return has_fwd_agg_ && need_calc_relevance(); }
   bool need_inv_idx_agg() const { return has_inv_agg_ && need_calc_relevance(); }
+  // results are sorted by relevance in descending order with a limit above the retrieval,
+  // so documents that can not enter the top-k are allowed to be skipped
+  bool need_topk_pruning() const { return has_relevance_topk_ && need_calc_relevance(); }
   const ObDASScanCtDef *get_inv_idx_scan_ctdef() const
   {
     const ObDASScanCtDef *idx_scan_ctdef = nullptr;
@@ -115,7 +118,8 @@ public:
       uint8_t has_inv_agg_:1;
       uint8_t has_doc_id_agg_:1;
       uint8_t has_fwd_agg_:1;
-      uint8_t reserved_:5;
+      uint8_t has_relevance_topk_:1;
+      uint8_t reserved_:4;
     };
   };
 };
@@ -19,7 +19,8 @@ namespace sql
 {
 
 OB_SERIALIZE_MEMBER((ObDASVecAuxScanCtDef, ObDASAttachCtDef),
-                    inv_scan_vec_id_col_, vec_index_param_, dim_);
+                    inv_scan_vec_id_col_, vec_index_param_, dim_,
+                    row_count_, selectivity_);
 OB_SERIALIZE_MEMBER(ObDASVecAuxScanRtDef);
 
 } // sql
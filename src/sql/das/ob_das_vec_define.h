@@ -36,7 +36,9 @@ public:
     : ObDASAttachCtDef(alloc, DAS_OP_VEC_SCAN),
       inv_scan_vec_id_col_(nullptr),
       vec_index_param_(),
-      dim_(0)
+      dim_(0),
+      row_count_(0),
+      selectivity_(1.0)
   {
   }
   const ObDASScanCtDef *get_inv_idx_scan_ctdef() const
@@ -105,11 +107,15 @@ public:
   int64_t get_com_aux_tbl_idx() const { return ObVecAuxTableIdx::COM_AUX_TBL_IDX; }
 
   INHERIT_TO_STRING_KV("ObDASBaseCtDef", ObDASBaseCtDef,
-                       KPC_(inv_scan_vec_id_col), K_(vec_index_param), K_(dim));
+                       KPC_(inv_scan_vec_id_col), K_(vec_index_param), K_(dim),
+                       K_(row_count), K_(selectivity));
 
   ObExpr *inv_scan_vec_id_col_;
   ObString vec_index_param_;
   int64_t dim_;
+  // optimizer estimation of the main table, used to choose pre-filter or post-filter
+  int64_t row_count_;
+  double selectivity_; // selectivity of the filters of the main table lookup
 };
 
 struct ObDASVecAuxScanRtDef : ObDASAttachRtDef
@@ -92,6 +92,8 @@ int ObVectorIndexLookupOp::init(const ObDASBaseCtDef *table_lookup_ctdef,
       com_aux_vec_ctdef_ = vir_scan_ctdef->get_com_aux_tbl_ctdef();
       com_aux_vec_rtdef_ = vir_scan_rtdef->get_com_aux_tbl_rtdef();
       set_dim(vir_scan_ctdef->dim_);
+      prefilter_row_count_ = vir_scan_ctdef->row_count_;
+      prefilter_selectivity_ = vir_scan_ctdef->selectivity_;
       if (DAS_OP_SORT == aux_lookup_ctdef->get_doc_id_scan_ctdef()->op_type_) {
         sort_ctdef_ = static_cast<const ObDASSortCtDef *>(aux_lookup_ctdef->get_doc_id_scan_ctdef());
         sort_rtdef_ = static_cast<ObDASSortRtDef *>(aux_lookup_rtdef->get_doc_id_scan_rtdef());
@@ -680,11 +682,11 @@ int ObVectorIndexLookupOp::prepare_state(const ObVidAdaLookupStatus& cur_state,
       }
       break;
     }
-    case ObVidAdaLookupStatus::QUERY_ROWKEY_VEC: {
+    case ObVidAdaLookupStatus::QUERY_ROWKEY_VEC:
+    case ObVidAdaLookupStatus::QUERY_REFINE_VEC: {
       ObObj *vectors = nullptr;
       ObSEArray<uint64_t, 1> vector_column_ids;
       int64_t dim = ada_ctx.get_dim();
-      int64_t res_count = 0;
       int64_t count = ada_ctx.get_count();
 
       if (OB_ISNULL(vectors = ada_ctx.get_vids())) {
@@ -726,8 +728,10 @@ int ObVectorIndexLookupOp::prepare_state(const ObVidAdaLookupStatus& cur_state,
                                                                             com_aux_vec_ctdef_->result_output_.at(0)->obj_meta_.has_lob_header(),
                                                                             vector))) {
             LOG_WARN("failed to get real data.", K(ret));
+          } else if (OB_FAIL(ada_ctx.set_vector(i, vector.ptr(), vector.length()))) {
+            // keep the vector aligned with its vid, the vid without vector is skipped by the consumer
+            LOG_WARN("failed to set vector.", K(ret), K(i));
           } else {
-            ada_ctx.set_vector(res_count++, vector.ptr(), vector.length());
             doc_id_scan_param_.key_ranges_.reset();
             com_aux_vec_scan_param_.key_ranges_.reset();
           }
@@ -853,6 +857,15 @@ int ObVectorIndexLookupOp::call_pva_interface(const ObVidAdaLookupStatus& cur_st
       }
       break;
     }
+    case ObVidAdaLookupStatus::QUERY_REFINE_VEC: {
+      ObVectorQueryConditions query_cond;
+      if (OB_FAIL(set_vector_query_condition(query_cond))) {
+        LOG_WARN("fail to set query condition.", K(ret));
+      } else if (OB_FAIL(adaptor.refine_result(&ada_ctx, &query_cond, adaptor_vid_iter_))) {
+        LOG_WARN("fail to refine result.", K(ret));
+      }
+      break;
+    }
     default: {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("unexpected status.", K(ret));
@@ -887,6 +900,8 @@ int ObVectorIndexLookupOp::process_adaptor_state()
     if (OB_ISNULL(adaptor)) {
       ret = OB_BAD_NULL_ERROR;
       LOG_WARN("shouldn't be null.", K(ret));
+    } else if (need_prefilter() && OB_FAIL(build_filter_bitmap())) {
+      LOG_WARN("failed to build filter bitmap", K(ret));
     } else {
       while (OB_SUCC(ret) && is_continue) {
         if (last_state != cur_state && OB_FAIL(prepare_state(cur_state, ada_ctx))) {
@@ -900,9 +915,228 @@ int ObVectorIndexLookupOp::process_adaptor_state()
       }
     }
   }
+  free_filter_bitmap();
+  return ret;
+}
+
+bool ObVectorIndexLookupOp::need_prefilter() const
+{
+  bool bret = nullptr != lookup_ctdef_ && nullptr != doc_id_lookup_ctdef_
+              && !lookup_ctdef_->pd_expr_spec_.pushdown_filters_.empty()
+              && !lookup_ctdef_->rowkey_exprs_.empty()
+              && prefilter_row_count_ > 0
+              && prefilter_row_count_ <= PREFILTER_MAX_ROW_CNT
+              && prefilter_selectivity_ * 100 <= PREFILTER_MAX_PASS_PERCENT;
+  // the passed rows are mapped back to their vids by the rowkey of the main table
+  for (int64_t i = 0; bret && i < lookup_ctdef_->rowkey_exprs_.count(); ++i) {
+    bret = has_exist_in_array(lookup_ctdef_->result_output_, lookup_ctdef_->rowkey_exprs_.at(i));
+  }
+  return bret;
+}
+
+int ObVectorIndexLookupOp::init_filter_vid_scan_param()
+{
+  int ret = OB_SUCCESS;
+  ObNewRange scan_range;
+  if (OB_FAIL(set_doc_id_idx_lookup_param(doc_id_lookup_ctdef_, doc_id_lookup_rtdef_,
+                                          filter_vid_scan_param_, doc_id_idx_tablet_id_, ls_id_))) {
+    LOG_WARN("failed to init filter vid scan param", K(ret));
+  } else if (FALSE_IT(filter_vid_scan_param_.is_get_ = false)) {
+  } else if (OB_FAIL(gen_scan_range(FILTER_VID_PRI_KEY_CNT, doc_id_lookup_ctdef_->ref_table_id_, scan_range))) {
+    LOG_WARN("failed to generate filter vid scan range", K(ret));
+  } else if (OB_FAIL(filter_vid_scan_param_.key_ranges_.push_back(scan_range))) {
+    LOG_WARN("failed to append scan range", K(ret));
+  }
+  return ret;
+}
+
+int ObVectorIndexLookupOp::get_filter_vid_expr(ObExpr *&vid_expr)
+{
+  int ret = OB_SUCCESS;
+  // the vid rowkey table is accessed with the vid and the main table rowkey,
+  // only the rowkey is in the result output
+  const ExprFixedArray &access_exprs = doc_id_lookup_ctdef_->pd_expr_spec_.access_exprs_;
+  vid_expr = nullptr;
+  for (int64_t i = 0; OB_ISNULL(vid_expr) && i < access_exprs.count(); ++i) {
+    if (!has_exist_in_array(doc_id_lookup_ctdef_->result_output_, access_exprs.at(i))) {
+      vid_expr = access_exprs.at(i);
+    }
+  }
+  if (OB_ISNULL(vid_expr)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("failed to find vid expr", K(ret), KPC(doc_id_lookup_ctdef_));
+  }
+  return ret;
+}
+
+int ObVectorIndexLookupOp::locate_lookup_range(int64_t &range_idx)
+{
+  int ret = OB_SUCCESS;
+  const ExprFixedArray &rowkey_exprs = lookup_ctdef_->rowkey_exprs_;
+  const int64_t range_cnt = scan_param_.key_ranges_.count();
+  common::ObArenaAllocator &lookup_alloc = lookup_memctx_->get_arena_allocator();
+  ObObj *obj_ptr = nullptr;
+  void *buf = nullptr;
+  if (OB_ISNULL(buf = lookup_alloc.alloc(sizeof(ObObj) * rowkey_exprs.count()))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("allocate memory failed", K(ret), K(rowkey_exprs.count()));
+  } else {
+    obj_ptr = new (buf) ObObj[rowkey_exprs.count()];
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < rowkey_exprs.count(); ++i) {
+    ObExpr *expr = rowkey_exprs.at(i);
+    ObDatum &col_datum = expr->locate_expr_datum(*lookup_rtdef_->eval_ctx_);
+    if (OB_FAIL(col_datum.to_obj(obj_ptr[i], expr->obj_meta_, expr->obj_datum_map_))) {
+      LOG_WARN("convert datum to obj failed", K(ret));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    // the multi-get returns the passed rows in the order of the lookup ranges, so the search
+    // starts from the range of the last passed row and wraps around only if the order differs
+    ObRowkey row_rowkey(obj_ptr, rowkey_exprs.count());
+    bool is_equal = false;
+    for (int64_t i = 0; OB_SUCC(ret) && !is_equal && i < range_cnt; ++i) {
+      const int64_t idx = (range_idx + i) % range_cnt;
+      if (OB_FAIL(scan_param_.key_ranges_.at(idx).start_key_.equal(row_rowkey, is_equal))) {
+        LOG_WARN("failed to compare rowkey", K(ret), K(row_rowkey), K(idx));
+      } else if (is_equal) {
+        range_idx = idx;
+      }
+    }
+    if (OB_SUCC(ret) && !is_equal) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("main table row doesn't belong to any lookup range", K(ret), K(row_rowkey), K(range_cnt));
+    }
+  }
   return ret;
 }
 
+int ObVectorIndexLookupOp::add_filter_passed_vids(const ObIArray<uint64_t> &batch_vids, int64_t &pass_cnt)
+{
+  int ret = OB_SUCCESS;
+  int64_t range_idx = 0;
+  if (OB_UNLIKELY(batch_vids.count() != scan_param_.key_ranges_.count())) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("vid count mismatch lookup range count", K(ret), K(batch_vids.count()),
+             K(scan_param_.key_ranges_.count()));
+  } else if (OB_FAIL(do_index_lookup())) {
+    LOG_WARN("failed to do index lookup", K(ret));
+  }
+  // only the rows passing the pushdown filters of the main table are returned
+  while (OB_SUCC(ret)) {
+    if (OB_FAIL(get_next_row_from_data_table())) {
+      if (OB_ITER_END != ret) {
+        LOG_WARN("failed to get next row from data table", K(ret));
+      }
+    } else if (OB_FAIL(locate_lookup_range(range_idx))) {
+      LOG_WARN("failed to locate lookup range", K(ret));
+    } else {
+      roaring64_bitmap_add(filter_bitmap_, batch_vids.at(range_idx));
+      ++pass_cnt;
+    }
+  }
+  if (OB_ITER_END == ret) {
+    ret = OB_SUCCESS;
+  }
+  return ret;
+}
+
+int ObVectorIndexLookupOp::build_filter_bitmap()
+{
+  int ret = OB_SUCCESS;
+  ObITabletScan &tsc_service = get_tsc_service();
+  ObExpr *vid_expr = nullptr;
+  ObSEArray<uint64_t, PREFILTER_BATCH_SIZE> batch_vids;
+  int64_t scan_cnt = 0;
+  int64_t pass_cnt = 0;
+  bool is_iter_end = false;
+  filter_max_vid_ = 0;
+  if (OB_FAIL(get_filter_vid_expr(vid_expr))) {
+    LOG_WARN("failed to get filter vid expr", K(ret));
+  } else if (OB_ISNULL(filter_bitmap_ = roaring::api::roaring64_bitmap_create())) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("failed to create filter bitmap", K(ret));
+  } else if (nullptr == filter_vid_iter_) {
+    filter_vid_scan_param_.need_switch_param_ = false;
+    if (OB_FAIL(init_filter_vid_scan_param())) {
+      LOG_WARN("failed to init filter vid scan param", K(ret));
+    } else if (OB_FAIL(tsc_service.table_scan(filter_vid_scan_param_, filter_vid_iter_))) {
+      if (OB_SNAPSHOT_DISCARDED == ret && filter_vid_scan_param_.fb_snapshot_.is_valid()) {
+        ret = OB_INVALID_QUERY_TIMESTAMP;
+      } else if (OB_TRY_LOCK_ROW_CONFLICT != ret) {
+        LOG_WARN("fail to scan table", K(filter_vid_scan_param_), K(ret));
+      }
+    }
+  } else {
+    const ObTabletID &scan_tablet_id = filter_vid_scan_param_.tablet_id_;
+    filter_vid_scan_param_.need_switch_param_ = scan_tablet_id.is_valid() && (doc_id_idx_tablet_id_ != scan_tablet_id);
+    filter_vid_scan_param_.tablet_id_ = doc_id_idx_tablet_id_;
+    filter_vid_scan_param_.ls_id_ = ls_id_;
+    if (OB_FAIL(tsc_service.reuse_scan_iter(filter_vid_scan_param_.need_switch_param_, filter_vid_iter_))) {
+      LOG_WARN("failed to reuse filter vid iterator", K(ret));
+    } else if (OB_FAIL(tsc_service.table_rescan(filter_vid_scan_param_, filter_vid_iter_))) {
+      LOG_WARN("failed to rescan filter vid table", K(ret), K_(doc_id_idx_tablet_id), K(scan_tablet_id));
+    }
+  }
+
+  // the vid rowkey table is scanned in batches, the rowkeys of a batch are looked up
+  // in the main table by one multi-get evaluating the pushdown filters
+  while (OB_SUCC(ret) && !is_iter_end) {
+    batch_vids.reuse();
+    scan_param_.key_ranges_.reuse();
+    scan_param_.ss_key_ranges_.reuse();
+    if (nullptr != lookup_memctx_) {
+      lookup_memctx_->reset_remain_one_page();
+    }
+    while (OB_SUCC(ret) && !is_iter_end && batch_vids.count() < PREFILTER_BATCH_SIZE) {
+      doc_id_lookup_rtdef_->p_pd_expr_op_->clear_evaluated_flag();
+      if (OB_FAIL(filter_vid_iter_->get_next_row())) {
+        if (OB_ITER_END != ret) {
+          LOG_WARN("failed to get next row from filter vid iter", K(ret));
+        } else {
+          ret = OB_SUCCESS;
+          is_iter_end = true;
+        }
+      } else {
+        const uint64_t vid = vid_expr->locate_expr_datum(*doc_id_lookup_rtdef_->eval_ctx_).get_int();
+        filter_max_vid_ = MAX(filter_max_vid_, vid);
+        if (OB_FAIL(set_main_table_lookup_key())) {
+          LOG_WARN("failed to set main table lookup key", K(ret), K(vid));
+        } else if (OB_FAIL(batch_vids.push_back(vid))) {
+          LOG_WARN("failed to push back vid", K(ret), K(vid));
+        }
+      }
+    }
+    if (OB_FAIL(ret) || batch_vids.empty()) {
+    } else if (OB_FAIL(add_filter_passed_vids(batch_vids, pass_cnt))) {
+      LOG_WARN("failed to add filter passed vids", K(ret), K(batch_vids.count()));
+    } else {
+      scan_cnt += batch_vids.count();
+    }
+  }
+  // the lookup ranges are rebuilt for the vids returned by the adaptor
+  scan_param_.key_ranges_.reuse();
+  scan_param_.ss_key_ranges_.reuse();
+  if (nullptr != lookup_memctx_) {
+    lookup_memctx_->reset_remain_one_page();
+  }
+  LOG_TRACE("build filter bitmap", K(ret), K(scan_cnt), K(pass_cnt), K_(filter_max_vid),
+            K_(prefilter_row_count), K_(prefilter_selectivity));
+  if (OB_FAIL(ret)) {
+    free_filter_bitmap();
+  }
+  return ret;
+}
+
+void ObVectorIndexLookupOp::free_filter_bitmap()
+{
+  if (OB_NOT_NULL(filter_bitmap_)) {
+    roaring::api::roaring64_bitmap_free(filter_bitmap_);
+    filter_bitmap_ = nullptr;
+  }
+  filter_max_vid_ = 0;
+}
+
 int ObVectorIndexLookupOp::next_state(ObVidAdaLookupStatus& cur_state,
                                       ObVectorQueryAdaptorResultContext& ada_ctx,
                                       bool& is_continue)
@@ -977,6 +1211,15 @@ int ObVectorIndexLookupOp::next_state(ObVidAdaLookupStatus& cur_state,
       break;
     }
     case ObVidAdaLookupStatus::STATES_END: {
+      if (ada_ctx.get_status() == PluginVectorQueryResStatus::PVQ_REFINE) {
+        cur_state = ObVidAdaLookupStatus::QUERY_REFINE_VEC;
+        is_continue = true;
+      } else {
+        is_continue = false;
+      }
+      break;
+    }
+    case ObVidAdaLookupStatus::QUERY_REFINE_VEC: {
       is_continue = false;
       break;
     }
@@ -1204,6 +1447,13 @@ int ObVectorIndexLookupOp::revert_iter()
     com_aux_vec_scan_param_.~ObTableScanParam();
   }
 
+  if (OB_NOT_NULL(doc_id_lookup_rtdef_)) {
+    filter_vid_scan_param_.need_switch_param_ = false;
+    filter_vid_scan_param_.destroy_schema_guard();
+    filter_vid_scan_param_.~ObTableScanParam();
+  }
+  free_filter_bitmap();
+
   if (OB_FAIL(tsc_service.revert_scan_iter(delta_buf_iter_))) {
     LOG_WARN("revert scan iterator failed", K(ret));
   } else if (OB_FAIL(tsc_service.revert_scan_iter(index_id_iter_))) {
@@ -1212,11 +1462,14 @@ int ObVectorIndexLookupOp::revert_iter()
     LOG_WARN("revert scan iterator failed", K(ret));
   } else if (OB_FAIL(tsc_service.revert_scan_iter(aux_lookup_iter_))) {
     LOG_WARN("revert index table scan iterator (opened by dasop) failed", K(ret));
+  } else if (OB_FAIL(tsc_service.revert_scan_iter(filter_vid_iter_))) {
+    LOG_WARN("revert filter vid scan iterator failed", K(ret));
   } else {
     delta_buf_iter_ = nullptr;
     index_id_iter_ = nullptr;
     snapshot_iter_ = nullptr;
     aux_lookup_iter_ = nullptr;
+    filter_vid_iter_ = nullptr;
     if (OB_FAIL(ObDomainIndexLookupOp::revert_iter())) {
       LOG_WARN("failed to revert local index lookup op iter", K(ret));
     }
@@ -1235,6 +1488,8 @@ int ObVectorIndexLookupOp::set_vector_query_condition(ObVectorQueryConditions &q
     query_cond.query_order_ = true;
     query_cond.row_iter_ = snapshot_iter_;
     query_cond.query_scn_ = snapshot_scan_param_.snapshot_.core_.version_;
+    query_cond.filter_bitmap_ = filter_bitmap_;
+    query_cond.filter_max_vid_ = filter_max_vid_;
     ObSQLSessionInfo *session = nullptr;
     uint64_t ob_hnsw_ef_search = 0;
     ObDatum *vec_datum = NULL;
@@ -25,6 +25,7 @@ enum ObVidAdaLookupStatus
   QUERY_SNAPSHOT_TBL,
   QUERY_ROWKEY_VEC,
   STATES_END,
+  QUERY_REFINE_VEC, // fetch the full vectors of the quantized ivf candidates to re-rank
   STATES_ERROR
 };
 
@@ -55,6 +56,12 @@ public:
     snapshot_rtdef_(nullptr),
     com_aux_vec_ctdef_(nullptr),
     com_aux_vec_rtdef_(nullptr),
+    filter_vid_scan_param_(),
+    filter_vid_iter_(nullptr),
+    filter_bitmap_(nullptr),
+    filter_max_vid_(0),
+    prefilter_row_count_(0),
+    prefilter_selectivity_(1.0),
     vec_eval_ctx_(nullptr),
     limit_param_(),
     sort_ctdef_(nullptr),
@@ -134,11 +141,27 @@ private:
                                       bool reverse_order = false);
   int gen_scan_range(const int64_t obj_cnt, common::ObTableID table_id, ObNewRange &scan_range);
   int set_vector_query_condition(ObVectorQueryConditions &query_cond);
+  // pre-filter: collect the vids of the rows passing the filters of the main table lookup
+  bool need_prefilter() const;
+  int init_filter_vid_scan_param();
+  int get_filter_vid_expr(ObExpr *&vid_expr);
+  int add_filter_passed_vids(const ObIArray<uint64_t> &batch_vids, int64_t &pass_cnt);
+  int locate_lookup_range(int64_t &range_idx);
+  int build_filter_bitmap();
+  void free_filter_bitmap();
 private:
   static const int64_t DELTA_BUF_PRI_KEY_CNT = 2;
   static const int64_t INDEX_ID_PRI_KEY_CNT = 3;
   static const int64_t SNAPSHOT_PRI_KEY_CNT = 1;
   static const uint64_t MAX_VSAG_QUERY_RES_SIZE = 16384;
+  static const int64_t FILTER_VID_PRI_KEY_CNT = 1;
+  // the pre-filter is chosen only if the optimizer estimates at most PREFILTER_MAX_PASS_PERCENT
+  // of the rows pass the filters, the post-filter loses little otherwise. building the bitmap scans
+  // the whole vid rowkey table, so tables larger than PREFILTER_MAX_ROW_CNT are post-filtered
+  static const int64_t PREFILTER_MAX_PASS_PERCENT = 20;
+  static const int64_t PREFILTER_MAX_ROW_CNT = 1L << 20;
+  // the rowkeys of PREFILTER_BATCH_SIZE vids are looked up in the main table by one multi-get
+  static const int64_t PREFILTER_BATCH_SIZE = 256;
 private:
   common::ObNewRowIterator *aux_lookup_iter_;
   ObVectorQueryVidIterator* adaptor_vid_iter_;
@@ -167,6 +190,13 @@ private:
   ObDASScanRtDef *snapshot_rtdef_;
   const ObDASScanCtDef *com_aux_vec_ctdef_;
   ObDASScanRtDef *com_aux_vec_rtdef_;
+  // vid rowkey table scan for the pre-filter
+  ObTableScanParam filter_vid_scan_param_;
+  common::ObNewRowIterator *filter_vid_iter_;
+  roaring::api::roaring64_bitmap_t *filter_bitmap_;
+  uint64_t filter_max_vid_;
+  int64_t prefilter_row_count_;
+  double prefilter_selectivity_;
   ObEvalCtx *vec_eval_ctx_;
   common::ObLimitParam limit_param_;
   const ObDASSortCtDef *sort_ctdef_;
@@ -9010,7 +9010,8 @@ int ObAggregateProcessor::get_rb_build_agg_result(const ObAggrInfo &aggr_info,
     const ObChunkDatumStore::StoredRow *storted_row = NULL;
     bool inited_tmp_obj = false;
     ObObj *tmp_obj = NULL;
-    ObRoaringBitmap *rb = NULL;
+    ObRoaringBitmapLazyUnion rb_union(&tmp_alloc);
+    bool has_value = false;
 
     while (OB_SUCC(ret) && OB_SUCC(extra->get_next_row(storted_row))) {
       if (OB_ISNULL(storted_row)) {
@@ -9048,25 +9049,26 @@ int ObAggregateProcessor::get_rb_build_agg_result(const ObAggrInfo &aggr_info,
           LOG_WARN("invalid data type for roaringbitmap build agg");
         }
         if (OB_FAIL(ret) || is_null_val) {
-        } else if (OB_ISNULL(rb) && OB_ISNULL(rb = OB_NEWx(ObRoaringBitmap, &tmp_alloc, (&tmp_alloc)))) {
-          ret = OB_ALLOCATE_MEMORY_FAILED;
-          LOG_WARN("failed to create alloc memory to roaringbitmap", K(ret));
-        } else if (OB_FAIL(rb->value_add(val))) {
+        } else if (OB_FAIL(rb_union.value_add(val))) {
           LOG_WARN("failed to add value to roaringbitmap", K(ret), K(tmp_obj->get_uint64()));
+        } else {
+          has_value = true;
         }
       }
     }//end of while
 
     if (ret != OB_ITER_END && ret != OB_SUCCESS) {
       LOG_WARN("fail to get next row", K(ret));
-    } else if (OB_ISNULL(rb)) {
+    } else if (!has_value) {
       ret = OB_SUCCESS;
       concat_result.set_null();
     } else {
       ret = OB_SUCCESS;
       ObString rb_bin;
-      if (OB_FAIL(ObRbUtils::rb_serialize(tmp_alloc, rb_bin, rb))) {
+      ObStringBuffer rb_buf(&tmp_alloc);
+      if (OB_FAIL(rb_union.serialize(rb_buf))) {
         LOG_WARN("failed to serialize roaringbitmap", K(ret));
+      } else if (OB_FALSE_IT(rb_bin.assign_ptr(rb_buf.ptr(), rb_buf.length()))) {
       } else {
         ObString blob_locator;
         ObExprStrResAlloc expr_res_alloc(*aggr_info.expr_, eval_ctx_);
@@ -9083,7 +9085,6 @@ int ObAggregateProcessor::get_rb_build_agg_result(const ObAggrInfo &aggr_info,
         }
       }
     }
-    ObRbUtils::rb_destroy(rb);
   }
   return ret;
 }
@@ -9109,6 +9110,9 @@ int ObAggregateProcessor::get_rb_calc_agg_result(const ObAggrInfo &aggr_info,
     bool inited_tmp_obj = false;
     ObObj *tmp_obj = NULL;
     ObRoaringBitmap *rb = NULL;
+    // rb_or_agg merges the binaries into a lazy union instead of deserializing every row
+    ObRoaringBitmapLazyUnion rb_union(&tmp_alloc);
+    bool has_union_value = false;
     bool calc_finished = false;
 
     while (OB_SUCC(ret) && !calc_finished && OB_SUCC(extra->get_next_row(storted_row))) {
@@ -9144,6 +9148,12 @@ int ObAggregateProcessor::get_rb_calc_agg_result(const ObAggrInfo &aggr_info,
         }
 
         if (OB_FAIL(ret) || is_null_obj) {
+        } else if (ObRbOperation::OR == calc_op) {
+          if (OB_FAIL(rb_union.value_or(tmp_rb_bin))) {
+            LOG_WARN("failed to union roaringbitmap", K(ret));
+          } else {
+            has_union_value = true;
+          }
         } else if (OB_ISNULL(rb)) {
           if (OB_FAIL(ObRbUtils::rb_deserialize(tmp_alloc, tmp_rb_bin, rb))) {
             LOG_WARN("failed to deserialize roaringbitmap", K(ret));
@@ -9166,14 +9176,23 @@ int ObAggregateProcessor::get_rb_calc_agg_result(const ObAggrInfo &aggr_info,
 
     if (ret != OB_ITER_END && ret != OB_SUCCESS) {
       LOG_WARN("fail to get next row", K(ret));
-    } else if (OB_ISNULL(rb)) {
+    } else if (OB_ISNULL(rb) && !has_union_value) {
       ret = OB_SUCCESS;
       concat_result.set_null();
     } else {
       ret = OB_SUCCESS;
       ObString rb_bin;
-      if (OB_FAIL(ObRbUtils::rb_serialize(tmp_alloc, rb_bin, rb))) {
+      ObStringBuffer rb_buf(&tmp_alloc);
+      if (has_union_value) {
+        if (OB_FAIL(rb_union.serialize(rb_buf))) {
+          LOG_WARN("failed to serialize roaringbitmap", K(ret));
+        } else {
+          rb_bin.assign_ptr(rb_buf.ptr(), rb_buf.length());
+        }
+      } else if (OB_FAIL(ObRbUtils::rb_serialize(tmp_alloc, rb_bin, rb))) {
         LOG_WARN("failed to serialize roaringbitmap", K(ret));
+      }
+      if (OB_FAIL(ret)) {
       } else {
         ObString blob_locator;
         ObExprStrResAlloc expr_res_alloc(*aggr_info.expr_, eval_ctx_);
@@ -49,6 +49,12 @@ public:
       ObExpr &rt_expr) const override;
 
   static int eval_bm25_relevance_expr(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+  // relevance of a query token in any document is less than its query token weight,
+  // since the document token weight saturates below 1 as the token frequency grows
+  static double relevance_upper_bound(const int64_t token_doc_cnt, const int64_t total_doc_cnt)
+  {
+    return query_token_weight(token_doc_cnt, total_doc_cnt);
+  }
 public:
   static constexpr int TOKEN_DOC_CNT_PARAM_IDX = 0;
   static constexpr int TOTAL_DOC_CNT_PARAM_IDX = 1;
@@ -351,7 +351,7 @@ int ObExprConcat::calc_result_typeN(ObExprResType &type,
   return ret;
 }
 
-int ObExprConcat::cg_expr(ObExprCGCtx &, const ObRawExpr &, ObExpr &expr) const
+int ObExprConcat::cg_expr(ObExprCGCtx &, const ObRawExpr &raw_expr, ObExpr &expr) const
 {
   int ret = OB_SUCCESS;
   CK(expr.arg_cnt_ > 0);
@@ -360,6 +360,79 @@ int ObExprConcat::cg_expr(ObExprCGCtx &, const ObRawExpr &, ObExpr &expr) const
   }
   if (OB_SUCC(ret)) {
     expr.eval_func_ = &eval_concat;
+    // the first param must not be casted, it should still be the persist lob of the updated column
+    const ObRawExpr *first_param = raw_expr.get_param_expr(0);
+    if ((raw_expr.get_extra() & OB_LOB_PARTIAL_APPEND_ALLOW) != 0
+        && OB_NOT_NULL(first_param)
+        && first_param->is_column_ref_expr()
+        && first_param->get_data_type() == raw_expr.get_data_type()
+        && first_param->get_collation_type() == raw_expr.get_collation_type()) {
+      expr.extra_ = OB_LOB_PARTIAL_APPEND_ALLOW;
+    }
+  }
+  return ret;
+}
+
+// update t set c = concat(c, ...): c is a persist outrow lob, only the appended data is packed
+// into an append delta lob, storage appends it to c instead of rewriting the whole lob.
+static int eval_concat_lob_append(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_datum,
+                                  const int64_t res_len, bool &is_append)
+{
+  int ret = OB_SUCCESS;
+  is_append = false;
+  ObDatum &persist_datum = expr.locate_param_datum(ctx, 0);
+  ObLobLocatorV2 persist_lob(persist_datum.get_string(), expr.args_[0]->obj_meta_.has_lob_header());
+  int64_t persist_byte_len = 0;
+  if ((expr.extra_ & OB_LOB_PARTIAL_APPEND_ALLOW) == 0 || persist_datum.is_null()) {
+  } else if (!persist_lob.is_valid() || !persist_lob.is_persist_lob() || persist_lob.is_inrow()) {
+  } else if (OB_FAIL(persist_lob.get_lob_data_byte_len(persist_byte_len))) {
+    LOG_WARN("get lob data byte length failed", K(ret), K(persist_lob));
+  } else if (OB_UNLIKELY(persist_byte_len > res_len)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("invalid result length", K(ret), K(persist_byte_len), K(res_len));
+  } else {
+    ObEvalCtx::TempAllocGuard alloc_guard(ctx);
+    ObIAllocator &calc_alloc = alloc_guard.get_allocator();
+    const int64_t append_len = res_len - persist_byte_len;
+    char *append_buf = nullptr;
+    int64_t off = 0;
+    if (append_len > 0 && OB_ISNULL(append_buf = static_cast<char *>(calc_alloc.alloc(append_len)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("allocate memory failed", K(ret), K(append_len));
+    }
+    for (int64_t i = 1; OB_SUCC(ret) && i < expr.arg_cnt_; i++) {
+      ObDatum &v = expr.locate_param_datum(ctx, i);
+      ObDatumMeta input_meta = expr.args_[i]->datum_meta_;
+      bool has_lob_header = expr.args_[i]->obj_meta_.has_lob_header();
+      ObTextStringIter input_iter(input_meta.type_, input_meta.cs_type_, v.get_string(), has_lob_header);
+      ObString data;
+      if (OB_FAIL(input_iter.init(0, NULL, &calc_alloc))) {
+        LOG_WARN("init input_iter failed ", K(ret), K(input_iter));
+      } else if (OB_FAIL(input_iter.get_full_data(data))) {
+        LOG_WARN("get full data failed", K(ret), K(input_iter));
+      } else if (OB_UNLIKELY(off + data.length() > append_len)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("append data overflow", K(ret), K(off), K(data.length()), K(append_len));
+      } else if (data.length() > 0) {
+        MEMCPY(append_buf + off, data.ptr(), data.length());
+        off += data.length();
+      }
+    }
+    if (OB_SUCC(ret)) {
+      ObLobAppendDeltaLob delta_lob(persist_datum.get_string(), ObString(off, append_buf));
+      const int64_t res_buf_len = delta_lob.get_serialize_size();
+      char *res_buf = nullptr;
+      int64_t pos = 0;
+      if (OB_ISNULL(res_buf = expr.get_str_res_mem(ctx, res_buf_len))) {
+        ret = OB_ALLOCATE_MEMORY_FAILED;
+        LOG_WARN("alloc memory for delta lob locator fail", K(ret), K(res_buf_len));
+      } else if (OB_FAIL(delta_lob.serialize(res_buf, res_buf_len, pos))) {
+        LOG_WARN("serialize append delta lob fail", K(ret), K(res_buf_len), K(delta_lob));
+      } else {
+        expr_datum.set_string(res_buf, res_buf_len);
+        is_append = true;
+      }
+    }
   }
   return ret;
 }
@@ -491,7 +564,12 @@ int ObExprConcat::eval_concat(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &expr_
       }
       expr_datum.set_string(buf, res_len);
     } else { // text tc
-      ret = eval_concat_text(expr, ctx, expr_datum, res_len);
+      bool is_append = false;
+      if (OB_FAIL(eval_concat_lob_append(expr, ctx, expr_datum, res_len, is_append))) {
+        LOG_WARN("eval concat lob append failed", K(ret), K(res_len));
+      } else if (!is_append) {
+        ret = eval_concat_text(expr, ctx, expr_datum, res_len);
+      }
     }
 
   }
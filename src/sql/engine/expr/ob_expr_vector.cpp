@@ -113,6 +113,7 @@ int ObExprVectorDistance::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &raw
 {
   int ret = OB_SUCCESS;
   rt_expr.eval_func_ = ObExprVectorDistance::calc_distance;
+  rt_expr.eval_vector_func_ = ObExprVectorDistance::calc_distance_vector;
   return ret;
 }
 
@@ -157,29 +158,139 @@ int ObExprVectorDistance::calc_distance(const ObExpr &expr, ObEvalCtx &ctx, ObDa
   } else if (OB_ISNULL(arr_l) || OB_ISNULL(arr_r)) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("unexpected nullptr", K(ret), K(arr_l), K(arr_r));
-  } else if (OB_UNLIKELY(arr_l->size() != arr_r->size())) {
+  } else {
+    double distance = 0.0;
+    bool is_null = false;
+    if (OB_FAIL(calc_array_distance(*arr_l, *arr_r, dis_type, distance, is_null))) {
+      LOG_WARN("failed to calc distance", K(ret), K(dis_type));
+    } else if (is_null) {
+      res_datum.set_null();
+    } else {
+      res_datum.set_double(distance);
+    }
+  }
+  return ret;
+}
+
+int ObExprVectorDistance::calc_array_distance(const ObIArrayType &arr_l, const ObIArrayType &arr_r,
+                                              const ObVecDisType dis_type, double &distance, bool &is_null)
+{
+  int ret = OB_SUCCESS;
+  is_null = false;
+  distance = 0.0;
+  if (OB_UNLIKELY(arr_l.size() != arr_r.size())) {
     ret = OB_ERR_INVALID_VECTOR_DIM;
-    LOG_WARN("check array validty failed", K(ret), K(arr_l->size()), K(arr_r->size()));
-  } else if (arr_l->contain_null() || arr_r->contain_null()) {
+    LOG_WARN("check array validty failed", K(ret), K(arr_l.size()), K(arr_r.size()));
+  } else if (arr_l.contain_null() || arr_r.contain_null()) {
     ret = OB_ERR_NULL_VALUE;
     LOG_WARN("array with null can't calculate vector distance", K(ret));
+  } else if (distance_funcs[dis_type] == nullptr) {
+    ret = OB_NOT_SUPPORTED;
+    LOG_WARN("not support", K(ret), K(dis_type));
+  } else if (OB_FAIL(distance_funcs[dis_type](reinterpret_cast<const float*>(arr_l.get_data()),
+                                              reinterpret_cast<const float*>(arr_r.get_data()),
+                                              arr_l.size(), distance))) {
+    if (OB_ERR_NULL_VALUE == ret) {
+      is_null = true;
+      ret = OB_SUCCESS; // ignore
+    } else {
+      LOG_WARN("failed to calc distance", K(ret), K(dis_type));
+    }
+  }
+  return ret;
+}
+
+// re-init the array object of the argument in place with the value of row idx
+int ObExprVectorDistance::get_vector_arg(ObExpr &arg, ObEvalCtx &ctx, ObIAllocator &allocator,
+                                         const int64_t idx, ObIArrayType &arr)
+{
+  int ret = OB_SUCCESS;
+  ObIVector *arg_vec = arg.get_vector(ctx);
+  if (VEC_UNIFORM == arg_vec->get_format() || VEC_UNIFORM_CONST == arg_vec->get_format()) {
+    ObString data = arg_vec->get_string(idx);
+    if (OB_FAIL(ObTextStringHelper::read_real_string_data(&allocator, ObLongTextType, CS_TYPE_BINARY,
+                                                          true, data))) {
+      LOG_WARN("fail to get real data", K(ret), K(data));
+    } else if (OB_FAIL(arr.init(data))) {
+      LOG_WARN("failed to init array", K(ret));
+    }
+  } else if (OB_FAIL(ObArrayExprUtils::assemble_array_attrs(ctx, arg, idx, &arr))) {
+    LOG_WARN("assemble array attrs failed", K(ret));
+  }
+  return ret;
+}
+
+int ObExprVectorDistance::calc_distance_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                               const ObBitVector &skip, const EvalBound &bound)
+{
+  return calc_distance_vector(expr, ctx, skip, bound, ObVecDisType::EUCLIDEAN); // default metric
+}
+
+// Brute force knn evaluates the distance of every row against the same query vector, so the
+// constant argument is decoded only once per batch. The array objects of both arguments are
+// constructed once per batch and re-initialized in place for each row, leaving the distance
+// kernel as the only per row work.
+int ObExprVectorDistance::calc_distance_vector(const ObExpr &expr, ObEvalCtx &ctx, const ObBitVector &skip,
+                                               const EvalBound &bound, ObVecDisType dis_type)
+{
+  int ret = OB_SUCCESS;
+  if (OB_FAIL(expr.args_[0]->eval_vector(ctx, skip, bound))
+      || OB_FAIL(expr.args_[1]->eval_vector(ctx, skip, bound))) {
+    LOG_WARN("failed to eval params", K(ret));
+  } else if (3 == expr.arg_cnt_ && OB_FAIL(expr.args_[2]->eval_vector(ctx, skip, bound))) {
+    LOG_WARN("failed to eval distance type", K(ret));
   } else {
-    double distance = 0.0;
-    const float *data_l = reinterpret_cast<const float*>(arr_l->get_data());
-    const float *data_r = reinterpret_cast<const float*>(arr_r->get_data());
-    const uint32_t size = arr_l->size();
-    if (distance_funcs[dis_type] == nullptr) {
-      ret = OB_NOT_SUPPORTED;
-      LOG_WARN("not support", K(ret), K(dis_type));
-    } else if (OB_FAIL(distance_funcs[dis_type](data_l, data_r, size, distance))) {
-      if (OB_ERR_NULL_VALUE == ret) {
-        res_datum.set_null();
-        ret = OB_SUCCESS; // ignore
-      } else {
+    ObEvalCtx::TempAllocGuard tmp_alloc_g(ctx);
+    common::ObArenaAllocator &tmp_allocator = tmp_alloc_g.get_allocator();
+    ObIVector *arg_vecs[2] = {expr.args_[0]->get_vector(ctx), expr.args_[1]->get_vector(ctx)};
+    ObIVector *type_vec = 3 == expr.arg_cnt_ ? expr.args_[2]->get_vector(ctx) : NULL;
+    ObIVector *res_vec = expr.get_vector(ctx);
+    ObBitVector &eval_flags = expr.get_evaluated_flags(ctx);
+    ObIArrayType *arrs[2] = {NULL, NULL};
+    bool is_const[2] = {false, false};
+    for (int64_t i = 0; OB_SUCC(ret) && i < 2; ++i) {
+      const uint16_t meta_id = expr.args_[i]->obj_meta_.get_subschema_id();
+      if (OB_FAIL(ObArrayExprUtils::construct_array_obj(tmp_allocator, ctx, meta_id, arrs[i]))) {
+        LOG_WARN("construct array obj failed", K(ret), K(i), K(meta_id));
+      } else if (OB_ISNULL(arrs[i])) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpected nullptr", K(ret), K(i));
+      } else if (VEC_UNIFORM_CONST == arg_vecs[i]->get_format() && !arg_vecs[i]->is_null(bound.start())) {
+        is_const[i] = true;
+        if (OB_FAIL(get_vector_arg(*expr.args_[i], ctx, tmp_allocator, bound.start(), *arrs[i]))) {
+          LOG_WARN("failed to get const vector", K(ret), K(i));
+        }
+      }
+    }
+    for (int64_t idx = bound.start(); OB_SUCC(ret) && idx < bound.end(); ++idx) {
+      double distance = 0.0;
+      bool is_null = false;
+      if (skip.at(idx) || eval_flags.at(idx)) {
+        continue;
+      } else if (NULL != type_vec && type_vec->is_null(idx)) {
+        ret = OB_INVALID_ARGUMENT;
+        LOG_WARN("invalid arg", K(ret), K(idx));
+      } else if (NULL != type_vec && FALSE_IT(dis_type = static_cast<ObVecDisType>(type_vec->get_int(idx)))) {
+      } else if (dis_type < ObVecDisType::COSINE || dis_type >= ObVecDisType::MAX_TYPE) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("unexpect distance type", K(ret), K(dis_type));
+      } else if (arg_vecs[0]->is_null(idx) || arg_vecs[1]->is_null(idx)) {
+        res_vec->set_null(idx);
+        eval_flags.set(idx);
+      } else if (!is_const[0] && OB_FAIL(get_vector_arg(*expr.args_[0], ctx, tmp_allocator, idx, *arrs[0]))) {
+        LOG_WARN("failed to get vector", K(ret), K(idx));
+      } else if (!is_const[1] && OB_FAIL(get_vector_arg(*expr.args_[1], ctx, tmp_allocator, idx, *arrs[1]))) {
+        LOG_WARN("failed to get vector", K(ret), K(idx));
+      } else if (OB_FAIL(calc_array_distance(*arrs[0], *arrs[1], dis_type, distance, is_null))) {
         LOG_WARN("failed to calc distance", K(ret), K(dis_type));
+      } else {
+        if (is_null) {
+          res_vec->set_null(idx);
+        } else {
+          res_vec->set_double(idx, distance);
+        }
+        eval_flags.set(idx);
       }
-    } else {
-      res_datum.set_double(distance);
     }
   }
   return ret;
@@ -193,6 +304,7 @@ int ObExprVectorL1Distance::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &r
 {
     int ret = OB_SUCCESS;
     rt_expr.eval_func_ = ObExprVectorL1Distance::calc_l1_distance;
+    rt_expr.eval_vector_func_ = ObExprVectorL1Distance::calc_l1_distance_vector;
     return ret;
 }
 
@@ -201,6 +313,12 @@ int ObExprVectorL1Distance::calc_l1_distance(const ObExpr &expr, ObEvalCtx &ctx,
   return ObExprVectorDistance::calc_distance(expr, ctx, res_datum, ObVecDisType::MANHATTAN);
 }
 
+int ObExprVectorL1Distance::calc_l1_distance_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                                    const ObBitVector &skip, const EvalBound &bound)
+{
+  return ObExprVectorDistance::calc_distance_vector(expr, ctx, skip, bound, ObVecDisType::MANHATTAN);
+}
+
 ObExprVectorL2Distance::ObExprVectorL2Distance(ObIAllocator &alloc)
     : ObExprVectorDistance(alloc, T_FUN_SYS_L2_DISTANCE, N_VECTOR_L2_DISTANCE, 2, NOT_ROW_DIMENSION) {}
 
@@ -209,6 +327,7 @@ int ObExprVectorL2Distance::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &r
 {
     int ret = OB_SUCCESS;
     rt_expr.eval_func_ = ObExprVectorL2Distance::calc_l2_distance;
+    rt_expr.eval_vector_func_ = ObExprVectorL2Distance::calc_l2_distance_vector;
     return ret;
 }
 
@@ -217,6 +336,12 @@ int ObExprVectorL2Distance::calc_l2_distance(const ObExpr &expr, ObEvalCtx &ctx,
   return ObExprVectorDistance::calc_distance(expr, ctx, res_datum, ObVecDisType::EUCLIDEAN);
 }
 
+int ObExprVectorL2Distance::calc_l2_distance_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                                    const ObBitVector &skip, const EvalBound &bound)
+{
+  return ObExprVectorDistance::calc_distance_vector(expr, ctx, skip, bound, ObVecDisType::EUCLIDEAN);
+}
+
 ObExprVectorCosineDistance::ObExprVectorCosineDistance(ObIAllocator &alloc)
     : ObExprVectorDistance(alloc, T_FUN_SYS_COSINE_DISTANCE, N_VECTOR_COS_DISTANCE, 2, NOT_ROW_DIMENSION) {}
 
@@ -225,6 +350,7 @@ int ObExprVectorCosineDistance::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExp
 {
     int ret = OB_SUCCESS;
     rt_expr.eval_func_ = ObExprVectorCosineDistance::calc_cosine_distance;
+    rt_expr.eval_vector_func_ = ObExprVectorCosineDistance::calc_cosine_distance_vector;
     return ret;
 }
 
@@ -233,6 +359,12 @@ int ObExprVectorCosineDistance::calc_cosine_distance(const ObExpr &expr, ObEvalC
   return ObExprVectorDistance::calc_distance(expr, ctx, res_datum, ObVecDisType::COSINE);
 }
 
+int ObExprVectorCosineDistance::calc_cosine_distance_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                                            const ObBitVector &skip, const EvalBound &bound)
+{
+  return ObExprVectorDistance::calc_distance_vector(expr, ctx, skip, bound, ObVecDisType::COSINE);
+}
+
 ObExprVectorIPDistance::ObExprVectorIPDistance(ObIAllocator &alloc)
     : ObExprVectorDistance(alloc, T_FUN_SYS_INNER_PRODUCT, N_VECTOR_INNER_PRODUCT, 2, NOT_ROW_DIMENSION) {}
 
@@ -241,6 +373,7 @@ int ObExprVectorIPDistance::cg_expr(ObExprCGCtx &expr_cg_ctx, const ObRawExpr &r
 {
     int ret = OB_SUCCESS;
     rt_expr.eval_func_ = ObExprVectorIPDistance::calc_inner_product;
+    rt_expr.eval_vector_func_ = ObExprVectorIPDistance::calc_inner_product_vector;
     return ret;
 }
 
@@ -249,6 +382,12 @@ int ObExprVectorIPDistance::calc_inner_product(const ObExpr &expr, ObEvalCtx &ct
   return ObExprVectorDistance::calc_distance(expr, ctx, res_datum, ObVecDisType::DOT);
 }
 
+int ObExprVectorIPDistance::calc_inner_product_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                                      const ObBitVector &skip, const EvalBound &bound)
+{
+  return ObExprVectorDistance::calc_distance_vector(expr, ctx, skip, bound, ObVecDisType::DOT);
+}
+
 ObExprVectorDims::ObExprVectorDims(ObIAllocator &alloc)
     : ObExprVector(alloc, T_FUN_SYS_VECTOR_DIMS, N_VECTOR_DIMS, 1, NOT_ROW_DIMENSION) {}
 
@@ -99,8 +99,16 @@ public:
                       ObExpr &rt_expr) const override;
   static int calc_distance(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
   static int calc_distance(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum, ObVecDisType dis_type);
+  static int calc_distance_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                  const ObBitVector &skip, const EvalBound &bound);
+  static int calc_distance_vector(const ObExpr &expr, ObEvalCtx &ctx, const ObBitVector &skip,
+                                  const EvalBound &bound, ObVecDisType dis_type);
 
 private:
+  static int calc_array_distance(const common::ObIArrayType &arr_l, const common::ObIArrayType &arr_r,
+                                 const ObVecDisType dis_type, double &distance, bool &is_null);
+  static int get_vector_arg(ObExpr &arg, ObEvalCtx &ctx, common::ObIAllocator &allocator,
+                            const int64_t idx, common::ObIArrayType &arr);
   DISALLOW_COPY_AND_ASSIGN(ObExprVectorDistance);
 };
 
@@ -115,6 +123,8 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int calc_l1_distance(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+  static int calc_l1_distance_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                     const ObBitVector &skip, const EvalBound &bound);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprVectorL1Distance);
 };
@@ -130,6 +140,8 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int calc_l2_distance(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+  static int calc_l2_distance_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                     const ObBitVector &skip, const EvalBound &bound);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprVectorL2Distance);
 };
@@ -145,6 +157,8 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int calc_cosine_distance(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+  static int calc_cosine_distance_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                         const ObBitVector &skip, const EvalBound &bound);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprVectorCosineDistance);
 };
@@ -160,6 +174,8 @@ public:
                       ObExpr &rt_expr) const override;
 
   static int calc_inner_product(const ObExpr &expr, ObEvalCtx &ctx, ObDatum &res_datum);
+  static int calc_inner_product_vector(const ObExpr &expr, ObEvalCtx &ctx,
+                                       const ObBitVector &skip, const EvalBound &bound);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObExprVectorIPDistance);
 };
@@ -503,7 +503,13 @@ int ObTenantSqlMemoryManager::calc_work_area_size_by_profile(
     LOG_WARN("unexpect profile type", K(profile.get_work_area_type()));
   }
   profile.set_global_bound_size(global_bound_size);
-  profile.set_max_bound(min(global_bound_size, profile.get_cache_size()));
+  if (OB_SUCC(ret) && profile.has_grant_size(global_bound_size)) {
+    profile.set_expect_size(profile.get_grant_size());
+    profile.set_max_bound(max(profile.get_grant_size(),
+                              min(global_bound_size, profile.get_cache_size())));
+  } else {
+    profile.set_max_bound(min(global_bound_size, profile.get_cache_size()));
+  }
   return ret;
 }
 
@@ -1108,6 +1114,16 @@ bool ObTenantSqlMemoryManager::enable_auto_sql_memory_manager()
   return auto_memory_mgr;
 }
 
+bool ObTenantSqlMemoryManager::enable_workarea_redistribution()
+{
+  bool enable_redistribution = false;
+  ObTenantConfigGuard tenant_config(TENANT_CONF(tenant_id_));
+  if (tenant_config.is_valid()) {
+    enable_redistribution = tenant_config->_enable_workarea_redistribution;
+  }
+  return enable_redistribution;
+}
+
 // ensure lock outside
 void ObTenantSqlMemoryManager::reset()
 {
@@ -1124,9 +1140,19 @@ void ObTenantSqlMemoryManager::reset()
 }
 
 // try best to push global_bound_size to every profile registered
-int ObTenantSqlMemoryManager::try_push_profiles_work_area_size(int64_t global_bound_size)
+int ObTenantSqlMemoryManager::try_push_profiles_work_area_size(
+  int64_t global_bound_size,
+  const int64_t wa_max_memory_size,
+  const bool enable_redistribution)
 {
   int ret = OB_SUCCESS;
+  int64_t total_expect_size = 0;
+  // memory needed by hash joins to stay in memory
+  int64_t hash_lack_size = 0;
+  // grants are all or nothing, the smallest one needed by a hash join
+  int64_t min_hash_lack_size = INT64_MAX;
+  // memory can be reclaimed from in-memory sorts by degrading them to one-pass
+  int64_t sort_reclaimable_size = 0;
   if (nullptr == profile_lists_) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("profile list is null", K(ret));
@@ -1135,11 +1161,25 @@ int ObTenantSqlMemoryManager::try_push_profiles_work_area_size(int64_t global_bo
       if (OB_SUCC(profile_lists_[i].get_lock().trylock())) {
         ObDList<ObSqlWorkAreaProfile> &profile_list = profile_lists_[i].get_profile_list();
         DLIST_FOREACH_X(profile, profile_list, OB_SUCC(ret)) {
-          if (profile->get_auto_policy()
-              && OB_FAIL(calc_work_area_size_by_profile(global_bound_size, *profile))) {
+          if (!profile->get_auto_policy()) {
+          } else if (FALSE_IT(profile->reset_grant_size())) {
+          } else if (OB_FAIL(calc_work_area_size_by_profile(global_bound_size, *profile))) {
             ret = OB_SUCCESS;
             LOG_WARN("failed to calculate worka area size by profile", K(ret), K(*profile),
               K(global_bound_size));
+          } else {
+            total_expect_size += profile->get_expect_size();
+            if (profile->is_hash_join_wa()
+                && profile->get_expect_size() < profile->get_cache_size()) {
+              hash_lack_size += profile->get_cache_size() - profile->get_expect_size();
+              min_hash_lack_size = min(min_hash_lack_size,
+                                       profile->get_cache_size() - profile->get_expect_size());
+            } else if (profile->is_sort_wa()
+                && profile->get_expect_size() == profile->get_cache_size()
+                && profile->get_one_pass_size() < profile->get_cache_size()
+                && profile->get_mem_used() < profile->get_one_pass_size()) {
+              sort_reclaimable_size += profile->get_cache_size() - profile->get_one_pass_size();
+            }
           }
         }
         profile_lists_[i].get_lock().unlock();
@@ -1148,9 +1188,96 @@ int ObTenantSqlMemoryManager::try_push_profiles_work_area_size(int64_t global_bo
       }
     }
   }
+  if (OB_SUCC(ret) && enable_redistribution && 0 < hash_lack_size) {
+    int64_t spare_size = wa_max_memory_size
+                       - max(total_expect_size, sql_mem_callback_.get_total_alloc_size());
+    spare_size = max(spare_size, 0L);
+    int64_t reclaim_size = min(sort_reclaimable_size, max(hash_lack_size - spare_size, 0L));
+    int64_t reclaimed_size = reclaim_size;
+    if (spare_size + sort_reclaimable_size < min_hash_lack_size) {
+      // no hash join can be kept in memory, don't shrink sorts for nothing
+    } else if (0 < reclaim_size
+        && OB_FAIL(redistribute_work_area_size(global_bound_size, true, reclaimed_size))) {
+      LOG_WARN("failed to reclaim work area size", K(ret), K(reclaim_size));
+    } else {
+      int64_t grant_size = spare_size + reclaimed_size;
+      if (OB_FAIL(redistribute_work_area_size(global_bound_size, false, grant_size))) {
+        LOG_WARN("failed to grant work area size", K(ret), K(grant_size));
+      } else {
+        ++redistribute_cnt_;
+        LOG_TRACE("trace redistribute work area size", K(global_bound_size),
+          K(wa_max_memory_size), K(total_expect_size), K(hash_lack_size),
+          K(sort_reclaimable_size), K(spare_size), K(reclaimed_size), K(grant_size));
+      }
+    }
+  }
   return OB_SUCCESS;
 }
 
+// is_reclaim:
+//   true:  shrink in-memory sorts to one-pass until redistribute_size is reclaimed,
+//          redistribute_size is set to the size reclaimed actually
+//   false: grant hash joins cache size from redistribute_size,
+//          redistribute_size is set to the size granted actually
+// The new size takes effect when operator gets max available memory size periodically,
+// sort which exceeds the grant size dumps then
+int ObTenantSqlMemoryManager::redistribute_work_area_size(
+  const int64_t global_bound_size,
+  const bool is_reclaim,
+  int64_t &redistribute_size)
+{
+  int ret = OB_SUCCESS;
+  int64_t remain_size = redistribute_size;
+  if (nullptr == profile_lists_) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("profile list is null", K(ret));
+  } else {
+    for (int64_t i = 0; i < HASH_CNT && 0 < remain_size && OB_SUCC(ret); ++i)  {
+      if (OB_SUCC(profile_lists_[i].get_lock().trylock())) {
+        ObDList<ObSqlWorkAreaProfile> &profile_list = profile_lists_[i].get_profile_list();
+        DLIST_FOREACH_X(profile, profile_list, 0 < remain_size && OB_SUCC(ret)) {
+          int64_t delta_size = 0;
+          if (!profile->get_auto_policy() || profile->get_global_bound_size() != global_bound_size) {
+            // profile has not been calculated by current global bound size
+          } else if (is_reclaim) {
+            if (profile->is_sort_wa()
+                && profile->get_expect_size() == profile->get_cache_size()
+                && profile->get_one_pass_size() < profile->get_cache_size()
+                && profile->get_mem_used() < profile->get_one_pass_size()) {
+              delta_size = profile->get_cache_size() - profile->get_one_pass_size();
+              profile->set_grant_size(profile->get_one_pass_size(), global_bound_size);
+            }
+          } else if (profile->is_hash_join_wa()
+                    && profile->get_expect_size() < profile->get_cache_size()
+                    && profile->get_cache_size() - profile->get_expect_size() <= remain_size) {
+            delta_size = profile->get_cache_size() - profile->get_expect_size();
+            profile->set_grant_size(profile->get_cache_size(), global_bound_size);
+          }
+          if (0 < delta_size) {
+            remain_size -= delta_size;
+            if (OB_FAIL(calc_work_area_size_by_profile(global_bound_size, *profile))) {
+              ret = OB_SUCCESS;
+              LOG_WARN("failed to calculate worka area size by profile", K(ret), K(*profile),
+                K(global_bound_size));
+            }
+          }
+        }
+        profile_lists_[i].get_lock().unlock();
+      } else {
+        ret = OB_SUCCESS;
+      }
+    }
+  }
+  // note: it may reclaim a little more than expected
+  redistribute_size -= remain_size;
+  if (is_reclaim) {
+    redistribute_reclaim_size_ += redistribute_size;
+  } else {
+    redistribute_grant_size_ += redistribute_size;
+  }
+  return ret;
+}
+
 int ObTenantSqlMemoryManager::calculate_global_bound_size_by_interval_info(
   ObIAllocator &allocator,
   const int64_t wa_max_memory_size,
@@ -1189,9 +1316,12 @@ int ObTenantSqlMemoryManager::calculate_global_bound_size_by_interval_info(
           K(sql_mem_callback_.get_total_alloc_size()), K(tenant_id_), K(profile_cnt_),
           K(pre_profile_cnt_), K(pre_profile_cnt), K(calc_info.get_global_bound_size()),
           K(total_memory_size), K(cur_profile_cnt), K(calc_info.get_mem_target()), K(auto_calc),
-          K(sql_mem_callback_.get_total_dump_size()));
+          K(sql_mem_callback_.get_total_dump_size()), K(redistribute_cnt_),
+          K(redistribute_grant_size_), K(redistribute_reclaim_size_));
       }
-      if (OB_FAIL(try_push_profiles_work_area_size(calc_info.get_global_bound_size()))) {
+      if (OB_FAIL(try_push_profiles_work_area_size(calc_info.get_global_bound_size(),
+                                                   wa_max_memory_size,
+                                                   enable_workarea_redistribution()))) {
         LOG_WARN("failed to push profiles work area size",
           K(ret), K(calc_info.get_global_bound_size()));
       }
@@ -88,7 +88,8 @@ public:
     max_mem_used_(0), mem_used_(0),
     pre_mem_used_(0), dumped_size_(0), max_dumped_size_(0), data_ratio_(0.5),
     active_time_(0), number_pass_(0),
-    calc_count_(0), disable_auto_mem_mgr_(false)
+    calc_count_(0), disable_auto_mem_mgr_(false),
+    grant_size_(0), grant_bound_size_(0), grant_cnt_(0)
   {
     ObRandom rand;
     random_id_ = rand.get();
@@ -152,6 +153,20 @@ public:
   OB_INLINE int64_t get_max_bound() const { return max_bound_; }
   OB_INLINE void set_max_bound(int64_t max_bound) { max_bound_ = max_bound; }
 
+  // size granted by redistribution of ObTenantSqlMemoryManager, it takes priority over the
+  // size calculated by global bound until the global bound size is recalculated
+  OB_INLINE bool has_grant_size(int64_t global_bound_size) const
+  { return 0 < grant_size_ && grant_bound_size_ == global_bound_size; }
+  OB_INLINE int64_t get_grant_size() const { return grant_size_; }
+  OB_INLINE void set_grant_size(int64_t grant_size, int64_t global_bound_size)
+  {
+    grant_size_ = grant_size;
+    grant_bound_size_ = global_bound_size;
+    ++grant_cnt_;
+  }
+  OB_INLINE void reset_grant_size() { grant_size_ = 0; grant_bound_size_ = 0; }
+  OB_INLINE int64_t get_grant_cnt() const { return grant_cnt_; }
+
   OB_INLINE bool is_hash_join_wa() const { return ObSqlWorkAreaType::HASH_WORK_AREA == type_; }
   OB_INLINE bool is_sort_wa() const { return ObSqlWorkAreaType::SORT_WORK_AREA == type_; }
   OB_INLINE ObSqlWorkAreaType get_work_area_type() const { return type_; }
@@ -204,7 +219,7 @@ public:
 
   TO_STRING_KV(K_(random_id), K_(type), K_(op_id),
     K_(cache_size), K_(one_pass_size), K_(expect_size),
-    K_(calc_count));
+    K_(calc_count), K_(grant_size), K_(grant_cnt), K_(mem_used), K_(dumped_size));
 
 private:
   static const int64_t MIN_BOUND_SIZE[ObSqlWorkAreaType::MAX_TYPE];
@@ -242,6 +257,9 @@ public:
   int64_t number_pass_;
   int64_t calc_count_;    // the times of calculate global bound
   bool disable_auto_mem_mgr_;
+  int64_t grant_size_;       // size granted by redistribution
+  int64_t grant_bound_size_; // global bound size when the grant size is set
+  int64_t grant_cnt_;        // the times of grant size changed by redistribution
 };
 
 static constexpr const char *EXECUTION_OPTIMAL = "OPTIMAL";
@@ -631,7 +649,8 @@ public:
     drift_size_(0), profile_cnt_(0), pre_profile_cnt_(0), global_bound_size_(0),
     mem_target_(0), max_workarea_size_(0), workarea_hold_size_(0), max_auto_workarea_size_(0),
     max_tenant_memory_size_(0),
-    manual_calc_cnt_(0), wa_start_(0), wa_end_(0), wa_cnt_(0),
+    manual_calc_cnt_(0), redistribute_cnt_(0), redistribute_grant_size_(0),
+    redistribute_reclaim_size_(0), wa_start_(0), wa_end_(0), wa_cnt_(0),
     lock_(), global_bound_update_lock_()
   {}
   ~ObTenantSqlMemoryManager() {}
@@ -680,6 +699,10 @@ public:
   int64_t get_workarea_count() const { return profile_cnt_; }
   int64_t get_manual_calc_count() const { return manual_calc_cnt_; }
   int64_t get_total_mem_used() const { return sql_mem_callback_.get_total_alloc_size(); }
+  int64_t get_total_dump_size() const { return sql_mem_callback_.get_total_dump_size(); }
+  int64_t get_redistribute_count() const { return redistribute_cnt_; }
+  int64_t get_redistribute_grant_size() const { return redistribute_grant_size_; }
+  int64_t get_redistribute_reclaim_size() const { return redistribute_reclaim_size_; }
 private:
   OB_INLINE bool need_manual_calc_bound();
   OB_INLINE bool need_manual_by_drift();
@@ -692,9 +715,20 @@ private:
   OB_INLINE void increase_profile_cnt() { ATOMIC_INC(&profile_cnt_); }
   OB_INLINE void decrease_profile_cnt() { ATOMIC_DEC(&profile_cnt_); }
   void reset();
-  int try_push_profiles_work_area_size(int64_t global_bound_size);
+  int try_push_profiles_work_area_size(
+    int64_t global_bound_size,
+    const int64_t wa_max_memory_size,
+    const bool enable_redistribution);
   int calc_work_area_size_by_profile(int64_t global_bound_size, ObSqlWorkAreaProfile &profile);
+  // redistribution: memory which is not used under work area max memory size and memory
+  // reclaimed from in-memory sorts are granted to hash joins, which would dump otherwise.
+  // sort degrades to one-pass gracefully, while hash join has to dump and re-read all its input
+  int redistribute_work_area_size(
+    const int64_t global_bound_size,
+    const bool is_reclaim,
+    int64_t &redistribute_size);
   bool enable_auto_sql_memory_manager();
+  bool enable_workarea_redistribution();
   int get_max_work_area_size(int64_t &max_wa_memory_size, const bool auto_calc);
   int find_interval_index(const int64_t cache_size, int64_t &idx, int64_t &out_cache_size);
   int count_profile_into_work_area_intervals(
@@ -780,6 +814,9 @@ private:
 
   // statistics
   int64_t manual_calc_cnt_;
+  int64_t redistribute_cnt_;
+  int64_t redistribute_grant_size_;
+  int64_t redistribute_reclaim_size_;
 
   int64_t wa_start_;
   int64_t wa_end_;
@@ -7789,6 +7789,22 @@ int ObDDLResolver::resolve_vec_index_constraint(
           } else if (option_node->type_ != T_VEC_INDEX_PARAMS) {
           } else {
             has_set_params = true;
+            // the dim is only known here, pq_m must divide it
+            for (int64_t j = 0; OB_SUCC(ret) && j + 1 < option_node->num_child_; j += 2) {
+              const ParseNode *name_node = option_node->children_[j];
+              const ParseNode *value_node = option_node->children_[j + 1];
+              if (OB_ISNULL(name_node) || OB_ISNULL(value_node)) {
+                ret = OB_ERR_UNEXPECTED;
+                LOG_WARN("vector index param node is null", K(ret), KP(name_node), KP(value_node));
+              } else if (T_NUMBER != value_node->type_ ||
+                         0 != ObString(name_node->str_len_, name_node->str_value_).case_compare("PQ_M")) {
+              } else if (OB_FAIL(ObVectorIndexUtil::check_ivf_pq_m(dim, value_node->value_))) {
+                LOG_WARN("invalid vector index pq_m", K(ret), K(dim), K(value_node->value_));
+                if (OB_NOT_SUPPORTED == ret) {
+                  LOG_USER_ERROR(OB_NOT_SUPPORTED, "vector index pq_m which does not divide the vector dim is");
+                }
+              }
+            }
           }
         }
       }
@@ -13123,11 +13139,21 @@ int ObDDLResolver::check_index_param(const ParseNode *option_node, ObString &ind
     bool m_is_set = false;
     bool ef_construction_is_set = false;
     bool ef_search_is_set = false;
+    bool is_ivf_type = false;
+    bool is_quantized_type = false;
+    bool is_pq_type = false;
+    bool nlist_is_set = false;
+    bool nprobe_is_set = false;
+    bool pq_m_is_set = false;
+    bool refine_k_is_set = false;
 
     const ObString default_lib = "VSAG";
     const int64_t default_m_value = 16;
     const int64_t default_ef_construction_value = 200;
     const int64_t default_ef_search_value = 64;
+    const int64_t default_nlist_value = 128;
+    const int64_t default_nprobe_value = 8;
+    const int64_t default_refine_k_value = 4;
 
     for (int64_t i = 0; OB_SUCC(ret) && i < option_node->num_child_; ++i) {
       int32_t child_node_index = i % 2;
@@ -13142,7 +13168,11 @@ int ObDDLResolver::check_index_param(const ParseNode *option_node, ObString &ind
                    new_variable_name != "TYPE" &&
                    new_variable_name != "M" &&
                    new_variable_name != "EF_CONSTRUCTION" &&
-                   new_variable_name != "EF_SEARCH") {
+                   new_variable_name != "EF_SEARCH" &&
+                   new_variable_name != "NLIST" &&
+                   new_variable_name != "NPROBE" &&
+                   new_variable_name != "PQ_M" &&
+                   new_variable_name != "REFINE_K") {
           ret = OB_NOT_SUPPORTED;
           SQL_RESV_LOG(WARN, "unexpected vector variable name", K(ret), K(new_variable_name));
           LOG_USER_ERROR(OB_NOT_SUPPORTED, "unexpected vector index params items is");
@@ -13181,6 +13211,14 @@ int ObDDLResolver::check_index_param(const ParseNode *option_node, ObString &ind
         } else if (last_variable == "TYPE") {
           if (new_parser_name == "HNSW") {
             type_is_set = true;
+          } else if (new_parser_name == "IVF_FLAT") {
+            type_is_set = true;
+            is_ivf_type = true;
+          } else if (new_parser_name == "IVF_SQ8" || new_parser_name == "IVF_PQ") {
+            type_is_set = true;
+            is_ivf_type = true;
+            is_quantized_type = true;
+            is_pq_type = new_parser_name == "IVF_PQ";
           } else {
             ret = OB_NOT_SUPPORTED;
             SQL_RESV_LOG(WARN, "not support vector index type", K(ret), K(new_parser_name));
@@ -13212,6 +13250,38 @@ int ObDDLResolver::check_index_param(const ParseNode *option_node, ObString &ind
             SQL_RESV_LOG(WARN, "invalid vector index ef_search value", K(ret), K(parser_value));
             LOG_USER_ERROR(OB_NOT_SUPPORTED, "this value of vector index ef_search is");
           }
+        } else if (last_variable == "NLIST") {
+          if (parser_value >= 1 && parser_value <= 65536) {
+            nlist_is_set = true;
+          } else {
+            ret = OB_NOT_SUPPORTED;
+            SQL_RESV_LOG(WARN, "invalid vector index nlist value", K(ret), K(parser_value));
+            LOG_USER_ERROR(OB_NOT_SUPPORTED, "this value of vector index nlist is");
+          }
+        } else if (last_variable == "NPROBE") {
+          if (parser_value >= 1 && parser_value <= 65536) {
+            nprobe_is_set = true;
+          } else {
+            ret = OB_NOT_SUPPORTED;
+            SQL_RESV_LOG(WARN, "invalid vector index nprobe value", K(ret), K(parser_value));
+            LOG_USER_ERROR(OB_NOT_SUPPORTED, "this value of vector index nprobe is");
+          }
+        } else if (last_variable == "PQ_M") {
+          if (parser_value >= 1 && parser_value <= 4096) {
+            pq_m_is_set = true;
+          } else {
+            ret = OB_NOT_SUPPORTED;
+            SQL_RESV_LOG(WARN, "invalid vector index pq_m value", K(ret), K(parser_value));
+            LOG_USER_ERROR(OB_NOT_SUPPORTED, "this value of vector index pq_m is");
+          }
+        } else if (last_variable == "REFINE_K") {
+          if (parser_value >= 1 && parser_value <= 100) {
+            refine_k_is_set = true;
+          } else {
+            ret = OB_NOT_SUPPORTED;
+            SQL_RESV_LOG(WARN, "invalid vector index refine_k value", K(ret), K(parser_value));
+            LOG_USER_ERROR(OB_NOT_SUPPORTED, "this value of vector index refine_k is");
+          }
         } else {
           ret = OB_NOT_SUPPORTED;
           SQL_RESV_LOG(WARN, "not support vector index param", K(ret), K(last_variable));
@@ -13227,6 +13297,15 @@ int ObDDLResolver::check_index_param(const ParseNode *option_node, ObString &ind
         SQL_RESV_LOG(WARN, "unexpected setting of vector index param, distance or type has not been set",
           K(ret), K(distance_is_set), K(type_is_set));
         LOG_USER_ERROR(OB_NOT_SUPPORTED, "the vector index params of distance or type not set is");
+      } else if (!is_ivf_type && (nlist_is_set || nprobe_is_set || pq_m_is_set || refine_k_is_set)) {
+        ret = OB_NOT_SUPPORTED;
+        SQL_RESV_LOG(WARN, "unexpected setting of vector index param, ivf params set on non ivf index",
+          K(ret), K(nlist_is_set), K(nprobe_is_set), K(pq_m_is_set), K(refine_k_is_set));
+        LOG_USER_ERROR(OB_NOT_SUPPORTED, "the vector index params of nlist, nprobe, pq_m or refine_k on non ivf index is");
+      } else if (!is_pq_type && pq_m_is_set) {
+        ret = OB_NOT_SUPPORTED;
+        SQL_RESV_LOG(WARN, "unexpected setting of vector index param, pq_m set on non ivf_pq index", K(ret));
+        LOG_USER_ERROR(OB_NOT_SUPPORTED, "the vector index param of pq_m on non ivf_pq index is");
       } else if (ef_construction_value <= m_value) {
         ret = OB_NOT_SUPPORTED;
         SQL_RESV_LOG(WARN, "unexpected setting of vector index param, ef_construction value must be larger than m value",
@@ -13260,6 +13339,24 @@ int ObDDLResolver::check_index_param(const ParseNode *option_node, ObString &ind
                                                     ", EF_SEARCH=%ld",
                                                     default_ef_search_value))) {
           LOG_WARN("fail to printf databuff", K(ret));
+        } else if (is_ivf_type && !nlist_is_set && OB_FAIL(databuff_printf(not_set_params_str,
+                                                    OB_MAX_TABLE_NAME_LENGTH,
+                                                    pos,
+                                                    ", NLIST=%ld",
+                                                    default_nlist_value))) {
+          LOG_WARN("fail to printf databuff", K(ret));
+        } else if (is_ivf_type && !nprobe_is_set && OB_FAIL(databuff_printf(not_set_params_str,
+                                                    OB_MAX_TABLE_NAME_LENGTH,
+                                                    pos,
+                                                    ", NPROBE=%ld",
+                                                    default_nprobe_value))) {
+          LOG_WARN("fail to printf databuff", K(ret));
+        } else if (is_quantized_type && !refine_k_is_set && OB_FAIL(databuff_printf(not_set_params_str,
+                                                    OB_MAX_TABLE_NAME_LENGTH,
+                                                    pos,
+                                                    ", REFINE_K=%ld",
+                                                    default_refine_k_value))) {
+          LOG_WARN("fail to printf databuff", K(ret));
         } else {
           char *buf = nullptr;
           const int64_t alloc_len = index_params.length() + pos;
@@ -239,6 +239,8 @@ int ObDelUpdResolver::resolve_assignments(const ParseNode &parse_node,
     if (OB_FAIL(ret)) {
     } else if (OB_FAIL(resolve_json_partial_update_flag(table_assigns, scope))) {
       LOG_WARN("resolve_json_partial_update_flag fail", K(ret));
+    } else if (OB_FAIL(resolve_lob_partial_append_flag(table_assigns, scope))) {
+      LOG_WARN("resolve_lob_partial_append_flag fail", K(ret));
     }
   }
   return ret;
@@ -5038,6 +5040,94 @@ int ObDelUpdResolver::mark_json_partial_update_flag(const ObColumnRefRawExpr *re
 }
 
 
+// mark `update t set c = concat(c, ...)` on a longtext/longblob column, so that concat
+// only ships the appended tail to storage as an append delta lob instead of the full value.
+// the column must not be read by other assignments or generated columns, and the row must
+// not move between partitions, since only the update path of storage can apply delta lob.
+// triggers and check constraints evaluate the new value in sql, they are left to the full value.
+int ObDelUpdResolver::resolve_lob_partial_append_flag(ObIArray<ObTableAssignment> &table_assigns, ObStmtScope scope)
+{
+  INIT_SUCC(ret);
+  bool enable_partial_append = false;
+  int64_t binlog_row_image = ObBinlogRowImage::FULL;
+  const TableItem *table_item = nullptr;
+  const ObTableSchema *table_schema = nullptr;
+  if (T_UPDATE_SCOPE != scope || !is_mysql_mode() || 1 != table_assigns.count()) {
+  } else if (OB_ISNULL(session_info_) || OB_ISNULL(stmt_) || OB_ISNULL(schema_checker_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("get unexpected null", K(ret), KP(session_info_), KP(stmt_), KP(schema_checker_));
+  } else if (OB_FAIL(session_info_->get_binlog_row_image(binlog_row_image))) {
+    LOG_WARN("fail to get binlog row image", K(ret));
+  } else {
+    // the append delta only logs the appended pieces, which libobcdc can not merge
+    // onto the previous lob image, so keep full images whenever they are logged
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(session_info_->get_effective_tenant_id()));
+    enable_partial_append = tenant_config.is_valid() && tenant_config->_enable_lob_partial_append
+                            && ObBinlogRowImage::FULL != binlog_row_image;
+  }
+  if (OB_FAIL(ret) || !enable_partial_append) {
+  } else if (OB_ISNULL(table_item = stmt_->get_table_item_by_id(table_assigns.at(0).table_id_))) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("table item is NULL", K(ret), K(table_assigns.at(0).table_id_));
+  } else if (OB_FAIL(schema_checker_->get_table_schema(session_info_->get_effective_tenant_id(),
+                                                       table_item->get_base_table_item().ref_id_,
+                                                       table_schema))) {
+    LOG_WARN("fail to get table schema", K(ret), KPC(table_item));
+  } else if (OB_ISNULL(table_schema)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("table schema is NULL", K(ret), KPC(table_item));
+  } else if (table_schema->get_trigger_list().count() > 0 || table_schema->has_check_constraint()) {
+    enable_partial_append = false;
+  }
+  if (OB_SUCC(ret) && enable_partial_append) {
+    ObTableAssignment &table_assign = table_assigns.at(0);
+    bool is_update_part_key = false;
+    for (int64_t i = 0; OB_SUCC(ret) && !is_update_part_key && i < table_assign.assignments_.count(); ++i) {
+      const ObColumnRefRawExpr *column_expr = table_assign.assignments_.at(i).column_expr_;
+      if (OB_ISNULL(column_expr)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("column expr is NULL", K(ret), K(i));
+      } else {
+        is_update_part_key = column_expr->is_table_part_key_column();
+      }
+    }
+    for (int64_t i = 0; OB_SUCC(ret) && !is_update_part_key && i < table_assign.assignments_.count(); ++i) {
+      ObAssignment &assign = table_assign.assignments_.at(i);
+      ObRawExpr *value_expr = assign.expr_;
+      bool is_referenced = false;
+      if (OB_ISNULL(value_expr)) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("assign expr is NULL", K(ret), K(assign));
+      } else if (T_FUN_COLUMN_CONV == value_expr->get_expr_type()
+                 && OB_ISNULL(value_expr = value_expr->get_param_expr(4))) {
+        ret = OB_ERR_UNEXPECTED;
+        LOG_WARN("column conv value is NULL", K(ret), K(assign));
+      } else if (ObLongTextType != assign.column_expr_->get_data_type()
+                 || assign.column_expr_->has_generated_column_deps()
+                 || T_OP_CNN != value_expr->get_expr_type()
+                 || value_expr->get_param_count() < 2
+                 || !ObRawExprUtils::is_same_column_ref(assign.column_expr_, value_expr->get_param_expr(0))) {
+      } else {
+        for (int64_t j = 0; OB_SUCC(ret) && !is_referenced && j < table_assign.assignments_.count(); ++j) {
+          ObSEArray<ObRawExpr*, 4> column_exprs;
+          if (i == j) {
+          } else if (OB_FAIL(ObRawExprUtils::extract_column_exprs(table_assign.assignments_.at(j).expr_, column_exprs))) {
+            LOG_WARN("extract column exprs fail", K(ret), K(j));
+          } else {
+            for (int64_t k = 0; !is_referenced && k < column_exprs.count(); ++k) {
+              is_referenced = ObRawExprUtils::is_same_column_ref(assign.column_expr_, column_exprs.at(k));
+            }
+          }
+        }
+        if (OB_SUCC(ret) && !is_referenced) {
+          value_expr->set_extra(OB_LOB_PARTIAL_APPEND_ALLOW | value_expr->get_extra());
+        }
+      }
+    }
+  }
+  return ret;
+}
+
 int ObDelUpdResolver::build_vec_vid_function_expr(
     const ObInsertTableInfo& table_info,
     const ObColumnSchemaV2 &col_schema,
@@ -286,6 +286,7 @@ protected:
       AutoincParam &param);
   int resolve_json_partial_update_flag(ObIArray<ObTableAssignment> &table_assigns, ObStmtScope scope);
   int mark_json_partial_update_flag(const ObColumnRefRawExpr *ref_expr, ObRawExpr *expr, int depth, bool &allow_json_partial_update);
+  int resolve_lob_partial_append_flag(ObIArray<ObTableAssignment> &table_assigns, ObStmtScope scope);
   int add_select_item_func(ObSelectStmt &select_stmt, ColumnItem &col);
   int select_items_is_pk(const ObSelectStmt& select_stmt, bool &has_pk);
   int build_vec_vid_function_expr(
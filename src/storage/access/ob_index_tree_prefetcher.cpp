@@ -405,7 +405,8 @@ int ObIndexTreePrefetcher::prefetch_block_data(
                          !is_data || need_submit_io, /* need submit io */
                          use_multi_block_prefetch,
                          micro_handle,
-                         cur_level_))) {
+                         cur_level_,
+                         is_data ? get_compress_dict() : ObDecompressDict()))) {
     if (is_data && !need_submit_io && OB_ENTRY_NOT_EXIST == ret) {
       ret = OB_SUCCESS;
     } else {
@@ -456,6 +457,8 @@ void ObIndexTreeMultiPrefetcher::inner_reset()
   fetch_rowkey_idx_ = 0;
   prefetch_rowkey_idx_ = 0;
   prefetched_rowkey_cnt_ = 0;
+  prefetch_depth_ = 0;
+  depth_checked_rowkey_idx_ = -1;
   rowkeys_ = nullptr;
 }
 
@@ -480,14 +483,11 @@ int ObIndexTreeMultiPrefetcher::init(
     ext_read_handles_.set_allocator(long_life_allocator_);
     rowkeys_ = static_cast<const common::ObIArray<blocksstable::ObDatumRowkey> *> (query_range);
     const int32_t range_count = rowkeys_->count();
-    max_handle_prefetching_cnt_ = min(range_count, MAX_MULTIGET_MICRO_DATA_HANDLE_CNT);
-    max_rescan_range_cnt_ = max_handle_prefetching_cnt_ > max_rescan_range_cnt_ ? max_handle_prefetching_cnt_ : max_rescan_range_cnt_;
-    const int64_t handle_cnt = iter_param.is_use_global_iter_pool() ? MAX_MULTIGET_MICRO_DATA_HANDLE_CNT : max_handle_prefetching_cnt_;
     if (0 == range_count) {
       ret = OB_ERR_UNEXPECTED;
       LOG_WARN("range count should be greater than 0", K(ret), K(range_count));
-    } else if (OB_FAIL(ext_read_handles_.prepare_reallocate(handle_cnt))) {
-      LOG_WARN("Fail to init read_handles", K(ret), K(handle_cnt));
+    } else if (OB_FAIL(init_prefetch_handles(range_count))) {
+      LOG_WARN("Fail to init read_handles", K(ret), K(range_count));
     } else {
       is_inited_ = true;
     }
@@ -524,10 +524,8 @@ int ObIndexTreeMultiPrefetcher::switch_context(
                         ObStoreRowIterator::IteratorMultiGet == iter_type_ &&
                         !sstable.is_ddl_sstable();
     rowkeys_ = static_cast<const common::ObIArray<blocksstable::ObDatumRowkey> *> (query_range);
-    max_handle_prefetching_cnt_ = min(rowkeys_->count(), MAX_MULTIGET_MICRO_DATA_HANDLE_CNT);
-    max_rescan_range_cnt_ = max_handle_prefetching_cnt_ > max_rescan_range_cnt_ ? max_handle_prefetching_cnt_ : max_rescan_range_cnt_;
-    if (OB_FAIL(ext_read_handles_.prepare_reallocate(max_handle_prefetching_cnt_))) {
-      LOG_WARN("Fail to init read_handles", K(ret), K(max_handle_prefetching_cnt_));
+    if (OB_FAIL(init_prefetch_handles(rowkeys_->count()))) {
+      LOG_WARN("Fail to init read_handles", K(ret), K(rowkeys_->count()));
     }
   }
   if (OB_SUCC(ret)) {
@@ -540,6 +538,51 @@ int ObIndexTreeMultiPrefetcher::switch_context(
   return ret;
 }
 
+int ObIndexTreeMultiPrefetcher::init_prefetch_handles(const int64_t rowkey_cnt)
+{
+  int ret = OB_SUCCESS;
+  // sorted rowkeys are fetched in the order of the blocks, a deeper window keeps more block io in flight
+  const int64_t max_handle_cnt = is_rowkey_sorted_ ? MAX_SORTED_MULTIGET_MICRO_DATA_HANDLE_CNT : MAX_MULTIGET_MICRO_DATA_HANDLE_CNT;
+  max_handle_prefetching_cnt_ = static_cast<int32_t>(min(rowkey_cnt, max_handle_cnt));
+  prefetch_depth_ = min(max_handle_prefetching_cnt_, MAX_MULTIGET_MICRO_DATA_HANDLE_CNT);
+  depth_checked_rowkey_idx_ = -1;
+  max_rescan_range_cnt_ = max_handle_prefetching_cnt_ > max_rescan_range_cnt_ ? max_handle_prefetching_cnt_ : max_rescan_range_cnt_;
+  const int64_t handle_cnt = iter_param_->is_use_global_iter_pool() ?
+      max(max_handle_prefetching_cnt_, MAX_MULTIGET_MICRO_DATA_HANDLE_CNT) : max_handle_prefetching_cnt_;
+  if (OB_FAIL(ext_read_handles_.prepare_reallocate(handle_cnt))) {
+    LOG_WARN("Fail to prepare read handles", K(ret), K(handle_cnt));
+  }
+  return ret;
+}
+
+// The prefetch depth of sorted multi get adapts to the io latency: it doubles when the rowkey to
+// fetch still waits for the io of its data block, and shrinks by one when the block is in cache.
+void ObIndexTreeMultiPrefetcher::adjust_prefetch_depth()
+{
+  if (is_rowkey_sorted_ &&
+      fetch_rowkey_idx_ < prefetch_rowkey_idx_ &&
+      fetch_rowkey_idx_ != depth_checked_rowkey_idx_) {
+    const ObSSTableReadHandleExt &read_handle = current_read_handle();
+    if (read_handle.cur_prefetch_end_) {
+      depth_checked_rowkey_idx_ = fetch_rowkey_idx_;
+      if (ObSSTableRowState::IN_BLOCK == read_handle.row_state_ && nullptr != read_handle.micro_handle_) {
+        const ObMicroBlockDataHandle &micro_handle = *read_handle.micro_handle_;
+        update_prefetch_depth(micro_handle.block_state_, micro_handle.io_handle_.is_finished());
+      }
+    }
+  }
+}
+
+void ObIndexTreeMultiPrefetcher::update_prefetch_depth(const int32_t block_state, const bool is_io_finished)
+{
+  if (ObSSTableMicroBlockState::IN_BLOCK_IO == block_state && !is_io_finished) {
+    prefetch_depth_ = min(prefetch_depth_ * 2, max_handle_prefetching_cnt_);
+  } else if (ObSSTableMicroBlockState::IN_BLOCK_CACHE == block_state &&
+             prefetch_depth_ > MAX_MULTIGET_MICRO_DATA_HANDLE_CNT) {
+    prefetch_depth_--;
+  }
+}
+
 int ObIndexTreeMultiPrefetcher::init_for_sorted_multi_get()
 {
   int ret = OB_SUCCESS;
@@ -580,8 +623,9 @@ int ObIndexTreeMultiPrefetcher::multi_prefetch()
         level_handle.reset();
       }
     }
+    adjust_prefetch_depth();
     for (int64_t i = fetch_rowkey_idx_;
-         OB_SUCC(ret) && prefetched_rowkey_cnt_ < rowkey_cnt && i < fetch_rowkey_idx_ + max_handle_prefetching_cnt_;
+         OB_SUCC(ret) && prefetched_rowkey_cnt_ < rowkey_cnt && i < fetch_rowkey_idx_ + prefetch_depth_;
          ++i) {
       const bool is_rowkey_to_fetched = i == fetch_rowkey_idx_;
       const bool is_empty_handle = i >= prefetch_rowkey_idx_;
@@ -643,7 +687,8 @@ int ObIndexTreeMultiPrefetcher::multi_prefetch()
                     false, /* need submit io */
                     false, /* use_multi_block_prefetch */
                     next_handle,
-                    cur_level_))) {
+                    cur_level_,
+                    cur_index_info.is_data_block() ? get_compress_dict() : ObDecompressDict()))) {
           if (OB_ENTRY_NOT_EXIST == ret) {
             //not in cache yet, stop this rowkey prefetching if it's not the rowkey to be feteched
             ret = OB_SUCCESS;
@@ -1013,6 +1058,10 @@ int ObIndexTreeMultiPassPrefetcher<DATA_PREFETCH_DEPTH, INDEX_PREFETCH_DEPTH>::i
       access_ctx_->limit_param_->limit_ >= 0 &&
       access_ctx_->limit_param_->limit_ < 4096 &&
       access_ctx_->limit_param_->offset_ < INT32_MAX;
+  if (ObStoreRowIterator::is_scan(iter_type) && access_ctx_->query_flag_.enable_lob_prefetch()) {
+    // lob meta scan of a large lob always reads to the end of the range, skip the slow start
+    prefetch_depth_ = MAX(prefetch_depth_, DEFAULT_SCAN_MICRO_DATA_HANDLE_CNT / 2);
+  }
   use_multi_block_prefetch_ = (iter_param.get_io_read_batch_size() > 0);
   switch (iter_type) {
     case ObStoreRowIterator::IteratorMultiGet:
@@ -188,6 +188,13 @@ protected:
       ObTableAccessContext &access_ctx);
   OB_INLINE bool is_first_scan() const { return nullptr == sstable_; }
   OB_INLINE bool is_rescan() const { return 1 < table_scan_cnt_; }
+  // dictionary of the data blocks, it lives as long as sstable_meta_handle_
+  OB_INLINE common::ObDecompressDict get_compress_dict() const
+  {
+    return sstable_meta_handle_.is_valid()
+        ? sstable_meta_handle_.get_sstable_meta().get_compress_dict().get_decompress_dict()
+        : common::ObDecompressDict();
+  }
 private:
   ObMicroBlockDataHandle &get_read_handle(const int64_t level)
   {
@@ -269,6 +276,8 @@ class ObIndexTreeMultiPrefetcher : public ObIndexTreePrefetcher
 {
 public:
   static const int32_t MAX_MULTIGET_MICRO_DATA_HANDLE_CNT = 32;
+  // sorted multi get on cold data is bound by io latency, the prefetch depth grows up to it
+  static const int32_t MAX_SORTED_MULTIGET_MICRO_DATA_HANDLE_CNT = 256;
   struct ObSSTableReadHandleExt : public ObSSTableReadHandle {
     ObSSTableReadHandleExt() :
       ObSSTableReadHandle(),
@@ -320,6 +329,8 @@ public:
       prefetch_rowkey_idx_(0),
       prefetched_rowkey_cnt_(0),
       max_handle_prefetching_cnt_(0),
+      prefetch_depth_(0),
+      depth_checked_rowkey_idx_(-1),
       rowkeys_(nullptr),
       ext_read_handles_()
   {}
@@ -351,16 +362,19 @@ public:
     fetch_rowkey_idx_++;
   }
   OB_INLINE ObSSTableReadHandleExt &current_read_handle()
-  { return ext_read_handles_[fetch_rowkey_idx_ % MAX_MULTIGET_MICRO_DATA_HANDLE_CNT]; }
+  { return ext_read_handles_[fetch_rowkey_idx_ % max_handle_prefetching_cnt_]; }
   OB_INLINE ObMicroBlockDataHandle &current_micro_handle()
-  { return *ext_read_handles_[fetch_rowkey_idx_ % MAX_MULTIGET_MICRO_DATA_HANDLE_CNT].micro_handle_; }
+  { return *ext_read_handles_[fetch_rowkey_idx_ % max_handle_prefetching_cnt_].micro_handle_; }
   INHERIT_TO_STRING_KV("ObIndexTreePrefetcher", ObIndexTreePrefetcher, K_(index_tree_height), K_(is_rowkey_sorted),
-      K_(fetch_rowkey_idx), K_(prefetch_rowkey_idx), K_(prefetched_rowkey_cnt), K_(max_handle_prefetching_cnt));
+      K_(fetch_rowkey_idx), K_(prefetch_rowkey_idx), K_(prefetched_rowkey_cnt), K_(max_handle_prefetching_cnt),
+      K_(prefetch_depth));
   bool is_rowkey_sorted_;
   int64_t fetch_rowkey_idx_;
   int64_t prefetch_rowkey_idx_;
   int64_t prefetched_rowkey_cnt_;
   int32_t max_handle_prefetching_cnt_;
+  int32_t prefetch_depth_;
+  int64_t depth_checked_rowkey_idx_;
   const common::ObIArray<blocksstable::ObDatumRowkey> *rowkeys_;
   ReadHandleExtArray ext_read_handles_;
   ObReallocatedFixedArray<ObCachedLevelMicroDataHandle> level_handles_;
@@ -368,6 +382,9 @@ public:
   ObReallocatedFixedArray<int8_t> row_states_;
 private:
   void inner_reset();
+  int init_prefetch_handles(const int64_t rowkey_cnt);
+  void adjust_prefetch_depth();
+  void update_prefetch_depth(const int32_t block_state, const bool is_io_finished);
   int init_for_sorted_multi_get();
   int drill_down(
       const MacroBlockId &macro_id,
@@ -404,7 +404,8 @@ int ObMicroBlockHandleMgr::get_micro_block_handle(
     const bool need_submit_io,
     const bool use_multi_block_prefetch,
     ObMicroBlockDataHandle &micro_block_handle,
-    int16_t cur_level)
+    int16_t cur_level,
+    const ObDecompressDict &compress_dict)
 {
   int ret = OB_SUCCESS;
   const uint64_t tenant_id = MTL_ID();
@@ -424,6 +425,7 @@ int ObMicroBlockHandleMgr::get_micro_block_handle(
     LOG_WARN("Unexpect null index header", K(ret), KP(idx_header));
   } else if (OB_FAIL(idx_header->fill_micro_des_meta(true /* deep_copy_key */, micro_block_handle.des_meta_))) {
     LOG_WARN("Fail to fill micro block deserialize meta", K(ret));
+  } else if (FALSE_IT(micro_block_handle.des_meta_.compress_dict_ = compress_dict)) {
   } else if (FALSE_IT(micro_block_handle.init(tenant_id, macro_id, offset, size, index_block_info.get_logic_micro_id(),
                                               index_block_info.get_data_checksum(), this))) {
   } else if (OB_LIKELY(nullptr != ps_node)
@@ -483,11 +485,12 @@ int ObMicroBlockHandleMgr::prefetch_multi_data_block(
     if (1 == multi_io_params.count()) {
       for (int64_t i = 0; OB_SUCC(ret) && i < multi_io_params.count(); i++) {
         const ObMicroIndexInfo &index_info = micro_data_infos[multi_io_params.prefetch_idx_[i] % max_micro_handle_cnt];
+        ObMicroBlockDataHandle &micro_handle = micro_data_handles[multi_io_params.prefetch_idx_[i] % max_micro_handle_cnt];
         if (OB_FAIL(data_block_cache_->prefetch(tenant_id, macro_id, index_info, true,
-                                                macro_handle, &block_io_allocator_, is_major_macro_preread))) {
+                                                macro_handle, &block_io_allocator_, is_major_macro_preread,
+                                                micro_handle.des_meta_.compress_dict_))) {
           LOG_WARN("Fail to prefetch micro block", K(ret), K(index_info), K(macro_handle));
         } else {
-          ObMicroBlockDataHandle &micro_handle = micro_data_handles[multi_io_params.prefetch_idx_[i] % max_micro_handle_cnt];
           micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
           cache_mem_ctrl_.add_hold_size(micro_handle.get_handle_size());
           micro_handle.io_handle_ = macro_handle;
@@ -545,7 +548,8 @@ int ObMicroBlockHandleMgr::submit_async_io(
     ret = OB_SUCCESS;
     // continue and use prefetch in batch later
   } else if (OB_FAIL(cache->prefetch(tenant_id, macro_id, index_block_info, use_cache,
-                                     macro_handle, &block_io_allocator_))) {
+                                     macro_handle, &block_io_allocator_, false/*is_major_macro_preread*/,
+                                     micro_block_handle.des_meta_.compress_dict_))) {
     LOG_WARN("Fail to prefetch micro block", K(ret), K(index_block_info), K(macro_handle),
                                               K(micro_block_handle));
   } else {
@@ -178,7 +178,8 @@ public:
       const bool need_submit_io,
       const bool use_multi_block_prefetch,
       ObMicroBlockDataHandle &micro_block_handle,
-      int16_t cur_level);
+      int16_t cur_level,
+      const common::ObDecompressDict &compress_dict = common::ObDecompressDict());
   int prefetch_multi_data_block(
       const ObMicroIndexInfo *micro_data_infos,
       ObMicroBlockDataHandle *micro_data_handles,
@@ -62,6 +62,7 @@ void ObSSTableRowWholeScanner::reset()
   iter_param_ = nullptr;
   access_ctx_ = nullptr;
   sstable_ = nullptr;
+  sstable_meta_handle_.reset();
   query_range_.reset();
   prefetch_macro_cursor_ = 0;
   cur_macro_cursor_ = 0;
@@ -87,6 +88,7 @@ void ObSSTableRowWholeScanner::reuse()
   iter_param_ = nullptr;
   access_ctx_ = nullptr;
   sstable_ = nullptr;
+  sstable_meta_handle_.reset();
   query_range_.reset();
   prefetch_macro_cursor_ = 0;
   cur_macro_cursor_ = 0;
@@ -203,6 +205,8 @@ int ObSSTableRowWholeScanner::inner_open(
       rowkey_read_info = iter_param.read_info_;
     }
     if (OB_FAIL(ret)) {
+    } else if (OB_FAIL(sstable_->get_meta(sstable_meta_handle_))) {
+      LOG_WARN("fail to get sstable meta", K(ret), KPC_(sstable));
     } else if (OB_FAIL(init_micro_scanner(range))) {
       LOG_WARN("Failed to init micro scanner", K(ret));
     } else if (OB_FAIL(macro_block_iter_.open(
@@ -267,6 +271,8 @@ int ObSSTableRowWholeScanner::open(
 
     if (OB_FAIL(alloc_io_buf(io_buf_[0], sstable_->get_macro_read_size()))) {
       LOG_WARN("alloc io buffers failed", K(ret), K(sstable_->get_macro_read_size()));
+    } else if (OB_FAIL(sstable_->get_meta(sstable_meta_handle_))) {
+      LOG_WARN("fail to get sstable meta", K(ret), KPC_(sstable));
     } else if (OB_FAIL(init_micro_scanner(&query_range))) {
       LOG_WARN("Fail to init micro scanner", K(ret));
     } else {
@@ -485,6 +491,8 @@ int ObSSTableRowWholeScanner::open_macro_block()
       scan_handle.is_right_border_ = (cur_macro_cursor_ == prefetch_macro_cursor_ - 1);
       const ObITableReadInfo *rowkey_read_info = nullptr;
       micro_block_iter_.reset();
+      micro_block_iter_.set_compress_dict(
+          sstable_meta_handle_.get_sstable_meta().get_compress_dict().get_decompress_dict());
 
       if (OB_FAIL(iter_param_->get_index_read_info(sstable_->is_normal_cg_sstable(), rowkey_read_info))) {
         STORAGE_LOG(WARN, "unexpected null index read info", K(ret), K(sstable_->is_normal_cg_sstable()));
@@ -55,6 +55,7 @@ public:
       : iter_param_(nullptr),
       access_ctx_(nullptr),
       sstable_(nullptr),
+      sstable_meta_handle_(),
       allocator_(common::ObModIds::OB_SSTABLE_READER, OB_MALLOC_NORMAL_BLOCK_SIZE, MTL_ID()),
       io_buf_(),
       prefetch_macro_cursor_(0),
@@ -123,6 +124,8 @@ private:
   const ObTableIterParam *iter_param_;
   ObTableAccessContext *access_ctx_;
   blocksstable::ObSSTable *sstable_;
+  // keeps the compress dictionary of sstable_ alive while its micro blocks are decompressed
+  blocksstable::ObSSTableMetaHandle sstable_meta_handle_;
   blocksstable::ObDatumRange query_range_;
   common::ObArenaAllocator allocator_;
   compaction::ObCompactionBuffer io_buf_[PREFETCH_DEPTH];
@@ -238,7 +238,8 @@ ObSSTableMergeRes::ObSSTableMergeRes()
     nested_size_(0),
     table_backup_flag_(),
     root_row_store_type_(ObRowStoreType::MAX_ROW_STORE),
-    root_macro_seq_(0)
+    root_macro_seq_(0),
+    compress_dict_(nullptr)
 {
   MEMSET(encrypt_key_, 0, share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH);
   table_backup_flag_.clear();
@@ -293,6 +294,10 @@ void ObSSTableMergeRes::reset()
   table_backup_flag_.clear();
   root_row_store_type_ = ObRowStoreType::MAX_ROW_STORE;
   root_macro_seq_ = 0;
+  if (nullptr != compress_dict_) {
+    ObCompressDictMgr::get_instance().revert(compress_dict_);
+    compress_dict_ = nullptr;
+  }
 }
 
 bool ObSSTableMergeRes::is_valid() const
@@ -340,6 +345,7 @@ int ObSSTableMergeRes::assign(const ObSSTableMergeRes &src)
     root_row_store_type_ = src.root_row_store_type_;
     root_macro_seq_ = src.root_macro_seq_;
     MEMCPY(encrypt_key_, src.encrypt_key_, sizeof(encrypt_key_));
+    set_compress_dict(src.compress_dict_);
 
     if (OB_FAIL(data_block_ids_.reserve(src.data_block_ids_.count()))) {
       STORAGE_LOG(WARN, "failed to reserve count", K(ret));
@@ -377,6 +383,19 @@ int ObSSTableMergeRes::assign(const ObSSTableMergeRes &src)
   return ret;
 }
 
+void ObSSTableMergeRes::set_compress_dict(ObCompressDict *compress_dict)
+{
+  if (compress_dict_ != compress_dict) {
+    if (nullptr != compress_dict) {
+      ObCompressDictMgr::get_instance().inc_ref(compress_dict);
+    }
+    if (nullptr != compress_dict_) {
+      ObCompressDictMgr::get_instance().revert(compress_dict_);
+    }
+    compress_dict_ = compress_dict;
+  }
+}
+
 int ObSSTableMergeRes::fill_column_checksum_for_empty_major(
     const int64_t column_count, common::ObIArray<int64_t> &column_checksums)
 {
@@ -463,6 +482,7 @@ ObSSTableIndexBuilder::ObSSTableIndexBuilder(const bool use_double_write_buffer)
     ModulePageAllocator(sstable_allocator_)),
     res_(),
     object_cleaner_(),
+    compress_dict_(nullptr),
     optimization_mode_(ENABLE),
     enable_dump_disk_(false),
     is_closed_(false),
@@ -492,6 +512,10 @@ void ObSSTableIndexBuilder::reset()
   roots_.reset();
   index_row_.reset();
   res_.reset();
+  if (nullptr != compress_dict_) {
+    ObCompressDictMgr::get_instance().revert(compress_dict_);
+    compress_dict_ = nullptr;
+  }
   sstable_allocator_.reset();
   self_allocator_.reset();
   object_cleaner_.reset();
@@ -501,6 +525,33 @@ void ObSSTableIndexBuilder::reset()
   is_inited_ = false;
 }
 
+int ObSSTableIndexBuilder::publish_compress_dict(
+    const char *dict,
+    const int64_t dict_size,
+    ObCompressDict *&compress_dict)
+{
+  int ret = OB_SUCCESS;
+  compress_dict = nullptr;
+  if (OB_ISNULL(dict) || OB_UNLIKELY(dict_size <= 0)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), KP(dict), K(dict_size));
+  } else {
+    lib::ObMutexGuard guard(mutex_);
+    if (nullptr != compress_dict_) {
+      // published by another macro block writer of the parallel merge
+    } else if (OB_FAIL(ObCompressDictMgr::get_instance().acquire(dict, dict_size, compress_dict_))) {
+      STORAGE_LOG(WARN, "fail to acquire compress dict", K(ret), K(dict_size));
+    } else {
+      STORAGE_LOG(INFO, "publish compress dict", KPC_(compress_dict),
+          "table_cg_idx", data_store_desc_.get_desc().get_table_cg_idx());
+    }
+    if (OB_SUCC(ret)) {
+      compress_dict = compress_dict_;
+    }
+  }
+  return ret;
+}
+
 bool ObSSTableIndexBuilder::check_index_desc(const ObDataStoreDesc &index_desc) const
 {
   bool ret = true;
@@ -1645,6 +1696,7 @@ int ObSSTableIndexBuilder::close_with_macro_seq(
            share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH);
     res.master_key_id_ = desc.get_master_key_id();
     res.set_table_flag_with_macro_id_array();
+    res.set_compress_dict(get_compress_dict());
     if (OB_FAIL(res_.assign(res))) {
       STORAGE_LOG(WARN, "fail to save merge res", K(ret), K(res));
     } else if (OB_FAIL(object_cleaner_.mark_succeed())) {
@@ -14,6 +14,7 @@
 #define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_INDEX_MICRO_BLOCK_BUILDER_H_
 
 #include "lib/hash/ob_cuckoo_hashmap.h"
+#include "lib/compress/ob_compress_dict.h"
 #include "storage/blocksstable/index_block/ob_index_block_row_struct.h"
 #include "storage/blocksstable/index_block/ob_index_block_dumper.h"
 #include "storage/blocksstable/index_block/ob_clustered_index_block_writer.h"
@@ -257,6 +258,8 @@ public:
     dst_data.size_ = src_block_desc.addr_.size();
   }
   void set_table_flag_with_macro_id_array();
+  // take a reference of the dictionary, which is reverted in reset
+  void set_compress_dict(common::ObCompressDict *compress_dict);
   TO_STRING_KV(K_(root_desc), K_(data_root_desc), K(data_block_ids_.count()),
                K(other_block_ids_.count()), K_(index_blocks_cnt),
                K_(data_blocks_cnt), K_(micro_block_cnt), K_(data_column_cnt),
@@ -266,7 +269,7 @@ public:
                K_(use_old_macro_block_count), K_(compressor_type),
                K_(root_row_store_type), K_(nested_offset), K_(nested_size),
                K_(table_backup_flag), K_(root_macro_seq), K_(encrypt_id),
-               K_(master_key_id), KPHEX_(encrypt_key, sizeof(encrypt_key_)));
+               K_(master_key_id), KPHEX_(encrypt_key, sizeof(encrypt_key_)), KPC_(compress_dict));
 
 public:
   ObIndexTreeRootBlockDesc root_desc_;
@@ -294,6 +297,7 @@ public:
   ObRowStoreType root_row_store_type_;
   int64_t root_macro_seq_;
   char encrypt_key_[share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH];
+  common::ObCompressDict *compress_dict_;
   DISALLOW_COPY_AND_ASSIGN(ObSSTableMergeRes);
 };
 
@@ -637,7 +641,14 @@ public:
   OB_INLINE ObSSTablePrivateObjectCleaner & get_private_object_cleaner() { return object_cleaner_; }
   bool micro_index_clustered() const;
   const compaction::ObMergeBlockInfo &get_merge_block_info() const { return macro_writer_.get_merge_block_info(); }
-  TO_STRING_KV(K(roots_.count()));
+  // Dictionary shared by all the micro blocks of the sstable. The first published one wins,
+  // and the winner is returned to the later publishers.
+  int publish_compress_dict(
+      const char *dict,
+      const int64_t dict_size,
+      common::ObCompressDict *&compress_dict);
+  OB_INLINE common::ObCompressDict *get_compress_dict() const { return ATOMIC_LOAD(&compress_dict_); }
+  TO_STRING_KV(K(roots_.count()), KP_(compress_dict));
 
 public:
   static bool check_version_for_small_sstable(const ObDataStoreDesc &index_desc);
@@ -713,6 +724,7 @@ private:
   IndexTreeRootCtxList roots_;
   ObSSTableMergeRes res_;
   ObSSTablePrivateObjectCleaner object_cleaner_;
+  common::ObCompressDict *compress_dict_;
   ObSpaceOptimizationMode optimization_mode_;
   bool enable_dump_disk_;
   bool is_closed_;
@@ -0,0 +1,543 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#define USING_LOG_PREFIX STORAGE
+
+#include "storage/blocksstable/ob_block_cache_snapshot.h"
+#include <sys/stat.h>
+#include "lib/checksum/ob_crc64.h"
+#include "lib/file/ob_file.h"
+#include "lib/utility/ob_sort.h"
+#include "lib/utility/serialization.h"
+#include "share/ob_thread_mgr.h"
+#include "share/config/ob_server_config.h"
+#include "share/rc/ob_tenant_base.h"
+#include "observer/ob_server_struct.h"
+#include "storage/blocksstable/ob_macro_block_common_header.h"
+#include "storage/blocksstable/ob_sstable_macro_block_header.h"
+#include "storage/blocksstable/ob_storage_cache_suite.h"
+#include "storage/blocksstable/ob_object_manager.h"
+
+namespace oceanbase
+{
+using namespace common;
+namespace blocksstable
+{
+
+namespace
+{
+// index blocks first, then the micro blocks of a macro block in the order of offset
+struct WarmUpKeyCompare
+{
+  bool operator()(const ObMicroBlockCacheHotKey &left, const ObMicroBlockCacheHotKey &right) const
+  {
+    bool bret = false;
+    if (left.is_index_ != right.is_index_) {
+      bret = left.is_index_;
+    } else if (left.micro_id_.macro_id_ != right.micro_id_.macro_id_) {
+      bret = left.micro_id_.macro_id_ < right.micro_id_.macro_id_;
+    } else {
+      bret = left.micro_id_.offset_ < right.micro_id_.offset_;
+    }
+    return bret;
+  }
+};
+
+struct HotKeyHeatCompare
+{
+  bool operator()(const ObMicroBlockCacheHotKey &left, const ObMicroBlockCacheHotKey &right) const
+  {
+    return left.heat_ > right.heat_;
+  }
+};
+}
+
+ObBlockCacheSnapshot &ObBlockCacheSnapshot::get_instance()
+{
+  static ObBlockCacheSnapshot instance;
+  return instance;
+}
+
+ObBlockCacheSnapshot::ObBlockCacheSnapshot()
+  : is_inited_(false),
+    last_dump_ts_(0),
+    warm_up_pos_(0),
+    warm_up_block_cnt_(0),
+    warm_up_bytes_(0),
+    allocator_(ObMemAttr(OB_SERVER_TENANT_ID, "BlkCacheSnap")),
+    warm_up_keys_(),
+    macro_des_meta_(),
+    dump_task_(),
+    warm_up_task_()
+{
+  file_path_[0] = '\0';
+  warm_up_keys_.set_attr(ObMemAttr(OB_SERVER_TENANT_ID, "BlkCacheSnap"));
+}
+
+int ObBlockCacheSnapshot::init(const char *data_dir)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = 0;
+  if (OB_UNLIKELY(is_inited_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("block cache snapshot has been inited", K(ret));
+  } else if (OB_ISNULL(data_dir)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("invalid data dir", K(ret), KP(data_dir));
+  } else if (OB_FAIL(databuff_printf(file_path_, sizeof(file_path_), pos, "%s/block_cache_snapshot", data_dir))) {
+    LOG_WARN("fail to build snapshot file path", K(ret), K(data_dir));
+  } else {
+    is_inited_ = true;
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::start()
+{
+  int ret = OB_SUCCESS;
+  int tmp_ret = OB_SUCCESS;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("block cache snapshot is not inited", K(ret));
+  } else if (GCTX.is_shared_storage_mode()) {
+    LOG_INFO("block cache snapshot is not used in shared storage mode");
+  } else {
+    if (OB_TMP_FAIL(load_file())) {
+      LOG_WARN("fail to load block cache snapshot, skip warming up", K(tmp_ret), K_(file_path));
+      warm_up_keys_.reset();
+    }
+    last_dump_ts_ = ObTimeUtility::current_time();
+    if (OB_FAIL(TG_START(lib::TGDefIDs::BlockCacheSnapshot))) {
+      LOG_WARN("fail to start block cache snapshot timer", K(ret));
+    } else if (OB_FAIL(TG_SCHEDULE(lib::TGDefIDs::BlockCacheSnapshot, dump_task_, DUMP_CHECK_INTERVAL, true))) {
+      LOG_WARN("fail to schedule block cache dump task", K(ret));
+    } else if (!is_warm_up_finished() &&
+               OB_FAIL(TG_SCHEDULE(lib::TGDefIDs::BlockCacheSnapshot, warm_up_task_, WARM_UP_INTERVAL, true))) {
+      LOG_WARN("fail to schedule block cache warm up task", K(ret));
+    } else {
+      LOG_INFO("block cache snapshot started", KPC(this));
+    }
+  }
+  return ret;
+}
+
+void ObBlockCacheSnapshot::stop()
+{
+  TG_STOP(lib::TGDefIDs::BlockCacheSnapshot);
+}
+
+void ObBlockCacheSnapshot::wait()
+{
+  TG_WAIT(lib::TGDefIDs::BlockCacheSnapshot);
+}
+
+void ObBlockCacheSnapshot::destroy()
+{
+  TG_DESTROY(lib::TGDefIDs::BlockCacheSnapshot);
+  warm_up_keys_.reset();
+  warm_up_pos_ = 0;
+  macro_des_meta_.reset();
+  allocator_.reset();
+  is_inited_ = false;
+}
+
+int ObBlockCacheSnapshot::dump()
+{
+  int ret = OB_SUCCESS;
+  ObArray<ObMicroBlockCacheHotKey> hot_keys;
+  hot_keys.set_attr(ObMemAttr(OB_SERVER_TENANT_ID, "BlkCacheSnap"));
+  const int64_t start_ts = ObTimeUtility::current_time();
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("block cache snapshot is not inited", K(ret));
+  } else if (OB_FAIL(collect_hot_keys(hot_keys))) {
+    LOG_WARN("fail to collect hot keys of block cache", K(ret));
+  } else if (OB_FAIL(write_file(hot_keys))) {
+    LOG_WARN("fail to write block cache snapshot", K(ret), K_(file_path));
+  } else {
+    last_dump_ts_ = ObTimeUtility::current_time();
+    LOG_INFO("succeed to dump block cache snapshot", "key_cnt", hot_keys.count(),
+             "cost_us", last_dump_ts_ - start_ts, K_(file_path));
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::collect_hot_keys(ObIArray<ObMicroBlockCacheHotKey> &hot_keys)
+{
+  int ret = OB_SUCCESS;
+  int64_t start_pos = 0;
+  do {
+    if (OB_FAIL(ObKVGlobalCache::get_instance().get_batch_block_cache_hot_key(start_pos, hot_keys))) {
+      LOG_WARN("fail to get block cache hot keys", K(ret), K(start_pos));
+    } else if (hot_keys.count() >= 2 * MAX_HOT_KEY_CNT && OB_FAIL(shrink_hot_keys(hot_keys))) {
+      LOG_WARN("fail to shrink hot keys", K(ret));
+    }
+  } while (OB_SUCC(ret) && 0 != start_pos);
+  if (FAILEDx(shrink_hot_keys(hot_keys))) {
+    LOG_WARN("fail to shrink hot keys", K(ret));
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::shrink_hot_keys(ObIArray<ObMicroBlockCacheHotKey> &hot_keys)
+{
+  int ret = OB_SUCCESS;
+  if (hot_keys.count() > MAX_HOT_KEY_CNT) {
+    ObMicroBlockCacheHotKey *first = &hot_keys.at(0);
+    lib::ob_sort(first, first + hot_keys.count(), HotKeyHeatCompare());
+    while (hot_keys.count() > MAX_HOT_KEY_CNT) {
+      hot_keys.pop_back();
+    }
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::write_file(const ObIArray<ObMicroBlockCacheHotKey> &hot_keys)
+{
+  int ret = OB_SUCCESS;
+  const int64_t header_size = 5 * sizeof(int64_t);
+  int64_t body_size = 0;
+  for (int64_t i = 0; i < hot_keys.count(); ++i) {
+    body_size += hot_keys.at(i).get_serialize_size();
+  }
+  const int64_t buf_size = header_size + body_size;
+  char tmp_path[OB_MAX_FILE_NAME_LENGTH];
+  int64_t path_pos = 0;
+  char *buf = nullptr;
+  int64_t pos = header_size;
+  int fd = -1;
+  if (OB_FAIL(databuff_printf(tmp_path, sizeof(tmp_path), path_pos, "%s.tmp", file_path_))) {
+    LOG_WARN("fail to build tmp file path", K(ret), K_(file_path));
+  } else if (OB_ISNULL(buf = static_cast<char *>(ob_malloc(buf_size, ObMemAttr(OB_SERVER_TENANT_ID, "BlkCacheSnap"))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc snapshot buffer", K(ret), K(buf_size));
+  }
+  for (int64_t i = 0; OB_SUCC(ret) && i < hot_keys.count(); ++i) {
+    if (OB_FAIL(hot_keys.at(i).serialize(buf, buf_size, pos))) {
+      LOG_WARN("fail to serialize hot key", K(ret), K(i), K(hot_keys.at(i)));
+    }
+  }
+  if (OB_SUCC(ret)) {
+    const int64_t checksum = static_cast<int64_t>(ob_crc64(buf + header_size, body_size));
+    int64_t header_pos = 0;
+    if (OB_FAIL(serialization::encode_i64(buf, buf_size, header_pos, SNAPSHOT_MAGIC))) {
+      LOG_WARN("fail to encode magic", K(ret));
+    } else if (OB_FAIL(serialization::encode_i64(buf, buf_size, header_pos, SNAPSHOT_VERSION))) {
+      LOG_WARN("fail to encode version", K(ret));
+    } else if (OB_FAIL(serialization::encode_i64(buf, buf_size, header_pos, hot_keys.count()))) {
+      LOG_WARN("fail to encode key count", K(ret));
+    } else if (OB_FAIL(serialization::encode_i64(buf, buf_size, header_pos, body_size))) {
+      LOG_WARN("fail to encode body size", K(ret));
+    } else if (OB_FAIL(serialization::encode_i64(buf, buf_size, header_pos, checksum))) {
+      LOG_WARN("fail to encode checksum", K(ret));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if ((fd = ::open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP)) < 0) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to create snapshot file", K(ret), K(tmp_path), KERRMSG);
+  } else {
+    if (buf_size != unintr_write(fd, buf, buf_size)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("fail to write snapshot file", K(ret), K(tmp_path), K(buf_size), KERRMSG);
+    } else if (0 != ::fsync(fd)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("fail to sync snapshot file", K(ret), K(tmp_path), KERRMSG);
+    }
+    if (0 != ::close(fd)) {
+      ret = OB_SUCC(ret) ? OB_IO_ERROR : ret;
+      LOG_WARN("fail to close snapshot file", K(ret), K(tmp_path), KERRMSG);
+    }
+    if (OB_SUCC(ret) && 0 != ::rename(tmp_path, file_path_)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("fail to rename snapshot file", K(ret), K(tmp_path), K_(file_path), KERRMSG);
+    }
+  }
+  if (nullptr != buf) {
+    ob_free(buf);
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::load_file()
+{
+  int ret = OB_SUCCESS;
+  const int64_t header_size = 5 * sizeof(int64_t);
+  struct stat file_stat;
+  char *buf = nullptr;
+  int fd = -1;
+  int64_t file_size = 0;
+  if (0 != ::stat(file_path_, &file_stat)) {
+    if (ENOENT != errno) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("fail to stat snapshot file", K(ret), K_(file_path), KERRMSG);
+    }
+  } else if (FALSE_IT(file_size = file_stat.st_size)) {
+  } else if (OB_UNLIKELY(file_size < header_size)) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("snapshot file is too small", K(ret), K(file_size));
+  } else if (OB_ISNULL(buf = static_cast<char *>(ob_malloc(file_size, ObMemAttr(OB_SERVER_TENANT_ID, "BlkCacheSnap"))))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc snapshot buffer", K(ret), K(file_size));
+  } else if ((fd = ::open(file_path_, O_RDONLY)) < 0) {
+    ret = OB_IO_ERROR;
+    LOG_WARN("fail to open snapshot file", K(ret), K_(file_path), KERRMSG);
+  } else {
+    if (file_size != unintr_pread(fd, buf, file_size, 0)) {
+      ret = OB_IO_ERROR;
+      LOG_WARN("fail to read snapshot file", K(ret), K_(file_path), K(file_size), KERRMSG);
+    }
+    if (0 != ::close(fd)) {
+      LOG_WARN("fail to close snapshot file", K_(file_path), KERRMSG);
+    }
+  }
+  if (OB_SUCC(ret) && nullptr != buf) {
+    int64_t pos = 0;
+    int64_t magic = 0;
+    int64_t version = 0;
+    int64_t key_cnt = 0;
+    int64_t body_size = 0;
+    int64_t checksum = 0;
+    if (OB_FAIL(serialization::decode_i64(buf, file_size, pos, &magic))
+        || OB_FAIL(serialization::decode_i64(buf, file_size, pos, &version))
+        || OB_FAIL(serialization::decode_i64(buf, file_size, pos, &key_cnt))
+        || OB_FAIL(serialization::decode_i64(buf, file_size, pos, &body_size))
+        || OB_FAIL(serialization::decode_i64(buf, file_size, pos, &checksum))) {
+      LOG_WARN("fail to decode snapshot header", K(ret));
+    } else if (OB_UNLIKELY(SNAPSHOT_MAGIC != magic || version <= 0 || version > SNAPSHOT_VERSION
+                           || key_cnt < 0 || key_cnt > MAX_HOT_KEY_CNT
+                           || header_size + body_size != file_size)) {
+      ret = OB_INVALID_DATA;
+      LOG_WARN("invalid snapshot header", K(ret), K(magic), K(version), K(key_cnt), K(body_size), K(file_size));
+    } else if (OB_UNLIKELY(checksum != static_cast<int64_t>(ob_crc64(buf + header_size, body_size)))) {
+      ret = OB_CHECKSUM_ERROR;
+      LOG_WARN("snapshot checksum mismatch", K(ret), K(checksum));
+    } else if (OB_FAIL(warm_up_keys_.reserve(key_cnt))) {
+      LOG_WARN("fail to reserve warm up keys", K(ret), K(key_cnt));
+    } else {
+      ObMicroBlockCacheHotKey hot_key;
+      for (int64_t i = 0; OB_SUCC(ret) && i < key_cnt; ++i) {
+        if (OB_FAIL(hot_key.deserialize(buf, file_size, pos))) {
+          LOG_WARN("fail to deserialize hot key", K(ret), K(i));
+        } else if (!hot_key.is_valid()) {
+        } else if (OB_FAIL(warm_up_keys_.push_back(hot_key))) {
+          LOG_WARN("fail to push back hot key", K(ret), K(hot_key));
+        }
+      }
+      if (OB_SUCC(ret) && warm_up_keys_.count() > 0) {
+        lib::ob_sort(warm_up_keys_.begin(), warm_up_keys_.end(), WarmUpKeyCompare());
+        LOG_INFO("succeed to load block cache snapshot", "key_cnt", warm_up_keys_.count(), K_(file_path));
+      }
+    }
+  }
+  if (nullptr != buf) {
+    ob_free(buf);
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::warm_up(const int64_t max_bytes)
+{
+  int ret = OB_SUCCESS;
+  static const int64_t MAX_KEY_CNT_PER_ROUND = 4096;
+  int64_t bytes = 0;
+  int64_t key_cnt = 0;
+  if (IS_NOT_INIT) {
+    ret = OB_NOT_INIT;
+    LOG_WARN("block cache snapshot is not inited", K(ret));
+  } else if (!is_warm_up_finished()) {
+    ObMacroBlockReader reader;
+    while (bytes < max_bytes && key_cnt < MAX_KEY_CNT_PER_ROUND && !is_warm_up_finished()) {
+      const ObMicroBlockCacheHotKey &hot_key = warm_up_keys_.at(warm_up_pos_++);
+      int64_t read_size = 0;
+      ++key_cnt;
+      MTL_SWITCH(hot_key.tenant_id_) {
+        if (OB_FAIL(load_block(hot_key, reader, read_size))) {
+          LOG_WARN("fail to load micro block into block cache", K(ret), K(hot_key));
+        }
+      }
+      // best effort, the tenant may be dropped and the block may be recycled
+      ret = OB_SUCCESS;
+      allocator_.reuse();
+      if (read_size > 0) {
+        bytes += read_size;
+        warm_up_bytes_ += read_size;
+        ++warm_up_block_cnt_;
+      }
+    }
+    if (is_warm_up_finished()) {
+      LOG_INFO("finish warming up block cache", KPC(this));
+      warm_up_keys_.reset();
+      warm_up_pos_ = 0;
+      macro_des_meta_.reset();
+      allocator_.reset();
+    }
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::load_block(
+    const ObMicroBlockCacheHotKey &hot_key,
+    ObMacroBlockReader &reader,
+    int64_t &read_size)
+{
+  int ret = OB_SUCCESS;
+  const MacroBlockId &macro_id = hot_key.micro_id_.macro_id_;
+  const int64_t size = hot_key.micro_id_.size_;
+  ObIMicroBlockCache &cache = OB_STORE_CACHE.get_micro_block_cache(!hot_key.is_index_);
+  ObIMicroBlockCache::BaseBlockCache *kvcache = nullptr;
+  ObMicroBlockCacheKey key;
+  const ObMicroBlockCacheValue *cached_value = nullptr;
+  ObKVCacheHandle cached_handle;
+  bool is_free = false;
+  read_size = 0;
+  key.set(hot_key.tenant_id_, hot_key.micro_id_);
+  if (OB_FAIL(cache.get_cache(kvcache))) {
+    LOG_WARN("fail to get block cache", K(ret));
+  } else if (OB_SUCCESS == kvcache->get(key, cached_value, cached_handle)) {
+    // already loaded by the queries
+  } else if (OB_FAIL(OB_SERVER_BLOCK_MGR.check_macro_block_free(macro_id, is_free))) {
+    LOG_WARN("fail to check macro block free", K(ret), K(macro_id));
+  } else if (is_free) {
+    // the macro block is recycled after the snapshot
+  } else if (macro_id != macro_des_meta_.macro_id_ && OB_FAIL(read_des_meta(macro_id))) {
+    LOG_WARN("fail to read des meta of macro block", K(ret), K(macro_id));
+  } else if (!macro_des_meta_.is_valid_) {
+    // not a macro block of sstable with a header of its own
+  } else {
+    char *buf = nullptr;
+    ObStorageObjectHandle object_handle;
+    ObMicroBlockHeader header;
+    int64_t pos = 0;
+    if (OB_ISNULL(buf = static_cast<char *>(allocator_.alloc(size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to alloc micro block buffer", K(ret), K(size));
+    } else if (OB_FAIL(read_object(macro_id, hot_key.micro_id_.offset_, size, buf, object_handle))) {
+      LOG_WARN("fail to read micro block", K(ret), K(hot_key));
+    } else if (FALSE_IT(read_size = size)) {
+    } else if (OB_FAIL(header.deserialize(object_handle.get_buffer(), size, pos))) {
+      LOG_WARN("fail to deserialize micro block header", K(ret), K(hot_key));
+    } else if (OB_UNLIKELY(MICRO_BLOCK_HEADER_MAGIC != header.magic_ || OB_SUCCESS != header.check_header_checksum())) {
+      // the macro block is reused by other data
+      LOG_INFO("micro block of snapshot is changed, skip it", K(hot_key));
+    } else {
+      ObMicroBlockDesMeta des_meta = macro_des_meta_.des_meta_;
+      des_meta.row_store_type_ = static_cast<ObRowStoreType>(header.row_store_type_);
+      const ObMicroBlockCacheValue *micro_block = nullptr;
+      ObKVCacheHandle cache_handle;
+      if (OB_FAIL(cache.put_cache_block(des_meta, object_handle.get_buffer(), size, key,
+                                        reader, allocator_, micro_block, cache_handle))) {
+        LOG_WARN("fail to put micro block into cache", K(ret), K(hot_key), K(des_meta));
+      }
+    }
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::read_des_meta(const MacroBlockId &macro_id)
+{
+  int ret = OB_SUCCESS;
+  typedef ObSSTableMacroBlockHeader::FixedHeader FixedHeader;
+  ObStorageObjectHandle object_handle;
+  ObMacroBlockCommonHeader common_header;
+  FixedHeader fixed_header;
+  char *buf = nullptr;
+  int64_t pos = 0;
+  macro_des_meta_.reset();
+  macro_des_meta_.macro_id_ = macro_id;
+  if (OB_ISNULL(buf = static_cast<char *>(allocator_.alloc(MACRO_HEADER_READ_SIZE)))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to alloc macro header buffer", K(ret));
+  } else if (OB_FAIL(read_object(macro_id, 0, MACRO_HEADER_READ_SIZE, buf, object_handle))) {
+    LOG_WARN("fail to read macro block header", K(ret), K(macro_id));
+  } else if (OB_FAIL(common_header.deserialize(object_handle.get_buffer(), object_handle.get_data_size(), pos))) {
+    LOG_WARN("fail to deserialize common header", K(ret), K(macro_id));
+  } else if (OB_FAIL(common_header.check_integrity())) {
+    LOG_WARN("invalid common header", K(ret), K(macro_id), K(common_header));
+  } else if (!common_header.is_sstable_data_block()
+             && !common_header.is_sstable_index_block()
+             && !common_header.is_sstable_macro_meta_block()) {
+    // shared macro blocks put the headers of many sstables in one macro block
+  } else if (OB_UNLIKELY(pos + static_cast<int64_t>(sizeof(FixedHeader)) > object_handle.get_data_size())) {
+    ret = OB_BUF_NOT_ENOUGH;
+    LOG_WARN("macro block header is not read", K(ret), K(macro_id), K(pos));
+  } else if (FALSE_IT(MEMCPY(&fixed_header, object_handle.get_buffer() + pos, sizeof(FixedHeader)))) {
+  } else if (OB_UNLIKELY(!fixed_header.is_valid())) {
+    ret = OB_INVALID_DATA;
+    LOG_WARN("invalid macro block header", K(ret), K(macro_id), K(fixed_header));
+  } else {
+    // only the fixed part of the header is needed, which does not grow with the column count
+    ObMicroBlockDesMeta &des_meta = macro_des_meta_.des_meta_;
+    des_meta.compressor_type_ = fixed_header.compressor_type_;
+    des_meta.row_store_type_ = static_cast<ObRowStoreType>(fixed_header.row_store_type_);
+    des_meta.encrypt_id_ = fixed_header.encrypt_id_;
+    des_meta.master_key_id_ = fixed_header.master_key_id_;
+    MEMCPY(macro_des_meta_.encrypt_key_, fixed_header.encrypt_key_, sizeof(macro_des_meta_.encrypt_key_));
+    des_meta.encrypt_key_ = macro_des_meta_.encrypt_key_;
+    macro_des_meta_.is_valid_ = true;
+  }
+  return ret;
+}
+
+int ObBlockCacheSnapshot::read_object(
+    const MacroBlockId &macro_id,
+    const int64_t offset,
+    const int64_t size,
+    char *buf,
+    ObStorageObjectHandle &handle)
+{
+  int ret = OB_SUCCESS;
+  ObStorageObjectReadInfo read_info;
+  read_info.macro_block_id_ = macro_id;
+  read_info.offset_ = offset;
+  read_info.size_ = size;
+  read_info.buf_ = buf;
+  read_info.io_timeout_ms_ = IO_TIMEOUT_MS;
+  read_info.io_desc_.set_mode(ObIOMode::READ);
+  read_info.io_desc_.set_wait_event(ObWaitEventIds::DB_FILE_DATA_READ);
+  read_info.io_desc_.set_sys_module_id(ObIOModule::MICRO_BLOCK_CACHE_IO);
+  read_info.mtl_tenant_id_ = MTL_ID();
+  if (OB_FAIL(ObObjectManager::read_object(read_info, handle))) {
+    LOG_WARN("fail to read object", K(ret), K(read_info));
+  }
+  return ret;
+}
+
+void ObBlockCacheSnapshot::DumpTask::runTimerTask()
+{
+  int ret = OB_SUCCESS;
+  ObBlockCacheSnapshot &snapshot = ObBlockCacheSnapshot::get_instance();
+  const int64_t interval = GCONF._block_cache_snapshot_interval;
+  // do not overwrite the snapshot before it is loaded back
+  if (0 < interval && snapshot.is_warm_up_finished()
+      && ObTimeUtility::current_time() - snapshot.last_dump_ts_ >= interval) {
+    if (OB_FAIL(snapshot.dump())) {
+      LOG_WARN("fail to dump block cache snapshot", K(ret));
+    }
+  }
+}
+
+void ObBlockCacheSnapshot::WarmUpTask::runTimerTask()
+{
+  int ret = OB_SUCCESS;
+  ObBlockCacheSnapshot &snapshot = ObBlockCacheSnapshot::get_instance();
+  const int64_t bandwidth = GCONF._block_cache_warm_up_bandwidth;
+  if (0 < bandwidth && !snapshot.is_warm_up_finished()) {
+    const int64_t max_bytes = MAX(1, bandwidth * WARM_UP_INTERVAL / (1000 * 1000L));
+    if (OB_FAIL(snapshot.warm_up(max_bytes))) {
+      LOG_WARN("fail to warm up block cache", K(ret));
+    }
+  }
+}
+
+} // namespace blocksstable
+} // namespace oceanbase
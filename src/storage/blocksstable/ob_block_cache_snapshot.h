@@ -0,0 +1,106 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_BLOCK_CACHE_SNAPSHOT_H_
+#define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_BLOCK_CACHE_SNAPSHOT_H_
+
+#include "lib/task/ob_timer.h"
+#include "lib/container/ob_array.h"
+#include "storage/blocksstable/ob_micro_block_cache.h"
+#include "storage/blocksstable/ob_storage_object_handle.h"
+
+namespace oceanbase
+{
+namespace blocksstable
+{
+
+// ObBlockCacheSnapshot keeps the index and data block caches warm across observer restarts.
+// Every _block_cache_snapshot_interval, the hottest micro blocks of the caches are persisted
+// to a snapshot file in the data dir. After restart, the snapshot is loaded and the micro
+// blocks are read back into the caches in the background, at most
+// _block_cache_warm_up_bandwidth bytes per second. Index blocks are loaded first.
+// Only the physical cache keys of shared-nothing mode are persisted.
+class ObBlockCacheSnapshot
+{
+public:
+  static const int64_t MAX_HOT_KEY_CNT = 128L << 10;
+  static ObBlockCacheSnapshot &get_instance();
+  int init(const char *data_dir);
+  int start();
+  void stop();
+  void wait();
+  void destroy();
+  // persist the hottest micro blocks of the block caches
+  int dump();
+  // load the micro blocks of the snapshot into the block caches, at most @max_bytes per call
+  int warm_up(const int64_t max_bytes);
+  OB_INLINE bool is_warm_up_finished() const { return warm_up_pos_ >= warm_up_keys_.count(); }
+  TO_STRING_KV(K_(is_inited), K_(file_path), K_(last_dump_ts), K_(warm_up_pos),
+               "warm_up_key_cnt", warm_up_keys_.count(), K_(warm_up_block_cnt), K_(warm_up_bytes));
+private:
+  class DumpTask : public common::ObTimerTask
+  {
+  public:
+    virtual void runTimerTask() override;
+  };
+  class WarmUpTask : public common::ObTimerTask
+  {
+  public:
+    virtual void runTimerTask() override;
+  };
+  // the des meta of the micro blocks in a macro block, taken from the macro block header
+  struct MacroDesMeta
+  {
+    MacroDesMeta() : macro_id_(), des_meta_(), is_valid_(false) { MEMSET(encrypt_key_, 0, sizeof(encrypt_key_)); }
+    void reset() { macro_id_.reset(); is_valid_ = false; }
+    MacroBlockId macro_id_;
+    ObMicroBlockDesMeta des_meta_;
+    char encrypt_key_[share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH];
+    bool is_valid_;
+  };
+  static const int64_t DUMP_CHECK_INTERVAL = 60 * 1000 * 1000L; // 60s
+  static const int64_t WARM_UP_INTERVAL = 100 * 1000L; // 100ms
+  static const int64_t MACRO_HEADER_READ_SIZE = 4L << 10;
+  static const int64_t SNAPSHOT_MAGIC = 0x50414E53434B4C42; // "BLKCSNAP"
+  // snapshots of older versions must stay readable after upgrade, the hot keys are
+  // OB_UNIS encoded so new fields can be appended to them without a version change
+  static const int64_t SNAPSHOT_VERSION = 1;
+  static const int64_t IO_TIMEOUT_MS = 10 * 1000L;
+  ObBlockCacheSnapshot();
+  ~ObBlockCacheSnapshot() { destroy(); }
+  int collect_hot_keys(common::ObIArray<ObMicroBlockCacheHotKey> &hot_keys);
+  int shrink_hot_keys(common::ObIArray<ObMicroBlockCacheHotKey> &hot_keys);
+  int write_file(const common::ObIArray<ObMicroBlockCacheHotKey> &hot_keys);
+  int load_file();
+  int load_block(const ObMicroBlockCacheHotKey &hot_key, ObMacroBlockReader &reader, int64_t &read_size);
+  int read_des_meta(const MacroBlockId &macro_id);
+  int read_object(const MacroBlockId &macro_id, const int64_t offset, const int64_t size,
+                  char *buf, ObStorageObjectHandle &handle);
+private:
+  bool is_inited_;
+  int64_t last_dump_ts_;
+  int64_t warm_up_pos_;
+  int64_t warm_up_block_cnt_;
+  int64_t warm_up_bytes_;
+  char file_path_[common::OB_MAX_FILE_NAME_LENGTH];
+  common::ObArenaAllocator allocator_;
+  common::ObArray<ObMicroBlockCacheHotKey> warm_up_keys_;
+  MacroDesMeta macro_des_meta_;
+  DumpTask dump_task_;
+  WarmUpTask warm_up_task_;
+  DISALLOW_COPY_AND_ASSIGN(ObBlockCacheSnapshot);
+};
+
+} // namespace blocksstable
+} // namespace oceanbase
+
+#endif // OCEANBASE_STORAGE_BLOCKSSTABLE_OB_BLOCK_CACHE_SNAPSHOT_H_
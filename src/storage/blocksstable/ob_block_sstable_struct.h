@@ -16,6 +16,7 @@
 #include "common/log/ob_log_cursor.h"
 #include "common/ob_store_format.h"
 #include "lib/allocator/ob_mod_define.h"
+#include "lib/compress/ob_compress_dict.h"
 #include "lib/compress/ob_compress_util.h"
 #include "lib/container/ob_iarray.h"
 #include "lib/container/ob_se_array.h"
@@ -1068,7 +1069,7 @@ public:
     : compressor_type_(common::INVALID_COMPRESSOR),
       row_store_type_(common::ObRowStoreType::MAX_ROW_STORE),
       encrypt_id_(0),
-      master_key_id_(0), encrypt_key_(nullptr) {}
+      master_key_id_(0), encrypt_key_(nullptr), compress_dict_() {}
   ObMicroBlockDesMeta(const common::ObCompressorType compressor_type,
                       const common::ObRowStoreType row_store_type,
                       const int64_t encrypt_id,
@@ -1078,9 +1079,11 @@ public:
       row_store_type_(row_store_type),
       encrypt_id_(encrypt_id),
       master_key_id_(master_key_id),
-      encrypt_key_(encrypt_key) {}
+      encrypt_key_(encrypt_key),
+      compress_dict_() {}
   TO_STRING_KV(K_(compressor_type), K_(row_store_type), K_(encrypt_id), K_(master_key_id),
-      KPHEX_(encrypt_key, nullptr == encrypt_key_ ? 0 : share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH));
+      KPHEX_(encrypt_key, nullptr == encrypt_key_ ? 0 : share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH),
+      K(compress_dict_.length()));
   OB_INLINE bool is_valid() const
   {
     return common::ObCompressorType::INVALID_COMPRESSOR < compressor_type_
@@ -1093,6 +1096,9 @@ public:
   int64_t encrypt_id_;
   int64_t master_key_id_;
   const char *encrypt_key_;
+  // dictionary of the sstable for the data blocks compressed with dictionary, not owned,
+  // the reader holds the sstable meta handle while the block is read
+  common::ObDecompressDict compress_dict_;
 };
 }//end namespace blocksstable
 }//end namespace oceanbase
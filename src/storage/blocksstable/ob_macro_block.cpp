@@ -12,6 +12,8 @@
 
 #include "common/ob_store_format.h"
 #include "common/sql_mode/ob_sql_mode_utils.h"
+#include "lib/compress/ob_compress_dict.h"
+#include "lib/compress/zstd_1_3_8/ob_zstd_compressor_1_3_8.h"
 #include "lib/utility/ob_tracepoint.h"
 #include "ob_block_manager.h"
 #include "ob_macro_block.h"
@@ -45,6 +47,7 @@ ObMicroBlockCompressor::ObMicroBlockCompressor()
   : is_none_(false),
     micro_block_size_(0),
     compressor_(NULL),
+    dict_(NULL),
     comp_buf_("MicroBlkComp"),
     decomp_buf_("MicroBlkDecomp")
 {
@@ -61,6 +64,7 @@ void ObMicroBlockCompressor::reset()
   if (compressor_ != nullptr) {
     compressor_ = nullptr;
   }
+  dict_ = nullptr;
   comp_buf_.reuse();
   decomp_buf_.reuse();
 }
@@ -85,6 +89,22 @@ int ObMicroBlockCompressor::init(const int64_t micro_block_size, const ObCompres
   return ret;
 }
 
+int ObMicroBlockCompressor::set_dict(ObCompressDict *dict)
+{
+  int ret = OB_SUCCESS;
+  if (OB_ISNULL(dict)) {
+    ret = OB_INVALID_ARGUMENT;
+    STORAGE_LOG(WARN, "invalid argument", K(ret), KP(dict));
+  } else if (OB_ISNULL(compressor_)
+      || OB_UNLIKELY(ZSTD_1_3_8_COMPRESSOR != compressor_->get_compressor_type())) {
+    ret = OB_NOT_SUPPORTED;
+    STORAGE_LOG(WARN, "only zstd_1.3.8 supports dictionary", K(ret), KP_(compressor));
+  } else {
+    dict_ = dict;
+  }
+  return ret;
+}
+
 int ObMicroBlockCompressor::compress(const char *in, const int64_t in_size, const char *&out,
                                      int64_t &out_size)
 {
@@ -101,13 +121,19 @@ int ObMicroBlockCompressor::compress(const char *in, const int64_t in_size, cons
   } else {
     int64_t comp_size = 0;
     int64_t max_comp_size = max_overflow_size + in_size;
+    if (nullptr != dict_) {
+      max_comp_size += zstd_1_3_8::ObZstdCompressor_1_3_8::DICT_FRAME_HEADER_SIZE;
+    }
     int64_t need_size = std::max(max_comp_size, micro_block_size_ * 2);
     if (OB_FAIL(comp_buf_.ensure_space(need_size))) {
       STORAGE_LOG(WARN, "macro block writer fail to allocate memory for comp_buf_.", K(ret),
                   K(need_size));
-    } else if (OB_FAIL(compressor_->compress(in, in_size, comp_buf_.data(), max_comp_size, comp_size))) {
+    } else if (OB_FAIL(nullptr != dict_
+        ? static_cast<zstd_1_3_8::ObZstdCompressor_1_3_8 *>(compressor_)->compress(
+            in, in_size, comp_buf_.data(), max_comp_size, comp_size, *dict_)
+        : compressor_->compress(in, in_size, comp_buf_.data(), max_comp_size, comp_size))) {
       STORAGE_LOG(WARN, "compressor fail to compress.", K(in), K(in_size),
-                  "comp_ptr", comp_buf_.data(), K(max_comp_size), K(comp_size));
+                  "comp_ptr", comp_buf_.data(), K(max_comp_size), K(comp_size), KPC_(dict));
     } else if (comp_size >= in_size) {
       STORAGE_LOG(TRACE, "compressed_size is larger than origin_size",
                   K(comp_size), K(in_size));
@@ -27,6 +27,9 @@
 #include "storage/compaction/ob_sstable_merge_history.h"
 
 namespace oceanbase {
+namespace common {
+class ObCompressDict;
+}
 namespace blocksstable {
 class ObSSTableIndexBuilder;
 struct ObMicroBlockDesc;
@@ -41,6 +44,10 @@ public:
   virtual ~ObMicroBlockCompressor();
   void reset();
   int init(const int64_t micro_block_size, const ObCompressorType type);
+  // compress with the dictionary from now on, only zstd_1.3.8 supports it.
+  // The caller holds the reference of the dictionary.
+  int set_dict(common::ObCompressDict *dict);
+  OB_INLINE bool has_dict() const { return nullptr != dict_; }
   int compress(const char *in, const int64_t in_size, const char *&out, int64_t &out_size);
   int decompress(const char *in, const int64_t in_size, const int64_t uncomp_size,
       const char *&out, int64_t &out_size);
@@ -48,6 +55,7 @@ private:
   bool is_none_;
   int64_t micro_block_size_;
   common::ObCompressor *compressor_;
+  common::ObCompressDict *dict_;
   storage::ObCompactionBufferWriter comp_buf_;
   storage::ObCompactionBufferWriter decomp_buf_;
 };
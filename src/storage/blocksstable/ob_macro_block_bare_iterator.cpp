@@ -31,7 +31,7 @@ ObMicroBlockBareIterator::ObMicroBlockBareIterator(const uint64_t tenant_id)
     macro_block_header_(), reader_(nullptr), micro_reader_helper_(),
     index_rowkey_cnt_(0),
     begin_idx_(0), end_idx_(0), iter_idx_(0), read_pos_(0),
-    need_deserialize_(false), is_inited_(false)
+    compress_dict_(), need_deserialize_(false), is_inited_(false)
 {
 }
 
@@ -53,6 +53,7 @@ void ObMicroBlockBareIterator::reset()
   end_idx_ = 0;
   iter_idx_ = 0;
   read_pos_ = 0;
+  compress_dict_.reset();
   allocator_.reset();
   is_inited_ = false;
 }
@@ -206,7 +207,8 @@ int ObMicroBlockBareIterator::get_next_micro_block_data_and_offset(ObMicroBlockD
         micro_buf_size,
         micro_block.get_buf(),
         micro_block.get_buf_size(),
-        is_compressed))) {
+        is_compressed,
+        compress_dict_))) {
       LOG_WARN("Fail to decrypt and decompress micro block data", K(ret), K(macro_block_header_));
     }
 
@@ -331,7 +333,8 @@ int ObMicroBlockBareIterator::get_next_micro_block_desc(
         micro_buf_size,
         micro_block.get_buf(),
         micro_block.get_buf_size(),
-        is_compressed))) {
+        is_compressed,
+        compress_dict_))) {
       LOG_WARN("Fail to decrypt and decompress micro block data", K(ret), K(macro_block_header_));
     } else if (OB_FAIL(last_row.init(allocator, index_rowkey_cnt_ + 1))) {
       STORAGE_LOG(WARN, "Fail to init last row", K(ret));
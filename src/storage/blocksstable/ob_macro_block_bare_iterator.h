@@ -65,6 +65,8 @@ public:
   int get_macro_meta_block(ObMicroBlockData &micro_block);
   bool is_left_border() const { return iter_idx_ == begin_idx_; }
   bool is_right_border() const { return iter_idx_ == end_idx_; }
+  // dictionary of the sstable the macro block belongs to, not owned, kept across reuse()
+  void set_compress_dict(const common::ObDecompressDict &compress_dict) { compress_dict_ = compress_dict; }
   TO_STRING_KV(KP_(macro_block_buf), K_(macro_block_buf_size), K_(common_header),
       K_(macro_block_header), K_(begin_idx), K_(end_idx), K_(iter_idx), K_(read_pos),
       K_(need_deserialize), K_(is_inited));
@@ -91,6 +93,7 @@ private:
   int64_t end_idx_;
   int64_t iter_idx_;
   int64_t read_pos_;
+  common::ObDecompressDict compress_dict_;
   bool need_deserialize_;
   bool is_inited_;
 private:
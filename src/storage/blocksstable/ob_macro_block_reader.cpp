@@ -15,6 +15,7 @@
 #include "storage/blocksstable/encoding/ob_micro_block_decoder.h"
 #include "storage/blocksstable/cs_encoding/ob_cs_micro_block_transformer.h"
 #include "lib/compress/ob_compressor_pool.h"
+#include "lib/compress/zstd_1_3_8/ob_zstd_compressor_1_3_8.h"
 #include "share/ob_encryption_util.h"
 #include "share/rc/ob_tenant_base.h"
 #include "share/scheduler/ob_tenant_dag_scheduler.h"
@@ -118,7 +119,8 @@ int ObMacroBlockReader::decompress_data_buf(
     const int64_t data_buf_size,
     const char *&uncomp_buf,
     int64_t &uncomp_size,
-    ObIAllocator *ext_allocator)
+    ObIAllocator *ext_allocator,
+    const ObDecompressDict &compress_dict)
 {
   // uncomp_buf: header + uncomp_data
   int ret = OB_SUCCESS;
@@ -131,12 +133,6 @@ int ObMacroBlockReader::decompress_data_buf(
   } else if (OB_FAIL(header.deserialize(header_buf, header_size, pos))) {
     STORAGE_LOG(WARN, "fail to deserialize record header", K(ret));
   } else {
-    if (nullptr == compressor_ || compressor_->get_compressor_type() != compressor_type) {
-      if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor_))) {
-        STORAGE_LOG(WARN, "Fail to get compressor, ", K(ret), K(compressor_type));
-      }
-    }
-
     const int64_t data_length = header.data_length_;
     uncomp_size = header_size + data_length;
     int64_t pos = 0;
@@ -147,7 +143,7 @@ int ObMacroBlockReader::decompress_data_buf(
       if (OB_FAIL(alloc_buf(*ext_allocator, uncomp_size, ext_uncomp_buf))) {
         LOG_WARN("Fail to allocate buf", K(ret), K(uncomp_size), K(header));
       } else {
-        if (OB_FAIL(compressor_->decompress(data_buf, data_buf_size,
+        if (OB_FAIL(do_decompress(compressor_type, compress_dict, data_buf, data_buf_size,
             ext_uncomp_buf + header_size, data_length, uncomp_size))) {
           LOG_WARN("compressor fail to decompress.", K(ret));
         } else if (OB_FAIL(header.deep_copy(ext_uncomp_buf, header_size, pos, copied_header))) {
@@ -163,7 +159,7 @@ int ObMacroBlockReader::decompress_data_buf(
       }
     } else if (OB_FAIL(alloc_buf(uncomp_size, uncomp_buf_, uncomp_buf_size_))) {
       LOG_WARN("Fail to allocate buf", K(ret));
-    } else if (OB_FAIL(compressor_->decompress(data_buf, data_buf_size,
+    } else if (OB_FAIL(do_decompress(compressor_type, compress_dict, data_buf, data_buf_size,
         uncomp_buf_ + header_size, data_length, uncomp_size))) {
       LOG_WARN("Fail to decompress", K(ret));
     } else if (OB_FAIL(header.deep_copy(uncomp_buf_, header_size, pos, copied_header))) {
@@ -218,7 +214,8 @@ int ObMacroBlockReader::decrypt_and_decompress_data(
     const int64_t size,
     const char *&uncomp_buf,
     int64_t &uncomp_size,
-    bool &is_compressed)
+    bool &is_compressed,
+    const ObDecompressDict &compress_dict)
 {
   int ret = OB_SUCCESS;
   int64_t header_size = 0;
@@ -234,6 +231,7 @@ int ObMacroBlockReader::decrypt_and_decompress_data(
         block_header.fixed_header_.encrypt_id_,
         block_header.fixed_header_.master_key_id_,
         block_header.fixed_header_.encrypt_key_);
+    deserialize_meta.compress_dict_ = compress_dict;
     if (OB_FAIL(decrypt_and_decompress_data(deserialize_meta, buf, size, uncomp_buf, uncomp_size,
         is_compressed, false/*need_deep_copy*/, nullptr/*ext_allocator*/))) {
       STORAGE_LOG(WARN, "fail to decrypt and decompress data", K(ret));
@@ -247,12 +245,11 @@ int ObMacroBlockReader::decompress_data_with_prealloc_buf(
     const char *buf,
     const int64_t size,
     char *uncomp_buf,
-    const int64_t uncomp_buf_size)
+    const int64_t uncomp_buf_size,
+    const ObDecompressDict &compress_dict)
 {
   int ret = OB_SUCCESS;
   int64_t uncomp_size = 0;
-  ObCompressorPool &comp_pool = ObCompressorPool::get_instance();
-  ObCompressorType cur_type = ObCompressorType::INVALID_COMPRESSOR;
   if (OB_ISNULL(buf) || OB_UNLIKELY(size <= 0) || OB_ISNULL(uncomp_buf)
       || OB_UNLIKELY(uncomp_buf_size <= 0)) {
     ret = OB_INVALID_ARGUMENT;
@@ -260,16 +257,7 @@ int ObMacroBlockReader::decompress_data_with_prealloc_buf(
   } else if (size == uncomp_buf_size) {
     MEMCPY(uncomp_buf, buf, size);
   } else {
-    if (OB_NOT_NULL(compressor_)
-        && OB_FAIL(comp_pool.get_compressor_type(compressor_->get_compressor_name(), cur_type))) {
-      LOG_WARN("Fail to get current compressor type", K(ret));
-    } else if (OB_ISNULL(compressor_) || cur_type != compressor_type) {
-      if (OB_FAIL(comp_pool.get_instance().get_compressor(compressor_type, compressor_))) {
-        LOG_WARN("Fail to get compressor", K(ret), K(compressor_type));
-      }
-    }
-
-    if (FAILEDx(compressor_->decompress(buf, size, uncomp_buf, uncomp_buf_size, uncomp_size))) {
+    if (OB_FAIL(do_decompress(compressor_type, compress_dict, buf, size, uncomp_buf, uncomp_buf_size, uncomp_size))) {
       LOG_WARN("Fail to decompress data", K(ret));
     } else {
       if (OB_UNLIKELY(uncomp_size != uncomp_buf_size)) {
@@ -317,6 +305,33 @@ int ObMacroBlockReader::decompress_data_with_prealloc_buf(
   return ret;
 }
 
+int ObMacroBlockReader::do_decompress(
+    const common::ObCompressorType compressor_type,
+    const ObDecompressDict &compress_dict,
+    const char *buf,
+    const int64_t size,
+    char *uncomp_buf,
+    const int64_t uncomp_buf_size,
+    int64_t &uncomp_size)
+{
+  int ret = OB_SUCCESS;
+  if (nullptr == compressor_ || compressor_->get_compressor_type() != compressor_type) {
+    if (OB_FAIL(ObCompressorPool::get_instance().get_compressor(compressor_type, compressor_))) {
+      STORAGE_LOG(WARN, "Fail to get compressor, ", K(ret), K(compressor_type));
+    }
+  }
+  if (OB_FAIL(ret)) {
+  } else if (compress_dict.empty() || ZSTD_1_3_8_COMPRESSOR != compressor_type) {
+    if (OB_FAIL(compressor_->decompress(buf, size, uncomp_buf, uncomp_buf_size, uncomp_size))) {
+      LOG_WARN("Fail to decompress", K(ret), K(compressor_type), K(size), K(uncomp_buf_size));
+    }
+  } else if (OB_FAIL(static_cast<zstd_1_3_8::ObZstdCompressor_1_3_8 *>(compressor_)->decompress(
+      buf, size, uncomp_buf, uncomp_buf_size, uncomp_size, compress_dict))) {
+    LOG_WARN("Fail to decompress with dict", K(ret), K(size), K(uncomp_buf_size), K(compress_dict));
+  }
+  return ret;
+}
+
 int ObMacroBlockReader::alloc_buf(const int64_t req_size, char *&buf, int64_t &buf_size)
 {
   int ret = OB_SUCCESS;
@@ -452,7 +467,8 @@ int ObMacroBlockReader::do_decrypt_and_decompress_data(
 
     if (OB_SUCC(ret) && is_compressed) {
       if (OB_FAIL(decompress_data_buf(deserialize_meta.compressor_type_, src_buf, header.header_size_,
-          payload_buf, payload_size, uncomp_buf, uncomp_size, ext_allocator))) {
+          payload_buf, payload_size, uncomp_buf, uncomp_size, ext_allocator,
+          deserialize_meta.compress_dict_))) {
         LOG_WARN("Fail to decompress data buffer", K(ret), K(header));
       }
     }
@@ -60,7 +60,8 @@ public:
       const int64_t comp_size,
       const char *&uncomp_buf,
       int64_t &uncomp_size,
-      ObIAllocator *ext_allocator = nullptr);
+      ObIAllocator *ext_allocator = nullptr,
+      const common::ObDecompressDict &compress_dict = common::ObDecompressDict());
 
   // both payload_buf and uncomp_buf don't contain micro block header
   int decompress_payload_buf(
@@ -74,7 +75,8 @@ public:
       const char *buf,
       const int64_t size,
       char *uncomp_buf,
-      const int64_t uncomp_buf_size);
+      const int64_t uncomp_buf_size,
+      const common::ObDecompressDict &compress_dict = common::ObDecompressDict());
   int decompress_data_with_prealloc_buf(
       const char *compressor_name,
       const char *buf,
@@ -87,7 +89,8 @@ public:
       const int64_t size,
       const char *&uncomp_buf,
       int64_t &uncomp_size,
-      bool &is_compressed);
+      bool &is_compressed,
+      const common::ObDecompressDict &compress_dict = common::ObDecompressDict());
   int decrypt_and_decompress_data(
       const ObMicroBlockDesMeta &deserialize_meta,
       const char *input,
@@ -127,6 +130,15 @@ public:
       int64_t &decrypt_size);
 #endif
 private:
+  // compress_dict is the dictionary of the sstable, it is only used by zstd_1.3.8
+  int do_decompress(
+      const common::ObCompressorType compressor_type,
+      const common::ObDecompressDict &compress_dict,
+      const char *buf,
+      const int64_t size,
+      char *uncomp_buf,
+      const int64_t uncomp_buf_size,
+      int64_t &uncomp_size);
   int alloc_buf(const int64_t req_size, char *&buf, int64_t &buf_size);
   int alloc_buf(ObIAllocator &allocator, const int64_t buf_size, char *&buf);
 #ifdef OB_BUILD_TDE_SECURITY
@@ -15,6 +15,7 @@
 #include "common/row/ob_row.h"
 #include "common/ob_store_format.h"
 #include "lib/compress/ob_compressor_pool.h"
+#include "lib/compress/ob_compress_dict.h"
 #include "lib/utility/ob_tracepoint.h"
 #include "share/config/ob_server_config.h"
 #include "share/ob_force_print_log.h"
@@ -48,6 +49,8 @@ ObMicroBlockBufferHelper::ObMicroBlockBufferHelper()
   : data_store_desc_(nullptr),
     micro_block_merge_verify_level_(0),
     compressor_(),
+    dict_trainer_(nullptr),
+    enable_compress_dict_(false),
     encryption_(),
     check_reader_helper_(),
     checksum_helper_(),
@@ -71,6 +74,18 @@ int ObMicroBlockBufferHelper::open(
     }
   } else if (OB_FAIL(compressor_.init(data_store_desc.get_micro_block_size(), data_store_desc.get_compressor_type()))) {
     STORAGE_LOG(WARN, "Fail to init micro block compressor, ", K(ret), K(data_store_desc));
+  } else if (need_compress_dict(data_store_desc)) {
+    void *buf = nullptr;
+    enable_compress_dict_ = true;
+    if (nullptr != data_store_desc.sstable_index_builder_->get_compress_dict()) {
+      // inherited from the base sstable or published by another writer, no need to train
+    } else if (OB_ISNULL(buf = allocator.alloc(sizeof(ObCompressDictTrainer)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      STORAGE_LOG(WARN, "fail to alloc compress dict trainer", K(ret));
+    } else if (FALSE_IT(dict_trainer_ = new (buf) ObCompressDictTrainer(allocator))) {
+    } else if (OB_FAIL(dict_trainer_->init())) {
+      STORAGE_LOG(WARN, "fail to init compress dict trainer", K(ret));
+    }
   }
 
   if (OB_FAIL(ret)) {
@@ -102,6 +117,11 @@ void ObMicroBlockBufferHelper::reset()
   data_store_desc_ = nullptr;
   micro_block_merge_verify_level_ = 0;
   compressor_.reset();
+  if (nullptr != dict_trainer_) {
+    dict_trainer_->~ObCompressDictTrainer();
+    dict_trainer_ = nullptr;
+  }
+  enable_compress_dict_ = false;
 #ifdef OB_BUILD_TDE_SECURITY
   encryption_.reset();
 #endif
@@ -121,6 +141,9 @@ int ObMicroBlockBufferHelper::compress_encrypt_micro_block(ObMicroBlockDesc &mic
   if (OB_UNLIKELY(!micro_block_desc.is_valid())) {
     ret = OB_INVALID_ARGUMENT;
     STORAGE_LOG(WARN, "invalid micro block desc", K(ret), K(micro_block_desc));
+  } else if (enable_compress_dict_ && !compressor_.has_dict()
+      && OB_FAIL(prepare_compress_dict(block_buffer, block_size))) {
+    STORAGE_LOG(WARN, "fail to prepare compress dict", K(ret), K(block_size));
   } else if (OB_FAIL(compressor_.compress(block_buffer, block_size, compress_buf, compress_buf_size))) {
     STORAGE_LOG(WARN, "macro block writer fail to compress.",
         K(ret), K(OB_P(block_buffer)), K(block_size));
@@ -151,6 +174,61 @@ int ObMicroBlockBufferHelper::compress_encrypt_micro_block(ObMicroBlockDesc &mic
   return ret;
 }
 
+bool ObMicroBlockBufferHelper::need_compress_dict(const ObDataStoreDesc &data_store_desc) const
+{
+  bool bret = false;
+  if (ZSTD_1_3_8_COMPRESSOR != data_store_desc.get_compressor_type()
+      || !data_store_desc.is_major_merge_type()
+      || data_store_desc.is_for_index_or_meta()
+      || nullptr == data_store_desc.sstable_index_builder_) {
+  } else {
+    omt::ObTenantConfigGuard tenant_config(TENANT_CONF(MTL_ID()));
+    bret = tenant_config.is_valid() && tenant_config->_enable_compress_dict;
+  }
+  return bret;
+}
+
+int ObMicroBlockBufferHelper::prepare_compress_dict(const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  ObSSTableIndexBuilder *index_builder = data_store_desc_->sstable_index_builder_;
+  ObCompressDict *dict = index_builder->get_compress_dict();
+  if (nullptr != dict) {
+    // inherited from the base sstable or published by another writer
+  } else if (OB_ISNULL(dict_trainer_)) {
+    // the samples are not repetitive enough, compress without dictionary
+  } else if (OB_FAIL(dict_trainer_->add_sample(buf, size))) {
+    STORAGE_LOG(WARN, "fail to add compress dict sample", K(ret), K(size));
+  } else if (dict_trainer_->is_ready()) {
+    char dict_buf[ObCompressDictTrainer::DEFAULT_DICT_SIZE];
+    int64_t dict_len = 0;
+    if (OB_FAIL(dict_trainer_->train(dict_buf, sizeof(dict_buf), dict_len))) {
+      if (OB_ENTRY_NOT_EXIST == ret) {
+        ret = OB_SUCCESS;
+        STORAGE_LOG(INFO, "samples are not repetitive enough for compress dict", KPC_(dict_trainer));
+      } else {
+        STORAGE_LOG(WARN, "fail to train compress dict", K(ret), KPC_(dict_trainer));
+      }
+    } else if (OB_FAIL(index_builder->publish_compress_dict(dict_buf, dict_len, dict))) {
+      STORAGE_LOG(WARN, "fail to publish compress dict", K(ret), K(dict_len));
+    }
+    if (OB_SUCC(ret)) {
+      dict_trainer_->~ObCompressDictTrainer();
+      dict_trainer_ = nullptr;
+    }
+  }
+  if (OB_SUCC(ret) && nullptr != dict) {
+    // the reference is held by the index builder until the sstable is created
+    if (OB_FAIL(compressor_.set_dict(dict))) {
+      STORAGE_LOG(WARN, "fail to set compress dict", K(ret), KPC(dict));
+    } else if (nullptr != dict_trainer_) {
+      dict_trainer_->~ObCompressDictTrainer();
+      dict_trainer_ = nullptr;
+    }
+  }
+  return ret;
+}
+
 int ObMicroBlockBufferHelper::check_micro_block(
     const char *compressed_buf,
     const int64_t compressed_size,
@@ -1321,6 +1399,7 @@ int ObMacroBlockWriter::build_micro_block_desc_with_rewrite(
   } else {
     bool is_compressed = false;
     reader->reset();
+    micro_des_meta.compress_dict_ = get_compress_dict();
 
     if (OB_FAIL(macro_reader_.decrypt_and_decompress_data(micro_des_meta, micro_block.data_.get_buf(),
         micro_block.data_.get_buf_size(), decompressed_data.get_buf(), decompressed_data.get_buf_size(), is_compressed))) {
@@ -1808,6 +1887,7 @@ int ObMacroBlockWriter::merge_micro_block(const ObMicroBlock &micro_block)
     }
 
     micro_reader->reset();
+    micro_des_meta.compress_dict_ = get_compress_dict();
     if (OB_FAIL(macro_reader_.decrypt_and_decompress_data(micro_des_meta, micro_block.data_.get_buf(),
         micro_block.data_.get_buf_size(), decompressed_data.get_buf(), decompressed_data.get_buf_size(), is_compressed))) {
       STORAGE_LOG(WARN, "fail to decrypt and decompress data", K(ret));
@@ -2004,6 +2084,17 @@ void ObMacroBlockWriter::dump_micro_block(ObIMicroBlockWriter &micro_writer)
   return;
 }
 
+ObDecompressDict ObMacroBlockWriter::get_compress_dict() const
+{
+  ObDecompressDict compress_dict;
+  const ObCompressDict *dict = nullptr;
+  if (OB_NOT_NULL(data_store_desc_) && OB_NOT_NULL(data_store_desc_->sstable_index_builder_)
+      && OB_NOT_NULL(dict = data_store_desc_->sstable_index_builder_->get_compress_dict())) {
+    compress_dict = dict->get_decompress_dict();
+  }
+  return compress_dict;
+}
+
 void ObMacroBlockWriter::dump_macro_block(ObMacroBlock &macro_block)
 {
   // dump incomplete macro block
@@ -2021,6 +2112,7 @@ void ObMacroBlockWriter::dump_macro_block(ObMacroBlock &macro_block)
     ObMicroBlockDesMeta micro_des_meta(
         data_store_desc_->get_compressor_type(), data_store_desc_->get_row_store_type(),
         data_store_desc_->get_encrypt_id(), data_store_desc_->get_master_key_id(), data_store_desc_->get_encrypt_key());
+    micro_des_meta.compress_dict_ = get_compress_dict();
     ObMicroBlockHeader header;
     ObMicroBlockData micro_data;
     ObMicroBlockData decompressed_data;
@@ -92,11 +92,15 @@ private:
       const int64_t uncompressed_size,
       const ObMicroBlockDesc &micro_block_desc/*check for this micro block*/);
   void print_micro_block_row(ObIMicroBlockReader *micro_reader);
+  bool need_compress_dict(const ObDataStoreDesc &data_store_desc) const;
+  int prepare_compress_dict(const char *buf, const int64_t size);
 
 private:
   const ObDataStoreDesc *data_store_desc_;
   int64_t micro_block_merge_verify_level_;
   ObMicroBlockCompressor compressor_;
+  common::ObCompressDictTrainer *dict_trainer_; // not null until the dictionary is ready
+  bool enable_compress_dict_;
   ObMicroBlockEncryption encryption_;
   ObMicroBlockReaderHelper check_reader_helper_;
   ObMicroBlockChecksumHelper checksum_helper_;
@@ -218,6 +222,8 @@ private:
   int write_micro_block(ObMicroBlockDesc &micro_block_desc);
   int check_micro_block_need_merge(const ObMicroBlock &micro_block, bool &need_merge);
   int merge_micro_block(const ObMicroBlock &micro_block);
+  // reused micro blocks come from the base sstable, whose dictionary the index builder inherits
+  common::ObDecompressDict get_compress_dict() const;
   int flush_macro_block(ObMacroBlock &macro_block);
   int try_active_flush_macro_block();
   int wait_io_finish(ObStorageObjectHandle &macro_handle, ObMacroBlock *macro_block);
@@ -253,6 +253,14 @@ int ObMicroBlockCacheValue::deep_copy(char *buf, const int64_t buf_len, ObIKVCac
   return ret;
 }
 
+OB_SERIALIZE_MEMBER(ObMicroBlockCacheHotKey,
+                    tenant_id_,
+                    micro_id_.macro_id_,
+                    micro_id_.offset_,
+                    micro_id_.size_,
+                    heat_,
+                    is_index_);
+
 /*---------------------------------Multi Block IO parameters--------------------------------------*/
 ObMultiBlockIOResult::ObMultiBlockIOResult() :
     micro_blocks_(nullptr),
@@ -300,6 +308,7 @@ void ObMultiBlockIOParam::reset()
   io_read_batch_size_ = 0;
   io_read_gap_size_ = 0;
   row_header_ = nullptr;
+  compress_dict_.reset();
   prefetch_idx_.reset();
   micro_infos_.reset();
 }
@@ -309,6 +318,7 @@ void ObMultiBlockIOParam::reuse()
   data_cache_size_ = 0;
   micro_block_count_ = 0;
   row_header_ = nullptr;
+  compress_dict_.reset();
 }
 
 bool ObMultiBlockIOParam::is_valid() const
@@ -349,6 +359,7 @@ bool ObMultiBlockIOParam::add_micro_data(const ObMicroIndexInfo &index_info,
   need_split = false;
   if (0 == micro_block_count_) {
     row_header_ = index_info.row_header_;
+    compress_dict_ = micro_handle.des_meta_.compress_dict_;
     size = index_info.get_block_size();
   } else if (!is_reverse_) {
     size = index_info.get_block_offset() + index_info.get_block_size() - micro_infos_[0].offset_;
@@ -915,7 +926,8 @@ int ObIMicroBlockCache::prefetch(
     const bool use_cache,
     ObStorageObjectHandle &macro_handle,
     ObIAllocator *allocator,
-    const bool is_major_macro_preread)
+    const bool is_major_macro_preread,
+    const ObDecompressDict &compress_dict)
 {
   int ret = OB_SUCCESS;
   const ObIndexBlockRowHeader *idx_header = idx_row.row_header_;
@@ -935,6 +947,7 @@ int ObIMicroBlockCache::prefetch(
       callback = new (buf) ObAsyncSingleMicroBlockIOCallback;
       callback->allocator_ = allocator;
       callback->use_block_cache_ = use_cache;
+      callback->block_des_meta_.compress_dict_ = compress_dict;
             if (OB_FAIL(prefetch(tenant_id, macro_id, idx_row, macro_handle, *callback, is_major_macro_preread))) {
         LOG_WARN("Fail to prefetch data micro block", K(ret));
       }
@@ -1019,6 +1032,7 @@ int ObIMicroBlockCache::prefetch(
   callback.offset_ = offset;
   callback.use_block_cache_ = use_cache;
   callback.set_micro_des_meta(io_param.row_header_);
+  callback.block_des_meta_.compress_dict_ = io_param.compress_dict_;
   // fill read info
   ObStorageObjectReadInfo read_info;
   read_info.macro_block_id_ = macro_id;
@@ -1148,7 +1162,7 @@ int ObMicroBlockBufTransformer::transfrom(char *block_buf, const int64_t buf_siz
       if (OB_SUCC(ret)) {
         if (OB_FAIL(reader_->decompress_data_with_prealloc_buf(
             block_des_meta_.compressor_type_, payload_buf_, payload_size_,
-            block_buf + pos, buf_size - pos))) {
+            block_buf + pos, buf_size - pos, block_des_meta_.compress_dict_))) {
           LOG_WARN("Fail to decompress data with preallocated buffer", K(ret), K_(header));
         }
       }
@@ -117,6 +117,21 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObMicroBlockCacheValue);
 };
 
+// A micro block held by the index or data block cache, collected by the block cache snapshot.
+// The heat is the get count of the cache node weighted by the priority of the cache.
+struct ObMicroBlockCacheHotKey
+{
+  OB_UNIS_VERSION(1);
+public:
+  ObMicroBlockCacheHotKey() : tenant_id_(common::OB_INVALID_TENANT_ID), micro_id_(), heat_(0), is_index_(false) {}
+  OB_INLINE bool is_valid() const { return common::is_valid_tenant_id(tenant_id_) && micro_id_.is_valid(); }
+  TO_STRING_KV(K_(tenant_id), K_(micro_id), K_(heat), K_(is_index));
+  uint64_t tenant_id_;
+  ObMicroBlockId micro_id_;
+  int64_t heat_;
+  bool is_index_;
+};
+
 class ObIMicroBlockCache;
 
 class ObMicroBlockBufferHandle
@@ -164,6 +179,7 @@ public:
       io_read_batch_size_(0),
       io_read_gap_size_(0),
       row_header_(nullptr),
+      compress_dict_(),
       prefetch_idx_(),
       micro_infos_()
   {}
@@ -209,6 +225,7 @@ public:
   int64_t io_read_batch_size_;
   int64_t io_read_gap_size_;
   const ObIndexBlockRowHeader *row_header_;
+  common::ObDecompressDict compress_dict_;
   ObReallocatedFixedArray<int64_t> prefetch_idx_;
   ObReallocatedFixedArray<ObMicroBlockInfo> micro_infos_;
 };
@@ -393,7 +410,8 @@ public:
       const bool use_cache,
       ObStorageObjectHandle &macro_handle,
       ObIAllocator *allocator,
-      const bool is_major_macro_preread = false);
+      const bool is_major_macro_preread = false,
+      const common::ObDecompressDict &compress_dict = common::ObDecompressDict());
   virtual int load_block(
       const ObMicroBlockId &micro_block_id,
       const ObMicroBlockDesMeta &des_meta,
@@ -13,6 +13,7 @@
 #define USING_LOG_PREFIX STORAGE
 
 #include "ob_sstable_meta.h"
+#include "lib/compress/ob_compress_dict.h"
 #include "share/schema/ob_schema_struct.h"
 #include "share/rc/ob_tenant_base.h"
 #include "storage/meta_mem/ob_tenant_meta_mem_mgr.h"
@@ -568,6 +569,135 @@ int64_t ObTxContext::get_variable_size() const
   return count_ * sizeof(ObTxDesc);
 }
 
+//================================== ObSSTableCompressDict ==================================
+int ObSSTableCompressDict::init(const common::ObString &dict, common::ObArenaAllocator &allocator)
+{
+  int ret = OB_SUCCESS;
+  if (OB_UNLIKELY(nullptr != dict_buf_)) {
+    ret = OB_INIT_TWICE;
+    LOG_WARN("init twice", K(ret), K(*this));
+  } else if (dict.empty()) {
+    reset();
+  } else if (OB_UNLIKELY(dict.length() > ObCompressDictMgr::MAX_DICT_SIZE)) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("compress dict is too large", K(ret), K(dict.length()));
+  } else if (OB_ISNULL(dict_buf_ = static_cast<char *>(allocator.alloc(dict.length())))) {
+    ret = OB_ALLOCATE_MEMORY_FAILED;
+    LOG_WARN("fail to allocate compress dict", K(ret), K(dict.length()));
+  } else {
+    MEMCPY(dict_buf_, dict.ptr(), dict.length());
+    dict_size_ = dict.length();
+    dict_id_ = ObCompressDictMgr::calc_dict_id(dict_buf_, dict_size_);
+  }
+  return ret;
+}
+
+void ObSSTableCompressDict::reset()
+{
+  len_ = 0;
+  dict_size_ = 0;
+  dict_buf_ = nullptr;
+  dict_id_ = 0;
+}
+
+int ObSSTableCompressDict::serialize(char *buf, const int64_t buf_len, int64_t &pos) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t tmp_pos = pos;
+  const_cast<ObSSTableCompressDict *>(this)->len_ = get_serialize_size();
+  if (OB_FAIL(serialization::encode_i32(buf, buf_len, pos, len_))) {
+    LOG_WARN("fail to encode length", K(ret), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::encode_vi32(buf, buf_len, pos, dict_size_))) {
+    LOG_WARN("fail to encode dict size", K(ret), K(buf_len), K(pos));
+  } else if (OB_UNLIKELY(pos + dict_size_ > buf_len)) {
+    ret = OB_BUF_NOT_ENOUGH;
+    LOG_WARN("buf not enough", K(ret), K(buf_len), K(pos), K_(dict_size));
+  } else if (dict_size_ > 0) {
+    MEMCPY(buf + pos, dict_buf_, dict_size_);
+    pos += dict_size_;
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_UNLIKELY(pos - tmp_pos != len_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected len_", K(ret), K(len_), K(tmp_pos), K(pos));
+  }
+  return ret;
+}
+
+int64_t ObSSTableCompressDict::get_serialize_size() const
+{
+  return serialization::encoded_length_i32(len_)
+       + serialization::encoded_length_vi32(dict_size_)
+       + dict_size_;
+}
+
+int ObSSTableCompressDict::deserialize(
+  common::ObArenaAllocator &allocator,
+  const char *buf,
+  const int64_t buf_len,
+  int64_t &pos)
+{
+  int ret = OB_SUCCESS;
+  const int64_t tmp_pos = pos;
+  int32_t dict_size = 0;
+  if (OB_FAIL(serialization::decode_i32(buf, buf_len, pos, &len_))) {
+    LOG_WARN("fail to decode length", K(ret), K(buf_len), K(pos));
+  } else if (OB_FAIL(serialization::decode_vi32(buf, buf_len, pos, &dict_size))) {
+    LOG_WARN("fail to decode dict size", K(ret), K(buf_len), K(pos));
+  } else if (OB_UNLIKELY(dict_size < 0 || pos + dict_size > buf_len)) {
+    ret = OB_DESERIALIZE_ERROR;
+    LOG_WARN("invalid dict size", K(ret), K(dict_size), K(buf_len), K(pos));
+  } else if (dict_size > 0) {
+    if (OB_ISNULL(dict_buf_ = static_cast<char *>(allocator.alloc(dict_size)))) {
+      ret = OB_ALLOCATE_MEMORY_FAILED;
+      LOG_WARN("fail to allocate compress dict", K(ret), K(dict_size));
+    } else {
+      MEMCPY(dict_buf_, buf + pos, dict_size);
+      dict_size_ = dict_size;
+      dict_id_ = ObCompressDictMgr::calc_dict_id(dict_buf_, dict_size_);
+      pos += dict_size;
+    }
+  }
+
+  if (OB_FAIL(ret)) {
+  } else if (OB_UNLIKELY(pos - tmp_pos > len_)) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("unexpected len_", K(ret), K(len_), K(tmp_pos), K(pos));
+  } else {
+    pos = tmp_pos + len_; // skip the fields of higher version
+  }
+  return ret;
+}
+
+int ObSSTableCompressDict::deep_copy(
+  char *buf,
+  const int64_t buf_len,
+  int64_t &pos,
+  ObSSTableCompressDict &dest) const
+{
+  int ret = OB_SUCCESS;
+  const int64_t variable_size = get_variable_size();
+  if (this == &dest) {
+    ret = OB_INVALID_ARGUMENT;
+    LOG_WARN("can't deep copy self", K(ret), K(*this));
+  } else if (pos + variable_size > buf_len) {
+    ret = OB_BUF_NOT_ENOUGH;
+    LOG_WARN("buf not enough", K(ret), K(pos), K(buf_len), K(*this));
+  } else {
+    dest.reset();
+    dest.len_ = len_;
+    if (dict_size_ > 0) {
+      dest.dict_buf_ = buf + pos;
+      dest.dict_size_ = dict_size_;
+      dest.dict_id_ = dict_id_;
+      MEMCPY(dest.dict_buf_, dict_buf_, dict_size_);
+      pos += variable_size;
+    }
+  }
+  return ret;
+}
+
 //================================== ObSSTableMeta ==================================
 ObSSTableMeta::ObSSTableMeta()
   : basic_meta_(),
@@ -576,6 +706,7 @@ ObSSTableMeta::ObSSTableMeta()
     cg_sstables_(),
     column_ckm_struct_(),
     tx_ctx_(),
+    compress_dict_(),
     is_inited_(false)
 {
 }
@@ -609,6 +740,7 @@ void ObSSTableMeta::reset()
   column_ckm_struct_.reset();
   cg_sstables_.reset();
   tx_ctx_.reset();
+  compress_dict_.reset();
   is_inited_ = false;
 }
 
@@ -742,6 +874,12 @@ int ObSSTableMeta::init(
     }
   }
 
+  if (OB_SUCC(ret) && !param.compress_dict_.empty()) {
+    if (OB_FAIL(compress_dict_.init(param.compress_dict_, allocator))) {
+      LOG_WARN("failed to init compress dict", K(ret), K(param));
+    }
+  }
+
   if (OB_SUCC(ret)) {
     if (param.is_ready_for_read_) {
       basic_meta_.status_ = SSTABLE_READY_FOR_READ;
@@ -807,6 +945,9 @@ int ObSSTableMeta::serialize_(char *buf, const int64_t buf_len, int64_t &pos) co
     LOG_WARN("fail to serialize cg sstables", K(ret), K(buf_len), K(pos), K(cg_sstables_));
   } else if (OB_FAIL(tx_ctx_.serialize(buf, buf_len, pos))) {
     LOG_WARN("fail to serialize tx ids", K(ret), K(buf_len), K(pos), K(tx_ctx_));
+  // only written when there is a dictionary, the meta without one keeps its old size
+  } else if (compress_dict_.is_valid() && OB_FAIL(compress_dict_.serialize(buf, buf_len, pos))) {
+    LOG_WARN("fail to serialize compress dict", K(ret), K(buf_len), K(pos), K(compress_dict_));
   }
   return ret;
 }
@@ -875,6 +1016,8 @@ int ObSSTableMeta::deserialize_(
       LOG_WARN("fail to deserialize cg sstables", K(ret), K(data_len), K(pos));
     } else if (pos < data_len && OB_FAIL(tx_ctx_.deserialize(allocator, buf, data_len, pos))) {
       LOG_WARN("fail to deserialize tx ids", K(ret), K(data_len), K(pos));
+    } else if (pos < data_len && OB_FAIL(compress_dict_.deserialize(allocator, buf, data_len, pos))) {
+      LOG_WARN("fail to deserialize compress dict", K(ret), K(data_len), K(pos));
     }
   }
   return ret;
@@ -899,6 +1042,9 @@ int64_t ObSSTableMeta::get_serialize_size_() const
   len += macro_info_.get_serialize_size();
   len += cg_sstables_.get_serialize_size();
   len += tx_ctx_.get_serialize_size();
+  if (compress_dict_.is_valid()) {
+    len += compress_dict_.get_serialize_size();
+  }
   return len;
 }
 
@@ -908,7 +1054,8 @@ int64_t ObSSTableMeta::get_variable_size() const
        + data_root_info_.get_variable_size()
        + macro_info_.get_variable_size()
        + cg_sstables_.get_deep_copy_size()
-       + tx_ctx_.get_variable_size();
+       + tx_ctx_.get_variable_size()
+       + compress_dict_.get_variable_size();
 }
 
 int ObSSTableMeta::deep_copy(
@@ -938,6 +1085,8 @@ int ObSSTableMeta::deep_copy(
       LOG_WARN("fail to deep copy cg sstables", K(ret), KP(buf), K(buf_len), K(pos), K(cg_sstables_));
     } else if (OB_FAIL(tx_ctx_.deep_copy(buf, buf_len, pos, dest->tx_ctx_))) {
       LOG_WARN("fail to deep copy tx context", K(ret), K(tx_ctx_));
+    } else if (OB_FAIL(compress_dict_.deep_copy(buf, buf_len, pos, dest->compress_dict_))) {
+      LOG_WARN("fail to deep copy compress dict", K(ret), K(compress_dict_));
     // TODO (jiahua.cjh): add defend code back
     // } else if (deep_size != pos - tmp_pos) {
     //  ret = OB_ERR_UNEXPECTED;
@@ -965,7 +1114,8 @@ ObMigrationSSTableParam::ObMigrationSSTableParam()
     root_block_buf_(nullptr),
     data_block_macro_meta_addr_(),
     data_block_macro_meta_buf_(nullptr),
-    is_meta_root_(false)
+    is_meta_root_(false),
+    compress_dict_()
 {
 }
 
@@ -990,6 +1140,7 @@ void ObMigrationSSTableParam::reset()
   data_block_macro_meta_addr_.reset();
   data_block_macro_meta_buf_ = nullptr;
   is_meta_root_ =false;
+  compress_dict_.reset();
   allocator_.reset();
 }
 
@@ -1030,6 +1181,8 @@ int ObMigrationSSTableParam::assign(const ObMigrationSSTableParam &param)
         static_cast<char *>(allocator_.alloc(data_block_macro_meta_addr_.size()))))) {
       ret = OB_ALLOCATE_MEMORY_FAILED;
       LOG_WARN("fail to alloc data block macro meta buf", K(ret));
+    } else if (OB_FAIL(ob_write_string(allocator_, param.compress_dict_, compress_dict_))) {
+      LOG_WARN("fail to copy compress dict", K(ret), K(param));
     } else {
       if (root_block_addr_.is_memory()) {
         MEMCPY(root_block_buf_, param.root_block_buf_, root_block_addr_.size());
@@ -1152,6 +1305,9 @@ int ObMigrationSSTableParam::serialize_(char *buf, const int64_t buf_len, int64_
   }
 
   LST_DO_CODE(OB_UNIS_ENCODE, is_meta_root_);
+  if (!compress_dict_.empty()) {
+    LST_DO_CODE(OB_UNIS_ENCODE, compress_dict_);
+  }
   return ret;
 }
 
@@ -1215,6 +1371,14 @@ int ObMigrationSSTableParam::deserialize_(const char *buf, const int64_t data_le
   }
 
   LST_DO_CODE(OB_UNIS_DECODE, is_meta_root_);
+  if (OB_SUCC(ret) && pos < data_len) {
+    ObString compress_dict;
+    if (OB_FAIL(compress_dict.deserialize(buf, data_len, pos))) {
+      LOG_WARN("fail to deserialize compress dict", K(ret), KP(buf), K(data_len), K(pos));
+    } else if (OB_FAIL(ob_write_string(allocator_, compress_dict, compress_dict_))) {
+      LOG_WARN("fail to copy compress dict", K(ret), K(compress_dict.length()));
+    }
+  }
 
   if (OB_FAIL(ret)) {
   } else if (OB_FAIL(ObSSTableMetaCompactUtil::fix_filled_tx_scn_value_for_compact(table_key_, basic_meta_.filled_tx_scn_))) {
@@ -1250,6 +1414,9 @@ int64_t ObMigrationSSTableParam::get_serialize_size_() const
   len += addr_get_serialize_size(data_block_macro_meta_addr_);
 
   LST_DO_CODE(OB_UNIS_ADD_LEN, is_meta_root_);
+  if (!compress_dict_.empty()) {
+    LST_DO_CODE(OB_UNIS_ADD_LEN, compress_dict_);
+  }
   return len;
 }
 
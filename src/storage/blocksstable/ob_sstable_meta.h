@@ -13,6 +13,7 @@
 #ifndef OCEANBASE_STORAGE_BLOCKSSTABLE_OB_SSTABLE_META_H
 #define OCEANBASE_STORAGE_BLOCKSSTABLE_OB_SSTABLE_META_H
 
+#include "lib/compress/ob_compress_dict.h"
 #include "lib/container/ob_iarray.h"
 #include "share/schema/ob_table_schema.h"
 #include "storage/ob_storage_schema.h"
@@ -85,6 +86,41 @@ private:
   DISALLOW_COPY_AND_ASSIGN(ObTxContext);
 };
 
+// Dictionary of the micro blocks compressed by zstd_1.3.8 with dictionary. The content is
+// persisted with the sstable meta and lives as long as the meta, readers holding the meta
+// handle pass it to the decompressor through ObMicroBlockDesMeta. The dict id is not persisted,
+// it is calculated when the dictionary is loaded.
+class ObSSTableCompressDict final
+{
+public:
+  ObSSTableCompressDict() : len_(0), dict_size_(0), dict_buf_(nullptr), dict_id_(0) {}
+  ~ObSSTableCompressDict() { reset(); }
+  int init(const common::ObString &dict, common::ObArenaAllocator &allocator);
+  int serialize(char *buf, const int64_t buf_len, int64_t &pos) const;
+  int64_t get_serialize_size() const;
+  int deserialize(common::ObArenaAllocator &allocator, const char *buf, const int64_t buf_len, int64_t &pos);
+  int deep_copy(
+    char *buf,
+    const int64_t buf_len,
+    int64_t &pos,
+    ObSSTableCompressDict &dest) const;
+  OB_INLINE int64_t get_variable_size() const { return dict_size_; }
+  OB_INLINE bool is_valid() const { return dict_size_ > 0; }
+  OB_INLINE common::ObString get_dict() const { return common::ObString(dict_size_, dict_buf_); }
+  OB_INLINE common::ObDecompressDict get_decompress_dict() const
+  {
+    return common::ObDecompressDict(dict_buf_, dict_size_, dict_id_);
+  }
+  void reset();
+  TO_STRING_KV(K_(dict_size), KP_(dict_buf), K_(dict_id));
+private:
+  int32_t len_; // for compat
+  int32_t dict_size_;
+  char *dict_buf_;
+  uint64_t dict_id_;
+  DISALLOW_COPY_AND_ASSIGN(ObSSTableCompressDict);
+};
+
 //For compatibility, the variables in this struct MUST NOT be deleted or moved.
 //You should ONLY add variables at the end.
 //Note that if you use complex structure as variables, the complex structure should also keep compatibility.
@@ -218,6 +254,7 @@ public:
   OB_INLINE int64_t *get_col_checksum() const { return column_ckm_struct_.column_checksums_; }
   OB_INLINE int64_t get_tx_id_count() const { return tx_ctx_.get_count(); }
   OB_INLINE int64_t get_tx_ids(const int64_t idx) const { return tx_ctx_.get_tx_id(idx); }
+  OB_INLINE const ObSSTableCompressDict &get_compress_dict() const { return compress_dict_; }
   OB_INLINE int64_t get_data_checksum() const { return basic_meta_.data_checksum_; }
   OB_INLINE int64_t get_rowkey_column_count() const { return basic_meta_.rowkey_column_count_; }
   OB_INLINE int64_t get_column_count() const { return basic_meta_.column_cnt_; }
@@ -308,7 +345,7 @@ public:
       const int64_t buf_len,
       int64_t &pos,
       ObSSTableMeta *&dest) const;
-  TO_STRING_KV(K_(basic_meta), K_(column_ckm_struct), K_(data_root_info), K_(macro_info), K_(cg_sstables), K_(tx_ctx), K_(is_inited));
+  TO_STRING_KV(K_(basic_meta), K_(column_ckm_struct), K_(data_root_info), K_(macro_info), K_(cg_sstables), K_(tx_ctx), K_(compress_dict), K_(is_inited));
 private:
   bool check_meta() const;
   int init_base_meta(const ObTabletCreateSSTableParam &param, common::ObArenaAllocator &allocator);
@@ -335,6 +372,7 @@ private:
   ObSSTableArray cg_sstables_;
   ObColumnCkmStruct column_ckm_struct_;
   ObTxContext tx_ctx_;
+  ObSSTableCompressDict compress_dict_;
   // The following fields don't to persist
   bool is_inited_;
   DISALLOW_COPY_AND_ASSIGN(ObSSTableMeta);
@@ -368,7 +406,8 @@ public:
                KP_(root_block_buf),
                K_(data_block_macro_meta_addr),
                KP_(data_block_macro_meta_buf),
-               K_(is_meta_root));
+               K_(is_meta_root),
+               K(compress_dict_.length()));
 private:
   int addr_serialize(const ObMetaDiskAddr &addr, const char *addr_buf, char *buf, const int64_t buf_len, int64_t &pos) const;
   int addr_deserialize(const char *buf, const int64_t data_len, int64_t &pos, ObMetaDiskAddr &addr, char *&root__buf);
@@ -393,6 +432,7 @@ public:
   ObMetaDiskAddr data_block_macro_meta_addr_;
   char *data_block_macro_meta_buf_;
   bool is_meta_root_;
+  common::ObString compress_dict_;
   OB_UNIS_VERSION(MIGRATION_SSTABLE_PARAM_VERSION);
 private:
   DISALLOW_COPY_AND_ASSIGN(ObMigrationSSTableParam);
@@ -26,6 +26,7 @@
 #include "share/schema/ob_tenant_schema_service.h"
 #include "storage/tablet/ob_mds_schema_helper.h"
 #include "storage/tablet/ob_mds_scan_param_helper.h"
+#include "storage/column_store/ob_column_oriented_sstable.h"
 
 namespace oceanbase
 {
@@ -1026,6 +1027,50 @@ int ObBasicTabletMergeCtx::build_index_tree(
     LOG_WARN("failed to init index store desc", K(ret), KPC(this));
   } else if (OB_FAIL(merge_info.prepare_index_builder())) {
     LOG_WARN("failed to prepare index builder", K(ret), K(merge_info));
+  } else if (OB_FAIL(inherit_compress_dict(merge_info, cg_schema, table_cg_idx))) {
+    LOG_WARN("failed to inherit compress dict", K(ret), K(table_cg_idx));
+  }
+  return ret;
+}
+
+int ObBasicTabletMergeCtx::inherit_compress_dict(
+  ObTabletMergeInfo &merge_info,
+  const storage::ObStorageColumnGroupSchema *cg_schema,
+  const uint16_t table_cg_idx)
+{
+  int ret = OB_SUCCESS;
+  ObITable *base_table = nullptr;
+  ObSSTable *base_sstable = nullptr;
+  ObSSTableWrapper cg_wrapper;
+  ObSSTableMetaHandle meta_handle;
+  common::ObCompressDict *compress_dict = nullptr;
+  if (!is_major_merge_type(get_merge_type()) || get_is_full_merge()
+      || OB_ISNULL(base_table = get_tables_handle().get_table(0))
+      || !base_table->is_major_sstable()) {
+    // no block of the base major sstable is reused
+  } else if (base_table->is_co_sstable() && nullptr != cg_schema) {
+    ObCOSSTableV2 *co_sstable = static_cast<ObCOSSTableV2 *>(base_table);
+    if (co_sstable->is_cgs_empty_co_table()) {
+      base_sstable = co_sstable;
+    } else if (OB_FAIL(co_sstable->fetch_cg_sstable(table_cg_idx, cg_wrapper))) {
+      LOG_WARN("failed to fetch cg sstable", K(ret), K(table_cg_idx), KPC(co_sstable));
+    } else if (OB_FAIL(cg_wrapper.get_loaded_column_store_sstable(base_sstable))) {
+      LOG_WARN("failed to get loaded cg sstable", K(ret), K(cg_wrapper));
+    }
+  } else {
+    base_sstable = static_cast<ObSSTable *>(base_table);
+  }
+
+  if (OB_FAIL(ret) || OB_ISNULL(base_sstable)) {
+  } else if (OB_FAIL(base_sstable->get_meta(meta_handle))) {
+    LOG_WARN("failed to get sstable meta", K(ret), KPC(base_sstable));
+  } else if (!meta_handle.get_sstable_meta().get_compress_dict().is_valid()) {
+    // base sstable is compressed without dictionary
+  } else {
+    const ObString dict = meta_handle.get_sstable_meta().get_compress_dict().get_dict();
+    if (OB_FAIL(merge_info.get_index_builder()->publish_compress_dict(dict.ptr(), dict.length(), compress_dict))) {
+      LOG_WARN("failed to publish compress dict", K(ret), K(table_cg_idx));
+    }
   }
   return ret;
 }
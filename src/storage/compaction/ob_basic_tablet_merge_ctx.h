@@ -145,6 +145,11 @@ public:
     const ObITableReadInfo *index_read_info,
     const storage::ObStorageColumnGroupSchema *cg_schema = nullptr,
     const uint16_t table_cg_idx = 0);
+  // the reused blocks of the base major sstable are compressed with its dictionary
+  int inherit_compress_dict(
+    ObTabletMergeInfo &merge_info,
+    const storage::ObStorageColumnGroupSchema *cg_schema,
+    const uint16_t table_cg_idx);
   virtual int get_ls_and_tablet();
   void init_time_guard(const int64_t time) {
     info_collector_.time_guard_.set_last_click_ts(time);
@@ -898,6 +898,7 @@ ObPartitionMicroMergeIter::ObPartitionMicroMergeIter(common::ObIAllocator &alloc
     curr_micro_block_(nullptr),
     micro_block_opened_(false),
     macro_reader_(),
+    sstable_meta_handle_(),
     need_reuse_micro_block_(true)
 {
 }
@@ -916,6 +917,7 @@ void ObPartitionMicroMergeIter::reset()
   }
   curr_micro_block_ = nullptr;
   micro_block_opened_ = false;
+  sstable_meta_handle_.reset();
   need_reuse_micro_block_ = true;
   ObPartitionMacroMergeIter::reset();
 }
@@ -960,6 +962,8 @@ int ObPartitionMicroMergeIter::inner_init(const ObMergeParameter &merge_param)
                                               access_context_,
                                               reinterpret_cast<ObSSTable *>(table_)))) {
     LOG_WARN("Failed to init micro row scanner", K(ret), K(access_param_), K(access_context_));
+  } else if (OB_FAIL(static_cast<ObSSTable *>(table_)->get_meta(sstable_meta_handle_))) {
+    LOG_WARN("Failed to get sstable meta", K(ret), KPC(table_));
   } else {
     curr_micro_block_ = nullptr;
     micro_block_opened_ = false;
@@ -1129,6 +1133,8 @@ int ObPartitionMicroMergeIter::open_curr_micro_block(const int64_t start_row_id)
     LOG_WARN("Unexpected micro block", K(ret), KPC(curr_micro_block_));
   } else if (OB_FAIL(micro_index_info->row_header_->fill_micro_des_meta(false, micro_des_meta))) {
     LOG_WARN("Fail to fill micro block deserialize meta", K(ret), KPC(micro_index_info));
+  } else if (FALSE_IT(micro_des_meta.compress_dict_ =
+      sstable_meta_handle_.get_sstable_meta().get_compress_dict().get_decompress_dict())) {
   } else if (OB_FAIL(macro_reader_.decrypt_and_decompress_data(
       micro_des_meta,
       curr_micro_block_->data_.get_buf(),
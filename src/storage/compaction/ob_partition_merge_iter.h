@@ -290,6 +290,7 @@ private:
   const blocksstable::ObMicroBlock *curr_micro_block_;
   bool micro_block_opened_;
   blocksstable::ObMacroBlockReader macro_reader_;
+  blocksstable::ObSSTableMetaHandle sstable_meta_handle_; // holds the compress dict of the base sstable
   bool need_reuse_micro_block_;
 };
 
@@ -258,9 +258,15 @@ int ObSSTableRebuilder::build_res_with_rewrite_macros(
   int64_t multiplexed_macro_block_count = 0;
   int64_t macro_start_seq = input_macro_seq;
   bool build_res_with_rebuild = false;
+  // the rewritten micro blocks keep the dictionary they are compressed with
+  common::ObCompressDict *compress_dict = index_builder.get_compress_dict();
+  common::ObCompressDict *rebuild_compress_dict = nullptr;
 
   if (OB_FAIL(rebuild_index_builder_.init(data_store_desc_.get_desc()))) {
     STORAGE_LOG(WARN, "fail to init", K(ret), K(data_store_desc_));
+  } else if (nullptr != compress_dict && OB_FAIL(rebuild_index_builder_.publish_compress_dict(
+      compress_dict->get_dict(), compress_dict->get_dict_size(), rebuild_compress_dict))) {
+    STORAGE_LOG(WARN, "fail to publish compress dict", K(ret), KPC(compress_dict));
   } else if (OB_FAIL(open_macro_writer(pre_warm_param))) {
     STORAGE_LOG(WARN, "fail to open macro writer", K(ret), K(pre_warm_param));
   } else if (OB_FAIL(index_builder.init_meta_iter(local_arena, iter))) {
@@ -385,18 +385,17 @@ void ObLobManager::transform_query_result_charset(
   byte_len = ObCharset::charpos(coll_type, data + byte_st, len - byte_st, byte_len);
 }
 
-int ObLobManager::get_real_data(
+int ObLobManager::get_real_data_ptr(
     ObLobAccessParam& param,
     const ObLobQueryResult& result,
     ObString& data)
 {
   int ret = OB_SUCCESS;
-  ObLobCtx lob_ctx;
   if (result.meta_result_.info_.piece_id_ != ObLobMetaUtil::LOB_META_INLINE_PIECE_ID) {
     ret = OB_ERR_UNEXPECTED;
     LOG_WARN("Invalid piece id.", K(ret), K(result));
-  } else if (result.meta_result_.info_.piece_id_ == ObLobMetaUtil::LOB_META_INLINE_PIECE_ID) {
-    // read data from lob_meta.lob_data
+  } else {
+    // refer to data in lob_meta.lob_data
     uint32_t byte_len = result.meta_result_.len_;
     uint32_t byte_st = result.meta_result_.st_;
     const char *lob_data = result.meta_result_.info_.lob_data_.ptr();
@@ -404,15 +403,28 @@ int ObLobManager::get_real_data(
       transform_query_result_charset(param.coll_type_, lob_data,
         result.meta_result_.info_.byte_len_, byte_len, byte_st);
     }
-    if (param.scan_backward_ && data.write_front(lob_data + byte_st, byte_len) != byte_len) {
-      ret = OB_ERR_INTERVAL_INVALID;
-      LOG_WARN("failed to write buffer to output_data.", K(ret),
-                K(data.length()), K(data.remain()), K(byte_st), K(byte_len));
-    } else if (!param.scan_backward_ && data.write(lob_data + byte_st, byte_len) != byte_len) {
-      ret = OB_ERR_INTERVAL_INVALID;
-      LOG_WARN("failed to write buffer to output_data.", K(ret),
-                K(data.length()), K(data.remain()), K(byte_st), K(byte_len));
-    }
+    data.assign_ptr(lob_data + byte_st, byte_len);
+  }
+  return ret;
+}
+
+int ObLobManager::get_real_data(
+    ObLobAccessParam& param,
+    const ObLobQueryResult& result,
+    ObString& data)
+{
+  int ret = OB_SUCCESS;
+  ObString piece;
+  if (OB_FAIL(get_real_data_ptr(param, result, piece))) {
+    LOG_WARN("get real data ptr failed.", K(ret), K(result));
+  } else if (param.scan_backward_ && data.write_front(piece.ptr(), piece.length()) != piece.length()) {
+    ret = OB_ERR_INTERVAL_INVALID;
+    LOG_WARN("failed to write buffer to output_data.", K(ret),
+              K(data.length()), K(data.remain()), K(piece.length()));
+  } else if (!param.scan_backward_ && data.write(piece.ptr(), piece.length()) != piece.length()) {
+    ret = OB_ERR_INTERVAL_INVALID;
+    LOG_WARN("failed to write buffer to output_data.", K(ret),
+              K(data.length()), K(data.remain()), K(piece.length()));
   }
   return ret;
 }
@@ -3785,20 +3797,13 @@ int ObLobQueryIter::open(ObLobAccessParam &param, ObLobCtx& lob_ctx, common::ObA
     is_inited_ = true;
     is_remote_ = true;
   } else { // init local scan
-    last_data_buf_len_ = OB_MIN(ObLobMetaUtil::LOB_OPER_PIECE_DATA_SIZE, param.byte_size_);
-    last_data_ptr_ = reinterpret_cast<char*>(param.allocator_->alloc(last_data_buf_len_));
-    if (OB_ISNULL(last_data_ptr_)) {
-      ret = OB_ALLOCATE_MEMORY_FAILED;
-      LOG_WARN("alloc buffer failed.", K(ret), K(last_data_buf_len_));
-    } else {
-      param_ = param;
-      lob_ctx_ = lob_ctx;
-      is_inited_ = true;
-      is_in_row_ = false;
-      is_reverse_ = param.scan_backward_;
-      cs_type_ = param.coll_type_;
-      last_data_.assign_buffer(last_data_ptr_, last_data_buf_len_);
-    }
+    param_ = param;
+    lob_ctx_ = lob_ctx;
+    is_inited_ = true;
+    is_in_row_ = false;
+    is_reverse_ = param.scan_backward_;
+    cs_type_ = param.coll_type_;
+    last_data_.reset();
   }
   return ret;
 }
@@ -3867,8 +3872,8 @@ bool ObLobQueryIter::fill_buffer_to_data(ObString& data)
       } else {
         write_size = data.write(last_data_.ptr(), last_data_.length());
       }
-      // reset last data buffer
-      last_data_.assign_buffer(last_data_ptr_, last_data_buf_len_);
+      // last data has been consumed
+      last_data_.reset();
     }
   }
   return bret;
@@ -3977,8 +3982,9 @@ int ObLobQueryIter::get_next_row(ObString& data)
               LOG_WARN("get real data failed.", K(ret));
             }
           } else {
-            if (OB_FAIL(lob_mngr->get_real_data(param_, result, last_data_))) {
-              LOG_WARN("get real data failed.", K(ret));
+            // meta row stays valid until next get_next_row, refer to it instead of copying twice
+            if (OB_FAIL(lob_mngr->get_real_data_ptr(param_, result, last_data_))) {
+              LOG_WARN("get real data ptr failed.", K(ret));
             }
           }
         }
@@ -3992,6 +3998,54 @@ int ObLobQueryIter::get_next_row(ObString& data)
   return ret;
 }
 
+int ObLobQueryIter::get_next_piece(ObString& piece)
+{
+  int ret = OB_SUCCESS;
+  piece.reset();
+  if (!is_inited_) {
+    ret = OB_ERR_UNEXPECTED;
+    LOG_WARN("iter is invalid.", K(ret));
+  } else if (is_in_row_) {
+    if (cur_pos_ == inner_data_.length()) {
+      ret = OB_ITER_END;
+    } else if (is_reverse_) {
+      piece.assign_ptr(inner_data_.ptr(), inner_data_.length() - cur_pos_);
+      cur_pos_ = inner_data_.length();
+    } else {
+      piece.assign_ptr(inner_data_.ptr() + cur_pos_, inner_data_.length() - cur_pos_);
+      cur_pos_ = inner_data_.length();
+    }
+  } else if (last_data_.length() > 0) {
+    // remain of last row not consumed by get_next_row
+    piece = last_data_;
+    last_data_.reset();
+  } else if (is_remote_) {
+    ObLobQueryBlock block;
+    ObLobRemoteQueryCtx *remote_ctx = reinterpret_cast<ObLobRemoteQueryCtx*>(remote_query_ctx_);
+    if (OB_FAIL(remote_ctx->remote_reader_.get_next_block(param_,
+                remote_ctx->rpc_buffer_, remote_ctx->handle_, block, piece))) {
+      if (ret != OB_ITER_END) {
+        LOG_WARN("fail to get block from remote reader", K(ret));
+      }
+    }
+  } else {
+    ObLobQueryResult result;
+    ObLobManager *lob_mngr = MTL(ObLobManager*);
+    if (OB_ISNULL(lob_mngr)) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("failed to get lob mngr.", K(ret));
+    } else if (OB_FAIL(get_next_row(result))) {
+      if (ret != OB_ITER_END) {
+        LOG_WARN("get next query result failed.", K(ret));
+      }
+    } else if (OB_FAIL(lob_mngr->get_real_data_ptr(param_, result, piece))) {
+      LOG_WARN("get real data ptr failed.", K(ret));
+    }
+  }
+  is_end_ = is_end_ || (ret == OB_ITER_END);
+  return ret;
+}
+
 void ObLobQueryIter::reset()
 {
   meta_iter_.reset();
@@ -4001,10 +4055,6 @@ void ObLobQueryIter::reset()
   is_inited_ = false;
   is_remote_ = false;
   last_data_.reset();
-  if (last_data_ptr_ != nullptr) {
-    param_.allocator_->free(last_data_ptr_);
-    last_data_ptr_ = nullptr;
-  }
   // release remote query resource
   if (OB_NOT_NULL(remote_query_ctx_)) {
     ObLobRemoteQueryCtx *remote_ctx = reinterpret_cast<ObLobRemoteQueryCtx*>(remote_query_ctx_);
@@ -103,12 +103,14 @@ class ObLobQueryIter
 {
 public:
   ObLobQueryIter() : is_reverse_(false), cs_type_(CS_TYPE_BINARY), is_end_(false),
-                     meta_iter_(), lob_ctx_(), param_(), last_data_(), last_data_ptr_(nullptr), last_data_buf_len_(0),
+                     meta_iter_(), lob_ctx_(), param_(), last_data_(),
                      inner_data_(), cur_pos_(0), is_in_row_(false), is_inited_(false),
                      is_remote_(false), remote_query_ctx_(nullptr) {}
   int open(ObString &data, uint32_t byte_offset, uint32_t byte_len, ObCollationType cs, bool is_reverse = false); // inrow open
   int open(ObLobAccessParam &param, ObLobCtx& lob_ctx, common::ObAddr& dst_addr, bool &is_remote); // open with retry inner
   int get_next_row(ObString& data);
+  // zero-copy read, piece points into the current meta row or remote block and is valid until next call
+  int get_next_piece(ObString& piece);
   int get_next_row(ObLobQueryResult &result); // for test
   uint64_t get_cur_pos() { return meta_iter_.get_cur_pos(); }
   void reset();
@@ -125,9 +127,8 @@ private:
   ObLobMetaScanIter meta_iter_;
   ObLobCtx lob_ctx_;
   ObLobAccessParam param_;
+  // unconsumed part of current meta row or remote block, refers to the row without copy
   ObString last_data_;
-  char *last_data_ptr_;
-  uint64_t last_data_buf_len_;
   // inrow ctx
   ObString inner_data_;
   uint64_t cur_pos_;
@@ -336,6 +337,9 @@ public:
   int get_real_data(ObLobAccessParam& param,
                     const ObLobQueryResult& result,
                     ObString& data);
+  int get_real_data_ptr(ObLobAccessParam& param,
+                        const ObLobQueryResult& result,
+                        ObString& data);
   int erase(ObLobAccessParam& param);
   int getlength(ObLobAccessParam& param, uint64_t &len);
   int build_lob_param(ObLobAccessParam& param,
@@ -675,6 +675,8 @@ int ObPersistentLobApator::build_common_scan_param(
   query_flag.disable_cache();
   if (param.enable_block_cache()) query_flag.set_use_block_cache();
   query_flag.scan_order_ = param.scan_backward_ ? ObQueryFlag::Reverse : ObQueryFlag::Forward;
+  // a large lob spans many meta rows, let the storage prefetcher read ahead at full depth
+  if (!is_get && param.byte_size_ > ObLobMetaUtil::LOB_OPER_PIECE_DATA_SIZE) query_flag.set_enable_lob_prefetch();
   scan_param.scan_flag_.flag_ = query_flag.flag_;
   // set column ids
   scan_param.column_ids_.reuse();
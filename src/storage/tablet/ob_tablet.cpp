@@ -5368,6 +5368,10 @@ int ObTablet::build_migration_sstable_param(
       mig_sstable_param.is_empty_cg_sstables_ = co_sstable->is_cgs_empty_co_table();
     }
 
+    if (OB_FAIL(ob_write_string(mig_sstable_param.allocator_,
+        sstable_meta.get_compress_dict().get_dict(), mig_sstable_param.compress_dict_))) {
+      LOG_WARN("fail to copy compress dict", K(ret), K(sstable_meta.get_compress_dict()));
+    }
     for (int64_t i = 0; OB_SUCC(ret) && i < sstable_meta.get_col_checksum_cnt(); ++i) {
       if (OB_FAIL(mig_sstable_param.column_checksums_.push_back(sstable_meta.get_col_checksum()[i]))) {
         LOG_WARN("fail to push back column checksum", K(ret), K(i));
@@ -5456,6 +5460,10 @@ int ObTablet::build_migration_sstable_param(
       mig_sstable_param.is_empty_cg_sstables_ = co_sstable->is_cgs_empty_co_table();
     }
 
+    if (OB_FAIL(ob_write_string(mig_sstable_param.allocator_,
+        sstable_meta.get_compress_dict().get_dict(), mig_sstable_param.compress_dict_))) {
+      LOG_WARN("fail to copy compress dict", K(ret), K(sstable_meta.get_compress_dict()));
+    }
     for (int64_t i = 0; OB_SUCC(ret) && i < sstable_meta.get_col_checksum_cnt(); ++i) {
       if (OB_FAIL(mig_sstable_param.column_checksums_.push_back(sstable_meta.get_col_checksum()[i]))) {
         LOG_WARN("fail to push back column checksum", K(ret), K(i));
@@ -82,7 +82,8 @@ ObTabletCreateSSTableParam::ObTabletCreateSSTableParam()
     other_block_ids_(),
     table_backup_flag_(),
     table_shared_flag_(),
-    uncommitted_tx_id_(0)
+    uncommitted_tx_id_(0),
+    compress_dict_()
 {
   MEMSET(encrypt_key_, 0, share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH);
 }
@@ -189,6 +190,10 @@ int ObTabletCreateSSTableParam::inner_init_with_merge_res(const blocksstable::Ob
   "ObSSTableMergeRes encrypt_key_ array size mismatch OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH");
   MEMCPY(encrypt_key_, res.encrypt_key_, share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH);
   table_backup_flag_ = res.table_backup_flag_;
+  if (nullptr != res.compress_dict_) {
+    compress_dict_.assign_ptr(res.compress_dict_->get_dict(),
+                              static_cast<int32_t>(res.compress_dict_->get_dict_size()));
+  }
 
   if (OB_FAIL(data_block_ids_.assign(res.data_block_ids_))) {
     LOG_WARN("fail to fill data block ids", K(ret), K(res.data_block_ids_));
@@ -623,6 +628,10 @@ int ObTabletCreateSSTableParam::init_for_ha(
   } else if (OB_FAIL(column_checksums_.assign(sstable_param.column_checksums_))) {
     LOG_WARN("fail to fill column checksum", K(ret), K(sstable_param));
   } else {
+    if (!sstable_param.compress_dict_.empty()) {
+      // the copied blocks are compressed with the dictionary of the source sstable
+      compress_dict_ = sstable_param.compress_dict_;
+    }
     root_macro_seq_ = MAX(root_macro_seq_, sstable_param.basic_meta_.root_macro_seq_);
 #ifdef OB_BUILD_SHARED_STORAGE
     root_macro_seq_ += oceanbase::compaction::MACRO_STEP_SIZE;
@@ -679,6 +688,7 @@ int ObTabletCreateSSTableParam::init_for_ha(const blocksstable::ObMigrationSSTab
     full_column_cnt_ = sstable_param.full_column_cnt_;
     co_base_type_ = sstable_param.co_base_type_;
   }
+  compress_dict_ = sstable_param.compress_dict_;
   if (OB_FAIL(column_checksums_.assign(sstable_param.column_checksums_))) {
     LOG_WARN("fail to assign column checksums", K(ret), K(sstable_param));
   } else if (!is_valid()) {
@@ -738,6 +748,7 @@ int ObTabletCreateSSTableParam::init_for_remote(const blocksstable::ObMigrationS
     is_co_table_without_cgs_ = sstable_param.is_empty_cg_sstables_;
   }
   MEMCPY(encrypt_key_, sstable_param.basic_meta_.encrypt_key_, share::OB_MAX_TABLESPACE_ENCRYPT_KEY_LENGTH);
+  compress_dict_ = sstable_param.compress_dict_;
   if (OB_FAIL(column_checksums_.assign(sstable_param.column_checksums_))) {
     LOG_WARN("fail to fill column checksum", K(ret), K(sstable_param));
   } else if (!is_valid()) {
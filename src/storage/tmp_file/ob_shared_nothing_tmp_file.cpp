@@ -252,6 +252,8 @@ ObSharedNothingTmpFile::ObSharedNothingTmpFile()
       ref_cnt_(0),
       truncated_offset_(0),
       read_offset_(0),
+      last_read_end_offset_(-1),
+      read_ahead_size_(0),
       file_size_(0),
       flushed_data_page_num_(0),
       write_back_data_page_num_(0),
@@ -409,6 +411,8 @@ void ObSharedNothingTmpFile::reset()
   ref_cnt_ = 0;
   truncated_offset_ = 0;
   read_offset_ = 0;
+  last_read_end_offset_ = -1;
+  read_ahead_size_ = 0;
   file_size_ = 0;
   flushed_data_page_num_ = 0;
   write_back_data_page_num_ = 0;
@@ -486,6 +490,7 @@ int ObSharedNothingTmpFile::aio_pread(ObTmpFileIOCtx &io_ctx)
         || 0 != io_ctx.get_todo_size() % ObTmpFileGlobal::PAGE_SIZE) {
       io_ctx.set_is_unaligned_read(true);
     }
+    const int64_t read_ahead_size = cal_read_ahead_size_(io_ctx.get_read_offset_in_file());
 
     LOG_DEBUG("start to inner read tmp file", K(fd_), K(io_ctx.get_read_offset_in_file()),
                                               K(io_ctx.get_todo_size()), K(io_ctx.get_done_size()), KPC(this));
@@ -513,13 +518,17 @@ int ObSharedNothingTmpFile::aio_pread(ObTmpFileIOCtx &io_ctx)
       } else if (io_ctx.get_read_offset_in_file() < wbp_begin_offset) {
         const int64_t expected_read_disk_size = MIN(io_ctx.get_todo_size(),
                                                     wbp_begin_offset - io_ctx.get_read_offset_in_file());
+        // never read ahead the pages which are still in wbp
+        const int64_t disk_read_ahead_size =
+            MAX(0, MIN(read_ahead_size, common::lower_align(wbp_begin_offset, ObTmpFileGlobal::PAGE_SIZE) -
+                                        io_ctx.get_read_offset_in_file() - expected_read_disk_size));
 
         if (OB_UNLIKELY(expected_read_disk_size < 0)) {
           ret = OB_ERR_UNEXPECTED;
           LOG_WARN("unexpected read disk size", KR(ret), K(fd_), K(expected_read_disk_size), K(wbp_begin_offset), K(io_ctx));
         } else if (expected_read_disk_size == 0) {
           // do nothing
-        } else if (OB_FAIL(inner_read_from_disk_(expected_read_disk_size, io_ctx))) {
+        } else if (OB_FAIL(inner_read_from_disk_(expected_read_disk_size, disk_read_ahead_size, io_ctx))) {
           LOG_WARN("fail to read tmp file from disk", KR(ret), K(fd_), K(expected_read_disk_size),
                   K(wbp_begin_offset), K(io_ctx));
         } else {
@@ -545,6 +554,17 @@ int ObSharedNothingTmpFile::aio_pread(ObTmpFileIOCtx &io_ctx)
       }
     }
 
+    if (OB_SUCC(ret)) {
+      int tmp_ret = OB_SUCCESS;
+      ATOMIC_STORE(&last_read_end_offset_, io_ctx.get_read_offset_in_file());
+      // the file has been consumed to the end, its flushed pages are unlikely to be read again,
+      // so evict them before the pages of other files
+      if (io_ctx.get_read_offset_in_file() >= file_size_ && is_in_data_eviction_list_ &&
+          OB_TMP_FAIL(eviction_mgr_->prioritize_file(false/*is_meta*/, *this))) {
+        LOG_WARN("fail to prioritize file in eviction list", KR(tmp_ret), K(fd_));
+      }
+    }
+
     LOG_DEBUG("inner read finish once", KR(ret), K(fd_),
                                         K(io_ctx.get_read_offset_in_file()),
                                         K(io_ctx.get_todo_size()),
@@ -585,6 +605,7 @@ int ObSharedNothingTmpFile::inner_read_truncated_part_(ObTmpFileIOCtx &io_ctx)
 }
 
 int ObSharedNothingTmpFile::inner_read_from_disk_(const int64_t expected_read_disk_size,
+                                                  const int64_t read_ahead_size,
                                                   ObTmpFileIOCtx &io_ctx)
 {
   int ret = OB_SUCCESS;
@@ -615,6 +636,10 @@ int ObSharedNothingTmpFile::inner_read_from_disk_(const int64_t expected_read_di
     const int64_t end_read_offset_in_block = (data_items.count() - 1  == i?
                                               begin_read_offset_in_block + remain_read_size :
                                               end_offset_in_block);
+    // pages after the last read range are loaded into page cache in advance for sequential readers
+    const int64_t prefetch_end_offset_in_block = (data_items.count() - 1 == i ?
+                                                  MIN(end_offset_in_block, end_read_offset_in_block + read_ahead_size) :
+                                                  end_read_offset_in_block);
     int64_t actual_block_read_size = 0;
 
     ObTmpBlockValueHandle block_value_handle;
@@ -667,6 +692,7 @@ int ObSharedNothingTmpFile::inner_read_from_disk_(const int64_t expected_read_di
         if (OB_FAIL(inner_rand_read_from_block_(block_index,
                                                 begin_read_offset_in_block,
                                                 end_read_offset_in_block,
+                                                prefetch_end_offset_in_block,
                                                 io_ctx, actual_block_read_size))) {
           LOG_WARN("fail to rand read from block",
               KR(ret), K(fd_), K(block_index), K(begin_offset_in_block), K(end_offset_in_block),
@@ -740,6 +766,7 @@ int ObSharedNothingTmpFile::inner_seq_read_from_block_(const int64_t block_index
 int ObSharedNothingTmpFile::inner_rand_read_from_block_(const int64_t block_index,
                                                         const int64_t begin_read_offset_in_block,
                                                         const int64_t end_read_offset_in_block,
+                                                        const int64_t prefetch_end_offset_in_block,
                                                         ObTmpFileIOCtx &io_ctx,
                                                         int64_t &actual_read_size)
 {
@@ -792,7 +819,10 @@ int ObSharedNothingTmpFile::inner_rand_read_from_block_(const int64_t block_inde
         }
       } else {
         if (OB_FAIL(inner_read_continuous_uncached_pages_(block_index, begin_read_offset,
-                                                          end_read_offset, io_ctx))) {
+                                                          end_read_offset,
+                                                          end_page_id == end_page_idx_in_block ?
+                                                          prefetch_end_offset_in_block : end_read_offset,
+                                                          io_ctx))) {
           LOG_WARN("fail to inner read continuous uncached pages", KR(ret), K(fd_), K(block_index),
                                                                    K(begin_read_offset),
                                                                    K(end_read_offset),
@@ -853,12 +883,14 @@ int ObSharedNothingTmpFile::collect_pages_in_block_(const int64_t block_index,
 int ObSharedNothingTmpFile::inner_read_continuous_uncached_pages_(const int64_t block_index,
                                                                   const int64_t begin_read_offset_in_block,
                                                                   const int64_t end_read_offset_in_block,
+                                                                  const int64_t prefetch_end_offset_in_block,
                                                                   ObTmpFileIOCtx &io_ctx)
 {
   int ret = OB_SUCCESS;
   ObArray<ObTmpPageCacheKey> page_keys;
   const int64_t begin_page_idx = get_page_id_in_block_(begin_read_offset_in_block);
-  const int64_t end_page_idx = get_page_id_in_block_(end_read_offset_in_block - 1); // -1 to change open interval to close interval
+  // pages in [end_read_offset_in_block, prefetch_end_offset_in_block) are only put into page cache
+  const int64_t end_page_idx = get_page_id_in_block_(prefetch_end_offset_in_block - 1); // -1 to change open interval to close interval
   const int64_t block_read_begin_offset = get_page_begin_offset_by_file_or_block_offset_(begin_read_offset_in_block);
   const int64_t block_read_end_offset = get_page_end_offset_by_file_or_block_offset_(end_read_offset_in_block);
   const int64_t block_read_size = block_read_end_offset - block_read_begin_offset;  // read and cached completed pages from disk
@@ -1903,6 +1935,21 @@ int ObSharedNothingTmpFile::truncate_the_first_wbp_page_()
   return ret;
 }
 
+int64_t ObSharedNothingTmpFile::cal_read_ahead_size_(const int64_t read_begin_offset)
+{
+  // a read which begins at the end of the previous read is regarded as sequential,
+  // the read-ahead window doubles for each sequential read and is reset by a random read
+  int64_t read_ahead_size = 0;
+  if (read_begin_offset == ATOMIC_LOAD(&last_read_end_offset_)) {
+    const int64_t last_read_ahead_size = ATOMIC_LOAD(&read_ahead_size_);
+    read_ahead_size = 0 == last_read_ahead_size ?
+                      ObTmpFileGlobal::TMP_FILE_MIN_READ_AHEAD_SIZE :
+                      MIN(last_read_ahead_size * 2, ObTmpFileGlobal::TMP_FILE_MAX_READ_AHEAD_SIZE);
+  }
+  ATOMIC_STORE(&read_ahead_size_, read_ahead_size);
+  return read_ahead_size;
+}
+
 void ObSharedNothingTmpFile::update_read_offset(int64_t read_offset)
 {
   common::TCRWLock::WLockGuard guard(meta_lock_);
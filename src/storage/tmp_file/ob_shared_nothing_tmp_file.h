@@ -228,6 +228,7 @@ public:
   TO_STRING_KV(K(is_inited_), K(is_deleting_),
                K(tenant_id_), K(dir_id_), K(fd_),
                K(ref_cnt_), K(truncated_offset_), K(read_offset_),
+               K(last_read_end_offset_), K(read_ahead_size_),
                K(file_size_), K(flushed_data_page_num_), K(write_back_data_page_num_),
                K(cached_page_nums_),
                K(begin_page_id_), K(begin_page_virtual_id_),
@@ -313,12 +314,14 @@ public:
 private:
   int inner_read_truncated_part_(ObTmpFileIOCtx &io_ctx);
   int inner_read_from_wbp_(ObTmpFileIOCtx &io_ctx);
-  int inner_read_from_disk_(const int64_t expected_read_disk_size, ObTmpFileIOCtx &io_ctx);
+  int inner_read_from_disk_(const int64_t expected_read_disk_size, const int64_t read_ahead_size,
+                            ObTmpFileIOCtx &io_ctx);
   int inner_seq_read_from_block_(const int64_t block_index,
                                  const int64_t begin_read_offset_in_block, const int64_t end_read_offset_in_block,
                                  ObTmpFileIOCtx &io_ctx, int64_t &actual_read_size);
   int inner_rand_read_from_block_(const int64_t block_index,
                                   const int64_t begin_read_offset_in_block, const int64_t end_read_offset_in_block,
+                                  const int64_t prefetch_end_offset_in_block,
                                   ObTmpFileIOCtx &io_ctx, int64_t &actual_read_size);
   int collect_pages_in_block_(const int64_t block_index,
                               const int64_t begin_page_idx_in_block,
@@ -333,7 +336,9 @@ private:
   int inner_read_continuous_uncached_pages_(const int64_t block_index,
                                             const int64_t begin_read_offset_in_block,
                                             const int64_t end_read_offset_in_block,
+                                            const int64_t prefetch_end_offset_in_block,
                                             ObTmpFileIOCtx &io_ctx);
+  int64_t cal_read_ahead_size_(const int64_t read_begin_offset);
   int inner_truncate_(const int64_t truncate_offset, const int64_t wbp_begin_offset);
 private:
   int inner_write_(ObTmpFileIOCtx &io_ctx);
@@ -436,6 +441,8 @@ private:
   int64_t ref_cnt_;
   int64_t truncated_offset_;      // read data befor truncated_offset will be set as 0
   int64_t read_offset_;           // read offset is on the entire file
+  int64_t last_read_end_offset_;  // end offset of the last read, used to detect sequential readers
+  int64_t read_ahead_size_;       // pages read ahead into page cache for sequential readers
   int64_t file_size_;             // has written size of this file
   int64_t flushed_data_page_num_; // equal to the page num between [begin_page_id_, flushed_page_id_] in wbp
   int64_t write_back_data_page_num_;
@@ -95,6 +95,24 @@ int ObTmpFileEvictionManager::remove_file(const bool is_meta, ObSharedNothingTmp
   return ret;
 }
 
+int ObTmpFileEvictionManager::prioritize_file(const bool is_meta, ObSharedNothingTmpFile &file)
+{
+  int ret = OB_SUCCESS;
+  ObSpinLock &lock = is_meta ? meta_list_lock_ : data_list_lock_;
+  TmpFileEvictionList &eviction_list = is_meta ? file_meta_eviction_list_ : file_data_eviction_list_;
+  ObSharedNothingTmpFile::ObTmpFileNode &eviction_node = is_meta ? file.get_meta_eviction_node() : file.get_data_eviction_node();
+  ObSpinLockGuard guard(lock);
+  // the node has been popped by evicting if it is not in list
+  if (OB_NOT_NULL(eviction_node.get_next()) && eviction_list.get_first() != &eviction_node) {
+    if (OB_UNLIKELY(!eviction_list.move_to_first(&eviction_node))) {
+      ret = OB_ERR_UNEXPECTED;
+      LOG_WARN("fail to move node to first", KR(ret), K(file));
+    }
+  }
+
+  return ret;
+}
+
 int ObTmpFileEvictionManager::evict(const int64_t expected_evict_page_num, int64_t &actual_evict_page_num)
 {
   int ret = OB_SUCCESS;
@@ -38,6 +38,8 @@ public:
   int add_file(const bool is_meta, ObSharedNothingTmpFile &file);
   int remove_file(ObSharedNothingTmpFile &file);
   int remove_file(const bool is_meta, ObSharedNothingTmpFile &file);
+  // move the file to the head of eviction list, so that its pages are evicted first
+  int prioritize_file(const bool is_meta, ObSharedNothingTmpFile &file);
   int evict(const int64_t expected_evict_page_num, int64_t &actual_evict_page_num);
 
 private:
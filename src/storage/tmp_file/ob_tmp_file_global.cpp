@@ -22,6 +22,8 @@ const int64_t ObTmpFileGlobal::INVALID_TMP_FILE_FD = -1;
 const int64_t ObTmpFileGlobal::INVALID_TMP_FILE_DIR_ID = -1;
 const int64_t ObTmpFileGlobal::TMP_FILE_READ_BATCH_SIZE = 8 * 1024 * 1024;   // 8MB
 const int64_t ObTmpFileGlobal::TMP_FILE_WRITE_BATCH_PAGE_NUM = 16;
+const int64_t ObTmpFileGlobal::TMP_FILE_MIN_READ_AHEAD_SIZE = 64 * 1024;          // 64KB
+const int64_t ObTmpFileGlobal::TMP_FILE_MAX_READ_AHEAD_SIZE = 1024 * 1024;        // 1MB
 const int64_t ObTmpFileGlobal::INVALID_TMP_FILE_BLOCK_INDEX = -1;
 const uint32_t ObTmpFileGlobal::INVALID_PAGE_ID = UINT32_MAX;
 const int64_t ObTmpFileGlobal::INVALID_VIRTUAL_PAGE_ID = -1;
@@ -30,6 +30,9 @@ struct ObTmpFileGlobal final
 
   static const int64_t TMP_FILE_READ_BATCH_SIZE;
   static const int64_t TMP_FILE_WRITE_BATCH_PAGE_NUM;
+  // read-ahead window of sequential readers grows from MIN to MAX by doubling
+  static const int64_t TMP_FILE_MIN_READ_AHEAD_SIZE;
+  static const int64_t TMP_FILE_MAX_READ_AHEAD_SIZE;
 
   static const int64_t TMP_FILE_MAX_LABEL_SIZE = 15;
 
@@ -21,12 +21,62 @@ using namespace common;
 namespace transaction
 {
 
+void ObGTSRequestStat::reset()
+{
+  request_cnt_ = 0;
+  request_rate_ = 0;
+  rtt_us_ = 0;
+  last_refresh_ts_ = 0;
+}
+
+void ObGTSRequestStat::update_rtt(const int64_t rtt_us)
+{
+  if (rtt_us > 0) {
+    const int64_t old_rtt = ATOMIC_LOAD(&rtt_us_);
+    // new_rtt = 7/8 * old_rtt + 1/8 * rtt, lost updates are acceptable
+    const int64_t new_rtt = (0 == old_rtt) ? rtt_us : (old_rtt * 7 + rtt_us) / 8;
+    ATOMIC_STORE(&rtt_us_, new_rtt);
+  }
+}
+
+void ObGTSRequestStat::refresh_request_rate(const int64_t cur_ts)
+{
+  const int64_t last_refresh_ts = ATOMIC_LOAD(&last_refresh_ts_);
+  const int64_t interval = cur_ts - last_refresh_ts;
+  if (0 == last_refresh_ts) {
+    if (ATOMIC_BCAS(&last_refresh_ts_, last_refresh_ts, cur_ts)) {
+      ATOMIC_STORE(&request_cnt_, 0);
+    }
+  } else if (interval > 0 && ATOMIC_BCAS(&last_refresh_ts_, last_refresh_ts, cur_ts)) {
+    const int64_t cnt = ATOMIC_TAS(&request_cnt_, 0);
+    const int64_t rate = cnt * 1000 * 1000 / interval;
+    const int64_t old_rate = ATOMIC_LOAD(&request_rate_);
+    // react to bursts immediately and decay slowly
+    const int64_t new_rate = (rate >= old_rate) ? rate : (old_rate + rate) / 2;
+    ATOMIC_STORE(&request_rate_, new_rate);
+  }
+}
+
+int64_t ObGTSRequestStat::get_rpc_lease() const
+{
+  const int64_t lease = RPC_LEASE_RTT_FACTOR * ATOMIC_LOAD(&rtt_us_);
+  return MIN(MAX(lease, MIN_RPC_LEASE_US), MAX_RPC_LEASE_US);
+}
+
+bool ObGTSRequestStat::is_hot() const
+{
+  const int64_t rtt = ATOMIC_LOAD(&rtt_us_);
+  const int64_t rate = ATOMIC_LOAD(&request_rate_);
+  return rtt > 0 && rate * rtt >= HOT_REQUEST_PER_RTT * 1000 * 1000;
+}
+
 void ObGTSLocalCache::reset()
 {
   srr_.reset();
   gts_ = 0;
   latest_srr_.reset();
   receive_gts_ts_.reset();
+  request_stat_.reset();
 }
 
 //Due to network and other factors, it is impossible to guarantee that srr and gts maintain partial order,
@@ -48,6 +98,9 @@ int ObGTSLocalCache::update_gts(const MonotonicTs srr,
     (void)atomic_update(&receive_gts_ts_.mts_, receive_gts_ts.mts_);
     (void)atomic_update(&gts_, gts);
     update = atomic_update(&srr_.mts_, srr.mts_);
+    if (update) {
+      request_stat_.update_rtt(receive_gts_ts.mts_ - srr.mts_);
+    }
   }
 
   return ret;
@@ -145,6 +198,20 @@ int ObGTSLocalCache::get_srr_and_gts_safe(MonotonicTs &srr,
   return OB_SUCCESS;
 }
 
+bool ObGTSLocalCache::need_coalesce_rpc(const MonotonicTs arrival_ts, const MonotonicTs cur_ts) const
+{
+  bool bool_ret = false;
+  const int64_t latest_srr = ATOMIC_LOAD(&latest_srr_.mts_);
+  // the gts of the rpc on the road may be older than a waiter arriving after it was sent
+  if (latest_srr > ATOMIC_LOAD(&srr_.mts_)
+      && arrival_ts.mts_ <= latest_srr
+      && cur_ts.mts_ - latest_srr < request_stat_.get_rpc_lease()
+      && request_stat_.is_hot()) {
+    bool_ret = true;
+  }
+  return bool_ret;
+}
+
 int ObGTSLocalCache::update_latest_srr(const MonotonicTs latest_srr)
 {
   int ret = OB_SUCCESS;
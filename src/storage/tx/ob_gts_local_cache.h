@@ -24,6 +24,42 @@ namespace oceanbase
 namespace transaction
 {
 
+// Tracks the gts request rate and the rpc round trip time of a tenant, which are
+// used to decide whether concurrent waiters can share the rpc already on the road
+// and whether the next rpc should be prefetched before anyone asks for it.
+class ObGTSRequestStat
+{
+public:
+  // the tenant is considered hot if at least this many requests are expected
+  // to arrive within one gts rpc round trip
+  static const int64_t HOT_REQUEST_PER_RTT = 2;
+  // an rpc on the road is shared only if it was sent within this many round trips,
+  // which bounds the extra latency caused by a lost rpc or response
+  static const int64_t RPC_LEASE_RTT_FACTOR = 2;
+  static const int64_t MIN_RPC_LEASE_US = 1000;
+  static const int64_t MAX_RPC_LEASE_US = 10 * 1000;
+public:
+  ObGTSRequestStat() { reset(); }
+  ~ObGTSRequestStat() { reset(); }
+  void reset();
+  void inc_request_cnt() { ATOMIC_INC(&request_cnt_); }
+  void update_rtt(const int64_t rtt_us);
+  void refresh_request_rate(const int64_t cur_ts);
+  int64_t get_request_rate() const { return ATOMIC_LOAD(&request_rate_); }
+  int64_t get_rtt() const { return ATOMIC_LOAD(&rtt_us_); }
+  int64_t get_rpc_lease() const;
+  bool is_hot() const;
+  TO_STRING_KV(K_(request_cnt), K_(request_rate), K_(rtt_us), K_(last_refresh_ts));
+private:
+  // requests since the last refresh
+  int64_t request_cnt_;
+  // moving average of requests per second
+  int64_t request_rate_;
+  // moving average of the rpc round trip time
+  int64_t rtt_us_;
+  int64_t last_refresh_ts_;
+};
+
 class ObGTSLocalCache
 {
 public:
@@ -46,8 +82,17 @@ public:
   int get_srr_and_gts_safe(MonotonicTs &srr, int64_t &gts, MonotonicTs &receive_gts_ts) const;
   int update_latest_srr(const MonotonicTs latest_srr);
   bool no_rpc_on_road() const { return ATOMIC_LOAD(&latest_srr_.mts_) == ATOMIC_LOAD(&srr_.mts_); }
+  // Whether the caller arriving at arrival_ts can skip sending a gts rpc and wait for the
+  // response of the rpc on the road instead, which then triggers one rpc for all the
+  // remaining waiters. Only the rpc sent after the caller arrived can satisfy it.
+  bool need_coalesce_rpc(const MonotonicTs arrival_ts, const MonotonicTs cur_ts) const;
+  // Whether the next rpc should be sent in advance to keep the local gts fresh
+  bool need_prefetch() const { return no_rpc_on_road() && request_stat_.is_hot(); }
+  void inc_request_cnt() { request_stat_.inc_request_cnt(); }
+  void refresh_request_rate(const int64_t cur_ts) { request_stat_.refresh_request_rate(cur_ts); }
+  const ObGTSRequestStat &get_request_stat() const { return request_stat_; }
 
-  TO_STRING_KV(K_(srr), K_(gts), K_(latest_srr));
+  TO_STRING_KV(K_(srr), K_(gts), K_(latest_srr), K_(request_stat));
 private:
   // send rpc request timestamp
   MonotonicTs srr_;
@@ -56,6 +101,7 @@ private:
   MonotonicTs latest_srr_;
   // receive gts
   MonotonicTs receive_gts_ts_;
+  ObGTSRequestStat request_stat_;
 };
 
 } // transaction
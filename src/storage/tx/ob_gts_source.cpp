@@ -41,6 +41,8 @@ void ObGtsStatistics::reset()
   try_get_gts_with_stc_cnt_ = 0;
   wait_gts_elapse_cnt_ = 0;
   try_wait_gts_elapse_cnt_ = 0;
+  gts_rpc_coalesce_cnt_ = 0;
+  gts_prefetch_cnt_ = 0;
 }
 
 int ObGtsStatistics::init(const uint64_t tenant_id)
@@ -53,7 +55,7 @@ int ObGtsStatistics::init(const uint64_t tenant_id)
   return ret;
 }
 
-void ObGtsStatistics::statistics()
+void ObGtsStatistics::statistics(const ObGTSRequestStat &request_stat)
 {
   const int64_t cur_ts = ObTimeUtility::current_time();
   const int64_t last_stat_ts = ATOMIC_LOAD(&last_stat_ts_);
@@ -67,7 +69,10 @@ void ObGtsStatistics::statistics()
                       "try_get_gts_cache_cnt", ATOMIC_LOAD(&try_get_gts_cache_cnt_),
                       "try_get_gts_with_stc_cnt", ATOMIC_LOAD(&try_get_gts_with_stc_cnt_),
                       "wait_gts_elapse_cnt", ATOMIC_LOAD(&wait_gts_elapse_cnt_),
-                      "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_));
+                      "try_wait_gts_elapse_cnt", ATOMIC_LOAD(&try_wait_gts_elapse_cnt_),
+                      "gts_rpc_coalesce_cnt", ATOMIC_LOAD(&gts_rpc_coalesce_cnt_),
+                      "gts_prefetch_cnt", ATOMIC_LOAD(&gts_prefetch_cnt_),
+                      K(request_stat));
       ATOMIC_STORE(&gts_rpc_cnt_, 0);
       ATOMIC_STORE(&get_gts_cache_cnt_, 0);
       ATOMIC_STORE(&get_gts_with_stc_cnt_, 0);
@@ -75,6 +80,8 @@ void ObGtsStatistics::statistics()
       ATOMIC_STORE(&try_get_gts_with_stc_cnt_, 0);
       ATOMIC_STORE(&wait_gts_elapse_cnt_, 0);
       ATOMIC_STORE(&try_wait_gts_elapse_cnt_, 0);
+      ATOMIC_STORE(&gts_rpc_coalesce_cnt_, 0);
+      ATOMIC_STORE(&gts_prefetch_cnt_, 0);
     }
   }
 
@@ -208,6 +215,7 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
   } else if (OB_UNLIKELY(!stc.is_valid())) {
     ret = OB_INVALID_ARGUMENT;
     TRANS_LOG(WARN, "invalid argument", KR(ret), K(stc), KP(task));
+  } else if (FALSE_IT(gts_local_cache_.inc_request_cnt())) {
   } else if (OB_SUCCESS == (ret = gts_local_cache_.get_gts(stc,
                                                            tmp_gts,
                                                            receive_gts_ts,
@@ -247,7 +255,7 @@ int ObGtsSource::get_gts(const MonotonicTs stc,
     } else {
       // If not in local, refresh gts
       if (need_send_rpc) {
-        if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
+        if (OB_SUCCESS != (tmp_ret = query_gts_if_needed_(leader, stc))) {
           TRANS_LOG(WARN, "query gts fail", K(tmp_ret), K(leader));
         }
       }
@@ -386,6 +394,7 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts, ObTsCbTask *task, bool &need_
     ret = OB_INVALID_ARGUMENT;
     TRANS_LOG(WARN, "invalid argument", KR(ret), K(ts), KP(task));
   } else {
+    gts_local_cache_.inc_request_cnt();
     int64_t gts = 0;
     bool tmp_need_wait = false;
     ObAddr leader;
@@ -464,6 +473,8 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts)
     ret = OB_INVALID_ARGUMENT;
     TRANS_LOG(WARN, "invalid argument", KR(ret), K(ts));
   } else {
+    gts_local_cache_.inc_request_cnt();
+    const MonotonicTs arrival_ts = MonotonicTs::current_time();
     int64_t gts = 0;
     ObAddr leader;
     if (OB_FAIL(gts_local_cache_.get_gts(gts))) {
@@ -495,7 +506,7 @@ int ObGtsSource::wait_gts_elapse(const int64_t ts)
         }
       } else {
         // If the leader is not in local, gts needs to be refreshed
-        if (OB_SUCCESS != (tmp_ret = query_gts_(leader))) {
+        if (OB_SUCCESS != (tmp_ret = query_gts_if_needed_(leader, arrival_ts))) {
           TRANS_LOG(WARN, "refresh gts failed", K(tmp_ret));
         }
       }
@@ -513,6 +524,7 @@ int ObGtsSource::refresh_gts(const bool need_refresh)
     TRANS_LOG(WARN, "not inited");
     ret = OB_NOT_INIT;
   } else {
+    gts_local_cache_.refresh_request_rate(ObTimeUtility::current_time());
     ret = refresh_gts_(need_refresh);
   }
   statistics_();
@@ -572,6 +584,38 @@ int ObGtsSource::query_gts_(const ObAddr &leader)
   return ret;
 }
 
+// While the tenant is hot, the waiters arriving before an rpc has been sent share the
+// response of that rpc instead of sending their own. The response handler sends one
+// rpc for all waiters that are still not satisfied, see handle_gts_result. A waiter
+// arriving after the rpc was sent can not use its gts, so it sends the next rpc at once,
+// which is then shared by the waiters arriving before it.
+int ObGtsSource::query_gts_if_needed_(const ObAddr &leader, const MonotonicTs arrival_ts)
+{
+  int ret = OB_SUCCESS;
+  if (gts_local_cache_.need_coalesce_rpc(arrival_ts, MonotonicTs::current_time())) {
+    gts_statistics_.inc_gts_rpc_coalesce_cnt();
+  } else {
+    ret = query_gts_(leader);
+  }
+  return ret;
+}
+
+// Keep one rpc on the road while the tenant is hot, so that the local gts is at most
+// one round trip behind and wait_gts_elapse seldom needs to wait for a new rpc.
+void ObGtsSource::prefetch_gts_()
+{
+  int tmp_ret = OB_SUCCESS;
+  if (gts_local_cache_.need_prefetch()) {
+    if (OB_SUCCESS != (tmp_ret = refresh_gts_(false))) {
+      if (EXECUTE_COUNT_PER_SEC(16)) {
+        TRANS_LOG(WARN, "prefetch gts failed", K(tmp_ret), K_(tenant_id));
+      }
+    } else {
+      gts_statistics_.inc_gts_prefetch_cnt();
+    }
+  }
+}
+
 int ObGtsSource::refresh_gts_location_()
 {
   int ret = OB_SUCCESS;
@@ -610,7 +654,7 @@ int ObGtsSource::refresh_gts_(const bool need_refresh)
 
 void ObGtsSource::statistics_()
 {
-  gts_statistics_.statistics();
+  gts_statistics_.statistics(gts_local_cache_.get_request_stat());
 }
 
 int ObGtsSource::update_gts(const MonotonicTs srr,
@@ -683,6 +727,8 @@ int ObGtsSource::handle_gts_result(const uint64_t tenant_id, const int64_t queue
       } else {
         TRANS_LOG(WARN, "iterate task failed", KR(ret), K(queue_index));
       }
+    } else {
+      prefetch_gts_();
     }
   }
   return ret;
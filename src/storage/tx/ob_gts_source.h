@@ -51,7 +51,9 @@ public:
   void inc_try_get_gts_with_stc_cnt() { ATOMIC_INC(&try_get_gts_with_stc_cnt_); }
   void inc_wait_gts_elapse_cnt() { ATOMIC_INC(&wait_gts_elapse_cnt_); }
   void inc_try_wait_gts_elapse_cnt() { ATOMIC_INC(&try_wait_gts_elapse_cnt_); }
-  void statistics();
+  void inc_gts_rpc_coalesce_cnt() { ATOMIC_INC(&gts_rpc_coalesce_cnt_); }
+  void inc_gts_prefetch_cnt() { ATOMIC_INC(&gts_prefetch_cnt_); }
+  void statistics(const ObGTSRequestStat &request_stat);
 private:
   uint64_t tenant_id_;
   int64_t last_stat_ts_;
@@ -64,6 +66,9 @@ private:
 
   int64_t wait_gts_elapse_cnt_;
   int64_t try_wait_gts_elapse_cnt_;
+
+  int64_t gts_rpc_coalesce_cnt_;
+  int64_t gts_prefetch_cnt_;
 };
 
 class ObGtsSource
@@ -98,6 +103,8 @@ private:
   int refresh_gts_location_();
   int refresh_gts_(const bool need_refresh);
   int query_gts_(const common::ObAddr &leader);
+  int query_gts_if_needed_(const common::ObAddr &leader, const MonotonicTs arrival_ts);
+  void prefetch_gts_();
   void statistics_();
   int get_gts_from_local_timestamp_service_(common::ObAddr &leader,
                                             int64_t &gts,
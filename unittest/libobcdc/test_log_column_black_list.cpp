@@ -0,0 +1,137 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "gtest/gtest.h"
+#define private public
+#include "logservice/libobcdc/src/ob_log_meta_manager.h"
+#undef private
+#include "logservice/libobcdc/src/ob_log_config.h"
+
+#define USING_LOG_PREFIX OBLOG
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+
+class TestLogColumnBlackList : public ::testing::Test
+{
+public:
+  virtual void TearDown()
+  {
+    TCONF.tb_column_black_list.set_value("|");
+  }
+  bool is_matched(const char *tenant_name, const char *db_name, const char *table_name,
+      const char *column_name)
+  {
+    bool matched = false;
+    EXPECT_EQ(OB_SUCCESS, meta_manager_.match_column_black_list_(tenant_name, db_name, table_name,
+        column_name, matched));
+    return matched;
+  }
+  ObLogMetaManager meta_manager_;
+};
+
+TEST_F(TestLogColumnBlackList, empty)
+{
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("|"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c1"));
+}
+
+TEST_F(TestLogColumnBlackList, split_pattern)
+{
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("tenant1.db1.t1.c1"));
+  EXPECT_TRUE(is_matched("tenant1", "db1", "t1", "c1"));
+  // every part of the pattern is matched with its own name
+  EXPECT_FALSE(is_matched("tenant2", "db1", "t1", "c1"));
+  EXPECT_FALSE(is_matched("tenant1", "db2", "t1", "c1"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t2", "c1"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c2"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c10"));
+  // the pattern is split at the first three dots only
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("tenant1.db1.t1.c.1"));
+  EXPECT_TRUE(is_matched("tenant1", "db1", "t1", "c.1"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c1"));
+}
+
+TEST_F(TestLogColumnBlackList, case_fold)
+{
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("Tenant1.DB1.t1.Col_A"));
+  EXPECT_TRUE(is_matched("tenant1", "db1", "T1", "COL_A"));
+  EXPECT_TRUE(is_matched("TENANT1", "Db1", "t1", "col_a"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "col_b"));
+}
+
+TEST_F(TestLogColumnBlackList, wildcard)
+{
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("*.*.t2.*_bak"));
+  EXPECT_TRUE(is_matched("tenant1", "db1", "t2", "c1_bak"));
+  EXPECT_TRUE(is_matched("tenant2", "db9", "t2", "_bak"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t2", "c1_bak2"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t3", "c1_bak"));
+
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("tenant?.db[12].t*.c?"));
+  EXPECT_TRUE(is_matched("tenant1", "db1", "t", "c1"));
+  EXPECT_TRUE(is_matched("tenant9", "db2", "t100", "cx"));
+  EXPECT_FALSE(is_matched("tenant10", "db1", "t1", "c1"));
+  EXPECT_FALSE(is_matched("tenant1", "db3", "t1", "c1"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c12"));
+}
+
+TEST_F(TestLogColumnBlackList, multiple_entries)
+{
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("tenant1.db1.t1.c1|*.*.t2.*_bak|tenant2.*.*.secret"));
+  EXPECT_TRUE(is_matched("tenant1", "db1", "t1", "c1"));
+  EXPECT_TRUE(is_matched("tenant1", "db1", "t2", "c2_bak"));
+  EXPECT_TRUE(is_matched("tenant2", "db3", "t3", "secret"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c2"));
+  EXPECT_FALSE(is_matched("tenant1", "db3", "t3", "secret"));
+  // empty entries are skipped
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("||tenant1.db1.t1.c1||"));
+  EXPECT_TRUE(is_matched("tenant1", "db1", "t1", "c1"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c2"));
+}
+
+TEST_F(TestLogColumnBlackList, malformed_entry)
+{
+  // an entry without the column part is ignored, the other entries still apply
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("tenant1.db1.t1|tenant1.db1.t2.c1"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c1"));
+  EXPECT_TRUE(is_matched("tenant1", "db1", "t2", "c1"));
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("tenant1"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c1"));
+  ASSERT_TRUE(TCONF.tb_column_black_list.set_value("*"));
+  EXPECT_FALSE(is_matched("tenant1", "db1", "t1", "c1"));
+}
+
+TEST_F(TestLogColumnBlackList, invalid_argument)
+{
+  bool matched = false;
+  EXPECT_EQ(OB_INVALID_ARGUMENT, meta_manager_.match_column_black_list_(NULL, "db1", "t1", "c1", matched));
+  EXPECT_EQ(OB_INVALID_ARGUMENT, meta_manager_.match_column_black_list_("tenant1", "db1", "t1", NULL, matched));
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_log_column_black_list.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include "gtest/gtest.h"
+#include "logservice/libobcdc/src/ob_cdc_lob_ctx.h"
+
+#define USING_LOG_PREFIX OBLOG
+
+using namespace oceanbase;
+using namespace common;
+using namespace libobcdc;
+
+namespace oceanbase
+{
+namespace unittest
+{
+
+class TestObCDCLobCtx : public ::testing::Test
+{
+public:
+  // ObLobData followed by the ObLobDataOutRowCtx, the same layout as the outrow lob in redo
+  ObLobData *build_lob_data(const ObLobDataOutRowCtx::OpType op)
+  {
+    ObLobData *lob_data = new (buf_) ObLobData();
+    ObLobDataOutRowCtx *out_row_ctx = new (lob_data->buffer_) ObLobDataOutRowCtx();
+    out_row_ctx->op_ = op;
+    out_row_ctx->is_full_ = (ObLobDataOutRowCtx::OpType::SQL == op) ? 1 : 0;
+    out_row_ctx->seq_no_st_ = 1;
+    out_row_ctx->seq_no_cnt_ = 2;
+    lob_data->byte_size_ = 1024;
+    return lob_data;
+  }
+private:
+  char buf_[sizeof(ObLobData) + sizeof(ObLobDataOutRowCtx)];
+};
+
+TEST_F(TestObCDCLobCtx, full_lob)
+{
+  blocksstable::ObDmlRowFlag dml_flag;
+  dml_flag.set_flag(blocksstable::DF_UPDATE);
+  ObLobDataGetCtx ctx;
+
+  ctx.reset(NULL, 16, dml_flag, build_lob_data(ObLobDataOutRowCtx::OpType::SQL));
+  EXPECT_EQ(ObLobDataGetTaskType::FULL_LOB, ctx.get_type());
+  EXPECT_FALSE(ctx.is_ext_info_log());
+  EXPECT_FALSE(ctx.is_partial_lob());
+
+  ctx.reset();
+  ctx.reset(NULL, 16, dml_flag, build_lob_data(ObLobDataOutRowCtx::OpType::EMPTY_SQL));
+  EXPECT_EQ(ObLobDataGetTaskType::FULL_LOB, ctx.get_type());
+  EXPECT_FALSE(ctx.is_partial_lob());
+}
+
+TEST_F(TestObCDCLobCtx, json_diff)
+{
+  blocksstable::ObDmlRowFlag dml_flag;
+  dml_flag.set_flag(blocksstable::DF_UPDATE);
+  ObLobDataGetCtx ctx;
+
+  ctx.reset(NULL, 16, dml_flag, build_lob_data(ObLobDataOutRowCtx::OpType::DIFF));
+  EXPECT_EQ(ObLobDataGetTaskType::EXT_INFO_LOG, ctx.get_type());
+  EXPECT_TRUE(ctx.is_ext_info_log());
+  EXPECT_FALSE(ctx.is_partial_lob());
+}
+
+TEST_F(TestObCDCLobCtx, partial_lob)
+{
+  blocksstable::ObDmlRowFlag dml_flag;
+  dml_flag.set_flag(blocksstable::DF_UPDATE);
+  const ObLobDataOutRowCtx::OpType partial_ops[] = {
+    ObLobDataOutRowCtx::OpType::APPEND,
+    ObLobDataOutRowCtx::OpType::INSERT,
+    ObLobDataOutRowCtx::OpType::WRITE,
+    ObLobDataOutRowCtx::OpType::ERASE,
+  };
+
+  for (int64_t i = 0; i < ARRAYSIZEOF(partial_ops); ++i) {
+    ObLobDataGetCtx ctx;
+    ctx.reset(NULL, 16, dml_flag, build_lob_data(partial_ops[i]));
+    // not a json diff, must not be routed to the ext info log path
+    EXPECT_EQ(ObLobDataGetTaskType::FULL_LOB, ctx.get_type());
+    // and must be refused by the merger instead of output as the full value
+    EXPECT_TRUE(ctx.is_partial_lob());
+  }
+}
+
+TEST_F(TestObCDCLobCtx, no_lob_data)
+{
+  blocksstable::ObDmlRowFlag dml_flag;
+  dml_flag.set_flag(blocksstable::DF_INSERT);
+  ObLobDataGetCtx ctx;
+
+  ctx.reset(NULL, 16, dml_flag, NULL);
+  EXPECT_EQ(ObLobDataGetTaskType::FULL_LOB, ctx.get_type());
+  EXPECT_FALSE(ctx.is_partial_lob());
+}
+
+}
+}
+
+int main(int argc, char **argv)
+{
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_cdc_lob_ctx.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc,argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include "observer/omt/ob_tenant.h"
+#include "observer/omt/ob_th_worker.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace omt;
+namespace unittest
+{
+
+TEST(TestReqQueueWaitStat, add)
+{
+  ReqQueueWaitStat stat;
+  int64_t pop_cnt = 0;
+  int64_t wait_us = 0;
+  for (int prio = 0; prio < RQ_MAX_PRIO; prio++) {
+    stat.get(prio, pop_cnt, wait_us);
+    ASSERT_EQ(0, pop_cnt);
+    ASSERT_EQ(0, wait_us);
+  }
+  stat.add(QQ_HIGH, 10);
+  stat.add(QQ_HIGH, 30);
+  stat.add(RQ_NORMAL, 100);
+  // a clock going backwards is not counted as wait time
+  stat.add(RQ_LOW, -5);
+  // out of range priorities are ignored
+  stat.add(-1, 1000);
+  stat.add(RQ_MAX_PRIO, 1000);
+
+  stat.get(QQ_HIGH, pop_cnt, wait_us);
+  ASSERT_EQ(2, pop_cnt);
+  ASSERT_EQ(40, wait_us);
+  stat.get(RQ_NORMAL, pop_cnt, wait_us);
+  ASSERT_EQ(1, pop_cnt);
+  ASSERT_EQ(100, wait_us);
+  stat.get(RQ_LOW, pop_cnt, wait_us);
+  ASSERT_EQ(1, pop_cnt);
+  ASSERT_EQ(0, wait_us);
+  stat.get(RQ_HIGH, pop_cnt, wait_us);
+  ASSERT_EQ(0, pop_cnt);
+  stat.get(RQ_MAX_PRIO, pop_cnt, wait_us);
+  ASSERT_EQ(0, pop_cnt);
+  ASSERT_EQ(0, wait_us);
+
+  char buf[1024];
+  const int64_t len = stat.to_string(buf, sizeof(buf));
+  ASSERT_GT(len, 0);
+  ASSERT_TRUE(NULL != strstr(buf, "queue[0]={pop_cnt:2, avg_wait_us:20}"));
+}
+
+TEST(TestReqQueueWaitStat, concurrent_add)
+{
+  ReqQueueWaitStat stat;
+  const int64_t thread_cnt = 8;
+  const int64_t add_cnt = 10000;
+  std::thread threads[thread_cnt];
+  for (int64_t i = 0; i < thread_cnt; i++) {
+    threads[i] = std::thread([&stat, i]() {
+      for (int64_t j = 0; j < add_cnt; j++) {
+        stat.add(static_cast<int>((i + j) % RQ_MAX_PRIO), 1);
+      }
+    });
+  }
+  for (int64_t i = 0; i < thread_cnt; i++) {
+    threads[i].join();
+  }
+  // the slots of all cpus add up to the total
+  int64_t total_pop_cnt = 0;
+  int64_t total_wait_us = 0;
+  for (int prio = 0; prio < RQ_MAX_PRIO; prio++) {
+    int64_t pop_cnt = 0;
+    int64_t wait_us = 0;
+    stat.get(prio, pop_cnt, wait_us);
+    ASSERT_EQ(pop_cnt, wait_us);
+    total_pop_cnt += pop_cnt;
+    total_wait_us += wait_us;
+  }
+  ASSERT_EQ(thread_cnt * add_cnt, total_pop_cnt);
+  ASSERT_EQ(thread_cnt * add_cnt, total_wait_us);
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_req_queue_wait_stat.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
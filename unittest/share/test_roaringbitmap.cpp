@@ -14,6 +14,7 @@
 #define private public
 #include "lib/roaringbitmap/ob_roaringbitmap.h"
 #include "lib/roaringbitmap/ob_rb_utils.h"
+#include "lib/roaringbitmap/ob_rb_bin.h"
 #include "lib/utility/ob_macro_utils.h"
 
 #undef private
@@ -383,6 +384,318 @@ TEST_F(TestRoaringBitmap, to_roaring_bin)
 
 }
 
+static void serialize_bitmap32(ObIAllocator &allocator, roaring::api::roaring_bitmap_t *bitmap, ObString &bin)
+{
+  size_t size = roaring::api::roaring_bitmap_portable_size_in_bytes(bitmap);
+  char *buf = static_cast<char *>(allocator.alloc(size));
+  ASSERT_TRUE(OB_NOT_NULL(buf));
+  ASSERT_EQ(size, roaring::api::roaring_bitmap_portable_serialize(bitmap, buf));
+  bin.assign_ptr(buf, static_cast<int32_t>(size));
+}
+
+// the result of calc_and/calc_andnot is | high32 | roaring_bitmap |, or nothing when empty
+static void check_bin_result(ObStringBuffer &res_buf, uint64_t res_card, roaring::api::roaring_bitmap_t *expected)
+{
+  ASSERT_EQ(roaring::api::roaring_bitmap_get_cardinality(expected), res_card);
+  if (0 == res_card) {
+    ASSERT_EQ(0, res_buf.length());
+  } else {
+    ASSERT_EQ(7U, *reinterpret_cast<const uint32_t *>(res_buf.ptr()));
+    roaring::api::roaring_bitmap_t *res = roaring::api::roaring_bitmap_portable_deserialize_safe(
+        res_buf.ptr() + sizeof(uint32_t), res_buf.length() - sizeof(uint32_t));
+    ASSERT_TRUE(OB_NOT_NULL(res));
+    ASSERT_TRUE(roaring::api::roaring_bitmap_equals(expected, res));
+    roaring::api::roaring_bitmap_free(res);
+  }
+}
+
+TEST_F(TestRoaringBitmap, roaring_bin_multi_container)
+{
+  ObArenaAllocator allocator(ObModIds::TEST);
+  roaring::api::roaring_bitmap_t *left = roaring::api::roaring_bitmap_create();
+  roaring::api::roaring_bitmap_t *right = roaring::api::roaring_bitmap_create();
+  // the container cardinalities differ from the container keys, so a key search
+  // that compares against cardinalities lands on the wrong container
+  for (uint32_t i = 0; i < 3; i++) {
+    roaring::api::roaring_bitmap_add(left, i);
+  }
+  for (uint32_t i = 0; i < 100; i++) {
+    roaring::api::roaring_bitmap_add(left, (1 << 16) | (i * 3));
+    roaring::api::roaring_bitmap_add(right, (1 << 16) | (i * 5));
+  }
+  for (uint32_t i = 0; i < 50; i++) {
+    roaring::api::roaring_bitmap_add(right, (2 << 16) | i);
+  }
+  // bitset containers
+  for (uint32_t i = 0; i < 5000; i++) {
+    roaring::api::roaring_bitmap_add(left, (3 << 16) | (i * 2));
+    roaring::api::roaring_bitmap_add(right, (3 << 16) | (i * 3));
+  }
+  roaring::api::roaring_bitmap_add_range(left, (7 << 16) | 100, (7 << 16) | 3000);
+  roaring::api::roaring_bitmap_add_range(right, (7 << 16) | 2000, (7 << 16) | 4000);
+  roaring::api::roaring_bitmap_add(left, (9 << 16) | 1);
+  roaring::api::roaring_bitmap_add(right, (9 << 16) | 2);
+  roaring::api::roaring_bitmap_add(right, (12 << 16) | 1);
+
+  for (int round = 0; round < 2; round++) {
+    if (1 == round) {
+      // the second round reads run containers
+      roaring::api::roaring_bitmap_run_optimize(left);
+      roaring::api::roaring_bitmap_run_optimize(right);
+    }
+    ObString left_bin;
+    ObString right_bin;
+    serialize_bitmap32(allocator, left, left_bin);
+    serialize_bitmap32(allocator, right, right_bin);
+    ObRoaringBin l_bin(&allocator, left_bin);
+    ObRoaringBin r_bin(&allocator, right_bin);
+    ASSERT_EQ(OB_SUCCESS, l_bin.init());
+    ASSERT_EQ(OB_SUCCESS, r_bin.init());
+    ASSERT_EQ(5, l_bin.size_);
+    ASSERT_EQ(6, r_bin.size_);
+
+    // contains
+    bool is_contains = false;
+    const uint32_t probes[] = {0, 2, 3, (1 << 16), (1 << 16) | 3, (1 << 16) | 4, (2 << 16) | 1,
+                               (3 << 16), (3 << 16) | 1, (3 << 16) | 9998, (7 << 16) | 99,
+                               (7 << 16) | 100, (7 << 16) | 2999, (7 << 16) | 3000, (9 << 16) | 1,
+                               (9 << 16) | 2, (12 << 16) | 1, (100 << 16) | 1, UINT32_MAX};
+    for (int64_t i = 0; i < ARRAYSIZEOF(probes); i++) {
+      ASSERT_EQ(OB_SUCCESS, l_bin.contains(probes[i], is_contains));
+      ASSERT_EQ(roaring::api::roaring_bitmap_contains(left, probes[i]), is_contains);
+      ASSERT_EQ(OB_SUCCESS, r_bin.contains(probes[i], is_contains));
+      ASSERT_EQ(roaring::api::roaring_bitmap_contains(right, probes[i]), is_contains);
+    }
+
+    // cardinality
+    uint64_t cardinality = 0;
+    ASSERT_EQ(OB_SUCCESS, l_bin.get_cardinality(cardinality));
+    ASSERT_EQ(roaring::api::roaring_bitmap_get_cardinality(left), cardinality);
+    ASSERT_EQ(OB_SUCCESS, l_bin.calc_and_cardinality(&r_bin, cardinality));
+    ASSERT_EQ(roaring::api::roaring_bitmap_and_cardinality(left, right), cardinality);
+    ASSERT_EQ(OB_SUCCESS, r_bin.calc_and_cardinality(&l_bin, cardinality));
+    ASSERT_EQ(roaring::api::roaring_bitmap_and_cardinality(left, right), cardinality);
+
+    // and
+    uint64_t res_card = 0;
+    ObStringBuffer and_buf(&allocator);
+    roaring::api::roaring_bitmap_t *expected = roaring::api::roaring_bitmap_and(left, right);
+    ASSERT_EQ(OB_SUCCESS, l_bin.calc_and(&r_bin, and_buf, res_card, 7));
+    check_bin_result(and_buf, res_card, expected);
+    roaring::api::roaring_bitmap_free(expected);
+
+    // andnot both ways
+    ObStringBuffer andnot_buf(&allocator);
+    expected = roaring::api::roaring_bitmap_andnot(left, right);
+    ASSERT_EQ(OB_SUCCESS, l_bin.calc_andnot(&r_bin, andnot_buf, res_card, 7));
+    check_bin_result(andnot_buf, res_card, expected);
+    roaring::api::roaring_bitmap_free(expected);
+    ObStringBuffer r_andnot_buf(&allocator);
+    expected = roaring::api::roaring_bitmap_andnot(right, left);
+    ASSERT_EQ(OB_SUCCESS, r_bin.calc_andnot(&l_bin, r_andnot_buf, res_card, 7));
+    check_bin_result(r_andnot_buf, res_card, expected);
+    roaring::api::roaring_bitmap_free(expected);
+
+    // andnot of itself is empty
+    ObStringBuffer self_buf(&allocator);
+    ASSERT_EQ(OB_SUCCESS, l_bin.calc_andnot(&l_bin, self_buf, res_card, 7));
+    ASSERT_EQ(0, res_card);
+    ASSERT_EQ(0, self_buf.length());
+  }
+  roaring::api::roaring_bitmap_free(left);
+  roaring::api::roaring_bitmap_free(right);
+}
+
+// lazy union the inputs, and check the result against the union of the existing
+// ObRoaringBitmap::value_or path and a roaring64 bitmap of all the values
+static void check_lazy_union(ObIAllocator &allocator, const ObIArray<ObString> &bins,
+                             roaring::api::roaring64_bitmap_t *expected, ObRbBinType expected_bin_type)
+{
+  ObRoaringBitmapLazyUnion lazy_union(&allocator);
+  ObRoaringBitmap *or_rb = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  ASSERT_TRUE(OB_NOT_NULL(or_rb));
+  for (int64_t i = 0; i < bins.count(); i++) {
+    ObRoaringBitmap *rb = nullptr;
+    ASSERT_EQ(OB_SUCCESS, lazy_union.value_or(bins.at(i)));
+    ASSERT_EQ(OB_SUCCESS, ObRbUtils::rb_deserialize(allocator, bins.at(i), rb));
+    ASSERT_EQ(OB_SUCCESS, or_rb->value_or(rb));
+  }
+  ObStringBuffer res_buf(&allocator);
+  ASSERT_EQ(OB_SUCCESS, lazy_union.serialize(res_buf));
+  ObString res_bin;
+  res_bin.assign_ptr(res_buf.ptr(), res_buf.length());
+  ObRbBinType bin_type;
+  ASSERT_EQ(OB_SUCCESS, ObRbUtils::get_bin_type(res_bin, bin_type));
+  ASSERT_EQ(expected_bin_type, bin_type);
+
+  ObString or_bin;
+  ASSERT_EQ(OB_SUCCESS, ObRbUtils::rb_serialize(allocator, or_bin, or_rb));
+  ObRbBinType or_bin_type;
+  ASSERT_EQ(OB_SUCCESS, ObRbUtils::get_bin_type(or_bin, or_bin_type));
+  ASSERT_EQ(or_bin_type, bin_type);
+
+  ObRoaringBitmap *res = nullptr;
+  ASSERT_EQ(OB_SUCCESS, ObRbUtils::rb_deserialize(allocator, res_bin, res, true));
+  ASSERT_EQ(roaring::api::roaring64_bitmap_get_cardinality(expected), res->get_cardinality());
+  ASSERT_EQ(or_rb->get_cardinality(), res->get_cardinality());
+  roaring::api::roaring64_iterator_t *it = roaring::api::roaring64_iterator_create(expected);
+  if (roaring::api::roaring64_bitmap_get_cardinality(expected) > 0) {
+    do {
+      ASSERT_TRUE(res->is_contains(roaring::api::roaring64_iterator_value(it)));
+    } while (roaring::api::roaring64_iterator_advance(it));
+  }
+  roaring::api::roaring64_iterator_free(it);
+}
+
+static void add_bin(ObIAllocator &allocator, ObRoaringBitmap *rb, bool to_roaring_bin,
+                    ObRbBinType bin_type, ObIArray<ObString> &bins)
+{
+  ObString bin;
+  ObString roaring_bin;
+  ObRbBinType res_type;
+  ASSERT_EQ(OB_SUCCESS, ObRbUtils::rb_serialize(allocator, bin, rb));
+  if (to_roaring_bin) {
+    ASSERT_EQ(OB_SUCCESS, ObRbUtils::binary_format_convert(allocator, bin, roaring_bin));
+    bin = roaring_bin;
+  }
+  ASSERT_EQ(OB_SUCCESS, ObRbUtils::get_bin_type(bin, res_type));
+  ASSERT_EQ(bin_type, res_type);
+  ASSERT_EQ(OB_SUCCESS, bins.push_back(bin));
+}
+
+TEST_F(TestRoaringBitmap, lazy_union_mixed_types)
+{
+  ObArenaAllocator allocator(ObModIds::TEST);
+  ObSEArray<ObString, 8> bins;
+  roaring::api::roaring64_bitmap_t *expected = roaring::api::roaring64_bitmap_create();
+  const uint64_t high = 1UL << 32;
+
+  // EMPTY
+  ObRoaringBitmap *empty_rb = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  add_bin(allocator, empty_rb, false, ObRbBinType::EMPTY, bins);
+  // SINGLE_32 and SINGLE_64
+  ObRoaringBitmap *single_rb = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  ASSERT_EQ(OB_SUCCESS, single_rb->value_add(7));
+  roaring::api::roaring64_bitmap_add(expected, 7);
+  add_bin(allocator, single_rb, false, ObRbBinType::SINGLE_32, bins);
+  ObRoaringBitmap *single64_rb = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  ASSERT_EQ(OB_SUCCESS, single64_rb->value_add(3 * high + 5));
+  roaring::api::roaring64_bitmap_add(expected, 3 * high + 5);
+  add_bin(allocator, single64_rb, false, ObRbBinType::SINGLE_64, bins);
+  // SET_32 and SET_64, overlapping with the single values
+  ObRoaringBitmap *set_rb = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  ObRoaringBitmap *set64_rb = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  for (uint64_t i = 0; i < 10; i++) {
+    ASSERT_EQ(OB_SUCCESS, set_rb->value_add(i));
+    ASSERT_EQ(OB_SUCCESS, set64_rb->value_add(3 * high + i));
+    roaring::api::roaring64_bitmap_add(expected, i);
+    roaring::api::roaring64_bitmap_add(expected, 3 * high + i);
+  }
+  add_bin(allocator, set_rb, false, ObRbBinType::SET_32, bins);
+  add_bin(allocator, set64_rb, false, ObRbBinType::SET_64, bins);
+  // BITMAP_32 with an array and a bitset container
+  ObRoaringBitmap *bitmap_rb = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  for (uint64_t i = 0; i < 5000; i++) {
+    ASSERT_EQ(OB_SUCCESS, bitmap_rb->value_add(i * 2));
+    roaring::api::roaring64_bitmap_add(expected, i * 2);
+  }
+  for (uint64_t i = 0; i < 100; i++) {
+    ASSERT_EQ(OB_SUCCESS, bitmap_rb->value_add((5 << 16) + i));
+    roaring::api::roaring64_bitmap_add(expected, (5 << 16) + i);
+  }
+  add_bin(allocator, bitmap_rb, true, ObRbBinType::BITMAP_32, bins);
+  // BITMAP_64 over several high 32 bits, sharing a bucket with SET_64 and BITMAP_32
+  ObRoaringBitmap *bitmap64_rb = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  for (uint64_t i = 0; i < 100; i++) {
+    const uint64_t value = (i % 4) * high + i * 7;
+    ASSERT_EQ(OB_SUCCESS, bitmap64_rb->value_add(value));
+    roaring::api::roaring64_bitmap_add(expected, value);
+  }
+  add_bin(allocator, bitmap64_rb, false, ObRbBinType::BITMAP_64, bins);
+  // the same inputs twice, and in reverse order
+  check_lazy_union(allocator, bins, expected, ObRbBinType::BITMAP_64);
+  const int64_t bin_cnt = bins.count();
+  for (int64_t i = bin_cnt - 1; i >= 0; i--) {
+    ASSERT_EQ(OB_SUCCESS, bins.push_back(bins.at(i)));
+  }
+  check_lazy_union(allocator, bins, expected, ObRbBinType::BITMAP_64);
+
+  // value_add and value_or mixed
+  ObRoaringBitmapLazyUnion lazy_union(&allocator);
+  ASSERT_EQ(OB_SUCCESS, lazy_union.value_add(2 * high));
+  ASSERT_EQ(OB_SUCCESS, lazy_union.value_or(bins.at(bin_cnt - 1)));
+  roaring::api::roaring64_bitmap_t *added = roaring::api::roaring64_bitmap_copy(bitmap64_rb->bitmap_);
+  roaring::api::roaring64_bitmap_add(added, 2 * high);
+  ObStringBuffer res_buf(&allocator);
+  ASSERT_EQ(OB_SUCCESS, lazy_union.serialize(res_buf));
+  ObString res_bin;
+  ObRoaringBitmap *res = nullptr;
+  res_bin.assign_ptr(res_buf.ptr(), res_buf.length());
+  ASSERT_EQ(OB_SUCCESS, ObRbUtils::rb_deserialize(allocator, res_bin, res, true));
+  ASSERT_EQ(roaring::api::roaring64_bitmap_get_cardinality(added), res->get_cardinality());
+  ASSERT_TRUE(res->is_contains(2 * high));
+  roaring::api::roaring64_bitmap_free(added);
+  roaring::api::roaring64_bitmap_free(expected);
+}
+
+TEST_F(TestRoaringBitmap, lazy_union_set_bitmap_switch)
+{
+  ObArenaAllocator allocator(ObModIds::TEST);
+  const uint64_t high = 1UL << 32;
+  // two BITMAP_32 inputs of 20 values that overlap in 8 values
+  ObRoaringBitmap *rb1 = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  ObRoaringBitmap *rb2 = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  roaring::api::roaring64_bitmap_t *expected = roaring::api::roaring64_bitmap_create();
+  for (uint64_t i = 0; i < 20; i++) {
+    ASSERT_EQ(OB_SUCCESS, rb1->value_add(100 + i));
+    ASSERT_EQ(OB_SUCCESS, rb2->value_add(112 + i));
+    roaring::api::roaring64_bitmap_add(expected, 100 + i);
+    roaring::api::roaring64_bitmap_add(expected, 112 + i);
+  }
+  ObSEArray<ObString, 4> bins;
+  add_bin(allocator, rb1, true, ObRbBinType::BITMAP_32, bins);
+  add_bin(allocator, rb2, true, ObRbBinType::BITMAP_32, bins);
+  // 32 values are written as a set
+  ASSERT_EQ(MAX_BITMAP_SET_VALUES, roaring::api::roaring64_bitmap_get_cardinality(expected));
+  check_lazy_union(allocator, bins, expected, ObRbBinType::SET_32);
+
+  // the 33rd value switches to bitmap
+  ObRoaringBitmap *rb3 = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  ASSERT_EQ(OB_SUCCESS, rb3->value_add(1000));
+  roaring::api::roaring64_bitmap_add(expected, 1000);
+  add_bin(allocator, rb3, false, ObRbBinType::SINGLE_32, bins);
+  check_lazy_union(allocator, bins, expected, ObRbBinType::BITMAP_64);
+
+  // 32 values with a 64-bit value are a 64-bit set
+  ObSEArray<ObString, 4> bins64;
+  roaring::api::roaring64_bitmap_t *expected64 = roaring::api::roaring64_bitmap_create();
+  ObRoaringBitmap *rb4 = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  for (uint64_t i = 0; i < MAX_BITMAP_SET_VALUES - 1; i++) {
+    ASSERT_EQ(OB_SUCCESS, rb4->value_add(i));
+    roaring::api::roaring64_bitmap_add(expected64, i);
+  }
+  add_bin(allocator, rb4, false, ObRbBinType::SET_32, bins64);
+  ObRoaringBitmap *rb5 = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  ASSERT_EQ(OB_SUCCESS, rb5->value_add(high + 1));
+  roaring::api::roaring64_bitmap_add(expected64, high + 1);
+  add_bin(allocator, rb5, false, ObRbBinType::SINGLE_64, bins64);
+  check_lazy_union(allocator, bins64, expected64, ObRbBinType::SET_64);
+
+  // a single value and nothing
+  ObSEArray<ObString, 4> small_bins;
+  roaring::api::roaring64_bitmap_t *expected_small = roaring::api::roaring64_bitmap_create();
+  ObRoaringBitmap *empty_rb = OB_NEWx(ObRoaringBitmap, &allocator, (&allocator));
+  add_bin(allocator, empty_rb, true, ObRbBinType::BITMAP_32, small_bins);
+  check_lazy_union(allocator, small_bins, expected_small, ObRbBinType::EMPTY);
+  add_bin(allocator, rb5, false, ObRbBinType::SINGLE_64, small_bins);
+  roaring::api::roaring64_bitmap_add(expected_small, high + 1);
+  check_lazy_union(allocator, small_bins, expected_small, ObRbBinType::SINGLE_64);
+
+  roaring::api::roaring64_bitmap_free(expected);
+  roaring::api::roaring64_bitmap_free(expected64);
+  roaring::api::roaring64_bitmap_free(expected_small);
+}
+
 } // namespace common
 } // namespace oceanbase
 
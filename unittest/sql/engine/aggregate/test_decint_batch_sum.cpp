@@ -0,0 +1,323 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "share/aggregate/sum.h"
+#include "sql/engine/ob_exec_context.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+using namespace share::aggregate;
+
+static const int64_t BATCH_SIZE = 256;
+// agg row: | sum result (16 bytes) | not null bitmap |
+static const int32_t NULLBITS_OFFSET = 16;
+
+class TestDecIntBatchSum : public ::testing::Test
+{
+public:
+  TestDecIntBatchSum()
+    : allocator_("TestDecIntSum"),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      aggr_infos_(allocator_),
+      agg_ctx_(eval_ctx_, OB_SYS_TENANT_ID, aggr_infos_, "TestDecIntSum"),
+      skip_(nullptr)
+  {}
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, aggr_infos_.init(1));
+    ASSERT_EQ(OB_SUCCESS, aggr_infos_.prepare_allocate(1));
+    ObAggrInfo &aggr_info = aggr_infos_.at(0);
+    aggr_info.param_exprs_.set_allocator(&allocator_);
+    ASSERT_EQ(OB_SUCCESS, aggr_info.param_exprs_.init(1));
+    ASSERT_EQ(OB_SUCCESS, aggr_info.param_exprs_.push_back(&expr_));
+
+    col_offsets_[0] = 0;
+    col_offsets_[1] = NULLBITS_OFFSET;
+    tmp_res_sizes_[0] = 0;
+    AggrRowMeta &row_meta = agg_ctx_.agg_row_meta_;
+    row_meta.row_size_ = sizeof(row_);
+    row_meta.col_cnt_ = 1;
+    row_meta.nullbits_offset_ = NULLBITS_OFFSET;
+    row_meta.col_offsets_ = col_offsets_;
+    row_meta.tmp_res_sizes_ = tmp_res_sizes_;
+    MEMSET(row_, 0, sizeof(row_));
+
+    void *skip_buf = allocator_.alloc(ObBitVector::memory_size(BATCH_SIZE));
+    ASSERT_TRUE(NULL != skip_buf);
+    skip_ = to_bit_vector(skip_buf);
+    skip_->reset(BATCH_SIZE);
+  }
+  virtual void TearDown()
+  {
+    allocator_.reset();
+  }
+
+  // same frame layout as ObStaticEngineExprCG::arrange_datums_data, data of the VEC_FIXED
+  // vector is the contiguous res buf
+  void init_param_expr(const VecValueTypeClass vec_tc, const ObPrecision precision,
+                       const int32_t elem_size)
+  {
+    int64_t total_size = 0;
+    expr_.reset();
+    expr_.batch_result_ = 1;
+    expr_.frame_idx_ = 0;
+    expr_.vec_value_tc_ = vec_tc;
+    expr_.is_fixed_length_data_ = true;
+    expr_.res_buf_len_ = elem_size;
+    expr_.datum_meta_.type_ = ObDecimalIntType;
+    expr_.datum_meta_.precision_ = precision;
+    expr_.datum_meta_.scale_ = 0;
+
+    expr_.datum_off_ = total_size;
+    total_size += sizeof(ObDatum) * BATCH_SIZE;
+    expr_.pvt_skip_off_ = total_size;
+    total_size += ObBitVector::memory_size(BATCH_SIZE);
+    expr_.vector_header_off_ = total_size;
+    total_size += sizeof(VectorHeader);
+    expr_.null_bitmap_off_ = total_size;
+    total_size += ObBitVector::memory_size(BATCH_SIZE);
+    expr_.eval_info_off_ = total_size;
+    total_size += sizeof(ObEvalInfo);
+    expr_.eval_flags_off_ = total_size;
+    total_size += ObBitVector::memory_size(BATCH_SIZE);
+    expr_.dyn_buf_header_offset_ = total_size;
+    expr_.res_buf_off_ = total_size;
+    total_size += elem_size * BATCH_SIZE;
+
+    char **frame_arr = static_cast<char **>(allocator_.alloc(sizeof(char *)));
+    char *frame = static_cast<char *>(allocator_.alloc(total_size));
+    ASSERT_TRUE(NULL != frame_arr);
+    ASSERT_TRUE(NULL != frame);
+    MEMSET(frame, 0, total_size);
+    eval_ctx_.frames_ = frame_arr;
+    eval_ctx_.frames_[0] = frame;
+    ASSERT_EQ(OB_SUCCESS, expr_.init_vector(eval_ctx_, VEC_FIXED, BATCH_SIZE));
+  }
+
+  template <typename T>
+  T *param_data()
+  {
+    return reinterpret_cast<T *>(expr_.get_res_buf(eval_ctx_));
+  }
+
+  void set_null(const int64_t idx)
+  {
+    static_cast<ObFixedLengthBase *>(expr_.get_vector(eval_ctx_))->set_null(idx);
+  }
+
+  template <VecValueTypeClass in_tc, VecValueTypeClass out_tc>
+  int add_batch(const EvalBound &bound)
+  {
+    SumAggregate<in_tc, out_tc> aggr;
+    return aggr.add_batch_rows(agg_ctx_, 0, *skip_, bound, row_);
+  }
+
+  bool not_null()
+  {
+    return agg_ctx_.locate_notnulls_bitmap(0, row_).at(0);
+  }
+
+  template <typename T>
+  T &result()
+  {
+    return *reinterpret_cast<T *>(row_);
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  ObExpr expr_;
+  AggrInfoFixedArray aggr_infos_;
+  RuntimeContext agg_ctx_;
+  int32_t col_offsets_[2];
+  int32_t tmp_res_sizes_[1];
+  char row_[32] __attribute__((aligned(16)));
+  ObBitVector *skip_;
+};
+
+// the int64 accumulator overflows in both directions and is spilled into the int128 result
+TEST_F(TestDecIntBatchSum, int64_spill_to_int128)
+{
+  init_param_expr(VEC_TC_DEC_INT64, 18, sizeof(int64_t));
+  int64_t *vals = param_data<int64_t>();
+  int128_t expected = 100;
+  result<int128_t>() = 100;
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    vals[i] = (i % 5 == 4) ? INT64_MIN : INT64_MAX - i;
+    expected = expected + vals[i];
+  }
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>(EvalBound(BATCH_SIZE, true))));
+  ASSERT_TRUE(expected == result<int128_t>());
+  ASSERT_TRUE(not_null());
+
+  // the result is accumulated over batches
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>(EvalBound(BATCH_SIZE, true))));
+  expected = expected + expected - 100;
+  ASSERT_TRUE(expected == result<int128_t>());
+
+  // only negative values
+  result<int128_t>() = 0;
+  expected = 0;
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    vals[i] = INT64_MIN + i;
+    expected = expected + vals[i];
+  }
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>(EvalBound(BATCH_SIZE, true))));
+  ASSERT_TRUE(expected == result<int128_t>());
+  ASSERT_TRUE(expected < 0);
+}
+
+// the int32 params are accumulated in int64, sums beyond the int32 range are exact
+TEST_F(TestDecIntBatchSum, int32_accumulator)
+{
+  init_param_expr(VEC_TC_DEC_INT32, 9, sizeof(int32_t));
+  int32_t *vals = param_data<int32_t>();
+  int64_t expected = 0;
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    vals[i] = (i % 3 == 2) ? INT32_MIN : INT32_MAX;
+    expected += vals[i];
+  }
+  ASSERT_GT(expected, INT32_MAX);
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT32, VEC_TC_DEC_INT64>(EvalBound(BATCH_SIZE, true))));
+  ASSERT_EQ(expected, result<int64_t>());
+  ASSERT_TRUE(not_null());
+
+  MEMSET(row_, 0, sizeof(row_));
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT32, VEC_TC_DEC_INT128>(EvalBound(BATCH_SIZE, true))));
+  ASSERT_TRUE(int128_t(expected) == result<int128_t>());
+  ASSERT_TRUE(not_null());
+}
+
+TEST_F(TestDecIntBatchSum, nulls_and_skip)
+{
+  init_param_expr(VEC_TC_DEC_INT64, 18, sizeof(int64_t));
+  int64_t *vals = param_data<int64_t>();
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    vals[i] = INT64_MAX - i;
+    if (i % 3 == 0) {
+      set_null(i);
+    } else if (i % 3 == 1) {
+      skip_->set(i);
+    }
+  }
+  int128_t expected = 0;
+  for (int64_t i = 10; i < 200; i++) {
+    if (i % 3 == 2) {
+      expected = expected + vals[i];
+    }
+  }
+  // null and skipped rows hold values too, they must not be added
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>(
+                          EvalBound(BATCH_SIZE, 10, 200, false))));
+  ASSERT_TRUE(expected == result<int128_t>());
+  ASSERT_TRUE(not_null());
+
+  // all rows in [3, 5) are null or skipped
+  MEMSET(row_, 0, sizeof(row_));
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>(
+                          EvalBound(BATCH_SIZE, 3, 5, false))));
+  ASSERT_TRUE(int128_t(0) == result<int128_t>());
+  ASSERT_FALSE(not_null());
+
+  // only nulls, the skip bitmap is ignored when all rows are active
+  MEMSET(row_, 0, sizeof(row_));
+  expected = 0;
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    if (i % 3 != 0) {
+      expected = expected + vals[i];
+    }
+  }
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>(EvalBound(BATCH_SIZE, true))));
+  ASSERT_TRUE(expected == result<int128_t>());
+  ASSERT_TRUE(not_null());
+}
+
+TEST_F(TestDecIntBatchSum, empty_batch)
+{
+  init_param_expr(VEC_TC_DEC_INT64, 18, sizeof(int64_t));
+  int64_t *vals = param_data<int64_t>();
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    vals[i] = i + 1;
+  }
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>(EvalBound(BATCH_SIZE, 7, 7, true))));
+  ASSERT_TRUE(int128_t(0) == result<int128_t>());
+  ASSERT_FALSE(not_null());
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>(EvalBound(BATCH_SIZE, 7, 7, false))));
+  ASSERT_FALSE(not_null());
+
+  ASSERT_EQ(OB_SUCCESS, (add_batch<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>(EvalBound(BATCH_SIZE, 7, 8, true))));
+  ASSERT_TRUE(int128_t(8) == result<int128_t>());
+  ASSERT_TRUE(not_null());
+}
+
+TEST_F(TestDecIntBatchSum, do_op)
+{
+  int64_t vals[4] = {1, INT64_MAX, INT64_MAX, -3};
+  int128_t res = 0;
+  bool has_value = false;
+  using Int64Sum = DecIntBatchSum<VEC_TC_DEC_INT64, VEC_TC_DEC_INT128>;
+  ASSERT_EQ(OB_SUCCESS, Int64Sum::do_op(reinterpret_cast<const char *>(vals), nullptr, nullptr, 0, 4,
+                                        reinterpret_cast<char *>(&res), has_value));
+  ASSERT_TRUE(has_value);
+  ASSERT_TRUE(int128_t(INT64_MAX) + INT64_MAX - 2 == res);
+
+  res = 0;
+  has_value = true;
+  ASSERT_EQ(OB_SUCCESS, Int64Sum::do_op(reinterpret_cast<const char *>(vals), nullptr, nullptr, 2, 2,
+                                        reinterpret_cast<char *>(&res), has_value));
+  ASSERT_FALSE(has_value);
+  ASSERT_TRUE(int128_t(0) == res);
+
+  uint64_t skip_buf = 0;
+  ObBitVector *skip = to_bit_vector(&skip_buf);
+  skip->reset(4);
+  skip->set(1);
+  skip->set(2);
+  has_value = false;
+  ASSERT_EQ(OB_SUCCESS, Int64Sum::do_op(reinterpret_cast<const char *>(vals), nullptr, skip, 0, 4,
+                                        reinterpret_cast<char *>(&res), has_value));
+  ASSERT_TRUE(has_value);
+  ASSERT_TRUE(int128_t(-2) == res);
+
+  res = 0;
+  has_value = false;
+  ASSERT_EQ(OB_SUCCESS, Int64Sum::do_op(reinterpret_cast<const char *>(vals), skip, skip, 1, 3,
+                                        reinterpret_cast<char *>(&res), has_value));
+  ASSERT_FALSE(has_value);
+  ASSERT_TRUE(int128_t(0) == res);
+
+  int64_t int_res = 0;
+  ASSERT_EQ(OB_NOT_SUPPORTED,
+            (DecIntBatchSum<VEC_TC_INTEGER, VEC_TC_INTEGER>::do_op(
+              reinterpret_cast<const char *>(vals), nullptr, nullptr, 0, 4,
+              reinterpret_cast<char *>(&int_res), has_value)));
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
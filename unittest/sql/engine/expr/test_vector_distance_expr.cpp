@@ -0,0 +1,322 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <math.h>
+#define private public
+#define protected public
+#include "sql/engine/expr/ob_expr_vector.h"
+#include "sql/engine/ob_exec_context.h"
+#include "sql/engine/ob_physical_plan_ctx.h"
+#undef private
+#undef protected
+#include "share/ob_lob_access_utils.h"
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static const int64_t BATCH_SIZE = 64;
+// not a multiple of the simd width, the kernels go through their tail loop
+static const int64_t DIM = 19;
+
+class TestVectorDistanceExpr : public ::testing::Test
+{
+public:
+  TestVectorDistanceExpr()
+    : allocator_("TestVecDist"),
+      exec_ctx_(allocator_),
+      eval_ctx_(exec_ctx_),
+      skip_(nullptr),
+      subschema_id_(0)
+  {}
+  virtual void SetUp()
+  {
+    // released by the exec ctx
+    ObPhysicalPlanCtx *plan_ctx = OB_NEWx(ObPhysicalPlanCtx, &allocator_, allocator_);
+    ASSERT_TRUE(NULL != plan_ctx);
+    exec_ctx_.set_physical_plan_ctx(plan_ctx);
+    char type_str[32];
+    snprintf(type_str, sizeof(type_str), "VECTOR(%ld)", DIM);
+    ASSERT_EQ(OB_SUCCESS, exec_ctx_.get_subschema_id_by_type_string(ObString::make_string(type_str),
+                                                                    subschema_id_));
+
+    void *skip_buf = allocator_.alloc(ObBitVector::memory_size(BATCH_SIZE));
+    ASSERT_TRUE(NULL != skip_buf);
+    skip_ = to_bit_vector(skip_buf);
+    skip_->reset(BATCH_SIZE);
+  }
+
+  // same frame layout as ObStaticEngineExprCG::arrange_datums_data, one frame per expr
+  void init_expr(ObExpr &expr, const int64_t frame_idx, const bool is_batch,
+                 const ObObjType type, const int32_t res_buf_len)
+  {
+    const int64_t size = is_batch ? BATCH_SIZE : 1;
+    int64_t total_size = 0;
+    expr.reset();
+    expr.batch_result_ = is_batch;
+    expr.frame_idx_ = frame_idx;
+    expr.datum_meta_.type_ = type;
+    expr.obj_meta_.set_type(type);
+    if (ObCollectionSQLType == type) {
+      expr.obj_meta_.set_collection(subschema_id_);
+      expr.vec_value_tc_ = VEC_TC_COLLECTION;
+    } else {
+      expr.vec_value_tc_ = VEC_TC_DOUBLE;
+      expr.is_fixed_length_data_ = true;
+    }
+    expr.res_buf_len_ = res_buf_len;
+
+    expr.datum_off_ = total_size;
+    total_size += sizeof(ObDatum) * size;
+    expr.pvt_skip_off_ = total_size;
+    total_size += ObBitVector::memory_size(size);
+    expr.vector_header_off_ = total_size;
+    total_size += sizeof(VectorHeader);
+    expr.null_bitmap_off_ = total_size;
+    total_size += ObBitVector::memory_size(size);
+    expr.eval_info_off_ = total_size;
+    total_size += sizeof(ObEvalInfo);
+    expr.eval_flags_off_ = total_size;
+    total_size += ObBitVector::memory_size(size);
+    expr.dyn_buf_header_offset_ = total_size;
+    total_size += sizeof(ObDynReserveBuf) * size;
+    expr.res_buf_off_ = total_size;
+    total_size += res_buf_len * size;
+
+    char *frame = static_cast<char *>(allocator_.alloc(total_size));
+    ASSERT_TRUE(NULL != frame);
+    MEMSET(frame, 0, total_size);
+    frames_[frame_idx] = frame;
+  }
+
+  // arg0 and arg1 are vector columns or constants, the distance expr is evaluated by eval_vector
+  // the way the static engine cg sets it up
+  void init_exprs(const bool is_const0, const bool is_const1,
+                  ObExpr::EvalFunc eval_func, ObExpr::EvalVectorFunc eval_vector_func)
+  {
+    eval_ctx_.frames_ = frames_;
+    init_expr(args_[0], 0, !is_const0, ObCollectionSQLType, 0);
+    init_expr(args_[1], 1, !is_const1, ObCollectionSQLType, 0);
+    init_expr(expr_, 2, true, ObDoubleType, sizeof(double));
+    arg_ptrs_[0] = &args_[0];
+    arg_ptrs_[1] = &args_[1];
+    expr_.args_ = arg_ptrs_;
+    expr_.arg_cnt_ = 2;
+    expr_.eval_func_ = eval_func;
+    expr_.eval_batch_func_ = expr_default_eval_batch_func;
+    expr_.eval_vector_func_ = eval_vector_func;
+    ASSERT_EQ(OB_SUCCESS, args_[0].init_vector(eval_ctx_, is_const0 ? VEC_UNIFORM_CONST : VEC_UNIFORM,
+                                               is_const0 ? 1 : BATCH_SIZE));
+    ASSERT_EQ(OB_SUCCESS, args_[1].init_vector(eval_ctx_, is_const1 ? VEC_UNIFORM_CONST : VEC_UNIFORM,
+                                               is_const1 ? 1 : BATCH_SIZE));
+  }
+
+  // integer values keep the double sums exact whatever order the kernel adds them in
+  float *gen_vector(const int64_t seed, const int64_t dim = DIM)
+  {
+    float *vec = static_cast<float *>(allocator_.alloc(sizeof(float) * dim));
+    EXPECT_TRUE(NULL != vec);
+    for (int64_t i = 0; NULL != vec && i < dim; i++) {
+      vec[i] = static_cast<float>((seed * 7 + i * 3) % 9 - 4);
+    }
+    return vec;
+  }
+
+  // vector datums are in-row temp lobs
+  void set_vector(ObExpr &expr, const int64_t idx, const float *vec, const int64_t dim = DIM)
+  {
+    ObString data;
+    ObTextStringResult str_res(ObLongTextType, true, &allocator_);
+    ASSERT_EQ(OB_SUCCESS, str_res.init(sizeof(float) * dim));
+    ASSERT_EQ(OB_SUCCESS, str_res.append(reinterpret_cast<const char *>(vec), sizeof(float) * dim));
+    str_res.get_result_buffer(data);
+    expr.locate_batch_datums(eval_ctx_)[idx].set_string(data);
+  }
+
+  void set_null(ObExpr &expr, const int64_t idx)
+  {
+    expr.locate_batch_datums(eval_ctx_)[idx].set_null();
+  }
+
+  int eval(const EvalBound &bound)
+  {
+    return expr_.eval_vector(eval_ctx_, *skip_, bound);
+  }
+
+  bool is_evaluated(const int64_t idx) { return expr_.get_evaluated_flags(eval_ctx_).at(idx); }
+  bool res_is_null(const int64_t idx) { return expr_.get_vector(eval_ctx_)->is_null(idx); }
+  double res(const int64_t idx) { return expr_.get_vector(eval_ctx_)->get_double(idx); }
+
+  static double l2(const float *a, const float *b)
+  {
+    double sum = 0;
+    for (int64_t i = 0; i < DIM; i++) {
+      sum += (static_cast<double>(a[i]) - b[i]) * (static_cast<double>(a[i]) - b[i]);
+    }
+    return sqrt(sum);
+  }
+  static double l1(const float *a, const float *b)
+  {
+    double sum = 0;
+    for (int64_t i = 0; i < DIM; i++) {
+      sum += fabs(static_cast<double>(a[i]) - b[i]);
+    }
+    return sum;
+  }
+  static double dot(const float *a, const float *b)
+  {
+    double sum = 0;
+    for (int64_t i = 0; i < DIM; i++) {
+      sum += static_cast<double>(a[i]) * b[i];
+    }
+    return sum;
+  }
+  static double cosine(const float *a, const float *b)
+  {
+    return 1.0 - dot(a, b) / (sqrt(dot(a, a)) * sqrt(dot(b, b)));
+  }
+
+protected:
+  ObArenaAllocator allocator_;
+  ObExecContext exec_ctx_;
+  ObEvalCtx eval_ctx_;
+  char *frames_[3];
+  ObExpr args_[2];
+  ObExpr *arg_ptrs_[2];
+  ObExpr expr_;
+  ObBitVector *skip_;
+  uint16_t subschema_id_;
+};
+
+// brute force knn: every row against the same constant query vector
+TEST_F(TestVectorDistanceExpr, const_query_vector)
+{
+  init_exprs(false, true, ObExprVectorL2Distance::calc_l2_distance,
+             ObExprVectorL2Distance::calc_l2_distance_vector);
+  const float *query = gen_vector(1000);
+  const float *rows[BATCH_SIZE];
+  set_vector(args_[1], 0, query);
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    rows[i] = gen_vector(i);
+    if (i % 10 == 3) {
+      set_null(args_[0], i);
+    } else {
+      set_vector(args_[0], i, rows[i]);
+    }
+    if (i % 10 == 7) {
+      skip_->set(i);
+    }
+  }
+  ASSERT_EQ(OB_SUCCESS, eval(EvalBound(BATCH_SIZE, false)));
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    if (i % 10 == 7) {
+      ASSERT_FALSE(is_evaluated(i));
+    } else if (i % 10 == 3) {
+      ASSERT_TRUE(is_evaluated(i));
+      ASSERT_TRUE(res_is_null(i));
+    } else {
+      ASSERT_TRUE(is_evaluated(i));
+      ASSERT_FALSE(res_is_null(i));
+      ASSERT_NEAR(l2(rows[i], query), res(i), 1e-9);
+    }
+  }
+}
+
+// the array objects of non constant arguments are re-initialized row by row
+TEST_F(TestVectorDistanceExpr, column_vectors)
+{
+  struct {
+    ObExpr::EvalFunc eval_func_;
+    ObExpr::EvalVectorFunc eval_vector_func_;
+    double (*expect_)(const float *, const float *);
+  } cases[] = {
+    {ObExprVectorL2Distance::calc_l2_distance, ObExprVectorL2Distance::calc_l2_distance_vector, l2},
+    {ObExprVectorL1Distance::calc_l1_distance, ObExprVectorL1Distance::calc_l1_distance_vector, l1},
+    {ObExprVectorIPDistance::calc_inner_product, ObExprVectorIPDistance::calc_inner_product_vector, dot},
+    {ObExprVectorCosineDistance::calc_cosine_distance,
+     ObExprVectorCosineDistance::calc_cosine_distance_vector, cosine},
+  };
+  for (int64_t c = 0; c < ARRAYSIZEOF(cases); c++) {
+    init_exprs(false, false, cases[c].eval_func_, cases[c].eval_vector_func_);
+    const float *lefts[BATCH_SIZE];
+    const float *rights[BATCH_SIZE];
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      lefts[i] = gen_vector(i);
+      rights[i] = gen_vector(i * 5 + 1);
+      set_vector(args_[0], i, lefts[i]);
+      set_vector(args_[1], i, rights[i]);
+    }
+    // evaluate a sub range, rows out of it are untouched
+    ASSERT_EQ(OB_SUCCESS, eval(EvalBound(BATCH_SIZE, 5, BATCH_SIZE - 5, true)));
+    for (int64_t i = 0; i < BATCH_SIZE; i++) {
+      if (i < 5 || i >= BATCH_SIZE - 5) {
+        ASSERT_FALSE(is_evaluated(i));
+      } else {
+        ASSERT_TRUE(is_evaluated(i));
+        ASSERT_FALSE(res_is_null(i));
+        ASSERT_NEAR(cases[c].expect_(lefts[i], rights[i]), res(i), 1e-9);
+      }
+    }
+  }
+}
+
+TEST_F(TestVectorDistanceExpr, null_and_invalid)
+{
+  // cosine distance of a zero vector is null
+  init_exprs(true, false, ObExprVectorCosineDistance::calc_cosine_distance,
+             ObExprVectorCosineDistance::calc_cosine_distance_vector);
+  float zero[DIM];
+  MEMSET(zero, 0, sizeof(zero));
+  const float *query = gen_vector(1000);
+  const float *row = gen_vector(1);
+  set_vector(args_[0], 0, query);
+  set_vector(args_[1], 0, zero);
+  set_vector(args_[1], 1, row);
+  ASSERT_EQ(OB_SUCCESS, eval(EvalBound(2, true)));
+  ASSERT_TRUE(res_is_null(0));
+  ASSERT_FALSE(res_is_null(1));
+  ASSERT_NEAR(cosine(query, row), res(1), 1e-9);
+
+  // a null constant makes every row null
+  init_exprs(true, false, ObExprVectorL2Distance::calc_l2_distance,
+             ObExprVectorL2Distance::calc_l2_distance_vector);
+  set_null(args_[0], 0);
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    set_vector(args_[1], i, gen_vector(i));
+  }
+  ASSERT_EQ(OB_SUCCESS, eval(EvalBound(BATCH_SIZE, true)));
+  for (int64_t i = 0; i < BATCH_SIZE; i++) {
+    ASSERT_TRUE(res_is_null(i));
+  }
+
+  // dimensions of the two arguments differ
+  init_exprs(false, true, ObExprVectorL2Distance::calc_l2_distance,
+             ObExprVectorL2Distance::calc_l2_distance_vector);
+  set_vector(args_[1], 0, query);
+  set_vector(args_[0], 0, gen_vector(0));
+  set_vector(args_[0], 1, gen_vector(1, DIM - 1), DIM - 1);
+  ASSERT_EQ(OB_ERR_INVALID_VECTOR_DIM, eval(EvalBound(2, true)));
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_file_name("test_vector_distance_expr.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,152 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "sql/engine/ob_tenant_sql_memory_manager.h"
+#undef private
+#undef protected
+
+namespace oceanbase
+{
+namespace sql
+{
+using namespace common;
+
+static const int64_t MB_SIZE = 1L << 20;
+
+class TestSqlMemoryManager : public ::testing::Test
+{
+public:
+  TestSqlMemoryManager()
+    : mgr_(OB_SYS_TENANT_ID + 1000),
+      hash_join_(ObSqlWorkAreaType::HASH_WORK_AREA),
+      sort_(ObSqlWorkAreaType::SORT_WORK_AREA)
+  {}
+  virtual void SetUp()
+  {
+    // same layout as mtl_init
+    char *buf = static_cast<char*>(ob_malloc(sizeof(ObSqlMemoryList) * ObTenantSqlMemoryManager::HASH_CNT,
+                                             ObMemAttr(OB_SYS_TENANT_ID, "TestSqlMemMgr")));
+    ASSERT_TRUE(NULL != buf);
+    mgr_.profile_lists_ = reinterpret_cast<ObSqlMemoryList*>(buf);
+    for (int64_t i = 0; i < ObTenantSqlMemoryManager::HASH_CNT; ++i) {
+      ObSqlMemoryList *list = new (buf) ObSqlMemoryList(i);
+      list->get_profile_list().reset();
+      buf += sizeof(ObSqlMemoryList);
+    }
+    // hash join: cache 20M, one-pass about 6.3M
+    hash_join_.init(20 * MB_SIZE, 2 * MB_SIZE);
+    hash_join_.set_expect_size(0);
+    // sort: cache 8M, one-pass 4M + 1, only 1M is used now
+    sort_.init(8 * MB_SIZE, 2 * MB_SIZE);
+    sort_.set_expect_size(0);
+    sort_.mem_used_ = 1 * MB_SIZE;
+    ASSERT_EQ(OB_SUCCESS, mgr_.profile_lists_[mgr_.get_hash_value(hash_join_.get_id())]
+                            .register_work_area_profile(hash_join_));
+    ASSERT_EQ(OB_SUCCESS, mgr_.profile_lists_[mgr_.get_hash_value(sort_.get_id())]
+                            .register_work_area_profile(sort_));
+  }
+  virtual void TearDown()
+  {
+    for (int64_t i = 0; i < ObTenantSqlMemoryManager::HASH_CNT; ++i) {
+      mgr_.profile_lists_[i].~ObSqlMemoryList();
+    }
+    ob_free(mgr_.profile_lists_);
+    mgr_.profile_lists_ = nullptr;
+  }
+protected:
+  ObTenantSqlMemoryManager mgr_;
+  ObSqlWorkAreaProfile hash_join_;
+  ObSqlWorkAreaProfile sort_;
+};
+
+// the total expect size is 18M under global bound 10M, and the hash join lacks 10M
+TEST_F(TestSqlMemoryManager, disabled)
+{
+  ASSERT_EQ(OB_SUCCESS, mgr_.try_push_profiles_work_area_size(10 * MB_SIZE, 100 * MB_SIZE, false));
+  ASSERT_EQ(10 * MB_SIZE, hash_join_.get_expect_size());
+  ASSERT_EQ(8 * MB_SIZE, sort_.get_expect_size());
+  ASSERT_EQ(0, hash_join_.get_grant_cnt());
+  ASSERT_EQ(0, sort_.get_grant_cnt());
+  ASSERT_EQ(0, mgr_.get_redistribute_count());
+}
+
+TEST_F(TestSqlMemoryManager, grant_spare_memory)
+{
+  ASSERT_EQ(OB_SUCCESS, mgr_.try_push_profiles_work_area_size(10 * MB_SIZE, 100 * MB_SIZE, true));
+  // enough spare memory, the sort keeps in memory
+  ASSERT_EQ(20 * MB_SIZE, hash_join_.get_expect_size());
+  ASSERT_EQ(20 * MB_SIZE, hash_join_.get_max_bound());
+  ASSERT_EQ(8 * MB_SIZE, sort_.get_expect_size());
+  ASSERT_EQ(1, mgr_.get_redistribute_count());
+  ASSERT_EQ(10 * MB_SIZE, mgr_.get_redistribute_grant_size());
+  ASSERT_EQ(0, mgr_.get_redistribute_reclaim_size());
+}
+
+TEST_F(TestSqlMemoryManager, reclaim_from_sort)
+{
+  // 7M spare memory, the other 3M has to be reclaimed from the sort
+  ASSERT_EQ(OB_SUCCESS, mgr_.try_push_profiles_work_area_size(10 * MB_SIZE, 25 * MB_SIZE, true));
+  ASSERT_EQ(sort_.get_one_pass_size(), sort_.get_expect_size());
+  ASSERT_EQ(20 * MB_SIZE, hash_join_.get_expect_size());
+  ASSERT_EQ(1, mgr_.get_redistribute_count());
+  ASSERT_EQ(sort_.get_cache_size() - sort_.get_one_pass_size(), mgr_.get_redistribute_reclaim_size());
+  ASSERT_EQ(10 * MB_SIZE, mgr_.get_redistribute_grant_size());
+
+  // the grant is dropped once the global bound changes
+  ASSERT_EQ(OB_SUCCESS, mgr_.calc_work_area_size_by_profile(12 * MB_SIZE, hash_join_));
+  ASSERT_EQ(12 * MB_SIZE, hash_join_.get_expect_size());
+  ASSERT_EQ(OB_SUCCESS, mgr_.calc_work_area_size_by_profile(12 * MB_SIZE, sort_));
+  ASSERT_EQ(8 * MB_SIZE, sort_.get_expect_size());
+}
+
+TEST_F(TestSqlMemoryManager, not_enough_memory)
+{
+  // the sort has used more than its one-pass size, it can't be shrunk
+  sort_.mem_used_ = 5 * MB_SIZE;
+  ASSERT_EQ(OB_SUCCESS, mgr_.try_push_profiles_work_area_size(10 * MB_SIZE, 18 * MB_SIZE, true));
+  ASSERT_EQ(10 * MB_SIZE, hash_join_.get_expect_size());
+  ASSERT_EQ(8 * MB_SIZE, sort_.get_expect_size());
+  ASSERT_EQ(0, mgr_.get_redistribute_grant_size());
+  ASSERT_EQ(0, mgr_.get_redistribute_reclaim_size());
+
+  // the hash join is only granted its whole cache size, and 2M spare plus 4M
+  // from the sort is not enough, so the sort is not shrunk for nothing
+  sort_.mem_used_ = 1 * MB_SIZE;
+  ASSERT_EQ(OB_SUCCESS, mgr_.try_push_profiles_work_area_size(10 * MB_SIZE, 20 * MB_SIZE, true));
+  ASSERT_EQ(8 * MB_SIZE, sort_.get_expect_size());
+  ASSERT_EQ(10 * MB_SIZE, hash_join_.get_expect_size());
+  ASSERT_EQ(0, mgr_.get_redistribute_grant_size());
+  ASSERT_EQ(0, mgr_.get_redistribute_reclaim_size());
+}
+
+// grants are recalculated on every push
+TEST_F(TestSqlMemoryManager, repush)
+{
+  ASSERT_EQ(OB_SUCCESS, mgr_.try_push_profiles_work_area_size(10 * MB_SIZE, 25 * MB_SIZE, true));
+  ASSERT_EQ(20 * MB_SIZE, hash_join_.get_expect_size());
+  ASSERT_EQ(OB_SUCCESS, mgr_.try_push_profiles_work_area_size(10 * MB_SIZE, 25 * MB_SIZE, false));
+  ASSERT_EQ(10 * MB_SIZE, hash_join_.get_expect_size());
+  ASSERT_EQ(8 * MB_SIZE, sort_.get_expect_size());
+}
+
+} // end namespace sql
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  OB_LOGGER.set_log_level("INFO");
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
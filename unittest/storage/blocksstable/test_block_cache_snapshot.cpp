@@ -0,0 +1,291 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#define protected public
+#define private public
+#include "storage/blocksstable/ob_block_cache_snapshot.h"
+#include "lib/checksum/ob_crc64.h"
+#include "lib/file/file_directory_utils.h"
+#include "lib/utility/serialization.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace blocksstable;
+
+namespace unittest
+{
+static const char *DATA_DIR = "./test_block_cache_snapshot_dir";
+static const int64_t HEADER_SIZE = 5 * sizeof(int64_t);
+
+// the hot key written by the first version of the snapshot, keep it unchanged
+struct HotKeyV1
+{
+  OB_UNIS_VERSION(1);
+public:
+  uint64_t tenant_id_;
+  MacroBlockId macro_id_;
+  int64_t offset_;
+  int64_t size_;
+  int64_t heat_;
+  bool is_index_;
+};
+OB_SERIALIZE_MEMBER(HotKeyV1, tenant_id_, macro_id_, offset_, size_, heat_, is_index_);
+
+// a hot key with a field appended by a later release
+struct HotKeyAppended
+{
+  OB_UNIS_VERSION(1);
+public:
+  HotKeyV1 key_;
+  int64_t extra_;
+};
+OB_SERIALIZE_MEMBER(HotKeyAppended, key_.tenant_id_, key_.macro_id_, key_.offset_, key_.size_,
+                    key_.heat_, key_.is_index_, extra_);
+
+class TestBlockCacheSnapshot : public ::testing::Test
+{
+public:
+  TestBlockCacheSnapshot() : snapshot_() {}
+  virtual void SetUp()
+  {
+    ASSERT_EQ(OB_SUCCESS, FileDirectoryUtils::create_full_path(DATA_DIR));
+    ASSERT_EQ(OB_SUCCESS, snapshot_.init(DATA_DIR));
+    ::unlink(snapshot_.file_path_);
+  }
+  virtual void TearDown()
+  {
+    ::unlink(snapshot_.file_path_);
+  }
+  static ObMicroBlockCacheHotKey make_key(const uint64_t tenant_id, const int64_t block_index,
+                                          const int64_t offset, const int64_t heat, const bool is_index)
+  {
+    ObMicroBlockCacheHotKey hot_key;
+    hot_key.tenant_id_ = tenant_id;
+    hot_key.micro_id_ = ObMicroBlockId(MacroBlockId(0, block_index, 0), offset, 4096);
+    hot_key.heat_ = heat;
+    hot_key.is_index_ = is_index;
+    return hot_key;
+  }
+  template <typename T>
+  int write_raw(const int64_t magic, const int64_t version, const T *keys, const int64_t key_cnt);
+  int write_buf(const char *buf, const int64_t size);
+protected:
+  ObBlockCacheSnapshot snapshot_;
+  char buf_[4096];
+};
+
+// build the snapshot file by hand instead of through write_file, so that a change of the
+// writer can't hide a change of the format
+template <typename T>
+int TestBlockCacheSnapshot::write_raw(const int64_t magic, const int64_t version,
+                                      const T *keys, const int64_t key_cnt)
+{
+  int ret = OB_SUCCESS;
+  int64_t pos = HEADER_SIZE;
+  int64_t header_pos = 0;
+  for (int64_t i = 0; OB_SUCC(ret) && i < key_cnt; ++i) {
+    ret = keys[i].serialize(buf_, sizeof(buf_), pos);
+  }
+  const int64_t body_size = pos - HEADER_SIZE;
+  const int64_t checksum = static_cast<int64_t>(ob_crc64(buf_ + HEADER_SIZE, body_size));
+  if (OB_FAIL(ret)) {
+  } else if (OB_FAIL(serialization::encode_i64(buf_, sizeof(buf_), header_pos, magic))
+             || OB_FAIL(serialization::encode_i64(buf_, sizeof(buf_), header_pos, version))
+             || OB_FAIL(serialization::encode_i64(buf_, sizeof(buf_), header_pos, key_cnt))
+             || OB_FAIL(serialization::encode_i64(buf_, sizeof(buf_), header_pos, body_size))
+             || OB_FAIL(serialization::encode_i64(buf_, sizeof(buf_), header_pos, checksum))) {
+  } else {
+    ret = write_buf(buf_, pos);
+  }
+  return ret;
+}
+
+int TestBlockCacheSnapshot::write_buf(const char *buf, const int64_t size)
+{
+  int ret = OB_SUCCESS;
+  FILE *fp = fopen(snapshot_.file_path_, "w");
+  if (OB_ISNULL(fp)) {
+    ret = OB_IO_ERROR;
+  } else {
+    if (size != static_cast<int64_t>(fwrite(buf, 1, size, fp))) {
+      ret = OB_IO_ERROR;
+    }
+    fclose(fp);
+  }
+  return ret;
+}
+
+TEST_F(TestBlockCacheSnapshot, no_snapshot)
+{
+  ASSERT_EQ(OB_SUCCESS, snapshot_.load_file());
+  ASSERT_EQ(0, snapshot_.warm_up_keys_.count());
+  ASSERT_TRUE(snapshot_.is_warm_up_finished());
+}
+
+TEST_F(TestBlockCacheSnapshot, round_trip)
+{
+  ObArray<ObMicroBlockCacheHotKey> hot_keys;
+  ASSERT_EQ(OB_SUCCESS, hot_keys.push_back(make_key(1001, 20, 8192, 5, false)));
+  ASSERT_EQ(OB_SUCCESS, hot_keys.push_back(make_key(1002, 10, 4096, 7, false)));
+  ASSERT_EQ(OB_SUCCESS, hot_keys.push_back(make_key(1001, 20, 4096, 9, true)));
+  ASSERT_EQ(OB_SUCCESS, hot_keys.push_back(make_key(1, 10, 16384, 3, false)));
+  // invalid keys are dropped on load
+  ASSERT_EQ(OB_SUCCESS, hot_keys.push_back(make_key(OB_INVALID_TENANT_ID, 30, 4096, 1, false)));
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(hot_keys));
+  ASSERT_EQ(OB_SUCCESS, snapshot_.load_file());
+  ASSERT_EQ(4, snapshot_.warm_up_keys_.count());
+  ASSERT_FALSE(snapshot_.is_warm_up_finished());
+
+  // index blocks first, then ordered by macro block and offset
+  const ObMicroBlockCacheHotKey &k0 = snapshot_.warm_up_keys_.at(0);
+  ASSERT_EQ(hot_keys.at(2).tenant_id_, k0.tenant_id_);
+  ASSERT_TRUE(hot_keys.at(2).micro_id_ == k0.micro_id_);
+  ASSERT_EQ(9, k0.heat_);
+  ASSERT_TRUE(k0.is_index_);
+  ASSERT_TRUE(hot_keys.at(1).micro_id_ == snapshot_.warm_up_keys_.at(1).micro_id_);
+  ASSERT_EQ(1002UL, snapshot_.warm_up_keys_.at(1).tenant_id_);
+  ASSERT_TRUE(hot_keys.at(3).micro_id_ == snapshot_.warm_up_keys_.at(2).micro_id_);
+  ASSERT_EQ(1UL, snapshot_.warm_up_keys_.at(2).tenant_id_);
+  ASSERT_TRUE(hot_keys.at(0).micro_id_ == snapshot_.warm_up_keys_.at(3).micro_id_);
+  ASSERT_EQ(5, snapshot_.warm_up_keys_.at(3).heat_);
+  ASSERT_FALSE(snapshot_.warm_up_keys_.at(3).is_index_);
+
+  // an empty snapshot overwrites the old one
+  snapshot_.warm_up_keys_.reset();
+  hot_keys.reset();
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(hot_keys));
+  ASSERT_EQ(OB_SUCCESS, snapshot_.load_file());
+  ASSERT_EQ(0, snapshot_.warm_up_keys_.count());
+}
+
+TEST_F(TestBlockCacheSnapshot, shrink_hot_keys)
+{
+  ObArray<ObMicroBlockCacheHotKey> hot_keys;
+  const int64_t max_key_cnt = ObBlockCacheSnapshot::MAX_HOT_KEY_CNT;
+  const int64_t key_cnt = max_key_cnt + 100;
+  for (int64_t i = 0; i < key_cnt; ++i) {
+    ASSERT_EQ(OB_SUCCESS, hot_keys.push_back(make_key(1001, i + 1, 4096, i, false)));
+  }
+  ASSERT_EQ(OB_SUCCESS, snapshot_.shrink_hot_keys(hot_keys));
+  ASSERT_EQ(max_key_cnt, hot_keys.count());
+  for (int64_t i = 0; i < hot_keys.count(); ++i) {
+    ASSERT_GE(hot_keys.at(i).heat_, 100);
+  }
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(hot_keys));
+  ASSERT_EQ(OB_SUCCESS, snapshot_.load_file());
+  ASSERT_EQ(max_key_cnt, snapshot_.warm_up_keys_.count());
+}
+
+TEST_F(TestBlockCacheSnapshot, read_v1_snapshot)
+{
+  HotKeyV1 keys[2];
+  keys[0].tenant_id_ = 1001;
+  keys[0].macro_id_ = MacroBlockId(0, 11, 0);
+  keys[0].offset_ = 4096;
+  keys[0].size_ = 2048;
+  keys[0].heat_ = 3;
+  keys[0].is_index_ = false;
+  keys[1] = keys[0];
+  keys[1].is_index_ = true;
+  ASSERT_EQ(OB_SUCCESS, write_raw(ObBlockCacheSnapshot::SNAPSHOT_MAGIC, 1, keys, 2));
+  ASSERT_EQ(OB_SUCCESS, snapshot_.load_file());
+  ASSERT_EQ(2, snapshot_.warm_up_keys_.count());
+  const ObMicroBlockCacheHotKey &key = snapshot_.warm_up_keys_.at(1);
+  ASSERT_EQ(1001UL, key.tenant_id_);
+  ASSERT_TRUE(keys[0].macro_id_ == key.micro_id_.macro_id_);
+  ASSERT_EQ(4096, key.micro_id_.offset_);
+  ASSERT_EQ(2048, key.micro_id_.size_);
+  ASSERT_EQ(3, key.heat_);
+  ASSERT_FALSE(key.is_index_);
+  ASSERT_TRUE(snapshot_.warm_up_keys_.at(0).is_index_);
+
+  // the current writer still produces the v1 layout
+  ObArray<ObMicroBlockCacheHotKey> hot_keys;
+  ASSERT_EQ(OB_SUCCESS, hot_keys.push_back(key));
+  ASSERT_EQ(OB_SUCCESS, snapshot_.write_file(hot_keys));
+  char written[sizeof(buf_)];
+  FILE *fp = fopen(snapshot_.file_path_, "r");
+  ASSERT_TRUE(NULL != fp);
+  const int64_t written_size = fread(written, 1, sizeof(written), fp);
+  fclose(fp);
+  ASSERT_EQ(OB_SUCCESS, write_raw(ObBlockCacheSnapshot::SNAPSHOT_MAGIC, 1, keys, 1));
+  ASSERT_EQ(written_size, HEADER_SIZE + keys[0].get_serialize_size());
+  ASSERT_EQ(0, MEMCMP(written, buf_, written_size));
+}
+
+TEST_F(TestBlockCacheSnapshot, read_appended_key)
+{
+  HotKeyAppended key;
+  key.key_.tenant_id_ = 1001;
+  key.key_.macro_id_ = MacroBlockId(0, 11, 0);
+  key.key_.offset_ = 4096;
+  key.key_.size_ = 2048;
+  key.key_.heat_ = 3;
+  key.key_.is_index_ = true;
+  key.extra_ = 12345;
+  ASSERT_EQ(OB_SUCCESS, write_raw(ObBlockCacheSnapshot::SNAPSHOT_MAGIC, 1, &key, 1));
+  ASSERT_EQ(OB_SUCCESS, snapshot_.load_file());
+  ASSERT_EQ(1, snapshot_.warm_up_keys_.count());
+  ASSERT_EQ(1001UL, snapshot_.warm_up_keys_.at(0).tenant_id_);
+  ASSERT_EQ(3, snapshot_.warm_up_keys_.at(0).heat_);
+  ASSERT_TRUE(snapshot_.warm_up_keys_.at(0).is_index_);
+}
+
+TEST_F(TestBlockCacheSnapshot, invalid_snapshot)
+{
+  HotKeyV1 key;
+  key.tenant_id_ = 1001;
+  key.macro_id_ = MacroBlockId(0, 11, 0);
+  key.offset_ = 4096;
+  key.size_ = 2048;
+  key.heat_ = 3;
+  key.is_index_ = false;
+
+  // written by a newer observer
+  ASSERT_EQ(OB_SUCCESS, write_raw(ObBlockCacheSnapshot::SNAPSHOT_MAGIC,
+                                  ObBlockCacheSnapshot::SNAPSHOT_VERSION + 1, &key, 1));
+  ASSERT_EQ(OB_INVALID_DATA, snapshot_.load_file());
+  ASSERT_EQ(OB_SUCCESS, write_raw(ObBlockCacheSnapshot::SNAPSHOT_MAGIC, 0, &key, 1));
+  ASSERT_EQ(OB_INVALID_DATA, snapshot_.load_file());
+  ASSERT_EQ(OB_SUCCESS, write_raw(static_cast<int64_t>(0x1234), 1, &key, 1));
+  ASSERT_EQ(OB_INVALID_DATA, snapshot_.load_file());
+
+  // corrupted body
+  ASSERT_EQ(OB_SUCCESS, write_raw(ObBlockCacheSnapshot::SNAPSHOT_MAGIC, 1, &key, 1));
+  const int64_t size = HEADER_SIZE + key.get_serialize_size();
+  buf_[size - 1] ^= 0x1;
+  ASSERT_EQ(OB_SUCCESS, write_buf(buf_, size));
+  ASSERT_EQ(OB_CHECKSUM_ERROR, snapshot_.load_file());
+
+  // truncated file
+  buf_[size - 1] ^= 0x1;
+  ASSERT_EQ(OB_SUCCESS, write_buf(buf_, size - 1));
+  ASSERT_EQ(OB_INVALID_DATA, snapshot_.load_file());
+  ASSERT_EQ(OB_SUCCESS, write_buf(buf_, HEADER_SIZE - 1));
+  ASSERT_EQ(OB_INVALID_DATA, snapshot_.load_file());
+  ASSERT_EQ(0, snapshot_.warm_up_keys_.count());
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_block_cache_snapshot.log*");
+  OB_LOGGER.set_file_name("test_block_cache_snapshot.log", true, true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
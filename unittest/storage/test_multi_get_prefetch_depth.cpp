@@ -0,0 +1,172 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#define protected public
+#include "storage/access/ob_index_tree_prefetcher.h"
+#undef private
+#undef protected
+#include "lib/random/ob_random.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace storage;
+namespace unittest
+{
+
+static const int32_t MIN_DEPTH = ObIndexTreeMultiPrefetcher::MAX_MULTIGET_MICRO_DATA_HANDLE_CNT;
+static const int32_t MAX_DEPTH = ObIndexTreeMultiPrefetcher::MAX_SORTED_MULTIGET_MICRO_DATA_HANDLE_CNT;
+
+class TestMultiGetPrefetchDepth : public ::testing::Test
+{
+public:
+  TestMultiGetPrefetchDepth() : allocator_(ObModIds::TEST) {}
+  virtual void SetUp()
+  {
+    prefetcher_.iter_param_ = &iter_param_;
+    prefetcher_.long_life_allocator_ = &allocator_;
+    prefetcher_.ext_read_handles_.set_allocator(&allocator_);
+  }
+  void init(const bool is_sorted, const int64_t rowkey_cnt)
+  {
+    prefetcher_.is_rowkey_sorted_ = is_sorted;
+    ASSERT_EQ(OB_SUCCESS, prefetcher_.init_prefetch_handles(rowkey_cnt));
+  }
+  void miss()
+  {
+    prefetcher_.update_prefetch_depth(ObSSTableMicroBlockState::IN_BLOCK_IO, false);
+  }
+  void hit()
+  {
+    prefetcher_.update_prefetch_depth(ObSSTableMicroBlockState::IN_BLOCK_CACHE, true);
+  }
+  int32_t depth() const { return prefetcher_.prefetch_depth_; }
+protected:
+  ObArenaAllocator allocator_;
+  ObTableIterParam iter_param_;
+  ObIndexTreeMultiPrefetcher prefetcher_;
+};
+
+TEST_F(TestMultiGetPrefetchDepth, init_depth)
+{
+  // sorted rowkeys get the deep window and start at the default depth
+  init(true, 1000);
+  ASSERT_EQ(MAX_DEPTH, prefetcher_.max_handle_prefetching_cnt_);
+  ASSERT_EQ(MIN_DEPTH, depth());
+  // the window never exceeds the rowkey count
+  init(true, 10);
+  ASSERT_EQ(10, prefetcher_.max_handle_prefetching_cnt_);
+  ASSERT_EQ(10, depth());
+  // unsorted rowkeys keep the fixed window
+  init(false, 1000);
+  ASSERT_EQ(MIN_DEPTH, prefetcher_.max_handle_prefetching_cnt_);
+  ASSERT_EQ(MIN_DEPTH, depth());
+}
+
+TEST_F(TestMultiGetPrefetchDepth, grow_and_shrink)
+{
+  init(true, 1000);
+  // doubles on every pending block io, bounded by the window
+  miss();
+  ASSERT_EQ(2 * MIN_DEPTH, depth());
+  miss();
+  ASSERT_EQ(4 * MIN_DEPTH, depth());
+  for (int64_t i = 0; i < 10; i++) {
+    miss();
+  }
+  ASSERT_EQ(MAX_DEPTH, depth());
+  // shrinks by one on every cache hit, bounded by the default depth
+  hit();
+  ASSERT_EQ(MAX_DEPTH - 1, depth());
+  for (int64_t i = 0; i < MAX_DEPTH; i++) {
+    hit();
+  }
+  ASSERT_EQ(MIN_DEPTH, depth());
+  // finished io and the other states keep the depth
+  miss();
+  ASSERT_EQ(2 * MIN_DEPTH, depth());
+  prefetcher_.update_prefetch_depth(ObSSTableMicroBlockState::IN_BLOCK_IO, true);
+  prefetcher_.update_prefetch_depth(ObSSTableMicroBlockState::NEED_SYNC_IO, false);
+  prefetcher_.update_prefetch_depth(ObSSTableMicroBlockState::UNKNOWN_STATE, false);
+  ASSERT_EQ(2 * MIN_DEPTH, depth());
+  // a new batch of rowkeys starts from the default depth again
+  init(true, 1000);
+  ASSERT_EQ(MIN_DEPTH, depth());
+}
+
+TEST_F(TestMultiGetPrefetchDepth, random_sequence)
+{
+  const int64_t rowkey_cnts[] = {1, 20, MIN_DEPTH, 100, MAX_DEPTH, 1000};
+  for (int64_t i = 0; i < ARRAYSIZEOF(rowkey_cnts); i++) {
+    init(true, rowkey_cnts[i]);
+    const int32_t max_depth = prefetcher_.max_handle_prefetching_cnt_;
+    const int32_t min_depth = MIN(MIN_DEPTH, max_depth);
+    for (int64_t j = 0; j < 10000; j++) {
+      if (0 == ObRandom::rand(0, 2)) {
+        miss();
+      } else {
+        hit();
+      }
+      ASSERT_LE(min_depth, depth());
+      ASSERT_GE(max_depth, depth());
+    }
+  }
+}
+
+TEST_F(TestMultiGetPrefetchDepth, adjust_by_read_handle)
+{
+  init(true, 1000);
+  ObMicroBlockDataHandle micro_handle;
+  micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_CACHE;
+  ObIndexTreeMultiPrefetcher::ObSSTableReadHandleExt &read_handle = prefetcher_.ext_read_handles_[0];
+  read_handle.row_state_ = ObSSTableRowState::IN_BLOCK;
+  read_handle.micro_handle_ = &micro_handle;
+  prefetcher_.prefetch_depth_ = 2 * MIN_DEPTH;
+  prefetcher_.fetch_rowkey_idx_ = 0;
+  prefetcher_.prefetch_rowkey_idx_ = 1;
+  // the rowkey to fetch is not prefetched to the end yet
+  read_handle.cur_prefetch_end_ = false;
+  prefetcher_.adjust_prefetch_depth();
+  ASSERT_EQ(2 * MIN_DEPTH, depth());
+  read_handle.cur_prefetch_end_ = true;
+  prefetcher_.adjust_prefetch_depth();
+  ASSERT_EQ(2 * MIN_DEPTH - 1, depth());
+  // every rowkey is checked only once
+  prefetcher_.adjust_prefetch_depth();
+  ASSERT_EQ(2 * MIN_DEPTH - 1, depth());
+  // an empty io handle is a finished io
+  prefetcher_.depth_checked_rowkey_idx_ = -1;
+  micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_IO;
+  prefetcher_.adjust_prefetch_depth();
+  ASSERT_EQ(2 * MIN_DEPTH - 1, depth());
+  // not adjusted for unsorted rowkeys
+  prefetcher_.depth_checked_rowkey_idx_ = -1;
+  prefetcher_.is_rowkey_sorted_ = false;
+  micro_handle.block_state_ = ObSSTableMicroBlockState::IN_BLOCK_CACHE;
+  prefetcher_.adjust_prefetch_depth();
+  ASSERT_EQ(2 * MIN_DEPTH - 1, depth());
+  read_handle.micro_handle_ = nullptr;
+}
+
+} // end namespace unittest
+} // end namespace oceanbase
+
+int main(int argc, char **argv)
+{
+  system("rm -f test_multi_get_prefetch_depth.log*");
+  OB_LOGGER.set_file_name("test_multi_get_prefetch_depth.log", true);
+  OB_LOGGER.set_log_level("INFO");
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2021 OceanBase
+ * OceanBase CE is licensed under Mulan PubL v2.
+ * You can use this software according to the terms and conditions of the Mulan PubL v2.
+ * You may obtain a copy of Mulan PubL v2 at:
+ *          http://license.coscl.org.cn/MulanPubL-2.0
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND,
+ * EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT,
+ * MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+ * See the Mulan PubL v2 for more details.
+ */
+
+#include <gtest/gtest.h>
+#define private public
+#include "storage/tx/ob_gts_local_cache.h"
+#undef private
+#include "lib/oblog/ob_log.h"
+
+namespace oceanbase
+{
+using namespace common;
+using namespace transaction;
+namespace unittest
+{
+
+class TestObGTSLocalCache : public ::testing::Test
+{
+public :
+  virtual void SetUp() {}
+  virtual void TearDown() {}
+};
+
+TEST_F(TestObGTSLocalCache, request_rate)
+{
+  ObGTSRequestStat stat;
+  const int64_t start_ts = 1000 * 1000;
+  stat.refresh_request_rate(start_ts);
+  for (int64_t i = 0; i < 1000; i++) {
+    stat.inc_request_cnt();
+  }
+  // 1000 requests in 100ms
+  stat.refresh_request_rate(start_ts + 100 * 1000);
+  EXPECT_EQ(10000, stat.get_request_rate());
+  // no request in the next 100ms, the rate decays by half
+  stat.refresh_request_rate(start_ts + 200 * 1000);
+  EXPECT_EQ(5000, stat.get_request_rate());
+  // no rtt sample yet
+  EXPECT_FALSE(stat.is_hot());
+  stat.update_rtt(1000);
+  EXPECT_EQ(1000, stat.get_rtt());
+  EXPECT_TRUE(stat.is_hot());
+  EXPECT_EQ(2000, stat.get_rpc_lease());
+  stat.update_rtt(100 * 1000);
+  EXPECT_EQ(ObGTSRequestStat::MAX_RPC_LEASE_US, stat.get_rpc_lease());
+}
+
+TEST_F(TestObGTSLocalCache, coalesce_rpc)
+{
+  ObGTSLocalCache cache;
+  bool update = false;
+  const int64_t start_ts = 1000 * 1000;
+  // the first rpc takes 1ms
+  EXPECT_EQ(OB_SUCCESS, cache.update_latest_srr(MonotonicTs(start_ts)));
+  EXPECT_EQ(OB_SUCCESS, cache.update_gts(MonotonicTs(start_ts), 100, MonotonicTs(start_ts + 1000), update));
+  EXPECT_TRUE(update);
+  EXPECT_TRUE(cache.no_rpc_on_road());
+  // not hot, every waiter sends its own rpc
+  EXPECT_EQ(OB_SUCCESS, cache.update_latest_srr(MonotonicTs(start_ts + 2000)));
+  EXPECT_FALSE(cache.need_coalesce_rpc(MonotonicTs(start_ts + 1900), MonotonicTs(start_ts + 2100)));
+  EXPECT_FALSE(cache.need_prefetch());
+
+  cache.refresh_request_rate(start_ts);
+  for (int64_t i = 0; i < 1000; i++) {
+    cache.inc_request_cnt();
+  }
+  cache.refresh_request_rate(start_ts + 100 * 1000);
+  // hot, share the rpc on the road within the lease
+  EXPECT_TRUE(cache.need_coalesce_rpc(MonotonicTs(start_ts + 1900), MonotonicTs(start_ts + 2100)));
+  EXPECT_TRUE(cache.need_coalesce_rpc(MonotonicTs(start_ts + 2000), MonotonicTs(start_ts + 2100)));
+  EXPECT_FALSE(cache.need_coalesce_rpc(MonotonicTs(start_ts + 1900),
+      MonotonicTs(start_ts + 2000 + cache.get_request_stat().get_rpc_lease())));
+  EXPECT_FALSE(cache.need_prefetch());
+  // the response arrives, nothing on the road
+  EXPECT_EQ(OB_SUCCESS, cache.update_gts(MonotonicTs(start_ts + 2000), 200, MonotonicTs(start_ts + 3000), update));
+  EXPECT_FALSE(cache.need_coalesce_rpc(MonotonicTs(start_ts + 1900), MonotonicTs(start_ts + 3100)));
+  EXPECT_TRUE(cache.need_prefetch());
+}
+
+TEST_F(TestObGTSLocalCache, coalesce_late_arrival)
+{
+  ObGTSLocalCache cache;
+  bool update = false;
+  int64_t gts = 0;
+  MonotonicTs receive_gts_ts;
+  bool need_send_rpc = false;
+  const int64_t start_ts = 1000 * 1000;
+  EXPECT_EQ(OB_SUCCESS, cache.update_latest_srr(MonotonicTs(start_ts)));
+  EXPECT_EQ(OB_SUCCESS, cache.update_gts(MonotonicTs(start_ts), 100, MonotonicTs(start_ts + 1000), update));
+  cache.refresh_request_rate(start_ts);
+  for (int64_t i = 0; i < 1000; i++) {
+    cache.inc_request_cnt();
+  }
+  cache.refresh_request_rate(start_ts + 100 * 1000);
+  ASSERT_TRUE(cache.get_request_stat().is_hot());
+
+  // an rpc is sent at start_ts + 2000
+  const MonotonicTs srr(start_ts + 2000);
+  EXPECT_EQ(OB_SUCCESS, cache.update_latest_srr(srr));
+  // a waiter arriving before it shares the rpc
+  EXPECT_EQ(OB_EAGAIN, cache.get_gts(MonotonicTs(start_ts + 1500), gts, receive_gts_ts, need_send_rpc));
+  EXPECT_FALSE(need_send_rpc);
+  EXPECT_TRUE(cache.need_coalesce_rpc(MonotonicTs(start_ts + 1500), MonotonicTs(start_ts + 2100)));
+  // a waiter arriving after it can not use its gts and sends the next rpc at once
+  const MonotonicTs late_stc(start_ts + 2050);
+  EXPECT_EQ(OB_EAGAIN, cache.get_gts(late_stc, gts, receive_gts_ts, need_send_rpc));
+  EXPECT_TRUE(need_send_rpc);
+  EXPECT_FALSE(cache.need_coalesce_rpc(late_stc, MonotonicTs(start_ts + 2100)));
+  // the waiters arriving between the two rpcs share the second one
+  const MonotonicTs next_srr(start_ts + 2100);
+  EXPECT_EQ(OB_SUCCESS, cache.update_latest_srr(next_srr));
+  EXPECT_EQ(OB_EAGAIN, cache.get_gts(MonotonicTs(start_ts + 2080), gts, receive_gts_ts, need_send_rpc));
+  EXPECT_FALSE(need_send_rpc);
+  EXPECT_TRUE(cache.need_coalesce_rpc(late_stc, MonotonicTs(start_ts + 2200)));
+  // the response of the first rpc only serves the waiters arriving before it was sent
+  EXPECT_EQ(OB_SUCCESS, cache.update_gts(srr, 200, MonotonicTs(start_ts + 3000), update));
+  EXPECT_EQ(OB_SUCCESS, cache.get_gts(MonotonicTs(start_ts + 1500), gts, receive_gts_ts, need_send_rpc));
+  EXPECT_EQ(200, gts);
+  EXPECT_EQ(OB_EAGAIN, cache.get_gts(late_stc, gts, receive_gts_ts, need_send_rpc));
+  EXPECT_FALSE(need_send_rpc);
+  // the second one serves the late waiter
+  EXPECT_EQ(OB_SUCCESS, cache.update_gts(next_srr, 300, MonotonicTs(start_ts + 3100), update));
+  EXPECT_EQ(OB_SUCCESS, cache.get_gts(late_stc, gts, receive_gts_ts, need_send_rpc));
+  EXPECT_EQ(300, gts);
+}
+
+}//end of unittest
+}//end of oceanbase
+
+using namespace oceanbase;
+using namespace oceanbase::common;
+
+int main(int argc, char **argv)
+{
+  int ret = 1;
+  ObLogger &logger = ObLogger::get_logger();
+  logger.set_file_name("test_ob_gts_local_cache.log", true);
+  logger.set_log_level(OB_LOG_LEVEL_INFO);
+  testing::InitGoogleTest(&argc, argv);
+  ret = RUN_ALL_TESTS();
+  return ret;
+}